@@ -0,0 +1,166 @@
+/**
+ * Allocation Tracker
+ * Replaces the global operator new/delete family with malloc-backed versions
+ * that count per thread. Compiled to no-op queries unless the build enables
+ * TOBII_BRIDGE_ALLOC_TRACKING (debug/bench mode)
+ */
+
+#include "alloc-tracker.hpp"
+
+#ifdef TOBII_BRIDGE_ALLOC_TRACKING
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace {
+
+/**
+ * Counters are written only by their owning thread (relaxed), read by stats
+ */
+struct ThreadCounter {
+    std::atomic<const char*> name{nullptr};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> bytes{0};
+};
+
+// Fixed tables: registering a thread must never allocate
+ThreadCounter counters[AllocTracker::MAX_THREADS];
+ThreadCounter overflowCounter;
+std::atomic<size_t> registeredThreads{0};
+thread_local ThreadCounter* currentCounter = nullptr;
+
+ThreadCounter* counterForThread() {
+    if (!currentCounter) {
+        const size_t slot = registeredThreads.fetch_add(1, std::memory_order_relaxed);
+        currentCounter = slot < AllocTracker::MAX_THREADS ? &counters[slot] : &overflowCounter;
+    }
+    return currentCounter;
+}
+
+void* trackedAlloc(std::size_t size) {
+    ThreadCounter* counter = counterForThread();
+    counter->allocations.fetch_add(1, std::memory_order_relaxed);
+    counter->bytes.fetch_add(size, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* trackedAlignedAlloc(std::size_t size, std::align_val_t alignment) {
+    ThreadCounter* counter = counterForThread();
+    counter->allocations.fetch_add(1, std::memory_order_relaxed);
+    counter->bytes.fetch_add(size, std::memory_order_relaxed);
+
+    const std::size_t align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    return _aligned_malloc(size ? size : 1, align);
+#else
+    void* ptr = nullptr;
+    return posix_memalign(&ptr, align < sizeof(void*) ? sizeof(void*) : align, size ? size : 1) == 0 ? ptr : nullptr;
+#endif
+}
+
+void trackedFree(void* ptr) {
+    if (!ptr) return;
+    counterForThread()->frees.fetch_add(1, std::memory_order_relaxed);
+    std::free(ptr);
+}
+
+void trackedAlignedFree(void* ptr) {
+    if (!ptr) return;
+    counterForThread()->frees.fetch_add(1, std::memory_order_relaxed);
+#ifdef _WIN32
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+}
+
+} // namespace
+
+namespace AllocTracker {
+
+bool enabled() {
+    return true;
+}
+
+void nameThread(const char* name) {
+    counterForThread()->name.store(name, std::memory_order_relaxed);
+}
+
+uint64_t threadAllocations() {
+    return counterForThread()->allocations.load(std::memory_order_relaxed);
+}
+
+size_t snapshot(ThreadStats* out, size_t maxThreads) {
+    const size_t registered = registeredThreads.load(std::memory_order_relaxed);
+    const size_t count = registered < MAX_THREADS ? registered : MAX_THREADS;
+
+    size_t written = 0;
+    for (size_t i = 0; i < count && written < maxThreads; ++i, ++written) {
+        const char* name = counters[i].name.load(std::memory_order_relaxed);
+        out[written].name = name ? name : "unnamed";
+        out[written].allocations = counters[i].allocations.load(std::memory_order_relaxed);
+        out[written].frees = counters[i].frees.load(std::memory_order_relaxed);
+        out[written].bytes = counters[i].bytes.load(std::memory_order_relaxed);
+    }
+    return written;
+}
+
+} // namespace AllocTracker
+
+// Replaced global allocation functions
+void* operator new(std::size_t size) {
+    void* ptr = trackedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    void* ptr = trackedAlloc(size);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return trackedAlloc(size); }
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    void* ptr = trackedAlignedAlloc(size, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    void* ptr = trackedAlignedAlloc(size, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { trackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { trackedAlignedFree(ptr); }
+
+#else
+
+namespace AllocTracker {
+
+bool enabled() { return false; }
+void nameThread(const char*) {}
+uint64_t threadAllocations() { return 0; }
+size_t snapshot(ThreadStats*, size_t) { return 0; }
+
+} // namespace AllocTracker
+
+#endif
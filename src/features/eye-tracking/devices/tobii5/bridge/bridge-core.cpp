@@ -0,0 +1,231 @@
+/**
+ * Bridge Core
+ * Source acquisition under the watchdog, per-sample processing and
+ * publishing into the ring and history; see include/bridge-core.hpp
+ */
+
+#include "bridge-core.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+#include "frame-writer.hpp"
+#include "sample-encoder.hpp"
+#include "synthetic-source.hpp"
+#ifdef TOBII_BRIDGE_HAS_TGI
+#include "tgi-source.hpp"
+#endif
+
+std::unique_ptr<TrackerSource> makeTrackerSource(const std::string& name, const std::string& faultSpec,
+                                                 BridgeClock& clock, FaultInjectingSource** faulty) {
+    FaultSettings faults;
+    try {
+        if (!faultSpec.empty()) faults = FaultSettings::parse(faultSpec);
+    } catch (const std::invalid_argument& e) {
+        throw std::invalid_argument(std::string("Invalid faults: ") + e.what());
+    }
+
+    std::unique_ptr<TrackerSource> source;
+    if (name == "synthetic") {
+        source = std::make_unique<SyntheticSource>(clock);
+    } else if (name == "synthetic-pursuit") {
+        source = std::make_unique<SyntheticSource>(clock, 5489u, SyntheticMotion::Pursuit);
+    }
+#ifdef TOBII_BRIDGE_HAS_TGI
+    else if (name == "tgi") {
+        source = std::make_unique<TgiSource>();
+    }
+#endif
+    else {
+        throw std::invalid_argument("Unknown or unavailable tracker source: " + name);
+    }
+
+    // Misbehaving-hardware simulation on top of whichever source was chosen
+    if (!faultSpec.empty()) {
+        auto wrapped = std::make_unique<FaultInjectingSource>(std::move(source), faults, clock);
+        if (faulty) *faulty = wrapped.get();
+        source = std::move(wrapped);
+    }
+    return source;
+}
+
+static bool finiteHead(const HeadReading& head) {
+    return std::isfinite(head.yaw) && std::isfinite(head.pitch) && std::isfinite(head.roll) &&
+           std::isfinite(head.posX) && std::isfinite(head.posY) && std::isfinite(head.posZ);
+}
+
+BridgeCore::BridgeCore(std::unique_ptr<TrackerSource> trackerSource, BridgeClock& bridgeClock)
+    : source(std::move(trackerSource)), clock(bridgeClock), gazeSmoothing(0.0f), sourceConnected(false),
+      latestSampleMicros(0), processed(0), writing(0), publishedEnd(0) {
+    memset(&latestData, 0, sizeof(latestData));
+    configure(BridgeConfig());
+}
+
+void BridgeCore::configure(const BridgeConfig& config) {
+    gazeSmoothing = config.gazeSmoothing;
+
+    WatchdogSettings watchdog;
+    watchdog.staleMicros = static_cast<uint64_t>(config.watchdogStaleMs) * 1000;
+    watchdog.stallMicros = static_cast<uint64_t>(config.watchdogStallMs) * 1000;
+    watchdog.retryMicros = static_cast<uint64_t>(config.watchdogRetryMs) * 1000;
+    watchdog.maxRetryMicros = static_cast<uint64_t>(config.watchdogMaxRetryMs) * 1000;
+    sourceWatchdog.configure(watchdog);
+
+    prediction.trackerLatencyMs = config.predictionTrackerLatencyMs;
+    prediction.maxHorizonMs = config.predictionMaxHorizonMs;
+    prediction.saccadeVelocity = config.predictionSaccadeVelocity;
+    prediction.settleMs = static_cast<uint64_t>(config.predictionSettleMs);
+
+    // The source's gaze space never changes, so it is folded in here too
+    Pose::PoseSettings pose;
+    pose.screenWidthMm = config.poseScreenWidthMm;
+    pose.screenHeightMm = config.poseScreenHeightMm;
+    pose.eyeDistanceMm = config.poseEyeDistanceMm;
+    std::copy_n(config.poseWorldOriginMm.begin(), 3, pose.worldOriginMm.begin());
+    std::copy_n(config.poseWorldRotationDeg.begin(), 3, pose.worldRotationDeg.begin());
+    pose.worldScale = config.poseWorldScale;
+    poseKernel.configure(pose, gazeSpace());
+}
+
+bool BridgeCore::initialize() {
+    if (!source || !source->initialize()) return false;
+    sourceConnected = true;
+    sourceWatchdog.started(clock.monotonicMicros());
+    return true;
+}
+
+const char* BridgeCore::pollSource(std::string& error) {
+    const uint64_t start = clock.monotonicMicros();
+    try {
+        source->update();
+    } catch (const std::exception& e) {
+        error = e.what();
+        return "exception";
+    }
+    return sourceWatchdog.stalled(clock.monotonicMicros() - start) ? "stalled" : nullptr;
+}
+
+bool BridgeCore::reinitialize(std::string& error) {
+    try {
+        return source->initialize();
+    } catch (const std::exception& e) {
+        error = e.what();
+        return false;
+    }
+}
+
+bool BridgeCore::process() {
+    if (!source) return false;
+    bool fresh = false;
+
+    latestData.timestamp = sampleClockMicros() / 1000;
+    latestSampleMicros = clock.monotonicMicros();
+
+    // Non-finite readings count as missing so they never reach the smoother
+    GazeReading gaze;
+    const bool hasGaze = source->getLatestGaze(gaze) && std::isfinite(gaze.x) && std::isfinite(gaze.y);
+    gazeSmoother.setSmoothing(gazeSmoothing);
+    gazeSmoother.apply(hasGaze, gaze.x, gaze.y);
+    if (hasGaze) {
+        fresh = !latestData.hasGaze || gaze.timestamp != latestData.gazeTimestamp;
+        latestData.hasGaze = true;
+        latestData.gazeX = gaze.x;
+        latestData.gazeY = gaze.y;
+        latestData.gazeTimestamp = gaze.timestamp;
+        latestData.gazeConfidence = 0.9f; // TGI doesn't provide confidence
+    } else {
+        latestData.hasGaze = false;
+    }
+
+    HeadReading head;
+    if (source->getLatestHead(head) && finiteHead(head)) {
+        fresh = fresh || !latestData.hasHead || head.yaw != latestData.headYaw || head.pitch != latestData.headPitch ||
+                head.roll != latestData.headRoll || head.posX != latestData.headPosX ||
+                head.posY != latestData.headPosY || head.posZ != latestData.headPosZ;
+        latestData.hasHead = true;
+        latestData.headYaw = head.yaw;
+        latestData.headPitch = head.pitch;
+        latestData.headRoll = head.roll;
+        latestData.headPosX = head.posX;
+        latestData.headPosY = head.posY;
+        latestData.headPosZ = head.posZ;
+        latestData.headConfidence = 0.9f; // TGI doesn't provide confidence
+    } else {
+        latestData.hasHead = false;
+    }
+
+    // With nobody in front of the tracker unchanged readings are expected
+    latestData.present = source->isPresent();
+    fresh = fresh || !latestData.present;
+
+    float qualitySum = 0;
+    int qualityCount = 0;
+    if (latestData.hasGaze) {
+        qualitySum += latestData.gazeConfidence;
+        qualityCount++;
+    }
+    if (latestData.hasHead) {
+        qualitySum += latestData.headConfidence;
+        qualityCount++;
+    }
+    if (latestData.present) {
+        qualitySum += 0.9f;
+        qualityCount++;
+    }
+    latestData.overallQuality = qualityCount > 0 ? qualitySum / qualityCount : 0;
+
+    // 3D pose from the published (smoothed) gaze and head, once per sample
+    poseKernel.apply(latestData);
+
+    // The predictor follows the published (smoothed) sample
+    gazePredictor.configure(prediction, source->gazeSpace());
+    gazePredictor.observe(latestData, latestSampleMicros);
+
+    processed.fetch_add(1, std::memory_order_relaxed);
+    return fresh;
+}
+
+void BridgeCore::markLost(const char* reason) {
+    sourceConnected = false;
+    sourceWatchdog.markLost(clock.monotonicMicros(), sampleClockMicros() / 1000, reason);
+    // A snapshot during the outage shows no tracking, not the last sample
+    latestData.hasGaze = latestData.hasHead = latestData.present = false;
+}
+
+const TrackerOutage& BridgeCore::restored() {
+    const TrackerOutage& outage = sourceWatchdog.restored(clock.monotonicMicros(), sampleClockMicros() / 1000);
+    sourceConnected = true;
+    return outage;
+}
+
+uint64_t BridgeCore::publish() {
+    const uint64_t sequence = sampleRing.end();
+    writing.store(sequence, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    sampleRing.publish(latestData);
+    publishedEnd.store(sequence + 1, std::memory_order_release);
+
+    std::lock_guard<std::mutex> lock(historyMutex);
+    history.add(latestData);
+    return sequence;
+}
+
+uint64_t BridgeCore::historyFirst() const {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    return history.empty() ? 0 : history.first();
+}
+
+uint64_t BridgeCore::historyNewest() const {
+    std::lock_guard<std::mutex> lock(historyMutex);
+    return history.newest();
+}
+
+size_t BridgeCore::encode(const TobiiDataPacket& sample, SampleFormat format, uint32_t streams,
+                          char* out, size_t capacity) {
+    FrameWriter writer(out, capacity);
+    sampleEncoder(format, streams)(writer, sample);
+    return writer.overflowed() ? 0 : writer.size();
+}
@@ -72,7 +72,7 @@ if errorlevel 1 (
 
 REM Build
 echo Building Tobii Bridge Server...
-cmake --build . --config Release --target tobii_bridge
+cmake --build . --config Release --target tobii_bridge tobiibridge_core
 if errorlevel 1 (
     echo ERROR: Build failed
     pause
@@ -84,6 +84,12 @@ echo Creating deployment package...
 mkdir ..\deployment 2>nul
 copy Release\tobii_bridge.exe ..\deployment\ 2>nul
 
+REM Embeddable core for in-process consumers (C API)
+mkdir ..\deployment\sdk 2>nul
+copy Release\tobiibridge_core.dll ..\deployment\sdk\ 2>nul
+copy Release\tobiibridge_core.lib ..\deployment\sdk\ 2>nul
+copy ..\include\tobiibridge.h ..\deployment\sdk\ 2>nul
+
 REM Copy Tobii DLLs if they exist
 if exist "C:\Program Files\Tobii\Tobii Game Integration\TobiiGameIntegration.dll" (
     copy "C:\Program Files\Tobii\Tobii Game Integration\TobiiGameIntegration.dll" ..\deployment\
@@ -96,7 +102,23 @@ echo { > ..\deployment\config.json
 echo   "websocket_port": 8080, >> ..\deployment\config.json
 echo   "udp_port": 4242, >> ..\deployment\config.json
 echo   "discovery_port": 8083, >> ..\deployment\config.json
-echo   "log_level": "info" >> ..\deployment\config.json
+echo   "loop_interval_ms": 16, >> ..\deployment\config.json
+echo   "io_threads": 0, >> ..\deployment\config.json
+echo   "buffers": { "ws_max_send_bytes": 262144, "udp_send_bytes": 0 }, >> ..\deployment\config.json
+echo   "backpressure": { "policy": "drop" }, >> ..\deployment\config.json
+echo   "filters": { "gaze_smoothing": 0.0 }, >> ..\deployment\config.json
+echo   "log_level": "info", >> ..\deployment\config.json
+echo   "recording": { "directory": "recordings" }, >> ..\deployment\config.json
+echo   "quality": { "window_s": 10, "alerts": { "min_rate_hz": 0, "min_gaze_ratio": 0, "max_gap_ms": 0 } }, >> ..\deployment\config.json
+echo   "adaptive_rate": { "max_decimation": 8, "target_queue_bytes": 16384, "interval_ms": 500, "rtt_slack_ms": 80, "quantize": true }, >> ..\deployment\config.json
+echo   "admission": { "max_connections": 128, "max_per_address": 16, "connect_rate": { "per_second": 20, "burst": 40 }, "address_connect_rate": { "per_second": 2, "burst": 8 }, "critical": { "addresses": [], "token": "" } }, >> ..\deployment\config.json
+echo   "load_shedding": { "tick_budget_us": 8000, "max_decimation": 8, "escalate_ms": 250, "recover_ms": 5000 }, >> ..\deployment\config.json
+echo   "prediction": { "tracker_latency_ms": 15, "max_horizon_ms": 100, "saccade_velocity": 0.7, "settle_ms": 50 }, >> ..\deployment\config.json
+echo   "watchdog": { "stale_ms": 3000, "stall_ms": 1000, "retry_ms": 500, "max_retry_ms": 30000 }, >> ..\deployment\config.json
+echo   "power": { "idle_after_ms": 5000, "keepalive_ms": 1000 }, >> ..\deployment\config.json
+echo   "udp_stream": { "port": 0, "max_subscribers": 16, "timeout_ms": 5000, "retransmit_window_ms": 250, "max_retransmits_per_s": 300 }, >> ..\deployment\config.json
+echo   "multicast": { "group": "", "port": 4244, "ttl": 1, "format": "binary", "fec": { "group": 8, "parity": 1 } }, >> ..\deployment\config.json
+echo   "pose": { "screen_width_mm": 527, "screen_height_mm": 296, "eye_distance_mm": 600, "world": { "origin_mm": [0, 0, 0], "rotation_deg": [0, 0, 0], "scale": 1 } } >> ..\deployment\config.json
 echo } >> ..\deployment\config.json
 
 REM Create install script
@@ -135,6 +157,7 @@ echo ✅ Build completed successfully!
 echo.
 echo Deployment files created in: deployment\
 echo - tobii_bridge.exe     (Main executable)
+echo - sdk\                (tobiibridge_core.dll and tobiibridge.h, the embeddable core)
 echo - config.json         (Configuration)
 echo - install.bat         (Startup script)
 echo - README.txt          (Documentation)
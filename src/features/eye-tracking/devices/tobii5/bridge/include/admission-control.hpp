@@ -0,0 +1,202 @@
+/**
+ * Admission Control
+ * Decides whether a WebSocket handshake may proceed: caps on open
+ * connections (total and per remote address) and token-bucket limits on
+ * how fast new ones arrive, so a client reconnecting in a loop cannot crowd
+ * out the rest. Clients designated critical (by address or token) bypass
+ * the limits and are never shed
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Shedding order: low-priority clients go first, critical ones never
+ */
+enum class ClientPriority { Low, Normal, Critical };
+
+inline const char* priorityName(ClientPriority priority) {
+    switch (priority) {
+    case ClientPriority::Low: return "low";
+    case ClientPriority::Normal: return "normal";
+    case ClientPriority::Critical: return "critical";
+    }
+    return "normal";
+}
+
+/**
+ * Refills at `rate` tokens/s up to `burst`; a rate of 0 never limits
+ */
+struct TokenBucket {
+    double tokens = -1.0;       // < 0 until first use, then starts full
+    uint64_t lastMicros = 0;
+
+    bool take(uint64_t nowMicros, double rate, double burst) {
+        if (rate <= 0.0) return true;
+        refill(nowMicros, rate, burst);
+        if (tokens < 1.0) return false;
+        tokens -= 1.0;
+        return true;
+    }
+
+    bool full(uint64_t nowMicros, double rate, double burst) {
+        refill(nowMicros, rate, burst);
+        return tokens >= burst;
+    }
+
+private:
+    void refill(uint64_t nowMicros, double rate, double burst) {
+        if (tokens < 0.0) {
+            tokens = burst;
+        } else if (nowMicros > lastMicros) {
+            tokens = std::min(burst, tokens + rate * static_cast<double>(nowMicros - lastMicros) * 1e-6);
+        }
+        lastMicros = nowMicros;
+    }
+};
+
+struct AdmissionSettings {
+    size_t maxConnections = 128;        // 0 = unlimited
+    size_t maxPerAddress = 16;
+    double connectRate = 20.0;          // new connections/s, all addresses
+    double connectBurst = 40.0;
+    double addressConnectRate = 2.0;    // new connections/s, one address
+    double addressConnectBurst = 8.0;
+    std::vector<std::string> criticalAddresses;
+    std::string criticalToken;
+};
+
+enum class AdmissionVerdict { Admit, TooManyConnections, TooManyFromAddress, RateLimited, AddressRateLimited, Shedding };
+
+inline const char* verdictName(AdmissionVerdict verdict) {
+    switch (verdict) {
+    case AdmissionVerdict::Admit: return "admit";
+    case AdmissionVerdict::TooManyConnections: return "max_connections";
+    case AdmissionVerdict::TooManyFromAddress: return "max_per_address";
+    case AdmissionVerdict::RateLimited: return "connect_rate";
+    case AdmissionVerdict::AddressRateLimited: return "address_connect_rate";
+    case AdmissionVerdict::Shedding: return "load_shedding";
+    }
+    return "admit";
+}
+
+/**
+ * Not thread-safe; the bridge calls it under clientsMutex
+ */
+class AdmissionController {
+private:
+    static constexpr size_t MAX_TRACKED_ADDRESSES = 1024;
+
+    struct AddressState {
+        size_t open = 0;
+        size_t pending = 0;     // admitted handshakes not yet opened or failed
+        TokenBucket bucket;
+    };
+
+    AdmissionSettings settings;
+    TokenBucket globalBucket;
+    std::unordered_map<std::string, AddressState> addresses;
+    size_t open;
+    size_t pending;
+    uint64_t rejected;
+
+public:
+    AdmissionController() : open(0), pending(0), rejected(0) {}
+
+    void configure(const AdmissionSettings& next) { settings = next; }
+
+    size_t openConnections() const { return open; }
+    size_t pendingHandshakes() const { return pending; }
+    uint64_t rejectedConnections() const { return rejected; }
+
+    /**
+     * Critical when the address is listed or the request carries the token
+     */
+    bool isCritical(const std::string& address, const std::string& token) const {
+        if (!settings.criticalToken.empty() && token == settings.criticalToken) return true;
+        return std::find(settings.criticalAddresses.begin(), settings.criticalAddresses.end(), address) !=
+               settings.criticalAddresses.end();
+    }
+
+    /**
+     * Check a handshake from address. An admitted one holds a slot against
+     * the connection caps until opened() counts it open or failed() gives
+     * it back, so handshakes in flight together cannot overshoot them.
+     * refuseNormal is set while load shedding has dropped normal clients
+     */
+    AdmissionVerdict admit(const std::string& address, bool critical, bool refuseNormal, uint64_t nowMicros) {
+        AddressState& state = track(address, nowMicros);
+        AdmissionVerdict verdict = AdmissionVerdict::Admit;
+        if (critical) {
+            // Bypasses the limits but still counts toward them
+        } else if (refuseNormal) {
+            verdict = AdmissionVerdict::Shedding;
+        } else if (settings.maxConnections > 0 && open + pending >= settings.maxConnections) {
+            verdict = AdmissionVerdict::TooManyConnections;
+        } else if (settings.maxPerAddress > 0 && state.open + state.pending >= settings.maxPerAddress) {
+            verdict = AdmissionVerdict::TooManyFromAddress;
+        } else if (!state.bucket.take(nowMicros, settings.addressConnectRate, settings.addressConnectBurst)) {
+            verdict = AdmissionVerdict::AddressRateLimited;
+        } else if (!globalBucket.take(nowMicros, settings.connectRate, settings.connectBurst)) {
+            verdict = AdmissionVerdict::RateLimited;
+        }
+        if (verdict != AdmissionVerdict::Admit) {
+            rejected++;
+            return verdict;
+        }
+        pending++;
+        state.pending++;
+        return verdict;
+    }
+
+    /**
+     * An admitted handshake completed: its slot is now an open connection
+     */
+    void opened(const std::string& address, uint64_t nowMicros) {
+        AddressState& state = track(address, nowMicros);
+        if (state.pending > 0) {
+            state.pending--;
+            pending--;
+        }
+        open++;
+        state.open++;
+    }
+
+    /**
+     * An admitted handshake failed before opening; give its slot back
+     */
+    void failed(const std::string& address) {
+        auto it = addresses.find(address);
+        if (it == addresses.end() || it->second.pending == 0) return;
+        it->second.pending--;
+        pending--;
+    }
+
+    void closed(const std::string& address) {
+        open = open > 0 ? open - 1 : 0;
+        auto it = addresses.find(address);
+        if (it != addresses.end() && it->second.open > 0) it->second.open--;
+    }
+
+private:
+    /**
+     * Addresses with nothing open or pending and a refilled bucket are forgotten once
+     * the table is full, so a scan from many addresses cannot grow it
+     */
+    AddressState& track(const std::string& address, uint64_t nowMicros) {
+        if (addresses.size() >= MAX_TRACKED_ADDRESSES && addresses.find(address) == addresses.end()) {
+            for (auto it = addresses.begin(); it != addresses.end();) {
+                const bool idle = it->second.open == 0 && it->second.pending == 0 &&
+                                  it->second.bucket.full(nowMicros, settings.addressConnectRate, settings.addressConnectBurst);
+                it = idle ? addresses.erase(it) : std::next(it);
+            }
+        }
+        return addresses[address];
+    }
+};
@@ -0,0 +1,44 @@
+/**
+ * Allocation Tracker
+ * Per-thread heap allocation counters fed by a replaced global operator new
+ * Only active in builds with TOBII_BRIDGE_ALLOC_TRACKING; otherwise every
+ * query returns zero and enabled() is false
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace AllocTracker {
+
+/**
+ * Snapshot of one thread's counters
+ */
+struct ThreadStats {
+    const char* name;
+    uint64_t allocations;
+    uint64_t frees;
+    uint64_t bytes;
+};
+
+static constexpr size_t MAX_THREADS = 64;
+
+bool enabled();
+
+/**
+ * Label the calling thread in reports (the string must outlive the thread)
+ */
+void nameThread(const char* name);
+
+/**
+ * Allocations made by the calling thread since it started
+ */
+uint64_t threadAllocations();
+
+/**
+ * Copy up to maxThreads per-thread snapshots into out, returning the count
+ */
+size_t snapshot(ThreadStats* out, size_t maxThreads);
+
+} // namespace AllocTracker
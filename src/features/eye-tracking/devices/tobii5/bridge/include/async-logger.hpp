@@ -0,0 +1,360 @@
+/**
+ * Async Logger
+ * Structured key/value logging for hot paths. Call sites are rate limited
+ * per site, records go into a lock-free bounded ring, and a background
+ * thread formats and writes them (logfmt) so callers never block on I/O
+ *
+ *   BRIDGE_LOG(LogLevel::Info, "ws.connect", {"client", id}, {"clients", n});
+ *
+ * A suppressed call costs one relaxed atomic load and one fetch_add
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+enum class LogLevel : uint8_t { Debug = 0, Info = 1, Warn = 2, Error = 3 };
+
+/**
+ * One key/value pair; string values are copied inline (truncated)
+ */
+struct LogField {
+    enum class Type : uint8_t { None, Int, Uint, Double, Bool, String };
+
+    static constexpr size_t MAX_STRING = 47;
+
+    const char* key;
+    Type type;
+    union {
+        int64_t i;
+        uint64_t u;
+        double d;
+        bool b;
+    };
+    char text[MAX_STRING + 1];
+
+    LogField() : key(nullptr), type(Type::None), u(0) { text[0] = '\0'; }
+    LogField(const char* k, bool v) : key(k), type(Type::Bool), b(v) { text[0] = '\0'; }
+    LogField(const char* k, double v) : key(k), type(Type::Double), d(v) { text[0] = '\0'; }
+    LogField(const char* k, float v) : key(k), type(Type::Double), d(v) { text[0] = '\0'; }
+    LogField(const char* k, const char* v) : key(k), type(Type::String), u(0) { copyText(v, std::strlen(v)); }
+    LogField(const char* k, const std::string& v) : key(k), type(Type::String), u(0) { copyText(v.data(), v.size()); }
+
+    template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int>::type = 0>
+    LogField(const char* k, T v) : key(k) {
+        text[0] = '\0';
+        if (std::is_signed<T>::value) {
+            type = Type::Int;
+            i = static_cast<int64_t>(v);
+        } else {
+            type = Type::Uint;
+            u = static_cast<uint64_t>(v);
+        }
+    }
+
+private:
+    void copyText(const char* value, size_t length) {
+        length = std::min(length, MAX_STRING);
+        std::memcpy(text, value, length);
+        text[length] = '\0';
+    }
+};
+
+/**
+ * Static per-call-site state: identity plus a per-second admission window
+ */
+struct LogSite {
+    const char* event;
+    uint32_t perSecond;
+    std::atomic<uint64_t> windowSecond;
+    std::atomic<uint32_t> admitted;
+    std::atomic<uint64_t> suppressed;
+
+    constexpr LogSite(const char* event, uint32_t perSecond)
+        : event(event), perSecond(perSecond), windowSecond(0), admitted(0), suppressed(0) {}
+
+    bool admit(uint64_t nowSecond) {
+        uint64_t window = windowSecond.load(std::memory_order_relaxed);
+        if (window != nowSecond && windowSecond.compare_exchange_strong(window, nowSecond, std::memory_order_relaxed)) {
+            admitted.store(0, std::memory_order_relaxed);
+        }
+        // Over budget: a plain load then a single counter increment
+        if (admitted.load(std::memory_order_relaxed) < perSecond &&
+            admitted.fetch_add(1, std::memory_order_relaxed) < perSecond) {
+            return true;
+        }
+
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+};
+
+struct LogRecord {
+    static constexpr size_t MAX_FIELDS = 8;
+
+    uint64_t timestampMillis;
+    LogLevel level;
+    const char* event;
+    uint64_t suppressed;
+    uint8_t fieldCount;
+    LogField fields[MAX_FIELDS];
+};
+
+class AsyncLogger {
+private:
+    /**
+     * Bounded MPSC ring (Vyukov-style sequence per cell)
+     */
+    struct Cell {
+        std::atomic<size_t> sequence;
+        LogRecord record;
+    };
+
+    static constexpr size_t CAPACITY = 1024;
+
+    std::unique_ptr<Cell[]> cells;
+    alignas(64) std::atomic<size_t> enqueuePos;
+    alignas(64) size_t dequeuePos;
+
+    std::atomic<uint64_t> coarseSecond;
+    std::atomic<uint8_t> minLevel;
+    std::atomic<uint64_t> droppedRecords;
+    std::atomic<bool> running;
+    std::thread drainThread;
+
+public:
+    AsyncLogger()
+        : cells(new Cell[CAPACITY]), enqueuePos(0), dequeuePos(0), coarseSecond(currentSecond()),
+          minLevel(static_cast<uint8_t>(LogLevel::Info)), droppedRecords(0), running(false) {
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    ~AsyncLogger() {
+        stop();
+    }
+
+    static AsyncLogger& instance() {
+        static AsyncLogger logger;
+        return logger;
+    }
+
+    void start() {
+        if (running.exchange(true)) return;
+        drainThread = std::thread(&AsyncLogger::drainLoop, this);
+    }
+
+    /**
+     * Stop the drain thread after writing everything already queued
+     */
+    void stop() {
+        if (!running.exchange(false)) return;
+        if (drainThread.joinable()) drainThread.join();
+    }
+
+    void setLevel(LogLevel level) {
+        minLevel.store(static_cast<uint8_t>(level), std::memory_order_relaxed);
+    }
+
+    static LogLevel parseLevel(const std::string& name, LogLevel fallback = LogLevel::Info) {
+        if (name == "debug") return LogLevel::Debug;
+        if (name == "info") return LogLevel::Info;
+        if (name == "warn" || name == "warning") return LogLevel::Warn;
+        if (name == "error") return LogLevel::Error;
+        return fallback;
+    }
+
+    /**
+     * Level filter plus per-site rate limit; the only cost on the suppressed path
+     */
+    bool admit(LogSite& site, LogLevel level) {
+        if (static_cast<uint8_t>(level) < minLevel.load(std::memory_order_relaxed)) return false;
+        return site.admit(coarseSecond.load(std::memory_order_relaxed));
+    }
+
+    void log(LogSite& site, LogLevel level, std::initializer_list<LogField> fields) {
+        size_t pos = enqueuePos.load(std::memory_order_relaxed);
+        Cell* cell;
+        for (;;) {
+            cell = &cells[pos & (CAPACITY - 1)];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                droppedRecords.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        LogRecord& record = cell->record;
+        record.timestampMillis = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count());
+        record.level = level;
+        record.event = site.event;
+        record.suppressed = site.suppressed.exchange(0, std::memory_order_relaxed);
+        record.fieldCount = 0;
+        for (const LogField& field : fields) {
+            if (record.fieldCount == LogRecord::MAX_FIELDS) break;
+            record.fields[record.fieldCount++] = field;
+        }
+
+        cell->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+private:
+    static uint64_t currentSecond() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+    }
+
+    bool tryPop(LogRecord& out) {
+        Cell& cell = cells[dequeuePos & (CAPACITY - 1)];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(dequeuePos + 1) < 0) return false;
+
+        out = cell.record;
+        cell.sequence.store(dequeuePos + CAPACITY, std::memory_order_release);
+        ++dequeuePos;
+        return true;
+    }
+
+    void drainLoop() {
+        LogRecord record;
+        for (;;) {
+            const bool keepRunning = running.load();
+            coarseSecond.store(currentSecond(), std::memory_order_relaxed);
+
+            size_t written = 0;
+            while (tryPop(record)) {
+                write(record);
+                written++;
+            }
+
+            const uint64_t dropped = droppedRecords.exchange(0, std::memory_order_relaxed);
+            if (dropped > 0) {
+                std::fprintf(stderr, "level=warn event=log.ring_full dropped=%llu\n",
+                             static_cast<unsigned long long>(dropped));
+                written++;
+            }
+
+            if (written > 0) {
+                std::fflush(stdout);
+                std::fflush(stderr);
+            }
+            if (!keepRunning) break;
+            if (written == 0) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    static const char* levelName(LogLevel level) {
+        switch (level) {
+        case LogLevel::Debug: return "debug";
+        case LogLevel::Info: return "info";
+        case LogLevel::Warn: return "warn";
+        case LogLevel::Error: return "error";
+        }
+        return "info";
+    }
+
+    /**
+     * A string value, quoted when it is empty or holds a space, '=', a quote,
+     * a backslash or a control character. Inside quotes, quotes and
+     * backslashes are escaped and control characters written as \n, \r, \t
+     * or \xHH, so a value (client text included) cannot end the line or forge
+     * fields
+     */
+    static void writeText(FILE* out, const char* text) {
+        bool quote = text[0] == '\0';
+        for (const char* c = text; *c && !quote; ++c) {
+            const unsigned char byte = static_cast<unsigned char>(*c);
+            quote = byte <= ' ' || byte == 0x7f || byte == '=' || byte == '"' || byte == '\\';
+        }
+        if (!quote) {
+            std::fputs(text, out);
+            return;
+        }
+
+        std::fputc('"', out);
+        for (const char* c = text; *c; ++c) {
+            const unsigned char byte = static_cast<unsigned char>(*c);
+            switch (byte) {
+            case '"': std::fputs("\\\"", out); break;
+            case '\\': std::fputs("\\\\", out); break;
+            case '\n': std::fputs("\\n", out); break;
+            case '\r': std::fputs("\\r", out); break;
+            case '\t': std::fputs("\\t", out); break;
+            default:
+                if (byte < 0x20 || byte == 0x7f) {
+                    std::fprintf(out, "\\x%02x", byte);
+                } else {
+                    std::fputc(byte, out);
+                }
+            }
+        }
+        std::fputc('"', out);
+    }
+
+    static void write(const LogRecord& record) {
+        FILE* out = record.level >= LogLevel::Warn ? stderr : stdout;
+
+        std::fprintf(out, "ts=%llu.%03llu level=%s event=%s",
+                     static_cast<unsigned long long>(record.timestampMillis / 1000),
+                     static_cast<unsigned long long>(record.timestampMillis % 1000),
+                     levelName(record.level), record.event);
+
+        for (uint8_t i = 0; i < record.fieldCount; ++i) {
+            const LogField& field = record.fields[i];
+            switch (field.type) {
+            case LogField::Type::Int:
+                std::fprintf(out, " %s=%lld", field.key, static_cast<long long>(field.i));
+                break;
+            case LogField::Type::Uint:
+                std::fprintf(out, " %s=%llu", field.key, static_cast<unsigned long long>(field.u));
+                break;
+            case LogField::Type::Double:
+                std::fprintf(out, " %s=%g", field.key, field.d);
+                break;
+            case LogField::Type::Bool:
+                std::fprintf(out, " %s=%s", field.key, field.b ? "true" : "false");
+                break;
+            case LogField::Type::String:
+                std::fprintf(out, " %s=", field.key);
+                writeText(out, field.text);
+                break;
+            case LogField::Type::None:
+                break;
+            }
+        }
+
+        if (record.suppressed > 0) {
+            std::fprintf(out, " suppressed=%llu", static_cast<unsigned long long>(record.suppressed));
+        }
+        std::fputc('\n', out);
+    }
+};
+
+#define BRIDGE_LOG_RATE(level, event, perSecond, ...)                                   \
+    do {                                                                                \
+        static LogSite bridgeLogSite_(event, perSecond);                                \
+        if (AsyncLogger::instance().admit(bridgeLogSite_, level)) {                     \
+            AsyncLogger::instance().log(bridgeLogSite_, level, {__VA_ARGS__});          \
+        }                                                                               \
+    } while (0)
+
+#define BRIDGE_LOG(level, event, ...) BRIDGE_LOG_RATE(level, event, 20, __VA_ARGS__)
@@ -0,0 +1,82 @@
+/**
+ * Bridge Clock
+ * Every timing decision on the data path (sample stamps, loop pacing,
+ * config polling, synthetic gaze and injected faults) reads this clock
+ * instead of std::chrono directly. The system clock is the default; the
+ * virtual clock only moves when the main loop sleeps on it, so a run is a
+ * pure function of its inputs and can be replayed tick for tick
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+class BridgeClock {
+public:
+    virtual ~BridgeClock() = default;
+
+    /**
+     * Monotonic microseconds, for intervals and pacing
+     */
+    virtual uint64_t monotonicMicros() = 0;
+
+    /**
+     * Microseconds since the Unix epoch, the clock samples are stamped with
+     */
+    virtual uint64_t wallMicros() = 0;
+
+    virtual void sleepFor(uint64_t micros) = 0;
+
+    virtual bool isVirtual() const { return false; }
+
+    static BridgeClock& system();
+};
+
+class SystemClock final : public BridgeClock {
+public:
+    uint64_t monotonicMicros() override {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count();
+    }
+
+    uint64_t wallMicros() override {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count();
+    }
+
+    void sleepFor(uint64_t micros) override {
+        std::this_thread::sleep_for(std::chrono::microseconds(micros));
+    }
+};
+
+inline BridgeClock& BridgeClock::system() {
+    static SystemClock clock;
+    return clock;
+}
+
+/**
+ * Stepped clock: time stands still until sleepFor() or advance() moves it.
+ * Only the main loop should sleep on it; other threads keep real time
+ */
+class VirtualClock final : public BridgeClock {
+private:
+    std::atomic<uint64_t> now;
+    uint64_t wallEpochMicros;
+
+public:
+    // 2023-11-14T22:13:20Z, a fixed start so sample stamps repeat across runs
+    explicit VirtualClock(uint64_t wallEpochMicros = 1700000000000000ull)
+        : now(0), wallEpochMicros(wallEpochMicros) {}
+
+    uint64_t monotonicMicros() override { return now.load(std::memory_order_acquire); }
+    uint64_t wallMicros() override { return wallEpochMicros + monotonicMicros(); }
+    void sleepFor(uint64_t micros) override { advance(micros); }
+    bool isVirtual() const override { return true; }
+
+    void advance(uint64_t micros) { now.fetch_add(micros, std::memory_order_acq_rel); }
+};
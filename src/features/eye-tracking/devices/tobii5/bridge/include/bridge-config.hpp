@@ -0,0 +1,532 @@
+/**
+ * Bridge Configuration
+ * Runtime settings loaded from config.json (the file build.bat ships) with
+ * command-line overrides layered on top. Settings are split into hot
+ * (applied between ticks on reload) and restart-only
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+enum class BackpressurePolicy { None, Drop, Disconnect };
+
+struct BridgeConfig {
+    // Network (restart-only)
+    int wsPort = 8080;
+    int udpPort = 4242;
+    int discoveryPort = 8083;
+
+    // Threads (restart-only)
+    int ioThreads = 0;                  // 0 = poll network events on the main loop
+    std::vector<int> ioThreadCpus;
+
+    // Rates (hot)
+    int loopIntervalMs = 16;            // ~60Hz
+    int discoveryIntervalSeconds = 5;
+
+    // CPU affinity of the main loop (hot, -1 = unpinned)
+    int mainThreadCpu = -1;
+
+    // Buffers
+    size_t wsMaxSendBytes = 256 * 1024; // hot: per-client queued bytes before backpressure
+    int udpSendBufferBytes = 0;         // restart-only, 0 = OS default
+
+    // Backpressure (hot)
+    BackpressurePolicy backpressure = BackpressurePolicy::Drop;
+
+    // Filters (hot)
+    float gazeSmoothing = 0.0f;         // 0 = off, closer to 1 = smoother
+
+    // Logging (hot)
+    std::string logLevel = "info";
+
+    // Recording (hot, read when a recording starts)
+    std::string recordingDirectory = "recordings";
+
+    // Quality monitor (hot; an alert threshold of 0 is off)
+    int qualityWindowSeconds = 10;
+    float qualityMinRateHz = 0.0f;
+    float qualityMinGazeRatio = 0.0f;
+    float qualityMinHeadRatio = 0.0f;
+    float qualityMinPresenceRatio = 0.0f;
+    int qualityMaxGapMs = 0;
+
+    // Adaptive per-client rate (hot; bounds for clients that subscribe with adaptive)
+    int adaptiveMaxDecimation = 8;
+    size_t adaptiveTargetQueueBytes = 16 * 1024;
+    int adaptiveIntervalMs = 500;
+    float adaptiveRttSlackMs = 80.0f;
+    bool adaptiveQuantize = true;
+
+    // Admission control (hot; a limit of 0 is off)
+    int admissionMaxConnections = 128;
+    int admissionMaxPerAddress = 16;
+    float admissionConnectRate = 20.0f;         // new connections/s across all addresses
+    float admissionConnectBurst = 40.0f;
+    float admissionAddressConnectRate = 2.0f;   // new connections/s from one address
+    float admissionAddressConnectBurst = 8.0f;
+    std::vector<std::string> criticalAddresses; // clients admitted as critical
+    std::string criticalToken;                  // or presenting ?token=<this>; "" = none
+
+    // Load shedding (hot; a tick budget of 0 is off)
+    int shedTickBudgetUs = 8000;
+    int shedMaxDecimation = 8;
+    int shedEscalateMs = 250;
+    int shedRecoverMs = 5000;
+
+    // Gaze prediction (hot; used by clients that subscribe with predict)
+    float predictionTrackerLatencyMs = 15.0f;   // added to half the client's RTT for automatic horizons
+    float predictionMaxHorizonMs = 100.0f;
+    float predictionSaccadeVelocity = 0.7f;     // unit display widths/s; prediction pauses above it
+    int predictionSettleMs = 50;
+
+    // Tracker watchdog (hot; a limit of 0 is off)
+    int watchdogStaleMs = 3000;         // unchanged readings for this long mean the source is lost
+    int watchdogStallMs = 1000;         // as does a single update() this slow
+    int watchdogRetryMs = 500;          // first reinitialization; doubles per failure
+    int watchdogMaxRetryMs = 30000;
+
+    // Idle power saving (hot): with no clients and no recording for idle_after_ms,
+    // the loop ticks once per keepalive_ms until a client connects; 0 = never idle
+    int powerIdleAfterMs = 5000;
+    int powerKeepaliveMs = 1000;
+
+    // UDP sample stream with NACK loss recovery (port restart-only, 0 = off;
+    // the rest hot)
+    int udpStreamPort = 0;
+    int udpStreamMaxSubscribers = 16;
+    int udpStreamTimeoutMs = 5000;              // subscribers that stop sending keep-alives are dropped
+    int udpStreamRetransmitWindowMs = 250;      // older samples are reported gone instead of resent
+    float udpStreamMaxRetransmitsPerSecond = 300.0f;    // per subscriber
+
+    // Multicast sample stream with forward error correction (group, port and
+    // ttl restart-only, "" = off; the rest hot): fec.parity parity datagrams
+    // follow every fec.group samples, 0 = no FEC
+    std::string multicastGroup;
+    int multicastPort = 4244;
+    int multicastTtl = 1;
+    std::string multicastFormat = "binary";
+    int multicastFecGroup = 8;
+    int multicastFecParity = 1;
+
+    // 3D pose outputs (hot): the tracked display's size, the ray origin used
+    // while the head is not tracked, and the world frame the pose is reported in
+    float poseScreenWidthMm = 527.0f;
+    float poseScreenHeightMm = 296.0f;
+    float poseEyeDistanceMm = 600.0f;
+    std::vector<float> poseWorldOriginMm = {0.0f, 0.0f, 0.0f};
+    std::vector<float> poseWorldRotationDeg = {0.0f, 0.0f, 0.0f};  // yaw, pitch, roll
+    float poseWorldScale = 1.0f;                                    // world units per mm
+
+    static const char* policyName(BackpressurePolicy policy) {
+        switch (policy) {
+        case BackpressurePolicy::None: return "none";
+        case BackpressurePolicy::Drop: return "drop";
+        case BackpressurePolicy::Disconnect: return "disconnect";
+        }
+        return "drop";
+    }
+
+    static BackpressurePolicy parsePolicy(const std::string& name) {
+        if (name == "none") return BackpressurePolicy::None;
+        if (name == "drop") return BackpressurePolicy::Drop;
+        if (name == "disconnect") return BackpressurePolicy::Disconnect;
+        throw std::invalid_argument("unknown backpressure policy '" + name + "'");
+    }
+
+    /**
+     * Parse over the current values; keys that are absent keep them
+     */
+    void merge(const nlohmann::json& j) {
+        wsPort = j.value("websocket_port", wsPort);
+        udpPort = j.value("udp_port", udpPort);
+        discoveryPort = j.value("discovery_port", discoveryPort);
+        loopIntervalMs = j.value("loop_interval_ms", loopIntervalMs);
+        discoveryIntervalSeconds = j.value("discovery_interval_s", discoveryIntervalSeconds);
+        ioThreads = j.value("io_threads", ioThreads);
+        logLevel = j.value("log_level", logLevel);
+
+        if (j.contains("cpu_affinity")) {
+            const auto& affinity = j["cpu_affinity"];
+            mainThreadCpu = affinity.value("main", mainThreadCpu);
+            ioThreadCpus = affinity.value("io", ioThreadCpus);
+        }
+        if (j.contains("buffers")) {
+            const auto& buffers = j["buffers"];
+            wsMaxSendBytes = buffers.value("ws_max_send_bytes", wsMaxSendBytes);
+            udpSendBufferBytes = buffers.value("udp_send_bytes", udpSendBufferBytes);
+        }
+        if (j.contains("backpressure")) {
+            backpressure = parsePolicy(j["backpressure"].value("policy", std::string(policyName(backpressure))));
+        }
+        if (j.contains("filters")) {
+            gazeSmoothing = j["filters"].value("gaze_smoothing", gazeSmoothing);
+        }
+        if (j.contains("recording")) {
+            recordingDirectory = j["recording"].value("directory", recordingDirectory);
+        }
+        if (j.contains("quality")) {
+            const auto& quality = j["quality"];
+            qualityWindowSeconds = quality.value("window_s", qualityWindowSeconds);
+            if (quality.contains("alerts")) {
+                const auto& alerts = quality["alerts"];
+                qualityMinRateHz = alerts.value("min_rate_hz", qualityMinRateHz);
+                qualityMinGazeRatio = alerts.value("min_gaze_ratio", qualityMinGazeRatio);
+                qualityMinHeadRatio = alerts.value("min_head_ratio", qualityMinHeadRatio);
+                qualityMinPresenceRatio = alerts.value("min_presence_ratio", qualityMinPresenceRatio);
+                qualityMaxGapMs = alerts.value("max_gap_ms", qualityMaxGapMs);
+            }
+        }
+        if (j.contains("adaptive_rate")) {
+            const auto& adaptive = j["adaptive_rate"];
+            adaptiveMaxDecimation = adaptive.value("max_decimation", adaptiveMaxDecimation);
+            adaptiveTargetQueueBytes = adaptive.value("target_queue_bytes", adaptiveTargetQueueBytes);
+            adaptiveIntervalMs = adaptive.value("interval_ms", adaptiveIntervalMs);
+            adaptiveRttSlackMs = adaptive.value("rtt_slack_ms", adaptiveRttSlackMs);
+            adaptiveQuantize = adaptive.value("quantize", adaptiveQuantize);
+        }
+        if (j.contains("admission")) {
+            const auto& admission = j["admission"];
+            admissionMaxConnections = admission.value("max_connections", admissionMaxConnections);
+            admissionMaxPerAddress = admission.value("max_per_address", admissionMaxPerAddress);
+            if (admission.contains("connect_rate")) {
+                admissionConnectRate = admission["connect_rate"].value("per_second", admissionConnectRate);
+                admissionConnectBurst = admission["connect_rate"].value("burst", admissionConnectBurst);
+            }
+            if (admission.contains("address_connect_rate")) {
+                admissionAddressConnectRate = admission["address_connect_rate"].value("per_second", admissionAddressConnectRate);
+                admissionAddressConnectBurst = admission["address_connect_rate"].value("burst", admissionAddressConnectBurst);
+            }
+            if (admission.contains("critical")) {
+                criticalAddresses = admission["critical"].value("addresses", criticalAddresses);
+                criticalToken = admission["critical"].value("token", criticalToken);
+            }
+        }
+        if (j.contains("load_shedding")) {
+            const auto& shedding = j["load_shedding"];
+            shedTickBudgetUs = shedding.value("tick_budget_us", shedTickBudgetUs);
+            shedMaxDecimation = shedding.value("max_decimation", shedMaxDecimation);
+            shedEscalateMs = shedding.value("escalate_ms", shedEscalateMs);
+            shedRecoverMs = shedding.value("recover_ms", shedRecoverMs);
+        }
+        if (j.contains("prediction")) {
+            const auto& prediction = j["prediction"];
+            predictionTrackerLatencyMs = prediction.value("tracker_latency_ms", predictionTrackerLatencyMs);
+            predictionMaxHorizonMs = prediction.value("max_horizon_ms", predictionMaxHorizonMs);
+            predictionSaccadeVelocity = prediction.value("saccade_velocity", predictionSaccadeVelocity);
+            predictionSettleMs = prediction.value("settle_ms", predictionSettleMs);
+        }
+        if (j.contains("watchdog")) {
+            const auto& watchdog = j["watchdog"];
+            watchdogStaleMs = watchdog.value("stale_ms", watchdogStaleMs);
+            watchdogStallMs = watchdog.value("stall_ms", watchdogStallMs);
+            watchdogRetryMs = watchdog.value("retry_ms", watchdogRetryMs);
+            watchdogMaxRetryMs = watchdog.value("max_retry_ms", watchdogMaxRetryMs);
+        }
+        if (j.contains("power")) {
+            const auto& power = j["power"];
+            powerIdleAfterMs = power.value("idle_after_ms", powerIdleAfterMs);
+            powerKeepaliveMs = power.value("keepalive_ms", powerKeepaliveMs);
+        }
+        if (j.contains("udp_stream")) {
+            const auto& stream = j["udp_stream"];
+            udpStreamPort = stream.value("port", udpStreamPort);
+            udpStreamMaxSubscribers = stream.value("max_subscribers", udpStreamMaxSubscribers);
+            udpStreamTimeoutMs = stream.value("timeout_ms", udpStreamTimeoutMs);
+            udpStreamRetransmitWindowMs = stream.value("retransmit_window_ms", udpStreamRetransmitWindowMs);
+            udpStreamMaxRetransmitsPerSecond = stream.value("max_retransmits_per_s", udpStreamMaxRetransmitsPerSecond);
+        }
+        if (j.contains("multicast")) {
+            const auto& multicast = j["multicast"];
+            multicastGroup = multicast.value("group", multicastGroup);
+            multicastPort = multicast.value("port", multicastPort);
+            multicastTtl = multicast.value("ttl", multicastTtl);
+            multicastFormat = multicast.value("format", multicastFormat);
+            if (multicast.contains("fec")) {
+                multicastFecGroup = multicast["fec"].value("group", multicastFecGroup);
+                multicastFecParity = multicast["fec"].value("parity", multicastFecParity);
+            }
+        }
+        if (j.contains("pose")) {
+            const auto& pose = j["pose"];
+            poseScreenWidthMm = pose.value("screen_width_mm", poseScreenWidthMm);
+            poseScreenHeightMm = pose.value("screen_height_mm", poseScreenHeightMm);
+            poseEyeDistanceMm = pose.value("eye_distance_mm", poseEyeDistanceMm);
+            if (pose.contains("world")) {
+                poseWorldOriginMm = pose["world"].value("origin_mm", poseWorldOriginMm);
+                poseWorldRotationDeg = pose["world"].value("rotation_deg", poseWorldRotationDeg);
+                poseWorldScale = pose["world"].value("scale", poseWorldScale);
+            }
+        }
+    }
+
+    /**
+     * Throws std::invalid_argument describing the first bad value
+     */
+    void validate() const {
+        auto requirePort = [](int port, const char* name) {
+            if (port < 1 || port > 65535) throw std::invalid_argument(std::string(name) + " out of range");
+        };
+        requirePort(wsPort, "websocket_port");
+        requirePort(udpPort, "udp_port");
+        requirePort(discoveryPort, "discovery_port");
+
+        if (loopIntervalMs < 1 || loopIntervalMs > 1000) throw std::invalid_argument("loop_interval_ms must be 1-1000");
+        if (discoveryIntervalSeconds < 1) throw std::invalid_argument("discovery_interval_s must be >= 1");
+        if (ioThreads < 0 || ioThreads > 64) throw std::invalid_argument("io_threads must be 0-64");
+        if (gazeSmoothing < 0.0f || gazeSmoothing >= 1.0f) throw std::invalid_argument("filters.gaze_smoothing must be in [0, 1)");
+        if (logLevel != "debug" && logLevel != "info" && logLevel != "warn" && logLevel != "warning" && logLevel != "error") {
+            throw std::invalid_argument("log_level must be debug, info, warn or error");
+        }
+        if (recordingDirectory.empty()) throw std::invalid_argument("recording.directory must not be empty");
+        if (qualityWindowSeconds < 1 || qualityWindowSeconds > 60) throw std::invalid_argument("quality.window_s must be 1-60");
+        if (qualityMinRateHz < 0.0f) throw std::invalid_argument("quality.alerts.min_rate_hz must be >= 0");
+        auto requireRatio = [](float ratio, const char* name) {
+            if (ratio < 0.0f || ratio > 1.0f) throw std::invalid_argument(std::string(name) + " must be in [0, 1]");
+        };
+        requireRatio(qualityMinGazeRatio, "quality.alerts.min_gaze_ratio");
+        requireRatio(qualityMinHeadRatio, "quality.alerts.min_head_ratio");
+        requireRatio(qualityMinPresenceRatio, "quality.alerts.min_presence_ratio");
+        if (qualityMaxGapMs < 0) throw std::invalid_argument("quality.alerts.max_gap_ms must be >= 0");
+        if (adaptiveMaxDecimation < 1 || adaptiveMaxDecimation > 64) throw std::invalid_argument("adaptive_rate.max_decimation must be 1-64");
+        if (adaptiveTargetQueueBytes < 1024) throw std::invalid_argument("adaptive_rate.target_queue_bytes must be >= 1024");
+        if (adaptiveIntervalMs < 100 || adaptiveIntervalMs > 10000) throw std::invalid_argument("adaptive_rate.interval_ms must be 100-10000");
+        if (adaptiveRttSlackMs < 0.0f) throw std::invalid_argument("adaptive_rate.rtt_slack_ms must be >= 0");
+        if (admissionMaxConnections < 0) throw std::invalid_argument("admission.max_connections must be >= 0");
+        if (admissionMaxPerAddress < 0) throw std::invalid_argument("admission.max_per_address must be >= 0");
+        auto requireRate = [](float perSecond, float burst, const char* name) {
+            if (perSecond < 0.0f || (perSecond > 0.0f && burst < 1.0f)) {
+                throw std::invalid_argument(std::string(name) + " needs per_second >= 0 and a burst of at least 1");
+            }
+        };
+        requireRate(admissionConnectRate, admissionConnectBurst, "admission.connect_rate");
+        requireRate(admissionAddressConnectRate, admissionAddressConnectBurst, "admission.address_connect_rate");
+        if (shedTickBudgetUs < 0) throw std::invalid_argument("load_shedding.tick_budget_us must be >= 0");
+        if (shedMaxDecimation < 1 || shedMaxDecimation > 64) throw std::invalid_argument("load_shedding.max_decimation must be 1-64");
+        if (shedEscalateMs < 10) throw std::invalid_argument("load_shedding.escalate_ms must be >= 10");
+        if (shedRecoverMs < shedEscalateMs) throw std::invalid_argument("load_shedding.recover_ms must be >= escalate_ms");
+        if (predictionTrackerLatencyMs < 0.0f) throw std::invalid_argument("prediction.tracker_latency_ms must be >= 0");
+        if (predictionMaxHorizonMs < 0.0f || predictionMaxHorizonMs > 500.0f) throw std::invalid_argument("prediction.max_horizon_ms must be 0-500");
+        if (predictionSaccadeVelocity <= 0.0f) throw std::invalid_argument("prediction.saccade_velocity must be > 0");
+        if (predictionSettleMs < 0 || predictionSettleMs > 1000) throw std::invalid_argument("prediction.settle_ms must be 0-1000");
+        if (watchdogStaleMs < 0) throw std::invalid_argument("watchdog.stale_ms must be >= 0");
+        if (watchdogStallMs < 0) throw std::invalid_argument("watchdog.stall_ms must be >= 0");
+        if (watchdogRetryMs < 10) throw std::invalid_argument("watchdog.retry_ms must be >= 10");
+        if (watchdogMaxRetryMs < watchdogRetryMs) throw std::invalid_argument("watchdog.max_retry_ms must be >= retry_ms");
+        if (powerIdleAfterMs < 0) throw std::invalid_argument("power.idle_after_ms must be >= 0");
+        if (powerKeepaliveMs < loopIntervalMs || powerKeepaliveMs > 10000) throw std::invalid_argument("power.keepalive_ms must be loop_interval_ms-10000");
+        if (udpStreamPort != 0) requirePort(udpStreamPort, "udp_stream.port");
+        if (udpStreamMaxSubscribers < 1 || udpStreamMaxSubscribers > 64) throw std::invalid_argument("udp_stream.max_subscribers must be 1-64");
+        if (udpStreamTimeoutMs < 100) throw std::invalid_argument("udp_stream.timeout_ms must be >= 100");
+        if (udpStreamRetransmitWindowMs < 0 || udpStreamRetransmitWindowMs > 4000) throw std::invalid_argument("udp_stream.retransmit_window_ms must be 0-4000");
+        if (udpStreamMaxRetransmitsPerSecond < 0.0f) throw std::invalid_argument("udp_stream.max_retransmits_per_s must be >= 0");
+        if (!multicastGroup.empty()) {
+            unsigned octets[4];
+            char trailing;
+            if (std::sscanf(multicastGroup.c_str(), "%u.%u.%u.%u%c", &octets[0], &octets[1], &octets[2], &octets[3], &trailing) != 4 ||
+                octets[0] < 224 || octets[0] > 239 || octets[1] > 255 || octets[2] > 255 || octets[3] > 255) {
+                throw std::invalid_argument("multicast.group must be an IPv4 multicast address (224.0.0.0-239.255.255.255)");
+            }
+            requirePort(multicastPort, "multicast.port");
+        }
+        if (multicastTtl < 0 || multicastTtl > 255) throw std::invalid_argument("multicast.ttl must be 0-255");
+        if (multicastFormat != "binary" && multicastFormat != "quantized") throw std::invalid_argument("multicast.format must be binary or quantized");
+        if (multicastFecGroup < 2 || multicastFecGroup > 32) throw std::invalid_argument("multicast.fec.group must be 2-32");
+        if (multicastFecParity < 0 || multicastFecParity > 8) throw std::invalid_argument("multicast.fec.parity must be 0-8");
+        if (!(poseScreenWidthMm > 0.0f) || !(poseScreenHeightMm > 0.0f)) throw std::invalid_argument("pose.screen_width_mm and screen_height_mm must be > 0");
+        if (!(poseEyeDistanceMm > 0.0f)) throw std::invalid_argument("pose.eye_distance_mm must be > 0");
+        auto requireVector = [](const std::vector<float>& vector, const char* name) {
+            if (vector.size() != 3 || !std::isfinite(vector[0]) || !std::isfinite(vector[1]) || !std::isfinite(vector[2])) {
+                throw std::invalid_argument(std::string(name) + " must be three numbers");
+            }
+        };
+        requireVector(poseWorldOriginMm, "pose.world.origin_mm");
+        requireVector(poseWorldRotationDeg, "pose.world.rotation_deg");
+        if (!(poseWorldScale > 0.0f) || !std::isfinite(poseWorldScale)) throw std::invalid_argument("pose.world.scale must be > 0");
+    }
+
+    nlohmann::json toJson() const {
+        nlohmann::json j;
+        j["websocket_port"] = wsPort;
+        j["udp_port"] = udpPort;
+        j["discovery_port"] = discoveryPort;
+        j["loop_interval_ms"] = loopIntervalMs;
+        j["discovery_interval_s"] = discoveryIntervalSeconds;
+        j["io_threads"] = ioThreads;
+        j["cpu_affinity"]["main"] = mainThreadCpu;
+        j["cpu_affinity"]["io"] = ioThreadCpus;
+        j["buffers"]["ws_max_send_bytes"] = wsMaxSendBytes;
+        j["buffers"]["udp_send_bytes"] = udpSendBufferBytes;
+        j["backpressure"]["policy"] = policyName(backpressure);
+        j["filters"]["gaze_smoothing"] = gazeSmoothing;
+        j["log_level"] = logLevel;
+        j["recording"]["directory"] = recordingDirectory;
+        j["quality"]["window_s"] = qualityWindowSeconds;
+        j["quality"]["alerts"]["min_rate_hz"] = qualityMinRateHz;
+        j["quality"]["alerts"]["min_gaze_ratio"] = qualityMinGazeRatio;
+        j["quality"]["alerts"]["min_head_ratio"] = qualityMinHeadRatio;
+        j["quality"]["alerts"]["min_presence_ratio"] = qualityMinPresenceRatio;
+        j["quality"]["alerts"]["max_gap_ms"] = qualityMaxGapMs;
+        j["adaptive_rate"]["max_decimation"] = adaptiveMaxDecimation;
+        j["adaptive_rate"]["target_queue_bytes"] = adaptiveTargetQueueBytes;
+        j["adaptive_rate"]["interval_ms"] = adaptiveIntervalMs;
+        j["adaptive_rate"]["rtt_slack_ms"] = adaptiveRttSlackMs;
+        j["adaptive_rate"]["quantize"] = adaptiveQuantize;
+        j["admission"]["max_connections"] = admissionMaxConnections;
+        j["admission"]["max_per_address"] = admissionMaxPerAddress;
+        j["admission"]["connect_rate"]["per_second"] = admissionConnectRate;
+        j["admission"]["connect_rate"]["burst"] = admissionConnectBurst;
+        j["admission"]["address_connect_rate"]["per_second"] = admissionAddressConnectRate;
+        j["admission"]["address_connect_rate"]["burst"] = admissionAddressConnectBurst;
+        j["admission"]["critical"]["addresses"] = criticalAddresses;
+        j["admission"]["critical"]["token"] = criticalToken.empty() ? "" : "***";
+        j["load_shedding"]["tick_budget_us"] = shedTickBudgetUs;
+        j["load_shedding"]["max_decimation"] = shedMaxDecimation;
+        j["load_shedding"]["escalate_ms"] = shedEscalateMs;
+        j["load_shedding"]["recover_ms"] = shedRecoverMs;
+        j["prediction"]["tracker_latency_ms"] = predictionTrackerLatencyMs;
+        j["prediction"]["max_horizon_ms"] = predictionMaxHorizonMs;
+        j["prediction"]["saccade_velocity"] = predictionSaccadeVelocity;
+        j["prediction"]["settle_ms"] = predictionSettleMs;
+        j["watchdog"]["stale_ms"] = watchdogStaleMs;
+        j["watchdog"]["stall_ms"] = watchdogStallMs;
+        j["watchdog"]["retry_ms"] = watchdogRetryMs;
+        j["watchdog"]["max_retry_ms"] = watchdogMaxRetryMs;
+        j["power"]["idle_after_ms"] = powerIdleAfterMs;
+        j["power"]["keepalive_ms"] = powerKeepaliveMs;
+        j["udp_stream"]["port"] = udpStreamPort;
+        j["udp_stream"]["max_subscribers"] = udpStreamMaxSubscribers;
+        j["udp_stream"]["timeout_ms"] = udpStreamTimeoutMs;
+        j["udp_stream"]["retransmit_window_ms"] = udpStreamRetransmitWindowMs;
+        j["udp_stream"]["max_retransmits_per_s"] = udpStreamMaxRetransmitsPerSecond;
+        j["multicast"]["group"] = multicastGroup;
+        j["multicast"]["port"] = multicastPort;
+        j["multicast"]["ttl"] = multicastTtl;
+        j["multicast"]["format"] = multicastFormat;
+        j["multicast"]["fec"]["group"] = multicastFecGroup;
+        j["multicast"]["fec"]["parity"] = multicastFecParity;
+        j["pose"]["screen_width_mm"] = poseScreenWidthMm;
+        j["pose"]["screen_height_mm"] = poseScreenHeightMm;
+        j["pose"]["eye_distance_mm"] = poseEyeDistanceMm;
+        j["pose"]["world"]["origin_mm"] = poseWorldOriginMm;
+        j["pose"]["world"]["rotation_deg"] = poseWorldRotationDeg;
+        j["pose"]["world"]["scale"] = poseWorldScale;
+        return j;
+    }
+
+    /**
+     * Names of restart-only settings that differ from other
+     */
+    std::vector<std::string> restartOnlyChanges(const BridgeConfig& other) const {
+        std::vector<std::string> changed;
+        if (wsPort != other.wsPort) changed.push_back("websocket_port");
+        if (udpPort != other.udpPort) changed.push_back("udp_port");
+        if (discoveryPort != other.discoveryPort) changed.push_back("discovery_port");
+        if (ioThreads != other.ioThreads) changed.push_back("io_threads");
+        if (ioThreadCpus != other.ioThreadCpus) changed.push_back("cpu_affinity.io");
+        if (udpSendBufferBytes != other.udpSendBufferBytes) changed.push_back("buffers.udp_send_bytes");
+        if (udpStreamPort != other.udpStreamPort) changed.push_back("udp_stream.port");
+        if (multicastGroup != other.multicastGroup) changed.push_back("multicast.group");
+        if (multicastPort != other.multicastPort) changed.push_back("multicast.port");
+        if (multicastTtl != other.multicastTtl) changed.push_back("multicast.ttl");
+        return changed;
+    }
+
+    /**
+     * Copy of next with restart-only settings pinned to this config's values
+     */
+    BridgeConfig withHotSettingsFrom(const BridgeConfig& next) const {
+        BridgeConfig merged = next;
+        merged.wsPort = wsPort;
+        merged.udpPort = udpPort;
+        merged.discoveryPort = discoveryPort;
+        merged.ioThreads = ioThreads;
+        merged.ioThreadCpus = ioThreadCpus;
+        merged.udpSendBufferBytes = udpSendBufferBytes;
+        merged.udpStreamPort = udpStreamPort;
+        merged.multicastGroup = multicastGroup;
+        merged.multicastPort = multicastPort;
+        merged.multicastTtl = multicastTtl;
+        return merged;
+    }
+};
+
+/**
+ * Owns the config file path and the command-line overrides so a reload
+ * re-applies them: defaults < file < runtime patches < command line
+ */
+class ConfigStore {
+private:
+    std::string path;
+    nlohmann::json cliOverrides;
+    nlohmann::json runtimePatch;
+    std::filesystem::file_time_type lastWriteTime;
+
+public:
+    explicit ConfigStore(std::string path = "")
+        : path(std::move(path)), cliOverrides(nlohmann::json::object()),
+          runtimePatch(nlohmann::json::object()) {}
+
+    const std::string& filePath() const { return path; }
+
+    nlohmann::json& overrides() { return cliOverrides; }
+
+    /**
+     * Build a validated config; throws with a readable message on failure
+     */
+    BridgeConfig load() {
+        BridgeConfig config;
+
+        if (!path.empty()) {
+            // Record the write time first so a broken file is not retried every poll
+            std::error_code ec;
+            lastWriteTime = std::filesystem::last_write_time(path, ec);
+
+            std::ifstream file(path);
+            if (!file) throw std::runtime_error("cannot open config file '" + path + "'");
+
+            const nlohmann::json fileJson = nlohmann::json::parse(file, nullptr, true, true);
+            config.merge(fileJson);
+        }
+
+        config.merge(runtimePatch);
+        config.merge(cliOverrides);
+        config.validate();
+        return config;
+    }
+
+    /**
+     * Validate and load with an extra runtime patch (kept for later reloads)
+     */
+    BridgeConfig loadWithPatch(const nlohmann::json& patch) {
+        nlohmann::json previous = runtimePatch;
+        runtimePatch.merge_patch(patch);
+        try {
+            return load();
+        } catch (...) {
+            runtimePatch = previous;
+            throw;
+        }
+    }
+
+    /**
+     * True once the config file's modification time moves past the last load
+     */
+    bool fileChanged() const {
+        if (path.empty()) return false;
+        std::error_code ec;
+        const auto writeTime = std::filesystem::last_write_time(path, ec);
+        return !ec && writeTime != lastWriteTime;
+    }
+};
@@ -0,0 +1,195 @@
+/**
+ * Bridge Core
+ * Acquisition, processing, history and encoding with no networking: the
+ * tracker source under its watchdog, smoothing and gaze prediction, the
+ * sample ring and the history pyramid. The WebSocket server is one
+ * frontend over it; tobiibridge.h is another, for in-process consumers.
+ * Built once as the tobiibridge_core_objects library and linked into both
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "bridge-clock.hpp"
+#include "bridge-config.hpp"
+#include "fault-injection.hpp"
+#include "gaze-filter.hpp"
+#include "gaze-predictor.hpp"
+#include "history-pyramid.hpp"
+#include "pose-math.hpp"
+#include "sample-ring.hpp"
+#include "sample-schema.hpp"
+#include "tobii-data-packet.hpp"
+#include "tracker-source.hpp"
+#include "tracker-watchdog.hpp"
+
+/**
+ * Build the named source ("synthetic", "synthetic-pursuit", or "tgi" where the SDK is present),
+ * wrapped in a FaultInjectingSource when faultSpec is not empty. Throws
+ * std::invalid_argument, with a message fit to show, for an unknown source
+ * or a bad fault spec
+ */
+std::unique_ptr<TrackerSource> makeTrackerSource(const std::string& name, const std::string& faultSpec,
+                                                 BridgeClock& clock, FaultInjectingSource** faulty = nullptr);
+
+/**
+ * One thread drives acquisition and publishing; its owner decides what
+ * lock readers take around latest(), ring() and watchdog(). Two reads are
+ * safe from any thread: published samples checked with readable(), and
+ * history queries, which take the core's own history lock
+ */
+class BridgeCore {
+public:
+    static constexpr size_t RING_CAPACITY = 256;
+    using Ring = SampleRing<RING_CAPACITY>;
+
+private:
+    std::unique_ptr<TrackerSource> source;
+    BridgeClock& clock;
+
+    // Settings from the last configure()
+    float gazeSmoothing;
+    PredictionSettings prediction;
+
+    // Acquisition
+    TrackerWatchdog sourceWatchdog;
+    std::atomic<bool> sourceConnected;
+    GazeSmoother gazeSmoother;
+    GazePredictor gazePredictor;
+    Pose::PoseKernel poseKernel;
+    TobiiDataPacket latestData;
+    uint64_t latestSampleMicros;
+    std::atomic<uint64_t> processed;
+
+    // Published samples. `writing` is the sequence whose slot is being
+    // overwritten; a reader that copied a slot checks it afterwards
+    Ring sampleRing;
+    std::atomic<uint64_t> writing;
+    std::atomic<uint64_t> publishedEnd;
+
+    HistoryPyramid history;
+    mutable std::mutex historyMutex;
+
+public:
+    explicit BridgeCore(std::unique_ptr<TrackerSource> trackerSource, BridgeClock& bridgeClock = BridgeClock::system());
+
+    BridgeCore(const BridgeCore&) = delete;
+    BridgeCore& operator=(const BridgeCore&) = delete;
+
+    /**
+     * Take the smoothing, watchdog, prediction and pose settings (hot)
+     */
+    void configure(const BridgeConfig& config);
+
+    bool hasSource() const { return source != nullptr; }
+    const char* sourceName() const { return source ? source->name() : ""; }
+    GazeSpace gazeSpace() const { return source ? source->gazeSpace() : GazeSpace::Unit; }
+    bool connected() const { return sourceConnected.load(std::memory_order_acquire); }
+
+    /**
+     * Microseconds on the clock samples are stamped with (bridge wall clock)
+     */
+    uint64_t sampleClockMicros() { return clock.wallMicros(); }
+
+    // --- Acquisition (driving thread) ---
+
+    /**
+     * First initialization; on failure the caller marks the source lost
+     * ("unavailable") and the watchdog retries it
+     */
+    bool initialize();
+
+    /**
+     * Update a connected source. Returns nullptr when it has readings, or
+     * why it counts as lost ("exception" with the message in error, or
+     * "stalled"); the caller then calls markLost()
+     */
+    const char* pollSource(std::string& error);
+
+    bool retryDue() const { return sourceWatchdog.retryDue(clock.monotonicMicros()); }
+
+    /**
+     * Try to initialize a lost source again; the caller follows up with
+     * restored() or retryFailed()
+     */
+    bool reinitialize(std::string& error);
+
+    /**
+     * Read the source into latest(). Returns whether any reading changed
+     * since the last call (always true while no user is present)
+     */
+    bool process();
+
+    /**
+     * After process(): true once readings have been unchanged for the stale limit
+     */
+    bool stale(bool fresh) { return sourceWatchdog.stale(clock.monotonicMicros(), fresh); }
+
+    void markLost(const char* reason);
+    void retryFailed() { sourceWatchdog.retryFailed(clock.monotonicMicros()); }
+    const TrackerOutage& restored();
+
+    // --- Publishing (driving thread) ---
+
+    /**
+     * Put latest() into the ring and the history; returns its sequence
+     */
+    uint64_t publish();
+
+    const TobiiDataPacket& latest() const { return latestData; }
+    uint64_t latestMicros() const { return latestSampleMicros; }
+    const Ring& ring() const { return sampleRing; }
+    const GazePredictor& predictor() const { return gazePredictor; }
+    const Pose::PoseKernel& pose() const { return poseKernel; }
+    const TrackerWatchdog& watchdog() const { return sourceWatchdog; }
+    uint64_t processedCount() const { return processed.load(std::memory_order_relaxed); }
+
+    // --- Any thread ---
+
+    /**
+     * Sequence the next publish will get
+     */
+    uint64_t end() const { return publishedEnd.load(std::memory_order_acquire); }
+
+    /**
+     * Whether the ring slot of sequence holds that sample and has not
+     * started to be overwritten. Check it after reading the slot
+     */
+    bool readable(uint64_t sequence) const {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence < end() && writing.load(std::memory_order_relaxed) < sequence + RING_CAPACITY;
+    }
+
+    /**
+     * Plan a history query and hand each point with samples to emit, oldest first
+     */
+    template <typename Emit>
+    HistoryPyramid::Query readHistory(uint64_t fromMs, uint64_t toMs, size_t points, Emit&& emit) const {
+        std::lock_guard<std::mutex> lock(historyMutex);
+        const HistoryPyramid::Query query = history.plan(fromMs, toMs, points);
+        for (size_t i = 0; i < query.points; ++i) {
+            const HistoryBucket bucket = history.point(query, i);
+            if (bucket.samples > 0) emit(bucket);
+        }
+        return query;
+    }
+
+    /**
+     * Oldest and newest sample times held in the history (ms; 0 when empty)
+     */
+    uint64_t historyFirst() const;
+    uint64_t historyNewest() const;
+
+    /**
+     * Serialize a sample in a wire format into a caller buffer; returns the
+     * length, or 0 when it does not fit
+     */
+    static size_t encode(const TobiiDataPacket& sample, SampleFormat format, uint32_t streams,
+                         char* out, size_t capacity);
+};
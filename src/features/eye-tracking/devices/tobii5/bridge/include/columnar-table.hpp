@@ -0,0 +1,413 @@
+/**
+ * Columnar Table
+ * Typed, column-major result tables for offline analysis, with string
+ * columns dictionary-encoded (one code per row, each distinct value stored
+ * once), a compact binary file format and a group-by aggregator that keys
+ * on dictionary codes instead of strings
+ *
+ * File layout (little-endian):
+ *   "TBCOL1\0\0"  u32 columns  u64 rows
+ *   per column:   u8 type  u16 name length  name
+ *                 dictionary columns: u32 entries, then u16 length + bytes each
+ *                 rows values (u32 codes, u64 integers or f64 reals)
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class ColumnType : uint8_t { Dictionary = 1, UInt64 = 2, Float64 = 3 };
+
+struct Column {
+    std::string name;
+    ColumnType type;
+
+    std::vector<std::string> dictionary;
+    std::vector<uint32_t> codes;
+    std::vector<uint64_t> integers;
+    std::vector<double> reals;          // NaN = missing
+
+    Column(std::string name, ColumnType type) : name(std::move(name)), type(type) {}
+
+    size_t size() const {
+        switch (type) {
+        case ColumnType::Dictionary: return codes.size();
+        case ColumnType::UInt64: return integers.size();
+        case ColumnType::Float64: return reals.size();
+        }
+        return 0;
+    }
+
+    void push(const std::string& value) {
+        auto found = lookup.find(value);
+        if (found == lookup.end()) {
+            found = lookup.emplace(value, static_cast<uint32_t>(dictionary.size())).first;
+            dictionary.push_back(value);
+        }
+        codes.push_back(found->second);
+    }
+
+    void push(uint64_t value) { integers.push_back(value); }
+    void push(double value) { reals.push_back(value); }
+
+    /**
+     * Row value as a number (NaN for dictionary columns)
+     */
+    double number(size_t row) const {
+        if (type == ColumnType::UInt64) return static_cast<double>(integers[row]);
+        if (type == ColumnType::Float64) return reals[row];
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+
+    std::string text(size_t row) const {
+        if (type == ColumnType::Dictionary) return dictionary[codes[row]];
+        if (type == ColumnType::UInt64) return std::to_string(integers[row]);
+        if (std::isnan(reals[row])) return "";
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.10g", reals[row]);
+        return buffer;
+    }
+
+    void rebuildLookup() {
+        lookup.clear();
+        for (size_t i = 0; i < dictionary.size(); ++i) lookup.emplace(dictionary[i], static_cast<uint32_t>(i));
+    }
+
+private:
+    std::unordered_map<std::string, uint32_t> lookup;
+};
+
+class ColumnarTable {
+private:
+    static constexpr char MAGIC[8] = {'T', 'B', 'C', 'O', 'L', '1', '\0', '\0'};
+
+    std::deque<Column> columns;         // deque: addColumn references stay valid
+
+public:
+    Column& addColumn(const std::string& name, ColumnType type) {
+        if (find(name)) throw std::invalid_argument("duplicate column '" + name + "'");
+        columns.emplace_back(name, type);
+        return columns.back();
+    }
+
+    const Column* find(const std::string& name) const {
+        for (const Column& column : columns) {
+            if (column.name == name) return &column;
+        }
+        return nullptr;
+    }
+
+    const Column& column(const std::string& name) const {
+        const Column* found = find(name);
+        if (!found) throw std::invalid_argument("no column '" + name + "'");
+        return *found;
+    }
+
+    Column& column(size_t index) { return columns[index]; }
+    const Column& column(size_t index) const { return columns[index]; }
+    size_t columnCount() const { return columns.size(); }
+    size_t rows() const { return columns.empty() ? 0 : columns[0].size(); }
+
+    /**
+     * Throws std::runtime_error unless every column has the same length
+     */
+    void validate() const {
+        for (const Column& column : columns) {
+            if (column.size() != rows()) throw std::runtime_error("column '" + column.name + "' has a different length");
+            if (column.type != ColumnType::Dictionary) continue;
+            for (uint32_t code : column.codes) {
+                if (code >= column.dictionary.size()) throw std::runtime_error("column '" + column.name + "' has a bad code");
+            }
+        }
+    }
+
+    void write(const std::string& path) const {
+        validate();
+        std::ofstream out(path, std::ios::binary);
+        if (!out) throw std::runtime_error("cannot write " + path);
+
+        out.write(MAGIC, sizeof(MAGIC));
+        put<uint32_t>(out, static_cast<uint32_t>(columns.size()));
+        put<uint64_t>(out, rows());
+        for (const Column& column : columns) {
+            put<uint8_t>(out, static_cast<uint8_t>(column.type));
+            putText(out, column.name);
+            switch (column.type) {
+            case ColumnType::Dictionary:
+                put<uint32_t>(out, static_cast<uint32_t>(column.dictionary.size()));
+                for (const std::string& entry : column.dictionary) putText(out, entry);
+                putArray(out, column.codes);
+                break;
+            case ColumnType::UInt64:
+                putArray(out, column.integers);
+                break;
+            case ColumnType::Float64:
+                putArray(out, column.reals);
+                break;
+            }
+        }
+        if (!out) throw std::runtime_error("failed writing " + path);
+    }
+
+    /**
+     * Load a table; throws std::runtime_error on a missing or malformed file
+     */
+    static ColumnarTable read(const std::string& path) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) throw std::runtime_error("cannot open " + path);
+        std::vector<char> bytes(static_cast<size_t>(file.tellg()));
+        file.seekg(0);
+        if (!file.read(bytes.data(), static_cast<std::streamsize>(bytes.size()))) throw std::runtime_error("cannot read " + path);
+
+        Reader in{bytes, 0};
+        char magic[sizeof(MAGIC)];
+        in.raw(magic, sizeof(magic));
+        if (std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) throw std::runtime_error(path + " is not a columnar table");
+
+        ColumnarTable table;
+        const uint32_t columnCount = in.get<uint32_t>();
+        const uint64_t rowCount = in.get<uint64_t>();
+        for (uint32_t c = 0; c < columnCount; ++c) {
+            const uint8_t type = in.get<uint8_t>();
+            if (type < 1 || type > 3) throw std::runtime_error(path + ": unknown column type");
+            Column& column = table.addColumn(in.text(), static_cast<ColumnType>(type));
+            switch (column.type) {
+            case ColumnType::Dictionary: {
+                const uint32_t entries = in.get<uint32_t>();
+                for (uint32_t i = 0; i < entries; ++i) column.dictionary.push_back(in.text());
+                in.array(column.codes, rowCount);
+                column.rebuildLookup();
+                break;
+            }
+            case ColumnType::UInt64:
+                in.array(column.integers, rowCount);
+                break;
+            case ColumnType::Float64:
+                in.array(column.reals, rowCount);
+                break;
+            }
+        }
+        table.validate();
+        return table;
+    }
+
+private:
+    template <typename T>
+    static void put(std::ofstream& out, T value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    static void putText(std::ofstream& out, const std::string& text) {
+        if (text.size() > UINT16_MAX) throw std::invalid_argument("text too long for a columnar table");
+        put<uint16_t>(out, static_cast<uint16_t>(text.size()));
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+    }
+
+    template <typename T>
+    static void putArray(std::ofstream& out, const std::vector<T>& values) {
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    struct Reader {
+        const std::vector<char>& bytes;
+        size_t position;
+
+        void raw(void* out, size_t count) {
+            if (count > bytes.size() - position) throw std::runtime_error("columnar table is truncated");
+            std::memcpy(out, bytes.data() + position, count);
+            position += count;
+        }
+
+        template <typename T>
+        T get() {
+            T value;
+            raw(&value, sizeof(value));
+            return value;
+        }
+
+        std::string text() {
+            std::string value(get<uint16_t>(), '\0');
+            raw(value.data(), value.size());
+            return value;
+        }
+
+        template <typename T>
+        void array(std::vector<T>& values, uint64_t count) {
+            if (count > (bytes.size() - position) / sizeof(T)) throw std::runtime_error("columnar table is truncated");
+            values.resize(static_cast<size_t>(count));
+            raw(values.data(), values.size() * sizeof(T));
+        }
+    };
+};
+
+/**
+ * One output column of a group-by: count (rows per group) or
+ * sum/mean/min/max of a numeric column, skipping missing (NaN) values
+ */
+struct GroupAggregate {
+    enum class Op { Count, Sum, Mean, Min, Max };
+
+    Op op;
+    std::string column;
+
+    /**
+     * Parse "count" or "<op>:<column>"
+     */
+    static GroupAggregate parse(const std::string& spec) {
+        if (spec == "count") return {Op::Count, ""};
+        const size_t colon = spec.find(':');
+        if (colon == std::string::npos) throw std::invalid_argument("aggregate must be count or op:column, got '" + spec + "'");
+        const std::string op = spec.substr(0, colon);
+        const std::string column = spec.substr(colon + 1);
+        if (op == "sum") return {Op::Sum, column};
+        if (op == "mean") return {Op::Mean, column};
+        if (op == "min") return {Op::Min, column};
+        if (op == "max") return {Op::Max, column};
+        throw std::invalid_argument("unknown aggregate '" + op + "'");
+    }
+
+    std::string outputName() const {
+        switch (op) {
+        case Op::Count: return "count";
+        case Op::Sum: return "sum_" + column;
+        case Op::Mean: return "mean_" + column;
+        case Op::Min: return "min_" + column;
+        case Op::Max: return "max_" + column;
+        }
+        return column;
+    }
+};
+
+/**
+ * Group rows by dictionary columns and aggregate. Rows map to groups through
+ * their combined dictionary codes: a dense array when the key space is small,
+ * a hash map otherwise. Groups come out ordered by key text
+ */
+inline ColumnarTable groupBy(const ColumnarTable& table, const std::vector<std::string>& keys,
+                             const std::vector<GroupAggregate>& aggregates) {
+    std::vector<const Column*> keyColumns;
+    uint64_t keySpace = 1;
+    for (const std::string& name : keys) {
+        const Column& column = table.column(name);
+        if (column.type != ColumnType::Dictionary) throw std::invalid_argument("group key '" + name + "' is not a dictionary column");
+        keyColumns.push_back(&column);
+        const uint64_t radix = std::max<uint64_t>(column.dictionary.size(), 1);
+        keySpace = keySpace > UINT64_MAX / radix ? UINT64_MAX : keySpace * radix;
+    }
+
+    std::vector<const Column*> valueColumns;
+    for (const GroupAggregate& aggregate : aggregates) {
+        if (aggregate.op == GroupAggregate::Op::Count) {
+            valueColumns.push_back(nullptr);
+            continue;
+        }
+        const Column& column = table.column(aggregate.column);
+        if (column.type == ColumnType::Dictionary) throw std::invalid_argument("cannot aggregate dictionary column '" + aggregate.column + "'");
+        valueColumns.push_back(&column);
+    }
+
+    // Keys combine each column's rank in its sorted dictionary, so ordering
+    // groups by key orders them by key text without comparing strings
+    std::vector<std::vector<uint32_t>> ranks;
+    for (const Column* column : keyColumns) {
+        std::vector<uint32_t> sorted(column->dictionary.size());
+        std::iota(sorted.begin(), sorted.end(), 0u);
+        std::sort(sorted.begin(), sorted.end(),
+                  [column](uint32_t a, uint32_t b) { return column->dictionary[a] < column->dictionary[b]; });
+        ranks.emplace_back(sorted.size());
+        for (uint32_t rank = 0; rank < sorted.size(); ++rank) ranks.back()[sorted[rank]] = rank;
+    }
+
+    // Row -> group
+    constexpr uint64_t DENSE_LIMIT = 1u << 22;
+    std::vector<uint32_t> dense(keySpace <= DENSE_LIMIT ? keySpace : 0, UINT32_MAX);
+    std::unordered_map<uint64_t, uint32_t> sparse;
+    std::vector<size_t> firstRow;
+    std::vector<uint64_t> groupKey;
+    std::vector<uint32_t> rowGroup(table.rows());
+
+    for (size_t row = 0; row < table.rows(); ++row) {
+        uint64_t key = 0;
+        for (size_t k = 0; k < keyColumns.size(); ++k) {
+            key = key * std::max<uint64_t>(ranks[k].size(), 1) + ranks[k][keyColumns[k]->codes[row]];
+        }
+        uint32_t& slot = keySpace <= DENSE_LIMIT ? dense[key] : sparse.emplace(key, UINT32_MAX).first->second;
+        if (slot == UINT32_MAX) {
+            slot = static_cast<uint32_t>(firstRow.size());
+            firstRow.push_back(row);
+            groupKey.push_back(key);
+        }
+        rowGroup[row] = slot;
+    }
+
+    // Column-at-a-time accumulation
+    const size_t groups = firstRow.size();
+    std::vector<std::vector<double>> sums(aggregates.size()), extremes(aggregates.size());
+    std::vector<std::vector<uint64_t>> counts(aggregates.size());
+    for (size_t a = 0; a < aggregates.size(); ++a) {
+        const GroupAggregate::Op op = aggregates[a].op;
+        counts[a].assign(groups, 0);
+        sums[a].assign(groups, 0.0);
+        extremes[a].assign(groups, op == GroupAggregate::Op::Min ? std::numeric_limits<double>::infinity()
+                                                                 : -std::numeric_limits<double>::infinity());
+        const Column* values = valueColumns[a];
+        for (size_t row = 0; row < table.rows(); ++row) {
+            const uint32_t group = rowGroup[row];
+            if (!values) {
+                counts[a][group]++;
+                continue;
+            }
+            const double value = values->number(row);
+            if (std::isnan(value)) continue;
+            counts[a][group]++;
+            sums[a][group] += value;
+            if (op == GroupAggregate::Op::Min) extremes[a][group] = std::min(extremes[a][group], value);
+            if (op == GroupAggregate::Op::Max) extremes[a][group] = std::max(extremes[a][group], value);
+        }
+    }
+
+    std::vector<size_t> order(groups);
+    std::iota(order.begin(), order.end(), size_t(0));
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return groupKey[a] < groupKey[b]; });
+
+    ColumnarTable result;
+    for (const Column* key : keyColumns) {
+        Column& out = result.addColumn(key->name, ColumnType::Dictionary);
+        out.dictionary = key->dictionary;
+        out.rebuildLookup();
+        out.codes.reserve(groups);
+        for (size_t group : order) out.codes.push_back(key->codes[firstRow[group]]);
+    }
+    for (size_t a = 0; a < aggregates.size(); ++a) {
+        const GroupAggregate::Op op = aggregates[a].op;
+        Column& out = result.addColumn(aggregates[a].outputName(),
+                                       op == GroupAggregate::Op::Count ? ColumnType::UInt64 : ColumnType::Float64);
+        for (size_t group : order) {
+            const uint64_t count = counts[a][group];
+            switch (op) {
+            case GroupAggregate::Op::Count: out.push(count); break;
+            case GroupAggregate::Op::Sum: out.push(sums[a][group]); break;
+            case GroupAggregate::Op::Mean:
+                out.push(count ? sums[a][group] / count : std::numeric_limits<double>::quiet_NaN());
+                break;
+            case GroupAggregate::Op::Min:
+            case GroupAggregate::Op::Max:
+                out.push(count ? extremes[a][group] : std::numeric_limits<double>::quiet_NaN());
+                break;
+            }
+        }
+    }
+    return result;
+}
@@ -0,0 +1,263 @@
+/**
+ * Display Mapper
+ * Maps normalized gaze onto the display layouts clients register with
+ * set-display. Clients sharing a layout share one interned geometry, each
+ * geometry is reduced to an affine transform once, and every tick maps the
+ * gaze point through all transforms in one vectorizable pass
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "tobii-data-packet.hpp"
+#include "tracker-source.hpp"
+
+/**
+ * Gaze as a unit position on the tracked display (0..1 from the top-left)
+ */
+inline void unitGaze(GazeSpace space, float& x, float& y) {
+    if (space == GazeSpace::Centered) {
+        x = 0.5f * x + 0.5f;
+        y = 0.5f - 0.5f * y;
+    }
+}
+
+/**
+ * One monitor in desktop coordinates (physical pixels)
+ */
+struct DisplayRect {
+    float x = 0.0f, y = 0.0f;
+    float width = 0.0f, height = 0.0f;
+    float scale = 1.0f;                 // DPI scale (physical pixels per logical pixel)
+
+    bool operator==(const DisplayRect& other) const {
+        return x == other.x && y == other.y && width == other.width &&
+               height == other.height && scale == other.scale;
+    }
+};
+
+/**
+ * A client's desktop layout and the monitor the tracker is mounted on
+ */
+struct DisplayGeometry {
+    static constexpr size_t MAX_DISPLAYS = 16;
+
+    std::vector<DisplayRect> displays;
+    size_t tracked = 0;
+    bool logical = false;               // report logical pixels (divided by the display's scale)
+
+    bool operator==(const DisplayGeometry& other) const {
+        return displays == other.displays && tracked == other.tracked && logical == other.logical;
+    }
+
+    /**
+     * Parse set-display data; throws std::invalid_argument describing the
+     * first bad value. An empty display list means "no geometry"
+     */
+    static DisplayGeometry fromJson(const nlohmann::json& data) {
+        DisplayGeometry geometry;
+        if (!data.is_object()) throw std::invalid_argument("display data must be an object");
+
+        const nlohmann::json displays = data.value("displays", nlohmann::json::array());
+        if (!displays.is_array()) throw std::invalid_argument("displays must be an array");
+        if (displays.size() > MAX_DISPLAYS) throw std::invalid_argument("at most 16 displays are supported");
+
+        for (const auto& entry : displays) {
+            if (!entry.is_object()) throw std::invalid_argument("each display must be an object");
+            DisplayRect rect;
+            rect.x = entry.value("x", 0.0f);
+            rect.y = entry.value("y", 0.0f);
+            rect.width = entry.value("width", 0.0f);
+            rect.height = entry.value("height", 0.0f);
+            rect.scale = entry.value("scale", 1.0f);
+            if (!(rect.width > 0.0f) || !(rect.height > 0.0f)) {
+                throw std::invalid_argument("display width and height must be positive");
+            }
+            if (!(rect.scale > 0.0f)) throw std::invalid_argument("display scale must be positive");
+            geometry.displays.push_back(rect);
+        }
+
+        geometry.tracked = data.value("tracked", 0u);
+        if (!geometry.displays.empty() && geometry.tracked >= geometry.displays.size()) {
+            throw std::invalid_argument("tracked must index a display");
+        }
+
+        const std::string units = data.value("units", "physical");
+        if (units != "physical" && units != "logical") {
+            throw std::invalid_argument("units must be physical or logical");
+        }
+        geometry.logical = units == "logical";
+        return geometry;
+    }
+
+    nlohmann::json toJson() const {
+        nlohmann::json out;
+        out["displays"] = nlohmann::json::array();
+        for (const DisplayRect& rect : displays) {
+            out["displays"].push_back({{"x", rect.x}, {"y", rect.y}, {"width", rect.width},
+                                       {"height", rect.height}, {"scale", rect.scale}});
+        }
+        out["tracked"] = tracked;
+        out["units"] = logical ? "logical" : "physical";
+        return out;
+    }
+};
+
+class DisplayMapper {
+public:
+    static constexpr size_t MAX_GEOMETRIES = 64;
+
+private:
+    struct Entry {
+        DisplayGeometry geometry;
+        size_t users = 0;
+    };
+
+    std::vector<Entry> entries;         // slot per geometry; users == 0 marks a free slot
+    size_t slotsInUse;                  // one past the highest slot ever used
+
+    // Desktop position = a * gaze + b, per geometry (structure of arrays)
+    float ax[MAX_GEOMETRIES], bx[MAX_GEOMETRIES];
+    float ay[MAX_GEOMETRIES], by[MAX_GEOMETRIES];
+
+    // Latest mapAll result
+    bool mappedValid;
+    float mappedX[MAX_GEOMETRIES], mappedY[MAX_GEOMETRIES];
+
+public:
+    DisplayMapper() : entries(MAX_GEOMETRIES), slotsInUse(0), ax(), bx(), ay(), by(),
+                      mappedValid(false), mappedX(), mappedY() {}
+
+    /**
+     * Share or intern geometry; returns its index, or -1 when every slot is
+     * taken by a different layout
+     */
+    int acquire(const DisplayGeometry& geometry, GazeSpace space) {
+        int freeSlot = -1;
+        for (size_t i = 0; i < slotsInUse; ++i) {
+            if (entries[i].users > 0 && entries[i].geometry == geometry) {
+                entries[i].users++;
+                return static_cast<int>(i);
+            }
+            if (entries[i].users == 0 && freeSlot < 0) freeSlot = static_cast<int>(i);
+        }
+        if (freeSlot < 0) {
+            if (slotsInUse == MAX_GEOMETRIES) return -1;
+            freeSlot = static_cast<int>(slotsInUse++);
+        }
+
+        Entry& entry = entries[freeSlot];
+        entry.geometry = geometry;
+        entry.users = 1;
+
+        // Gaze to a unit position on the tracked display (u = su * x + ou, v = sv * y + ov)
+        const bool centered = space == GazeSpace::Centered;
+        const float su = centered ? 0.5f : 1.0f, ou = centered ? 0.5f : 0.0f;
+        const float sv = centered ? -0.5f : 1.0f, ov = centered ? 0.5f : 0.0f;
+
+        const DisplayRect& rect = geometry.displays[geometry.tracked];
+        ax[freeSlot] = rect.width * su;
+        bx[freeSlot] = rect.x + rect.width * ou;
+        ay[freeSlot] = rect.height * sv;
+        by[freeSlot] = rect.y + rect.height * ov;
+        mappedValid = false;
+        return freeSlot;
+    }
+
+    void release(int index) {
+        if (index < 0 || static_cast<size_t>(index) >= slotsInUse) return;
+        Entry& entry = entries[index];
+        if (entry.users > 0 && --entry.users == 0) {
+            entry.geometry = DisplayGeometry();
+            while (slotsInUse > 0 && entries[slotsInUse - 1].users == 0) slotsInUse--;
+        }
+    }
+
+    const DisplayGeometry& geometry(int index) const { return entries[index].geometry; }
+
+    size_t size() const {
+        size_t count = 0;
+        for (size_t i = 0; i < slotsInUse; ++i) count += entries[i].users > 0 ? 1 : 0;
+        return count;
+    }
+
+    /**
+     * Map the tick's gaze point through every geometry at once
+     */
+    void mapAll(const TobiiDataPacket& sample) {
+        mappedValid = sample.hasGaze;
+        if (!mappedValid) return;
+
+        const float gx = sample.gazeX;
+        const float gy = sample.gazeY;
+        const size_t count = slotsInUse;
+        for (size_t i = 0; i < count; ++i) {
+            mappedX[i] = ax[i] * gx + bx[i];
+            mappedY[i] = ay[i] * gy + by[i];
+        }
+    }
+
+    /**
+     * Fill sample's screen fields for geometry index from the last mapAll
+     * (the live sample)
+     */
+    void applyMapped(int index, TobiiDataPacket& sample) const {
+        if (!mappedValid) {
+            clearScreen(sample);
+            return;
+        }
+        place(entries[index].geometry, mappedX[index], mappedY[index], sample);
+    }
+
+    /**
+     * Map a single sample (history replay)
+     */
+    void apply(int index, TobiiDataPacket& sample) const {
+        if (!sample.hasGaze) {
+            clearScreen(sample);
+            return;
+        }
+        place(entries[index].geometry, ax[index] * sample.gazeX + bx[index],
+              ay[index] * sample.gazeY + by[index], sample);
+    }
+
+private:
+    static void clearScreen(TobiiDataPacket& sample) {
+        sample.gazeDisplay = -1;
+        sample.gazeScreenX = sample.gazeScreenY = 0.0f;
+        sample.gazeScreenU = sample.gazeScreenV = 0.0f;
+    }
+
+    /**
+     * Resolve the display under a desktop position; u/v are relative to that
+     * display, or to the tracked one (display -1) when the gaze falls off
+     * every monitor
+     */
+    static void place(const DisplayGeometry& geometry, float x, float y, TobiiDataPacket& sample) {
+        size_t hit = geometry.tracked;
+        int32_t display = -1;
+        for (size_t d = 0; d < geometry.displays.size(); ++d) {
+            const DisplayRect& rect = geometry.displays[d];
+            if (x >= rect.x && x < rect.x + rect.width && y >= rect.y && y < rect.y + rect.height) {
+                hit = d;
+                display = static_cast<int32_t>(d);
+                break;
+            }
+        }
+
+        const DisplayRect& rect = geometry.displays[hit];
+        const float scale = geometry.logical ? rect.scale : 1.0f;
+        sample.gazeDisplay = display;
+        sample.gazeScreenX = x / scale;
+        sample.gazeScreenY = y / scale;
+        sample.gazeScreenU = (x - rect.x) / rect.width;
+        sample.gazeScreenV = (y - rect.y) / rect.height;
+    }
+};
@@ -0,0 +1,226 @@
+/**
+ * Fault Injection
+ * Tracker source decorator that reproduces misbehaving hardware on top of
+ * any other source: dropout bursts, extra gaze jitter, gaze clock steps,
+ * stalled update() calls, NaN readings, presence flapping and device
+ * disconnects that initialize() cannot undo until they end. Used with
+ * --faults to check that acquisition, filters, recording and fan-out stay
+ * within their budgets on degraded input
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "bridge-clock.hpp"
+#include "tracker-source.hpp"
+
+/**
+ * A fault that starts at random (rate per second) and lasts durationMs
+ */
+struct FaultBurst {
+    double perSecond = 0.0;
+    uint64_t durationMs = 0;
+};
+
+struct FaultSettings {
+    FaultBurst dropout;         // no gaze or head readings
+    FaultBurst clockStep;       // gaze timestamps jump by +/- durationMs
+    FaultBurst stall;           // update() blocks for durationMs
+    FaultBurst presenceFlap;    // presence reads false
+    FaultBurst disconnect;      // readings freeze and initialize() fails
+    float jitter = 0.0f;        // extra gaze noise (sigma, display units)
+    double nanRatio = 0.0;      // readings returned with NaN values
+    uint32_t seed = 7u;
+
+    bool any() const {
+        return dropout.perSecond > 0.0 || clockStep.perSecond > 0.0 || stall.perSecond > 0.0 ||
+               presenceFlap.perSecond > 0.0 || disconnect.perSecond > 0.0 || jitter > 0.0f || nanRatio > 0.0;
+    }
+
+    /**
+     * Parse "dropout=2:150,jitter=0.01,clock_step=0.1:500,stall=0.5:40,
+     * nan=0.01,presence_flap=0.2:300,disconnect=0.01:5000,seed=3"; throws
+     * std::invalid_argument
+     */
+    static FaultSettings parse(const std::string& spec) {
+        FaultSettings settings;
+        size_t start = 0;
+        while (start < spec.size()) {
+            const size_t comma = std::min(spec.find(',', start), spec.size());
+            const std::string item = spec.substr(start, comma - start);
+            start = comma + 1;
+            if (item.empty()) continue;
+
+            const size_t equals = item.find('=');
+            if (equals == std::string::npos) throw std::invalid_argument("fault '" + item + "' needs a value");
+            const std::string name = item.substr(0, equals);
+            const std::string value = item.substr(equals + 1);
+
+            if (name == "dropout") settings.dropout = parseBurst(name, value);
+            else if (name == "clock_step") settings.clockStep = parseBurst(name, value);
+            else if (name == "stall") settings.stall = parseBurst(name, value);
+            else if (name == "presence_flap") settings.presenceFlap = parseBurst(name, value);
+            else if (name == "disconnect") settings.disconnect = parseBurst(name, value);
+            else if (name == "jitter") settings.jitter = static_cast<float>(parseNumber(name, value, 0.0, 1.0));
+            else if (name == "nan") settings.nanRatio = parseNumber(name, value, 0.0, 1.0);
+            else if (name == "seed") settings.seed = static_cast<uint32_t>(parseNumber(name, value, 0.0, 4294967295.0));
+            else throw std::invalid_argument("unknown fault '" + name + "'");
+        }
+        return settings;
+    }
+
+private:
+    static double parseNumber(const std::string& name, const std::string& text, double min, double max) {
+        size_t used = 0;
+        double value;
+        try {
+            value = std::stod(text, &used);
+        } catch (const std::exception&) {
+            used = 0;
+        }
+        if (used == 0 || used != text.size() || !(value >= min && value <= max)) {
+            throw std::invalid_argument("fault '" + name + "' has a bad value '" + text + "'");
+        }
+        return value;
+    }
+
+    static FaultBurst parseBurst(const std::string& name, const std::string& value) {
+        const size_t colon = value.find(':');
+        if (colon == std::string::npos) throw std::invalid_argument("fault '" + name + "' must be <per_second>:<ms>");
+        FaultBurst burst;
+        burst.perSecond = parseNumber(name, value.substr(0, colon), 0.0, 1000.0);
+        burst.durationMs = static_cast<uint64_t>(parseNumber(name, value.substr(colon + 1), 0.0, 60000.0));
+        return burst;
+    }
+};
+
+/**
+ * Faults injected so far
+ */
+struct FaultCounts {
+    uint64_t dropouts = 0;
+    uint64_t clockSteps = 0;
+    uint64_t stalls = 0;
+    uint64_t presenceFlaps = 0;
+    uint64_t nanReadings = 0;
+    uint64_t disconnects = 0;
+};
+
+class FaultInjectingSource : public TrackerSource {
+private:
+    std::unique_ptr<TrackerSource> inner;
+    BridgeClock& clock;
+    FaultSettings settings;
+    FaultCounts counts;
+    std::string label;
+
+    std::mt19937 rng;
+    std::uniform_real_distribution<double> unit;
+    std::normal_distribution<float> noise;
+
+    // Monotonic microseconds on the bridge clock
+    uint64_t lastUpdate;
+    uint64_t dropoutUntil;
+    uint64_t absentUntil;
+    uint64_t disconnectedUntil;
+    int64_t clockOffsetMicros;
+
+public:
+    FaultInjectingSource(std::unique_ptr<TrackerSource> inner, const FaultSettings& settings,
+                         BridgeClock& clock = BridgeClock::system())
+        : inner(std::move(inner)), clock(clock), settings(settings), label(std::string(this->inner->name()) + "+faults"),
+          rng(settings.seed), unit(0.0, 1.0), noise(0.0f, settings.jitter > 0.0f ? settings.jitter : 1.0f),
+          lastUpdate(0), dropoutUntil(0), absentUntil(0), disconnectedUntil(0), clockOffsetMicros(0) {}
+
+    const char* name() const override { return label.c_str(); }
+    GazeSpace gazeSpace() const override { return inner->gazeSpace(); }
+    const FaultCounts& faults() const { return counts; }
+
+    bool initialize() override {
+        const uint64_t now = clock.monotonicMicros();
+        if (now < disconnectedUntil) return false;
+        lastUpdate = dropoutUntil = absentUntil = now;
+        return inner->initialize();
+    }
+
+    void update() override {
+        uint64_t now = clock.monotonicMicros();
+        const double elapsed = static_cast<double>(now - lastUpdate) * 1e-6;
+        lastUpdate = now;
+
+        if (starts(settings.stall, elapsed)) {
+            counts.stalls++;
+            clock.sleepFor(settings.stall.durationMs * 1000);
+            now = lastUpdate = clock.monotonicMicros();
+        }
+        if (starts(settings.dropout, elapsed)) {
+            counts.dropouts++;
+            dropoutUntil = now + settings.dropout.durationMs * 1000;
+        }
+        if (starts(settings.presenceFlap, elapsed)) {
+            counts.presenceFlaps++;
+            absentUntil = now + settings.presenceFlap.durationMs * 1000;
+        }
+        if (now >= disconnectedUntil && starts(settings.disconnect, elapsed)) {
+            counts.disconnects++;
+            disconnectedUntil = now + settings.disconnect.durationMs * 1000;
+        }
+        // A disconnected device repeats its last readings, as TGI does
+        if (now < disconnectedUntil) return;
+        if (starts(settings.clockStep, elapsed)) {
+            counts.clockSteps++;
+            const int64_t step = static_cast<int64_t>(settings.clockStep.durationMs) * 1000;
+            clockOffsetMicros += unit(rng) < 0.5 ? -step : step;
+        }
+
+        inner->update();
+    }
+
+    bool getLatestGaze(GazeReading& out) override {
+        if (dropping() || !inner->getLatestGaze(out)) return false;
+
+        if (settings.jitter > 0.0f) {
+            out.x += noise(rng);
+            out.y += noise(rng);
+        }
+        // A backward step can take the timestamp below zero; it wraps like a bad device clock would
+        out.timestamp = static_cast<uint64_t>(static_cast<int64_t>(out.timestamp) + clockOffsetMicros);
+        if (corrupt()) {
+            out.x = std::numeric_limits<float>::quiet_NaN();
+        }
+        return true;
+    }
+
+    bool getLatestHead(HeadReading& out) override {
+        if (dropping() || !inner->getLatestHead(out)) return false;
+        if (corrupt()) {
+            out.yaw = std::numeric_limits<float>::quiet_NaN();
+            out.posZ = std::numeric_limits<float>::infinity();
+        }
+        return true;
+    }
+
+    bool isPresent() override {
+        return lastUpdate >= absentUntil && inner->isPresent();
+    }
+
+private:
+    bool starts(const FaultBurst& burst, double elapsedSeconds) {
+        return burst.perSecond > 0.0 && unit(rng) < burst.perSecond * elapsedSeconds;
+    }
+
+    bool dropping() const { return lastUpdate < dropoutUntil; }
+
+    bool corrupt() {
+        if (settings.nanRatio <= 0.0 || unit(rng) >= settings.nanRatio) return false;
+        counts.nanReadings++;
+        return true;
+    }
+};
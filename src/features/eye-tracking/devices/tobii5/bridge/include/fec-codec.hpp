@@ -0,0 +1,539 @@
+/**
+ * FEC Codec
+ * Forward error correction for the multicast sample stream, where a NACK
+ * from every receiver would not scale. Each group of K sample datagrams is
+ * followed by M parity datagrams, and a receiver holding any K of the K + M
+ * rebuilds the rest without asking. The code is systematic over GF(2^8):
+ * parity j is the sum of coefficient(j, i) * data symbol i, with the
+ * coefficients a Cauchy matrix scaled so that row 0 is all ones. Every
+ * square submatrix stays invertible, so any M losses in a group are
+ * recoverable, and with M = 1 the parity is plain XOR.
+ *
+ * A data symbol is the sample frame behind its u16 length, zero-padded to
+ * the longest symbol of the group. The byte kernels multiply 16 bytes at a
+ * time with SSSE3 nibble lookups when the CPU has them and XOR in 64-bit
+ * words the compiler widens further
+ *
+ *   parity   'T' 'S' version 19, first u64, k u8, m u8, index u8, 0 u8,
+ *            symbol size u16, symbol
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "udp-stream.hpp"
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#include <tmmintrin.h>
+#define FEC_SSSE3 1
+#define FEC_SSSE3_TARGET
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__)
+#include <tmmintrin.h>
+#define FEC_SSSE3 1
+#define FEC_SSSE3_TARGET __attribute__((target("ssse3")))
+#endif
+
+namespace Fec {
+
+constexpr size_t MAX_GROUP = 32;
+constexpr size_t MAX_PARITY = 8;
+constexpr size_t LENGTH_SIZE = 2;
+constexpr size_t PARITY_HEADER_SIZE = UdpStream::HEADER_SIZE + 8 + 4 + 2;
+constexpr size_t MAX_SYMBOL = UdpStream::MAX_DATAGRAM - PARITY_HEADER_SIZE;
+
+/**
+ * GF(2^8) arithmetic over x^8 + x^4 + x^3 + x^2 + 1, with per-constant
+ * nibble product tables and the code's coefficients; built once
+ */
+struct Field {
+    uint8_t exp[512];
+    uint8_t log[256];
+    uint8_t low[256][16];       // c * n for a low nibble n
+    uint8_t high[256][16];      // c * (n << 4)
+    uint8_t coefficients[MAX_PARITY][MAX_GROUP];
+
+    Field() : exp(), log(), low(), high(), coefficients() {
+        unsigned x = 1;
+        for (unsigned i = 0; i < 255; ++i) {
+            exp[i] = exp[i + 255] = static_cast<uint8_t>(x);
+            log[x] = static_cast<uint8_t>(i);
+            x <<= 1;
+            if (x & 0x100) x ^= 0x11d;
+        }
+        for (unsigned c = 0; c < 256; ++c) {
+            for (unsigned n = 0; n < 16; ++n) {
+                low[c][n] = mul(static_cast<uint8_t>(c), static_cast<uint8_t>(n));
+                high[c][n] = mul(static_cast<uint8_t>(c), static_cast<uint8_t>(n << 4));
+            }
+        }
+        // Cauchy 1 / (x_j + y_i) with x_j = j and y_i = MAX_PARITY + i, column i scaled by y_i
+        for (size_t j = 0; j < MAX_PARITY; ++j) {
+            for (size_t i = 0; i < MAX_GROUP; ++i) {
+                const uint8_t y = static_cast<uint8_t>(MAX_PARITY + i);
+                coefficients[j][i] = mul(y, inverse(static_cast<uint8_t>(j ^ y)));
+            }
+        }
+    }
+
+    uint8_t mul(uint8_t a, uint8_t b) const { return a == 0 || b == 0 ? 0 : exp[log[a] + log[b]]; }
+    uint8_t inverse(uint8_t a) const { return exp[255 - log[a]]; }
+};
+
+inline const Field& field() {
+    static const Field instance;
+    return instance;
+}
+
+inline bool cpuHasSsse3() {
+#if defined(FEC_SSSE3) && defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 9)) != 0;
+#elif defined(FEC_SSSE3)
+    return __builtin_cpu_supports("ssse3");
+#else
+    return false;
+#endif
+}
+
+inline bool vectorized() {
+    static const bool ssse3 = cpuHasSsse3();
+    return ssse3;
+}
+
+inline const char* kernelName() { return vectorized() ? "ssse3" : "scalar"; }
+
+/**
+ * dst ^= src
+ */
+inline void addInto(uint8_t* dst, const uint8_t* src, size_t size) {
+    size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t a;
+        uint64_t b;
+        std::memcpy(&a, dst + i, 8);
+        std::memcpy(&b, src + i, 8);
+        a ^= b;
+        std::memcpy(dst + i, &a, 8);
+    }
+    for (; i < size; ++i) dst[i] ^= src[i];
+}
+
+#ifdef FEC_SSSE3
+/**
+ * The 16-byte blocks of mulAddInto; returns the bytes done
+ */
+FEC_SSSE3_TARGET inline size_t mulAddSsse3(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) {
+    const Field& gf = field();
+    const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gf.low[c]));
+    const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(gf.high[c]));
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i product = _mm_xor_si128(_mm_shuffle_epi8(low, _mm_and_si128(x, nibble)),
+                                              _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi64(x, 4), nibble)));
+        __m128i* out = reinterpret_cast<__m128i*>(dst + i);
+        _mm_storeu_si128(out, _mm_xor_si128(_mm_loadu_si128(out), product));
+    }
+    return i;
+}
+#endif
+
+/**
+ * dst ^= c * src
+ */
+inline void mulAddInto(uint8_t* dst, const uint8_t* src, uint8_t c, size_t size) {
+    if (c == 0) return;
+    if (c == 1) {
+        addInto(dst, src, size);
+        return;
+    }
+    size_t i = 0;
+#ifdef FEC_SSSE3
+    if (vectorized()) i = mulAddSsse3(dst, src, c, size);
+#endif
+    const uint8_t* low = field().low[c];
+    const uint8_t* high = field().high[c];
+    for (; i < size; ++i) dst[i] ^= low[src[i] & 0x0f] ^ high[src[i] >> 4];
+}
+
+using Matrix = uint8_t[MAX_PARITY][MAX_PARITY];
+
+/**
+ * Invert the top-left n x n of in into out; false if it is singular
+ */
+inline bool invert(const Matrix& in, Matrix& out, size_t n) {
+    const Field& gf = field();
+    Matrix a;
+    for (size_t r = 0; r < n; ++r) {
+        for (size_t c = 0; c < n; ++c) {
+            a[r][c] = in[r][c];
+            out[r][c] = r == c ? 1 : 0;
+        }
+    }
+    for (size_t col = 0; col < n; ++col) {
+        size_t pivot = col;
+        while (pivot < n && a[pivot][col] == 0) pivot++;
+        if (pivot == n) return false;
+        for (size_t c = 0; c < n; ++c) {
+            std::swap(a[pivot][c], a[col][c]);
+            std::swap(out[pivot][c], out[col][c]);
+        }
+        const uint8_t scale = gf.inverse(a[col][col]);
+        for (size_t c = 0; c < n; ++c) {
+            a[col][c] = gf.mul(a[col][c], scale);
+            out[col][c] = gf.mul(out[col][c], scale);
+        }
+        for (size_t r = 0; r < n; ++r) {
+            const uint8_t factor = a[r][col];
+            if (r == col || factor == 0) continue;
+            for (size_t c = 0; c < n; ++c) {
+                a[r][c] ^= gf.mul(factor, a[col][c]);
+                out[r][c] ^= gf.mul(factor, out[col][c]);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Sender side: folds each sample frame into the running parity of its
+ * group as it is sent. No allocation
+ */
+class Encoder {
+private:
+    std::array<std::array<uint8_t, MAX_SYMBOL>, MAX_PARITY> parity;
+    size_t groupSize;
+    size_t parityCount;
+    uint64_t first;
+    size_t count;
+    size_t symbolSize;
+
+public:
+    Encoder() : parity(), groupSize(0), parityCount(0), first(0), count(0), symbolSize(0) {}
+
+    size_t k() const { return groupSize; }
+    size_t m() const { return parityCount; }
+
+    /**
+     * Start over with groups of k data and m parity symbols; m = 0 is off
+     */
+    void configure(size_t k, size_t m) {
+        groupSize = std::min(k, MAX_GROUP);
+        parityCount = std::min(m, MAX_PARITY);
+        count = 0;
+    }
+
+    /**
+     * Add the frame sent as sequence. True when it completes a group, whose
+     * parity datagrams writeParity then produces; a gap in the sequence or
+     * a frame too long for a symbol starts the group over
+     */
+    bool add(uint64_t sequence, const char* frame, size_t length) {
+        if (parityCount == 0 || groupSize == 0) return false;
+        if (length + LENGTH_SIZE > MAX_SYMBOL) {
+            count = 0;
+            return false;
+        }
+        if (count == groupSize || (count > 0 && sequence != first + count)) count = 0;
+        if (count == 0) {
+            for (size_t j = 0; j < parityCount; ++j) std::memset(parity[j].data(), 0, symbolSize);
+            first = sequence;
+            symbolSize = 0;
+        }
+        const uint8_t prefix[LENGTH_SIZE] = {static_cast<uint8_t>(length), static_cast<uint8_t>(length >> 8)};
+        const uint8_t* bytes = reinterpret_cast<const uint8_t*>(frame);
+        for (size_t j = 0; j < parityCount; ++j) {
+            const uint8_t c = field().coefficients[j][count];
+            mulAddInto(parity[j].data(), prefix, c, LENGTH_SIZE);
+            mulAddInto(parity[j].data() + LENGTH_SIZE, bytes, c, length);
+        }
+        symbolSize = std::max(symbolSize, length + LENGTH_SIZE);
+        return ++count == groupSize;
+    }
+
+    /**
+     * Parity datagram index (< m) of the group add just completed
+     */
+    size_t writeParity(char* out, size_t index) const {
+        UdpStream::writeHeader(out, UdpStream::Kind::Parity);
+        UdpStream::put<uint64_t>(out + UdpStream::HEADER_SIZE, first);
+        out[UdpStream::HEADER_SIZE + 8] = static_cast<char>(groupSize);
+        out[UdpStream::HEADER_SIZE + 9] = static_cast<char>(parityCount);
+        out[UdpStream::HEADER_SIZE + 10] = static_cast<char>(index);
+        out[UdpStream::HEADER_SIZE + 11] = 0;
+        UdpStream::put<uint16_t>(out + UdpStream::HEADER_SIZE + 12, static_cast<uint16_t>(symbolSize));
+        std::memcpy(out + PARITY_HEADER_SIZE, parity[index].data(), symbolSize);
+        return PARITY_HEADER_SIZE + symbolSize;
+    }
+};
+
+struct ReceiverStats {
+    uint64_t received = 0;      // samples that arrived
+    uint64_t recovered = 0;     // samples rebuilt from parity
+    uint64_t lost = 0;          // missing and past recovery
+    uint64_t parity = 0;        // parity datagrams taken
+    uint64_t duplicates = 0;
+};
+
+/**
+ * Reference receiver side: keeps the last Window sample symbols and the
+ * parity of the last few groups, delivers samples as they arrive and
+ * rebuilds missing ones as soon as a group holds enough symbols (flagged,
+ * out of order). No allocation after construction
+ */
+template <size_t Window = 64>
+class Receiver {
+    static_assert((Window & (Window - 1)) == 0, "Receiver window must be a power of two");
+    static_assert(Window >= 2 * MAX_GROUP, "Receiver window must hold two groups");
+
+private:
+    enum class Slot : uint8_t { Empty, Received, Missing };
+
+    struct Group {
+        uint64_t first = 0;
+        size_t k = 0;
+        size_t m = 0;
+        size_t size = 0;            // symbol size
+        uint32_t present = 0;       // parity indices held
+        bool used = false;
+        bool done = false;          // recovered, complete or given up on
+        std::array<std::array<uint8_t, MAX_SYMBOL>, MAX_PARITY> parity;
+    };
+
+    static constexpr size_t GROUPS = 4;
+
+    std::array<std::array<uint8_t, MAX_SYMBOL>, Window> symbols;
+    std::array<uint16_t, Window> lengths;       // symbol bytes, length prefix included
+    std::array<uint64_t, Window> tag;           // sequence the slot holds
+    std::array<Slot, Window> state;
+    std::array<Group, GROUPS> groups;
+    std::array<std::array<uint8_t, MAX_SYMBOL>, MAX_PARITY> work;
+    uint64_t next;                              // one past the newest sequence seen
+    bool started;
+    ReceiverStats counters;
+
+public:
+    Receiver() : symbols(), lengths(), tag(), state(), groups(), work(), next(0), started(false), counters() {}
+
+    const ReceiverStats& stats() const { return counters; }
+    uint64_t end() const { return next; }
+
+    /**
+     * Take one datagram of the multicast stream. Samples go to
+     * deliver(sequence, frame, size, recovered) once each; returns false
+     * for anything that is not this protocol
+     */
+    template <typename Deliver>
+    bool receive(const char* data, size_t size, Deliver&& deliver) {
+        using UdpStream::Kind;
+        const uint8_t kind = UdpStream::kindOf(data, size);
+        if (kind == static_cast<uint8_t>(Kind::Parity)) {
+            takeParity(data, size, deliver);
+            return true;
+        }
+        if ((kind != static_cast<uint8_t>(Kind::Sample) && kind != static_cast<uint8_t>(Kind::Retransmit)) ||
+            size < UdpStream::SAMPLE_HEADER_SIZE) {
+            return kind != 0;
+        }
+        const uint64_t sequence = UdpStream::get<uint64_t>(data + UdpStream::HEADER_SIZE);
+        const char* frame = data + UdpStream::SAMPLE_HEADER_SIZE;
+        const size_t length = size - UdpStream::SAMPLE_HEADER_SIZE;
+
+        // First sample, or the bridge restarted and counts from 0 again
+        if (!started || sequence + Window < next) {
+            started = true;
+            state.fill(Slot::Empty);
+            for (auto& group : groups) group.used = false;
+            next = sequence;
+        }
+        if (sequence >= next) {
+            advance(sequence);
+        } else if (!holds(sequence) || tag[slot(sequence)] != sequence || state[slot(sequence)] != Slot::Missing) {
+            counters.duplicates++;
+            return true;
+        }
+        if (length + LENGTH_SIZE <= MAX_SYMBOL) {
+            const size_t s = slot(sequence);
+            symbols[s][0] = static_cast<uint8_t>(length);
+            symbols[s][1] = static_cast<uint8_t>(length >> 8);
+            std::memcpy(symbols[s].data() + LENGTH_SIZE, frame, length);
+            lengths[s] = static_cast<uint16_t>(length + LENGTH_SIZE);
+        } else {
+            lengths[slot(sequence)] = 0;    // too long for a symbol, so in no group
+        }
+        tag[slot(sequence)] = sequence;
+        state[slot(sequence)] = Slot::Received;
+        counters.received++;
+        deliver(sequence, frame, length, false);
+
+        for (auto& group : groups) {
+            if (group.used && !group.done && sequence >= group.first && sequence < group.first + group.k) {
+                recover(group, deliver);
+            }
+        }
+        return true;
+    }
+
+private:
+    static size_t slot(uint64_t sequence) { return static_cast<size_t>(sequence & (Window - 1)); }
+
+    bool holds(uint64_t sequence) const { return sequence < next && sequence + Window > next; }
+
+    /**
+     * Move the newest sequence up to sequence; everything skipped is missing
+     * and slots pushed out of the window are settled
+     */
+    void advance(uint64_t sequence) {
+        uint64_t gap = next;
+        if (sequence - next >= Window) {
+            counters.lost += sequence - (Window - 1) - next;
+            gap = sequence - (Window - 1);
+        }
+        for (; gap < sequence; ++gap) {
+            retire(gap);
+            tag[slot(gap)] = gap;
+            state[slot(gap)] = Slot::Missing;
+        }
+        retire(sequence);
+        next = sequence + 1;
+    }
+
+    void retire(uint64_t sequence) {
+        const size_t s = slot(sequence);
+        if (state[s] == Slot::Missing && tag[s] != sequence) counters.lost++;
+        state[s] = Slot::Empty;
+    }
+
+    bool has(uint64_t sequence) const {
+        return holds(sequence) && tag[slot(sequence)] == sequence && state[slot(sequence)] == Slot::Received;
+    }
+
+    template <typename Deliver>
+    void takeParity(const char* data, size_t size, Deliver& deliver) {
+        if (size < PARITY_HEADER_SIZE) return;
+        const uint64_t first = UdpStream::get<uint64_t>(data + UdpStream::HEADER_SIZE);
+        const size_t k = static_cast<uint8_t>(data[UdpStream::HEADER_SIZE + 8]);
+        const size_t m = static_cast<uint8_t>(data[UdpStream::HEADER_SIZE + 9]);
+        const size_t index = static_cast<uint8_t>(data[UdpStream::HEADER_SIZE + 10]);
+        const size_t symbolSize = UdpStream::get<uint16_t>(data + UdpStream::HEADER_SIZE + 12);
+        if (k == 0 || k > MAX_GROUP || m == 0 || m > MAX_PARITY || index >= m || symbolSize < LENGTH_SIZE ||
+            symbolSize > MAX_SYMBOL || size != PARITY_HEADER_SIZE + symbolSize) {
+            return;
+        }
+        counters.parity++;
+        // Nothing to place it against yet, or its group already left the window
+        if (!started || first + Window < next) return;
+
+        Group* group = nullptr;
+        for (auto& candidate : groups) {
+            if (candidate.used && candidate.first == first && candidate.k == k) group = &candidate;
+        }
+        if (!group) {
+            group = &groups[0];
+            for (auto& candidate : groups) {
+                if (!candidate.used) {
+                    group = &candidate;
+                    break;
+                }
+                if (candidate.first < group->first) group = &candidate;
+            }
+            group->first = first;
+            group->k = k;
+            group->m = m;
+            group->size = symbolSize;
+            group->present = 0;
+            group->used = true;
+            group->done = false;
+        }
+        if (group->done || group->m != m || group->size != symbolSize) return;
+        if (group->present & (1u << index)) {
+            counters.duplicates++;
+            return;
+        }
+        std::memcpy(group->parity[index].data(), data + PARITY_HEADER_SIZE, symbolSize);
+        group->present |= 1u << index;
+        recover(*group, deliver);
+    }
+
+    /**
+     * Rebuild the group's missing samples once it has a parity symbol for
+     * each of them
+     */
+    template <typename Deliver>
+    void recover(Group& group, Deliver& deliver) {
+        size_t parityHeld = 0;
+        size_t rows[MAX_PARITY];
+        for (size_t j = 0; j < group.m; ++j) {
+            if (group.present & (1u << j)) rows[parityHeld++] = j;
+        }
+        size_t missing[MAX_PARITY];
+        size_t missingCount = 0;
+        for (size_t i = 0; i < group.k; ++i) {
+            const uint64_t sequence = group.first + i;
+            if (sequence + Window <= next) {
+                group.done = true;      // slid out of the window before it could be rebuilt
+                return;
+            }
+            if (has(sequence)) {
+                if (lengths[slot(sequence)] > group.size) {
+                    group.done = true;  // not the group this parity was built over
+                    return;
+                }
+                continue;
+            }
+            if (missingCount == parityHeld) return;
+            missing[missingCount++] = i;
+        }
+        if (missingCount == 0) {
+            group.done = true;
+            return;
+        }
+
+        // What the missing symbols must add up to in each parity row used
+        const Field& gf = field();
+        Matrix coefficients;
+        for (size_t a = 0; a < missingCount; ++a) {
+            std::memcpy(work[a].data(), group.parity[rows[a]].data(), group.size);
+            for (size_t i = 0; i < group.k; ++i) {
+                const uint64_t sequence = group.first + i;
+                if (!has(sequence)) continue;
+                mulAddInto(work[a].data(), symbols[slot(sequence)].data(), gf.coefficients[rows[a]][i],
+                           lengths[slot(sequence)]);
+            }
+            for (size_t b = 0; b < missingCount; ++b) coefficients[a][b] = gf.coefficients[rows[a]][missing[b]];
+        }
+        Matrix solve;
+        group.done = true;
+        if (!invert(coefficients, solve, missingCount)) return;
+
+        for (size_t b = 0; b < missingCount; ++b) {
+            const uint64_t sequence = group.first + missing[b];
+            if (sequence >= next) advance(sequence);
+            const size_t s = slot(sequence);
+            std::memset(symbols[s].data(), 0, group.size);
+            for (size_t a = 0; a < missingCount; ++a) {
+                mulAddInto(symbols[s].data(), work[a].data(), solve[b][a], group.size);
+            }
+            const size_t length = symbols[s][0] | (static_cast<size_t>(symbols[s][1]) << 8);
+            tag[s] = sequence;
+            if (length + LENGTH_SIZE > group.size) {
+                state[s] = Slot::Missing;
+                continue;
+            }
+            lengths[s] = static_cast<uint16_t>(length + LENGTH_SIZE);
+            state[s] = Slot::Received;
+            counters.recovered++;
+            deliver(sequence, reinterpret_cast<const char*>(symbols[s].data() + LENGTH_SIZE), length, true);
+        }
+    }
+};
+
+} // namespace Fec
@@ -0,0 +1,106 @@
+/**
+ * Frame Writer
+ * Appends JSON tokens into a caller-owned fixed buffer without touching the
+ * heap; used on the per-tick data path instead of building a json DOM
+ */
+
+#pragma once
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+class FrameWriter {
+private:
+    char* buffer;
+    size_t capacity;
+    size_t length;
+    bool overflow;
+
+public:
+    FrameWriter(char* buffer, size_t capacity)
+        : buffer(buffer), capacity(capacity), length(0), overflow(false) {}
+
+    void clear() {
+        length = 0;
+        overflow = false;
+    }
+
+    const char* data() const { return buffer; }
+    size_t size() const { return length; }
+    bool overflowed() const { return overflow; }
+
+    void raw(const char* text, size_t count) {
+        if (length + count > capacity) {
+            overflow = true;
+            return;
+        }
+        std::memcpy(buffer + length, text, count);
+        length += count;
+    }
+
+    void raw(const char* text) {
+        raw(text, std::strlen(text));
+    }
+
+    /**
+     * Writes "name": (the caller handles separating commas)
+     */
+    void key(const char* name) {
+        raw("\"", 1);
+        raw(name);
+        raw("\":", 2);
+    }
+
+    void boolean(bool value) {
+        value ? raw("true", 4) : raw("false", 5);
+    }
+
+    void number(uint64_t value) {
+        char digits[24];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        raw(digits, static_cast<size_t>(result.ptr - digits));
+    }
+
+    void number(int64_t value) {
+        char digits[24];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        raw(digits, static_cast<size_t>(result.ptr - digits));
+    }
+
+    void number(int value) {
+        number(static_cast<int64_t>(value));
+    }
+
+    /**
+     * Shortest round-trip representation; non-finite values become null
+     */
+    void number(float value) {
+        if (!std::isfinite(value)) {
+            raw("null", 4);
+            return;
+        }
+        char digits[32];
+        const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        raw(digits, static_cast<size_t>(result.ptr - digits));
+    }
+};
+
+template <size_t Capacity>
+struct FrameStorage {
+    std::array<char, Capacity> storage;
+};
+
+/**
+ * Frame writer with inline storage (storage base is constructed first)
+ */
+template <size_t Capacity>
+class FixedFrameWriter : private FrameStorage<Capacity>, public FrameWriter {
+public:
+    FixedFrameWriter() : FrameWriter(this->storage.data(), Capacity) {}
+    FixedFrameWriter(const FixedFrameWriter&) = delete;
+    FixedFrameWriter& operator=(const FixedFrameWriter&) = delete;
+};
@@ -0,0 +1,161 @@
+/**
+ * Gaze Classifier
+ * Velocity-threshold (I-VT) segmentation of a gaze stream into fixations
+ * and saccades, fed one sample at a time. Short tracking gaps are bridged;
+ * longer ones close whatever event was open. Events carry the sequence of
+ * the sample they started at, so a caller splitting a stream into chunks
+ * can tell which chunk owns each event
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+
+struct GazeClassifierSettings {
+    float velocityThreshold = 0.7f;     // unit display widths per second
+    uint64_t minFixationMs = 100;
+    uint64_t maxGapMs = 75;             // longer tracking gaps end the current event
+};
+
+/**
+ * One sample in unit display coordinates (0..1 from the top-left)
+ */
+struct GazeClassifierSample {
+    uint64_t sequence;
+    uint64_t timestamp;     // ms
+    bool hasGaze;
+    float x, y;
+};
+
+enum class GazeEventKind : uint8_t { Fixation, Saccade };
+
+struct GazeEvent {
+    GazeEventKind kind;
+    uint64_t startSequence;
+    uint64_t startTimestamp;
+    uint64_t endTimestamp;
+    float x, y;             // fixation centroid, or saccade landing point
+    float amplitude;        // saccades: distance from launch to landing
+    float peakVelocity;     // saccades: unit display widths per second
+};
+
+class GazeClassifier {
+private:
+    enum class State : uint8_t { Idle, Fixation, Saccade };
+
+    GazeClassifierSettings settings;
+    State state;
+
+    // Open event
+    uint64_t startSequence;
+    uint64_t startTimestamp;
+    float startX, startY;
+    double sumX, sumY;
+    uint32_t count;
+    float peakVelocity;
+
+    // Last valid sample
+    bool hasPrevious;
+    uint64_t previousTimestamp;
+    float previousX, previousY;
+
+public:
+    explicit GazeClassifier(const GazeClassifierSettings& settings = GazeClassifierSettings())
+        : settings(settings), state(State::Idle), startSequence(0), startTimestamp(0),
+          startX(0), startY(0), sumX(0), sumY(0), count(0), peakVelocity(0),
+          hasPrevious(false), previousTimestamp(0), previousX(0), previousY(0) {}
+
+    /**
+     * True while an event is open, with the sequence it started at
+     */
+    bool open(uint64_t& sequence) const {
+        sequence = startSequence;
+        return state != State::Idle;
+    }
+
+    /**
+     * Advance by one sample; emit(const GazeEvent&) receives each event as
+     * it closes
+     */
+    template <typename EmitFn>
+    void add(const GazeClassifierSample& sample, EmitFn&& emit) {
+        if (!sample.hasGaze) {
+            if (hasPrevious && sample.timestamp - previousTimestamp > settings.maxGapMs) {
+                close(previousTimestamp, emit);
+                hasPrevious = false;
+            }
+            return;
+        }
+
+        if (!hasPrevious) {
+            begin(State::Fixation, sample, sample.x, sample.y);
+            accumulate(sample);
+            return;
+        }
+        if (sample.timestamp <= previousTimestamp) return;     // repeated sample
+
+        const float dx = sample.x - previousX, dy = sample.y - previousY;
+        const float velocity = std::sqrt(dx * dx + dy * dy) * 1000.0f /
+                               static_cast<float>(sample.timestamp - previousTimestamp);
+        const bool fast = velocity >= settings.velocityThreshold;
+
+        if (fast && state != State::Saccade) {
+            // The saccade launches from the last slow sample
+            close(previousTimestamp, emit);
+            begin(State::Saccade, sample, previousX, previousY);
+        } else if (!fast && state != State::Fixation) {
+            close(sample.timestamp, emit);
+            begin(State::Fixation, sample, sample.x, sample.y);
+        }
+
+        if (fast && velocity > peakVelocity) peakVelocity = velocity;
+        accumulate(sample);
+    }
+
+    /**
+     * Close the open event (end of stream)
+     */
+    template <typename EmitFn>
+    void flush(EmitFn&& emit) {
+        close(previousTimestamp, emit);
+        hasPrevious = false;
+    }
+
+private:
+    void begin(State next, const GazeClassifierSample& sample, float x, float y) {
+        state = next;
+        startSequence = sample.sequence;
+        startTimestamp = next == State::Saccade ? previousTimestamp : sample.timestamp;
+        startX = x;
+        startY = y;
+        sumX = sumY = 0.0;
+        count = 0;
+        peakVelocity = 0.0f;
+    }
+
+    void accumulate(const GazeClassifierSample& sample) {
+        sumX += sample.x;
+        sumY += sample.y;
+        count++;
+        hasPrevious = true;
+        previousTimestamp = sample.timestamp;
+        previousX = sample.x;
+        previousY = sample.y;
+    }
+
+    template <typename EmitFn>
+    void close(uint64_t endTimestamp, EmitFn& emit) {
+        const State closing = state;
+        state = State::Idle;
+        if (closing == State::Fixation) {
+            if (endTimestamp - startTimestamp < settings.minFixationMs) return;
+            emit(GazeEvent{GazeEventKind::Fixation, startSequence, startTimestamp, endTimestamp,
+                           static_cast<float>(sumX / count), static_cast<float>(sumY / count), 0.0f, 0.0f});
+        } else if (closing == State::Saccade) {
+            const float dx = previousX - startX, dy = previousY - startY;
+            emit(GazeEvent{GazeEventKind::Saccade, startSequence, startTimestamp, previousTimestamp,
+                           previousX, previousY, std::sqrt(dx * dx + dy * dy), peakVelocity});
+        }
+    }
+};
@@ -0,0 +1,42 @@
+/**
+ * Gaze Filter
+ * Exponential smoothing of the gaze point against the previous valid
+ * sample, shared by the live bridge (filters.gaze_smoothing) and offline
+ * analysis so both see the same filtered signal
+ */
+
+#pragma once
+
+class GazeSmoother {
+private:
+    float smoothing;        // 0 = off, closer to 1 = smoother
+    bool hasPrevious;
+    float previousX, previousY;
+
+public:
+    explicit GazeSmoother(float smoothing = 0.0f)
+        : smoothing(smoothing), hasPrevious(false), previousX(0.0f), previousY(0.0f) {}
+
+    void setSmoothing(float value) { smoothing = value; }
+
+    void reset() { hasPrevious = false; }
+
+    /**
+     * Filter one sample in place; an invalid sample breaks the chain so the
+     * next valid one starts fresh
+     */
+    void apply(bool valid, float& x, float& y) {
+        if (!valid) {
+            hasPrevious = false;
+            return;
+        }
+        if (smoothing > 0.0f && hasPrevious) {
+            const float alpha = 1.0f - smoothing;
+            x = previousX + alpha * (x - previousX);
+            y = previousY + alpha * (y - previousY);
+        }
+        hasPrevious = true;
+        previousX = x;
+        previousY = y;
+    }
+};
@@ -0,0 +1,381 @@
+/**
+ * Gaze Predictor
+ * Latency compensation for gaze-contingent clients. A constant-velocity
+ * Kalman filter per axis (gaze x/y and the six head pose values) follows
+ * the published samples, and extrapolate() moves a sample forward by a
+ * client's horizon plus the time since each axis group was last measured:
+ * a tracker slower than the bridge tick leaves gaze up to a sample period
+ * old by the time it is sent. A constant-velocity model overshoots saccades, so gaze
+ * prediction is suspended from saccade onset until the eye has settled,
+ * and after tracking gaps such as blinks; suspended values go out as
+ * measured. PredictionScore checks each client's predictions against the
+ * samples that later arrive for the predicted time
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "tobii-data-packet.hpp"
+#include "tracker-source.hpp"
+
+struct PredictionSettings {
+    float trackerLatencyMs = 15.0f;     // capture-to-report latency of the tracker, for automatic horizons
+    float maxHorizonMs = 100.0f;
+    float saccadeVelocity = 0.7f;       // unit display widths per second
+    uint64_t settleMs = 50;             // after a saccade or gap, before predicting again
+    uint64_t gapMs = 100;               // a longer pause between samples restarts the filter
+
+    // Filter tuning: expected acceleration (process noise) and measurement noise per axis group
+    float gazeAcceleration = 2.0f;      // unit display widths/s^2
+    float gazeNoise = 0.004f;           // unit display widths
+    float angleAcceleration = 60.0f;    // degrees/s^2
+    float angleNoise = 0.2f;            // degrees
+    float positionAcceleration = 300.0f;    // mm/s^2
+    float positionNoise = 1.0f;             // mm
+};
+
+/**
+ * Source gaze units to unit display widths
+ */
+inline float gazeUnitScale(GazeSpace space) {
+    return space == GazeSpace::Centered ? 0.5f : 1.0f;
+}
+
+/**
+ * Position/velocity Kalman filter for one axis; q is the acceleration
+ * variance, r the measurement variance
+ */
+struct KalmanAxis {
+    double position = 0.0;
+    double velocity = 0.0;
+    double p00 = 0.0, p01 = 0.0, p11 = 0.0;
+
+    void reset(double measured, double r, double velocityVariance) {
+        position = measured;
+        velocity = 0.0;
+        p00 = r;
+        p01 = 0.0;
+        p11 = velocityVariance;
+    }
+
+    void step(double measured, double dt, double q, double r) {
+        // Predict
+        position += velocity * dt;
+        const double dt2 = dt * dt;
+        p00 += dt * (2.0 * p01 + dt * p11) + q * dt2 * dt2 * 0.25;
+        p01 += dt * p11 + q * dt2 * dt * 0.5;
+        p11 += q * dt2;
+
+        // Correct
+        const double s = p00 + r;
+        const double k0 = p00 / s, k1 = p01 / s;
+        const double innovation = measured - position;
+        position += k0 * innovation;
+        velocity += k1 * innovation;
+        p11 -= k1 * p01;
+        p00 *= 1.0 - k0;
+        p01 *= 1.0 - k0;
+    }
+
+    double at(double seconds) const { return position + velocity * seconds; }
+};
+
+class GazePredictor {
+private:
+    static constexpr size_t HEAD_AXES = 6;
+
+    PredictionSettings settings;
+    float unitScale;            // source gaze units to unit display widths
+
+    KalmanAxis gazeX, gazeY;
+    std::array<KalmanAxis, HEAD_AXES> head;
+
+    // Gaze, on the tracker's sample clock (microseconds), and the bridge
+    // time the latest gaze sample was observed at
+    bool gazeTracking;
+    uint64_t lastGazeMicros;
+    uint64_t gazeSettledAt;
+    uint64_t gazeObservedMicros;
+    float lastX, lastY;
+    bool gazeReady;
+
+    // Head, on the bridge clock
+    bool headTracking;
+    uint64_t lastHeadMicros;
+    uint64_t headSettledAt;
+    bool headReady;
+
+public:
+    GazePredictor()
+        : unitScale(1.0f), gazeTracking(false), lastGazeMicros(0), gazeSettledAt(0), gazeObservedMicros(0),
+          lastX(0), lastY(0), gazeReady(false), headTracking(false), lastHeadMicros(0), headSettledAt(0),
+          headReady(false) {}
+
+    void configure(const PredictionSettings& next, GazeSpace space) {
+        settings = next;
+        unitScale = gazeUnitScale(space);
+    }
+
+    const PredictionSettings& current() const { return settings; }
+    bool predictingGaze() const { return gazeReady; }
+    bool predictingHead() const { return headReady; }
+
+    /**
+     * Track the tick's published sample
+     */
+    void observe(const TobiiDataPacket& sample, uint64_t nowMicros) {
+        observeGaze(sample, nowMicros);
+        observeHead(sample, nowMicros);
+    }
+
+    /**
+     * Move a copy of the latest sample to horizonMs past nowMicros on the
+     * bridge clock. Sets the prediction fields; returns true when any value
+     * was extrapolated
+     */
+    bool extrapolate(TobiiDataPacket& sample, float horizonMs, uint64_t nowMicros) const {
+        const float horizon = std::min(std::max(horizonMs, 0.0f), settings.maxHorizonMs);
+
+        // Gaze the tracker has stopped updating is not carried further forward
+        const bool gaze = gazeReady && sample.hasGaze && nowMicros >= gazeObservedMicros &&
+                          nowMicros - gazeObservedMicros <= settings.gapMs * 1000;
+        if (gaze) {
+            const double seconds = secondsAhead(gazeObservedMicros, nowMicros, horizon);
+            sample.gazeX = static_cast<float>(gazeX.at(seconds));
+            sample.gazeY = static_cast<float>(gazeY.at(seconds));
+        }
+        const bool headPose = headReady && sample.hasHead;
+        if (headPose) {
+            const double seconds = secondsAhead(lastHeadMicros, nowMicros, horizon);
+            sample.headYaw = static_cast<float>(head[0].at(seconds));
+            sample.headPitch = static_cast<float>(head[1].at(seconds));
+            sample.headRoll = static_cast<float>(head[2].at(seconds));
+            sample.headPosX = static_cast<float>(head[3].at(seconds));
+            sample.headPosY = static_cast<float>(head[4].at(seconds));
+            sample.headPosZ = static_cast<float>(head[5].at(seconds));
+        }
+
+        sample.predicted = gaze || headPose;
+        sample.predictionHorizonMs = sample.predicted ? horizon : 0.0f;
+        return sample.predicted;
+    }
+
+private:
+    static double secondsAhead(uint64_t observedMicros, uint64_t nowMicros, float horizonMs) {
+        const uint64_t elapsed = nowMicros > observedMicros ? nowMicros - observedMicros : 0;
+        return static_cast<double>(elapsed) * 1e-6 + static_cast<double>(horizonMs) * 1e-3;
+    }
+
+    void observeGaze(const TobiiDataPacket& sample, uint64_t nowMicros) {
+        if (!sample.hasGaze) {
+            gazeTracking = gazeReady = false;
+            return;
+        }
+        const double r = square(settings.gazeNoise / unitScale);
+        const double q = square(settings.gazeAcceleration / unitScale);
+        const uint64_t now = sample.gazeTimestamp;
+
+        // A gap, a clock step or the first sample starts the filter over
+        if (!gazeTracking || now < lastGazeMicros || now - lastGazeMicros > settings.gapMs * 1000) {
+            restartGaze(sample, now, r);
+            gazeObservedMicros = nowMicros;
+            return;
+        }
+        if (now == lastGazeMicros) return;  // the tracker repeated its last sample
+        gazeObservedMicros = nowMicros;
+
+        const double dt = static_cast<double>(now - lastGazeMicros) * 1e-6;
+        const float dx = sample.gazeX - lastX, dy = sample.gazeY - lastY;
+        const double speed = std::sqrt(dx * dx + dy * dy) * unitScale / dt;
+        if (speed >= settings.saccadeVelocity) {
+            // In flight: hold prediction until the eye lands and settles
+            restartGaze(sample, now, r);
+            return;
+        }
+
+        gazeX.step(sample.gazeX, dt, q, r);
+        gazeY.step(sample.gazeY, dt, q, r);
+        lastGazeMicros = now;
+        lastX = sample.gazeX;
+        lastY = sample.gazeY;
+        gazeReady = now - gazeSettledAt >= settings.settleMs * 1000;
+    }
+
+    void restartGaze(const TobiiDataPacket& sample, uint64_t now, double r) {
+        const double velocityVariance = square(settings.saccadeVelocity / unitScale);
+        gazeX.reset(sample.gazeX, r, velocityVariance);
+        gazeY.reset(sample.gazeY, r, velocityVariance);
+        gazeTracking = true;
+        gazeReady = false;
+        gazeSettledAt = lastGazeMicros = now;
+        lastX = sample.gazeX;
+        lastY = sample.gazeY;
+    }
+
+    void observeHead(const TobiiDataPacket& sample, uint64_t nowMicros) {
+        if (!sample.hasHead) {
+            headTracking = headReady = false;
+            return;
+        }
+        const float values[HEAD_AXES] = {sample.headYaw, sample.headPitch, sample.headRoll,
+                                         sample.headPosX, sample.headPosY, sample.headPosZ};
+        const bool restart = !headTracking || nowMicros <= lastHeadMicros ||
+                             nowMicros - lastHeadMicros > settings.gapMs * 1000;
+        const double dt = restart ? 0.0 : static_cast<double>(nowMicros - lastHeadMicros) * 1e-6;
+
+        for (size_t axis = 0; axis < HEAD_AXES; ++axis) {
+            const bool angle = axis < 3;
+            const double r = square(angle ? settings.angleNoise : settings.positionNoise);
+            const double q = square(angle ? settings.angleAcceleration : settings.positionAcceleration);
+            if (restart) {
+                head[axis].reset(values[axis], r, q);
+            } else {
+                head[axis].step(values[axis], dt, q, r);
+            }
+        }
+        if (restart) {
+            headTracking = true;
+            headSettledAt = nowMicros;
+        }
+        lastHeadMicros = nowMicros;
+        headReady = nowMicros - headSettledAt >= settings.settleMs * 1000;
+    }
+
+    static double square(double value) { return value * value; }
+};
+
+/**
+ * Accumulated prediction error and what the unpredicted samples would have
+ * had; gaze in unit display widths, head in degrees of yaw/pitch
+ */
+struct PredictionError {
+    uint64_t gazeSamples = 0;
+    double gaze = 0.0, gazeUnpredicted = 0.0;
+    uint64_t headSamples = 0;
+    double head = 0.0, headUnpredicted = 0.0;
+
+    void add(const PredictionError& other) {
+        gazeSamples += other.gazeSamples;
+        gaze += other.gaze;
+        gazeUnpredicted += other.gazeUnpredicted;
+        headSamples += other.headSamples;
+        head += other.head;
+        headUnpredicted += other.headUnpredicted;
+    }
+
+    double meanGaze() const { return mean(gaze, gazeSamples); }
+    double meanGazeUnpredicted() const { return mean(gazeUnpredicted, gazeSamples); }
+    double meanHead() const { return mean(head, headSamples); }
+    double meanHeadUnpredicted() const { return mean(headUnpredicted, headSamples); }
+
+private:
+    static double mean(double sum, uint64_t samples) {
+        return samples ? sum / static_cast<double>(samples) : 0.0;
+    }
+};
+
+/**
+ * Error of one client's predictions. Each prediction is held until the
+ * bridge has published samples on both sides of its target time, then
+ * compared with the sample interpolated there; the baseline is the error
+ * the unpredicted sample would have had
+ */
+class PredictionScore {
+private:
+    static constexpr size_t PENDING = 128;
+
+    struct Pending {
+        uint64_t target;
+        bool gaze, head;
+        float x, y, baseX, baseY;
+        float yaw, pitch, baseYaw, basePitch;
+    };
+
+    std::array<Pending, PENDING> pending;
+    size_t first;
+    size_t count;
+
+    // Previous actual sample, for interpolation
+    bool hasPrevious;
+    uint64_t previousMicros;
+    TobiiDataPacket previous;
+
+    float gazeScale;            // source gaze units to unit display widths
+    PredictionError error;
+
+public:
+    explicit PredictionScore(float gazeScale = 1.0f)
+        : pending(), first(0), count(0), hasPrevious(false), previousMicros(0), previous(),
+          gazeScale(gazeScale) {}
+
+    const PredictionError& totals() const { return error; }
+
+    /**
+     * A published sample at nowMicros settles the predictions that targeted
+     * the time since the previous one
+     */
+    void observe(uint64_t nowMicros, const TobiiDataPacket& actual) {
+        while (count > 0 && hasPrevious && pending[first].target <= nowMicros) {
+            const Pending& entry = pending[first];
+            if (entry.target >= previousMicros && nowMicros > previousMicros) {
+                const float t = static_cast<float>(entry.target - previousMicros) /
+                                static_cast<float>(nowMicros - previousMicros);
+                settle(entry, actual, t);
+            }
+            first = (first + 1) % PENDING;
+            count--;
+        }
+        hasPrevious = true;
+        previousMicros = nowMicros;
+        previous = actual;
+    }
+
+    /**
+     * Hold a prediction for targetMicros; gaze and head say which parts
+     * were extrapolated rather than passed through
+     */
+    void expect(uint64_t targetMicros, const TobiiDataPacket& predicted, const TobiiDataPacket& measured,
+                bool gaze, bool head) {
+        if (count == PENDING) {
+            // A horizon longer than the buffer covers: drop the oldest
+            first = (first + 1) % PENDING;
+            count--;
+        }
+        Pending& entry = pending[(first + count) % PENDING];
+        entry.target = targetMicros;
+        entry.gaze = gaze;
+        entry.head = head;
+        entry.x = predicted.gazeX;
+        entry.y = predicted.gazeY;
+        entry.baseX = measured.gazeX;
+        entry.baseY = measured.gazeY;
+        entry.yaw = predicted.headYaw;
+        entry.pitch = predicted.headPitch;
+        entry.baseYaw = measured.headYaw;
+        entry.basePitch = measured.headPitch;
+        count++;
+    }
+
+private:
+    void settle(const Pending& entry, const TobiiDataPacket& actual, float t) {
+        if (entry.gaze && previous.hasGaze && actual.hasGaze) {
+            const float x = previous.gazeX + (actual.gazeX - previous.gazeX) * t;
+            const float y = previous.gazeY + (actual.gazeY - previous.gazeY) * t;
+            error.gaze += std::hypot(entry.x - x, entry.y - y) * gazeScale;
+            error.gazeUnpredicted += std::hypot(entry.baseX - x, entry.baseY - y) * gazeScale;
+            error.gazeSamples++;
+        }
+        if (entry.head && previous.hasHead && actual.hasHead) {
+            const float yaw = previous.headYaw + (actual.headYaw - previous.headYaw) * t;
+            const float pitch = previous.headPitch + (actual.headPitch - previous.headPitch) * t;
+            error.head += std::hypot(entry.yaw - yaw, entry.pitch - pitch);
+            error.headUnpredicted += std::hypot(entry.baseYaw - yaw, entry.basePitch - pitch);
+            error.headSamples++;
+        }
+    }
+};
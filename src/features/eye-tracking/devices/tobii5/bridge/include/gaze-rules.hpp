@@ -0,0 +1,356 @@
+/**
+ * Gaze Rules
+ * Per-client conditions (dwell, enter/leave, absence, off-screen, velocity)
+ * evaluated incrementally on every sample, so a client interested in
+ * "dwell on AOI X for 800 ms" receives one event instead of the sample
+ * stream. AOIs are looked up through a uniform grid built when the rules
+ * are registered
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+enum class GazeRuleKind : uint8_t { Dwell, Enter, Leave, Absence, OffScreen, Velocity };
+
+/**
+ * One sample as the rules see it: position in the client's AOI space
+ * (desktop pixels with a display layout, else 0..1 on the tracked display)
+ */
+struct GazeRulePoint {
+    uint64_t timestamp;     // ms
+    bool hasGaze;
+    bool onScreen;
+    bool present;
+    float x, y;
+};
+
+/**
+ * A fired rule, handed to the caller's emit function
+ */
+struct GazeRuleEvent {
+    const char* rule;
+    const char* kind;
+    const char* aoi;        // nullptr for rules without an AOI
+    uint64_t timestamp;
+    uint64_t duration;      // ms the condition held (0 for enter/leave/velocity)
+    float value;            // velocity rules: speed in AOI units per second
+};
+
+class GazeRuleSet {
+public:
+    static constexpr size_t MAX_AOIS = 256;
+    static constexpr size_t MAX_RULES = 64;
+    static constexpr size_t MAX_NAME = 32;
+    static constexpr size_t GRID = 16;
+
+private:
+    // Per-sample state is kept compact and apart from the names, which are
+    // only read when a rule fires
+    struct Aoi {
+        float x0, y0, x1, y1;
+    };
+
+    struct Rule {
+        uint64_t holdMs;        // dwell/absence/off-screen duration
+        float threshold;        // velocity rules
+        int16_t aoi;            // index into aois, -1 if the rule has none
+        GazeRuleKind kind;
+        bool armed;
+    };
+
+    std::vector<Aoi> aois;
+    std::vector<uint64_t> enteredAt;
+    std::vector<std::string> aoiNames;
+    std::vector<Rule> rules;
+    std::vector<std::string> ruleIds;
+
+    // Uniform grid over the AOIs' bounding box: the AOIs overlapping cell c
+    // are cellAois[cellStart[c] .. cellStart[c + 1])
+    float gridX0, gridY0, cellWidth, cellHeight;
+    std::vector<uint32_t> cellStart;
+    std::vector<uint16_t> cellAois;
+
+    std::bitset<MAX_AOIS> inside;
+    uint64_t absentSince;
+    uint64_t offScreenSince;
+    bool hasPrevious;
+    float previousX, previousY;
+    uint64_t previousTimestamp;
+
+public:
+    GazeRuleSet() : gridX0(0), gridY0(0), cellWidth(1), cellHeight(1), absentSince(0),
+                    offScreenSince(0), hasPrevious(false), previousX(0), previousY(0),
+                    previousTimestamp(0) {}
+
+    /**
+     * Parse set-rules data; throws std::invalid_argument describing the first
+     * bad value
+     */
+    static GazeRuleSet fromJson(const nlohmann::json& data) {
+        if (!data.is_object()) throw std::invalid_argument("rules data must be an object");
+        GazeRuleSet set;
+
+        const nlohmann::json aois = data.value("aois", nlohmann::json::array());
+        if (!aois.is_array() || aois.size() > MAX_AOIS) throw std::invalid_argument("aois must be an array of at most 256");
+        for (const auto& entry : aois) {
+            if (!entry.is_object()) throw std::invalid_argument("each aoi must be an object");
+            Aoi aoi;
+            std::string name = checkedName(entry.value("name", ""), "aoi name");
+            const float x = entry.value("x", 0.0f), y = entry.value("y", 0.0f);
+            const float width = entry.value("width", 0.0f), height = entry.value("height", 0.0f);
+            if (!(width > 0.0f) || !(height > 0.0f)) throw std::invalid_argument("aoi width and height must be positive");
+            aoi.x0 = x;
+            aoi.y0 = y;
+            aoi.x1 = x + width;
+            aoi.y1 = y + height;
+            if (set.findAoi(name) >= 0) throw std::invalid_argument("duplicate aoi '" + name + "'");
+            set.aois.push_back(aoi);
+            set.enteredAt.push_back(0);
+            set.aoiNames.push_back(std::move(name));
+        }
+
+        const nlohmann::json rules = data.value("rules", nlohmann::json::array());
+        if (!rules.is_array() || rules.size() > MAX_RULES) throw std::invalid_argument("rules must be an array of at most 64");
+        for (const auto& entry : rules) {
+            if (!entry.is_object()) throw std::invalid_argument("each rule must be an object");
+            Rule rule;
+            rule.kind = parseKind(entry.value("type", ""));
+            std::string id = checkedName(entry.value("id", std::string(kindName(rule.kind))), "rule id");
+            rule.holdMs = entry.value("ms", 0u);
+            rule.threshold = entry.value("threshold", 0.0f);
+            rule.armed = true;
+            rule.aoi = -1;
+
+            const bool needsAoi = rule.kind == GazeRuleKind::Dwell || rule.kind == GazeRuleKind::Enter ||
+                                  rule.kind == GazeRuleKind::Leave;
+            if (needsAoi) {
+                rule.aoi = static_cast<int16_t>(set.findAoi(entry.value("aoi", "")));
+                if (rule.aoi < 0) throw std::invalid_argument("rule '" + id + "' names an unknown aoi");
+            }
+            if ((rule.kind == GazeRuleKind::Dwell || rule.kind == GazeRuleKind::Absence) && rule.holdMs == 0) {
+                throw std::invalid_argument("rule '" + id + "' needs ms > 0");
+            }
+            if (rule.kind == GazeRuleKind::Velocity && !(rule.threshold > 0.0f)) {
+                throw std::invalid_argument("rule '" + id + "' needs threshold > 0");
+            }
+            set.rules.push_back(rule);
+            set.ruleIds.push_back(std::move(id));
+        }
+
+        set.buildIndex();
+        return set;
+    }
+
+    size_t aoiCount() const { return aois.size(); }
+    size_t ruleCount() const { return rules.size(); }
+    const std::string& aoiName(size_t index) const { return aoiNames[index]; }
+    const std::string& ruleId(size_t index) const { return ruleIds[index]; }
+
+    /**
+     * Index of the first AOI containing a point, or -1
+     */
+    int aoiAt(float x, float y) const {
+        if (aois.empty()) return -1;
+        const size_t cell = cellRow(y) * GRID + cellColumn(x);
+        for (size_t c = cellStart[cell]; c < cellStart[cell + 1]; ++c) {
+            const Aoi& aoi = aois[cellAois[c]];
+            if (x >= aoi.x0 && x < aoi.x1 && y >= aoi.y0 && y < aoi.y1) return cellAois[c];
+        }
+        return -1;
+    }
+
+    /**
+     * Advance every rule by one sample; emit(const GazeRuleEvent&) is called
+     * for each rule that fires. Rules fire once per occurrence and re-arm when
+     * their condition clears
+     */
+    template <typename EmitFn>
+    void evaluate(const GazeRulePoint& point, EmitFn&& emit) {
+        const uint64_t now = point.timestamp;
+        const std::bitset<MAX_AOIS> previous = inside;
+        inside.reset();
+        if (point.hasGaze) lookup(point.x, point.y);
+
+        // Enter/leave transitions
+        const std::bitset<MAX_AOIS> changed = previous ^ inside;
+        if (changed.any()) {
+            for (size_t i = 0; i < aois.size(); ++i) {
+                if (changed[i] && inside[i]) enteredAt[i] = now;
+            }
+        }
+
+        if (!point.present) {
+            if (absentSince == 0) absentSince = now;
+        } else {
+            absentSince = 0;
+        }
+        const bool offScreen = !point.hasGaze || !point.onScreen;
+        if (offScreen) {
+            if (offScreenSince == 0) offScreenSince = now;
+        } else {
+            offScreenSince = 0;
+        }
+
+        float speed = 0.0f;
+        if (point.hasGaze && hasPrevious && now > previousTimestamp) {
+            const float dx = point.x - previousX, dy = point.y - previousY;
+            speed = std::sqrt(dx * dx + dy * dy) * 1000.0f / static_cast<float>(now - previousTimestamp);
+        }
+        hasPrevious = point.hasGaze;
+        previousX = point.x;
+        previousY = point.y;
+        previousTimestamp = now;
+
+        for (Rule& rule : rules) {
+            switch (rule.kind) {
+            case GazeRuleKind::Enter:
+                if (changed[rule.aoi] && inside[rule.aoi]) fire(rule, now, 0, 0.0f, emit);
+                break;
+            case GazeRuleKind::Leave:
+                if (changed[rule.aoi] && !inside[rule.aoi]) {
+                    fire(rule, now, now - enteredAt[rule.aoi], 0.0f, emit);
+                }
+                break;
+            case GazeRuleKind::Dwell:
+                holdRule(rule, inside[rule.aoi], enteredAt[rule.aoi], now, emit);
+                break;
+            case GazeRuleKind::Absence:
+                holdRule(rule, absentSince != 0, absentSince, now, emit);
+                break;
+            case GazeRuleKind::OffScreen:
+                holdRule(rule, offScreenSince != 0, offScreenSince, now, emit);
+                break;
+            case GazeRuleKind::Velocity:
+                if (speed < rule.threshold) {
+                    rule.armed = true;
+                } else if (rule.armed) {
+                    rule.armed = false;
+                    fire(rule, now, 0, speed, emit);
+                }
+                break;
+            }
+        }
+    }
+
+    static const char* kindName(GazeRuleKind kind) {
+        switch (kind) {
+        case GazeRuleKind::Dwell: return "dwell";
+        case GazeRuleKind::Enter: return "enter";
+        case GazeRuleKind::Leave: return "leave";
+        case GazeRuleKind::Absence: return "absence";
+        case GazeRuleKind::OffScreen: return "offscreen";
+        case GazeRuleKind::Velocity: return "velocity";
+        }
+        return "dwell";
+    }
+
+private:
+    static GazeRuleKind parseKind(const std::string& name) {
+        for (GazeRuleKind kind : {GazeRuleKind::Dwell, GazeRuleKind::Enter, GazeRuleKind::Leave,
+                                  GazeRuleKind::Absence, GazeRuleKind::OffScreen, GazeRuleKind::Velocity}) {
+            if (name == kindName(kind)) return kind;
+        }
+        throw std::invalid_argument("unknown rule type '" + name + "'");
+    }
+
+    /**
+     * Names go into event frames verbatim, so keep them to a JSON-safe set
+     */
+    static std::string checkedName(const std::string& name, const char* what) {
+        if (name.empty() || name.size() > MAX_NAME) {
+            throw std::invalid_argument(std::string(what) + " must be 1-32 characters");
+        }
+        for (char c : name) {
+            const bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                            c == '_' || c == '-' || c == '.' || c == ':';
+            if (!ok) throw std::invalid_argument(std::string(what) + " may only use letters, digits and _-.:");
+        }
+        return name;
+    }
+
+    int findAoi(const std::string& name) const {
+        for (size_t i = 0; i < aois.size(); ++i) {
+            if (aoiNames[i] == name) return static_cast<int>(i);
+        }
+        return -1;
+    }
+
+    size_t cellColumn(float x) const {
+        const float column = (x - gridX0) / cellWidth;
+        return column <= 0.0f ? 0 : (column >= GRID - 1 ? GRID - 1 : static_cast<size_t>(column));
+    }
+
+    size_t cellRow(float y) const {
+        const float row = (y - gridY0) / cellHeight;
+        return row <= 0.0f ? 0 : (row >= GRID - 1 ? GRID - 1 : static_cast<size_t>(row));
+    }
+
+    void buildIndex() {
+        if (aois.empty()) return;
+        float x0 = aois[0].x0, y0 = aois[0].y0, x1 = aois[0].x1, y1 = aois[0].y1;
+        for (const Aoi& aoi : aois) {
+            x0 = std::min(x0, aoi.x0);
+            y0 = std::min(y0, aoi.y0);
+            x1 = std::max(x1, aoi.x1);
+            y1 = std::max(y1, aoi.y1);
+        }
+        gridX0 = x0;
+        gridY0 = y0;
+        cellWidth = (x1 - x0) / GRID;
+        cellHeight = (y1 - y0) / GRID;
+
+        std::array<std::vector<uint16_t>, GRID * GRID> cells;
+        for (size_t i = 0; i < aois.size(); ++i) {
+            for (size_t row = cellRow(aois[i].y0); row <= cellRow(aois[i].y1); ++row) {
+                for (size_t column = cellColumn(aois[i].x0); column <= cellColumn(aois[i].x1); ++column) {
+                    cells[row * GRID + column].push_back(static_cast<uint16_t>(i));
+                }
+            }
+        }
+
+        cellStart.assign(1, 0);
+        for (const auto& cell : cells) {
+            cellAois.insert(cellAois.end(), cell.begin(), cell.end());
+            cellStart.push_back(static_cast<uint32_t>(cellAois.size()));
+        }
+    }
+
+    void lookup(float x, float y) {
+        if (aois.empty()) return;
+        const size_t cell = cellRow(y) * GRID + cellColumn(x);
+        for (size_t c = cellStart[cell]; c < cellStart[cell + 1]; ++c) {
+            const Aoi& aoi = aois[cellAois[c]];
+            if (x >= aoi.x0 && x < aoi.x1 && y >= aoi.y0 && y < aoi.y1) inside.set(cellAois[c]);
+        }
+    }
+
+    /**
+     * Fire once the condition has held for the rule's duration
+     */
+    template <typename EmitFn>
+    void holdRule(Rule& rule, bool holding, uint64_t since, uint64_t now, EmitFn& emit) {
+        if (!holding) {
+            rule.armed = true;
+        } else if (rule.armed && now - since >= rule.holdMs) {
+            rule.armed = false;
+            fire(rule, now, now - since, 0.0f, emit);
+        }
+    }
+
+    template <typename EmitFn>
+    void fire(const Rule& rule, uint64_t now, uint64_t duration, float value, EmitFn& emit) {
+        const size_t index = static_cast<size_t>(&rule - rules.data());
+        emit(GazeRuleEvent{ruleIds[index].c_str(), kindName(rule.kind), rule.aoi >= 0 ? aoiNames[rule.aoi].c_str() : nullptr,
+                           now, duration, value});
+    }
+};
@@ -0,0 +1,239 @@
+/**
+ * History Pyramid
+ * Published samples summarized into 1 s, 10 s and 60 s buckets (min, max
+ * and mean per channel), each level updated as samples arrive. Long-range
+ * queries read the coarsest level that still meets their resolution, so
+ * their cost follows the number of points asked for, not the time span
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "tobii-data-packet.hpp"
+
+/**
+ * Running min/max/sum of one channel
+ */
+struct HistoryStat {
+    float min = std::numeric_limits<float>::infinity();
+    float max = -std::numeric_limits<float>::infinity();
+    double sum = 0.0;
+    uint32_t count = 0;
+
+    void add(float value) {
+        min = std::min(min, value);
+        max = std::max(max, value);
+        sum += value;
+        count++;
+    }
+
+    void merge(const HistoryStat& other) {
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        sum += other.sum;
+        count += other.count;
+    }
+
+    double mean() const { return count ? sum / count : 0.0; }
+};
+
+enum HistoryChannel : size_t {
+    HISTORY_GAZE_X, HISTORY_GAZE_Y,
+    HISTORY_HEAD_YAW, HISTORY_HEAD_PITCH, HISTORY_HEAD_ROLL,
+    HISTORY_HEAD_X, HISTORY_HEAD_Y, HISTORY_HEAD_Z,
+    HISTORY_QUALITY,
+    HISTORY_CHANNEL_COUNT
+};
+
+static constexpr const char* HISTORY_CHANNEL_NAMES[HISTORY_CHANNEL_COUNT] = {
+    "gaze_x", "gaze_y", "head_yaw", "head_pitch", "head_roll", "head_x", "head_y", "head_z", "quality"
+};
+
+/**
+ * Channel groups a query can ask for
+ */
+enum HistoryGroup : uint32_t {
+    HISTORY_GROUP_GAZE = 1u << 0,
+    HISTORY_GROUP_HEAD = 1u << 1,
+    HISTORY_GROUP_QUALITY = 1u << 2,
+    HISTORY_GROUP_ALL = HISTORY_GROUP_GAZE | HISTORY_GROUP_HEAD | HISTORY_GROUP_QUALITY
+};
+
+inline HistoryGroup historyChannelGroup(size_t channel) {
+    if (channel <= HISTORY_GAZE_Y) return HISTORY_GROUP_GAZE;
+    if (channel <= HISTORY_HEAD_Z) return HISTORY_GROUP_HEAD;
+    return HISTORY_GROUP_QUALITY;
+}
+
+struct HistoryBucket {
+    uint64_t startMs = UINT64_MAX;  // UINT64_MAX = never filled
+    uint32_t samples = 0;
+    uint32_t present = 0;
+    std::array<HistoryStat, HISTORY_CHANNEL_COUNT> channels;
+
+    void add(const TobiiDataPacket& sample) {
+        samples++;
+        if (sample.present) present++;
+        if (sample.hasGaze) {
+            channels[HISTORY_GAZE_X].add(sample.gazeX);
+            channels[HISTORY_GAZE_Y].add(sample.gazeY);
+        }
+        if (sample.hasHead) {
+            channels[HISTORY_HEAD_YAW].add(sample.headYaw);
+            channels[HISTORY_HEAD_PITCH].add(sample.headPitch);
+            channels[HISTORY_HEAD_ROLL].add(sample.headRoll);
+            channels[HISTORY_HEAD_X].add(sample.headPosX);
+            channels[HISTORY_HEAD_Y].add(sample.headPosY);
+            channels[HISTORY_HEAD_Z].add(sample.headPosZ);
+        }
+        channels[HISTORY_QUALITY].add(sample.overallQuality);
+    }
+
+    void merge(const HistoryBucket& other) {
+        samples += other.samples;
+        present += other.present;
+        for (size_t c = 0; c < HISTORY_CHANNEL_COUNT; ++c) channels[c].merge(other.channels[c]);
+    }
+};
+
+class HistoryPyramid {
+public:
+    struct Level {
+        uint64_t widthMs;
+        size_t capacity;
+    };
+
+    // One hour at 1 s, six at 10 s, a day at 60 s
+    static constexpr size_t LEVEL_COUNT = 3;
+    static constexpr std::array<Level, LEVEL_COUNT> LEVELS = {{{1000, 3600}, {10000, 2160}, {60000, 1440}}};
+    static constexpr size_t MAX_POINTS = 4000;
+
+    /**
+     * A query's answer: points of widthMs read from one level, oldest first
+     */
+    struct Query {
+        uint64_t fromMs = 0;
+        uint64_t toMs = 0;
+        size_t points = 0;
+        size_t level = 0;
+        uint64_t widthMs = 0;
+    };
+
+private:
+    // Buckets are slotted by start time, so a slot whose start does not
+    // match the time asked for is empty (a gap, or overwritten)
+    std::array<std::vector<HistoryBucket>, LEVEL_COUNT> levels;
+    uint64_t newestMs;
+    uint64_t oldestMs;
+
+public:
+    HistoryPyramid() : newestMs(0), oldestMs(UINT64_MAX) {
+        for (size_t l = 0; l < LEVEL_COUNT; ++l) levels[l].resize(LEVELS[l].capacity);
+    }
+
+    bool empty() const { return oldestMs == UINT64_MAX; }
+    uint64_t first() const { return oldestMs; }
+    uint64_t newest() const { return newestMs; }
+
+    /**
+     * Oldest time still held at a level
+     */
+    uint64_t oldest(size_t level) const {
+        const uint64_t span = LEVELS[level].widthMs * (LEVELS[level].capacity - 1);
+        const uint64_t floor = newestMs > span ? align(newestMs, level) - span : 0;
+        return std::max(oldestMs, floor);
+    }
+
+    /**
+     * Account one published sample (timestamp in ms) at every level
+     */
+    void add(const TobiiDataPacket& sample) {
+        // A wall clock stepped back files into the newest bucket rather than reopening old ones
+        const uint64_t now = std::max<uint64_t>(sample.timestamp, newestMs);
+        for (size_t l = 0; l < LEVEL_COUNT; ++l) {
+            HistoryBucket& bucket = slot(l, now);
+            const uint64_t start = align(now, l);
+            if (bucket.startMs != start) {
+                bucket = HistoryBucket();
+                bucket.startMs = start;
+            }
+            bucket.add(sample);
+        }
+        newestMs = now;
+        if (oldestMs == UINT64_MAX) oldestMs = now;
+    }
+
+    /**
+     * Plan a query over [fromMs, toMs] with at most `points` points. Points
+     * are a whole number of one level's buckets; of the levels that reach
+     * back to fromMs, the one giving the narrowest points wins, the coarsest
+     * on a tie
+     */
+    Query plan(uint64_t fromMs, uint64_t toMs, size_t points) const {
+        Query query;
+        points = std::max<size_t>(1, std::min(points, MAX_POINTS));
+        // Resolution over the part of the range that has data
+        const uint64_t from = std::max(fromMs, oldestMs);
+        const uint64_t to = std::min(toMs, newestMs);
+        const uint64_t resolution = std::max<uint64_t>(1, (to - std::min(from, to)) / points);
+        query.level = LEVEL_COUNT - 1;
+        query.widthMs = pointWidth(query.level, resolution);
+        for (size_t l = LEVEL_COUNT - 1; l-- > 0;) {
+            // A level that lost more than the first bucket of the range is too short
+            if (oldest(l) > from + LEVELS[l].widthMs) continue;
+            const uint64_t width = pointWidth(l, resolution);
+            if (width < query.widthMs) {
+                query.level = l;
+                query.widthMs = width;
+            }
+        }
+        query.toMs = to;
+        // Points start on whole multiples of their width, and rounding the
+        // start down can add one; widen them until the range fits
+        for (;;) {
+            query.fromMs = std::max(from, oldest(query.level)) / query.widthMs * query.widthMs;
+            query.points = query.toMs >= query.fromMs ? static_cast<size_t>((query.toMs - query.fromMs) / query.widthMs + 1) : 0;
+            if (query.points <= points) return query;
+            query.widthMs += LEVELS[query.level].widthMs;
+        }
+    }
+
+    /**
+     * Point i of a planned query; samples is 0 when nothing was recorded in it
+     */
+    HistoryBucket point(const Query& query, size_t index) const {
+        HistoryBucket merged;
+        merged.startMs = query.fromMs + index * query.widthMs;
+        const uint64_t width = LEVELS[query.level].widthMs;
+        // Only the buckets the level still holds are visited, however wide the point
+        const uint64_t end = std::min(merged.startMs + query.widthMs, newestMs + 1);
+        for (uint64_t t = std::max(merged.startMs, align(oldest(query.level), query.level)); t < end; t += width) {
+            const HistoryBucket& bucket = slotAt(query.level, t);
+            if (bucket.startMs == align(t, query.level)) merged.merge(bucket);
+        }
+        return merged;
+    }
+
+private:
+    static uint64_t pointWidth(size_t level, uint64_t resolution) {
+        const uint64_t width = LEVELS[level].widthMs;
+        return (resolution + width - 1) / width * width;
+    }
+
+    static uint64_t align(uint64_t ms, size_t level) { return ms / LEVELS[level].widthMs * LEVELS[level].widthMs; }
+
+    HistoryBucket& slot(size_t level, uint64_t ms) {
+        return levels[level][(ms / LEVELS[level].widthMs) % LEVELS[level].capacity];
+    }
+
+    const HistoryBucket& slotAt(size_t level, uint64_t ms) const {
+        return levels[level][(ms / LEVELS[level].widthMs) % LEVELS[level].capacity];
+    }
+};
@@ -0,0 +1,136 @@
+/**
+ * Load Shedder
+ * Keeps the main loop inside its tick budget by degrading clients in
+ * priority order. The bridge reports each tick's cost; once the smoothed
+ * cost has stayed over budget for an escalate interval the shedder goes one
+ * stage further, and once it has been under half the budget for a recover
+ * interval it steps back. Each class passes through the same stages before
+ * the next class is touched: quantized encoding, doubling decimation up to
+ * a bound, then disconnection. Low-priority clients go first, then normal
+ * ones; critical clients are never shed
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+#include "admission-control.hpp"
+
+struct LoadShedSettings {
+    uint64_t tickBudgetMicros = 8000;   // 0 = never shed
+    uint32_t maxDecimation = 8;
+    uint64_t escalateMicros = 250000;
+    uint64_t recoverMicros = 5000000;
+};
+
+/**
+ * What a client of some priority gets at the current stage
+ */
+struct ShedAction {
+    bool quantize = false;
+    uint32_t decimationFactor = 1;
+    bool disconnect = false;
+
+    bool any() const { return quantize || decimationFactor > 1 || disconnect; }
+};
+
+class LoadShedder {
+private:
+    LoadShedSettings settings;
+    double cost;                // smoothed tick cost, microseconds
+    int stage;
+    uint64_t lastChange;
+    uint64_t overSince;         // 0 = within budget
+    uint64_t calmSince;         // 0 = over half the budget
+    uint64_t overloadedTicks;
+
+public:
+    LoadShedder() : cost(0.0), stage(0), lastChange(0), overSince(0), calmSince(0), overloadedTicks(0) {}
+
+    void configure(const LoadShedSettings& next) {
+        settings = next;
+        stage = std::min(stage, maxStage());
+    }
+
+    int currentStage() const { return stage; }
+    double averageCostMicros() const { return cost; }
+    uint64_t ticksOverBudget() const { return overloadedTicks; }
+    bool active() const { return stage > 0; }
+
+    /**
+     * Feed one tick's cost. lowClients says whether any low-priority client
+     * is connected; without one their stages are skipped. Returns true when
+     * the stage changed
+     */
+    bool observe(uint64_t nowMicros, uint64_t tickCostMicros, bool lowClients) {
+        if (settings.tickBudgetMicros == 0) {
+            if (stage == 0) return false;
+            stage = 0;
+            return true;
+        }
+
+        cost += (static_cast<double>(tickCostMicros) - cost) / 8.0;
+        const double budget = static_cast<double>(settings.tickBudgetMicros);
+        // A lone slow tick does not escalate; the overload has to persist
+        if (cost > budget) {
+            overloadedTicks++;
+            if (overSince == 0) overSince = std::max<uint64_t>(nowMicros, 1);
+        } else {
+            overSince = 0;
+        }
+        if (cost <= budget * 0.5) {
+            if (calmSince == 0) calmSince = std::max<uint64_t>(nowMicros, 1);
+        } else {
+            calmSince = 0;
+        }
+
+        if (overSince != 0 && stage < maxStage() && nowMicros - overSince >= settings.escalateMicros &&
+            nowMicros - lastChange >= settings.escalateMicros) {
+            stage = !lowClients && stage < classStages() ? classStages() + 1 : stage + 1;
+            lastChange = nowMicros;
+            return true;
+        }
+        if (stage > 0 && calmSince != 0 && nowMicros - calmSince >= settings.recoverMicros &&
+            nowMicros - lastChange >= settings.recoverMicros) {
+            stage = !lowClients && stage <= classStages() + 1 ? 0 : stage - 1;
+            lastChange = nowMicros;
+            return true;
+        }
+        return false;
+    }
+
+    ShedAction action(ClientPriority priority) const {
+        ShedAction action;
+        if (priority == ClientPriority::Critical) return action;
+
+        const int perClass = classStages();
+        const int classStage = priority == ClientPriority::Low ? std::min(stage, perClass)
+                                                                : std::max(0, stage - perClass);
+        if (classStage == 0) return action;
+        action.quantize = true;
+        action.decimationFactor = 1u << std::min(classStage - 1, doublings());
+        action.disconnect = classStage == perClass;
+        return action;
+    }
+
+    /**
+     * New clients of this priority are turned away while their class is
+     * being disconnected
+     */
+    bool refusing(ClientPriority priority) const {
+        return action(priority).disconnect;
+    }
+
+private:
+    int doublings() const {
+        int count = 0;
+        for (uint32_t d = 1; d < settings.maxDecimation; d <<= 1) count++;
+        return count;
+    }
+
+    // Quantize, each doubling, disconnect
+    int classStages() const { return 2 + doublings(); }
+
+    int maxStage() const { return 2 * classStages(); }
+};
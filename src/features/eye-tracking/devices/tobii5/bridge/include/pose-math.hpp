@@ -0,0 +1,150 @@
+/**
+ * Pose Math
+ * Head orientation and the 3D gaze ray, derived once per sample from the
+ * tracker's Euler angles, head position and gaze point. The tracker frame
+ * has its origin at the centre of the tracked display, +x right, +y up and
+ * +z toward the user, in millimetres; yaw, pitch and roll turn about +y, +x
+ * and +z, composed as R = Ry Rx Rz. A configured world transform then
+ * places that frame in the consumer's scene. Everything per sample is
+ * straight-line float arithmetic on fixed-size arrays (one sincos per
+ * angle, one square root), with the world transform and the gaze space
+ * folded into constants at configure time
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include "tobii-data-packet.hpp"
+#include "tracker-source.hpp"
+
+namespace Pose {
+
+using Vec3 = std::array<float, 3>;
+using Quat = std::array<float, 4>;      // w, x, y, z
+using Mat3 = std::array<float, 9>;      // row-major
+
+constexpr float HALF_RADIANS_PER_DEGREE = 3.14159265358979f / 360.0f;
+
+/**
+ * Rotation Ry(yaw) Rx(pitch) Rz(roll), angles in degrees
+ */
+inline Quat fromEuler(float yawDeg, float pitchDeg, float rollDeg) {
+    const float cy = std::cos(yawDeg * HALF_RADIANS_PER_DEGREE), sy = std::sin(yawDeg * HALF_RADIANS_PER_DEGREE);
+    const float cp = std::cos(pitchDeg * HALF_RADIANS_PER_DEGREE), sp = std::sin(pitchDeg * HALF_RADIANS_PER_DEGREE);
+    const float cr = std::cos(rollDeg * HALF_RADIANS_PER_DEGREE), sr = std::sin(rollDeg * HALF_RADIANS_PER_DEGREE);
+    return {cy * cp * cr + sy * sp * sr,
+            cy * sp * cr + sy * cp * sr,
+            sy * cp * cr - cy * sp * sr,
+            cy * cp * sr - sy * sp * cr};
+}
+
+inline Quat multiply(const Quat& a, const Quat& b) {
+    return {a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3],
+            a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2],
+            a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1],
+            a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0]};
+}
+
+inline Mat3 toMatrix(const Quat& q) {
+    const float w = q[0], x = q[1], y = q[2], z = q[3];
+    return {1.0f - 2.0f * (y * y + z * z), 2.0f * (x * y - w * z), 2.0f * (x * z + w * y),
+            2.0f * (x * y + w * z), 1.0f - 2.0f * (x * x + z * z), 2.0f * (y * z - w * x),
+            2.0f * (x * z - w * y), 2.0f * (y * z + w * x), 1.0f - 2.0f * (x * x + y * y)};
+}
+
+inline Vec3 rotate(const Mat3& m, const Vec3& v) {
+    return {m[0] * v[0] + m[1] * v[1] + m[2] * v[2],
+            m[3] * v[0] + m[4] * v[1] + m[5] * v[2],
+            m[6] * v[0] + m[7] * v[1] + m[8] * v[2]};
+}
+
+/**
+ * Tracked display and world frame (see the pose config section)
+ */
+struct PoseSettings {
+    float screenWidthMm = 527.0f;       // 24" 16:9
+    float screenHeightMm = 296.0f;
+    float eyeDistanceMm = 600.0f;       // ray origin in front of the display centre while the head is not tracked
+    Vec3 worldOriginMm = {0.0f, 0.0f, 0.0f};    // where the tracker frame's origin sits in the world
+    Vec3 worldRotationDeg = {0.0f, 0.0f, 0.0f}; // yaw, pitch, roll of the tracker frame in the world
+    float worldScale = 1.0f;            // world units per mm
+};
+
+/**
+ * Fills a sample's pose fields from its gaze and head readings
+ */
+class PoseKernel {
+private:
+    Quat world;
+    Mat3 worldMatrix;
+    Vec3 worldOrigin;
+    float worldScale;
+    Vec3 nominalEye;
+
+    // Source gaze to millimetres on the display: scale * gaze + offset
+    float gazeScaleX, gazeOffsetX;
+    float gazeScaleY, gazeOffsetY;
+
+public:
+    PoseKernel() { configure(PoseSettings(), GazeSpace::Unit); }
+
+    void configure(const PoseSettings& settings, GazeSpace space) {
+        world = fromEuler(settings.worldRotationDeg[0], settings.worldRotationDeg[1], settings.worldRotationDeg[2]);
+        worldMatrix = toMatrix(world);
+        worldOrigin = settings.worldOriginMm;
+        worldScale = settings.worldScale;
+        nominalEye = {0.0f, 0.0f, settings.eyeDistanceMm};
+
+        // Unit gaze is 0..1 from the top-left with +y down; centred gaze -1..1 with +y up
+        const bool centered = space == GazeSpace::Centered;
+        gazeScaleX = settings.screenWidthMm * (centered ? 0.5f : 1.0f);
+        gazeOffsetX = centered ? 0.0f : -0.5f * settings.screenWidthMm;
+        gazeScaleY = settings.screenHeightMm * (centered ? 0.5f : -1.0f);
+        gazeOffsetY = centered ? 0.0f : 0.5f * settings.screenHeightMm;
+    }
+
+    /**
+     * Head orientation (from the angles) and the ray from the head position
+     * through the gaze point, both in the world frame. Computed whatever
+     * hasGaze/hasHead say; the flags gate what gets sent
+     */
+    void apply(TobiiDataPacket& sample) const {
+        const Quat head = multiply(world, fromEuler(sample.headYaw, sample.headPitch, sample.headRoll));
+        const Mat3 rotation = toMatrix(head);
+        sample.headQuatW = head[0];
+        sample.headQuatX = head[1];
+        sample.headQuatY = head[2];
+        sample.headQuatZ = head[3];
+        sample.headRot00 = rotation[0];
+        sample.headRot01 = rotation[1];
+        sample.headRot02 = rotation[2];
+        sample.headRot10 = rotation[3];
+        sample.headRot11 = rotation[4];
+        sample.headRot12 = rotation[5];
+        sample.headRot20 = rotation[6];
+        sample.headRot21 = rotation[7];
+        sample.headRot22 = rotation[8];
+
+        const Vec3 eye = sample.hasHead ? Vec3{sample.headPosX, sample.headPosY, sample.headPosZ} : nominalEye;
+        const Vec3 target = {gazeScaleX * sample.gazeX + gazeOffsetX, gazeScaleY * sample.gazeY + gazeOffsetY, 0.0f};
+        Vec3 direction = {target[0] - eye[0], target[1] - eye[1], target[2] - eye[2]};
+        const float length = std::sqrt(direction[0] * direction[0] + direction[1] * direction[1] +
+                                       direction[2] * direction[2]);
+        const float inverse = 1.0f / std::max(length, 1e-6f);
+        for (float& component : direction) component *= inverse;
+
+        const Vec3 origin = rotate(worldMatrix, eye);
+        direction = rotate(worldMatrix, direction);
+        sample.gazeOriginX = worldScale * (worldOrigin[0] + origin[0]);
+        sample.gazeOriginY = worldScale * (worldOrigin[1] + origin[1]);
+        sample.gazeOriginZ = worldScale * (worldOrigin[2] + origin[2]);
+        sample.gazeDirX = direction[0];
+        sample.gazeDirY = direction[1];
+        sample.gazeDirZ = direction[2];
+    }
+};
+
+} // namespace Pose
@@ -0,0 +1,314 @@
+/**
+ * Quality Monitor
+ * Rolling tracking-quality figures maintained from the tick stream: the
+ * achieved tracker rate, valid gaze/head and presence ratios, and a
+ * histogram of gaze gap lengths. Each tick only bumps counters; once per
+ * second the closed second is added to the rolling window (and the second
+ * leaving it subtracted), and alert thresholds are checked against it
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "frame-writer.hpp"
+#include "tobii-data-packet.hpp"
+
+/**
+ * Alert thresholds (0 disables a check). Ratios and rate are judged over the
+ * rolling window so a single bad second does not flap the alert
+ */
+struct QualityThresholds {
+    float minRateHz = 0.0f;
+    float minGazeRatio = 0.0f;
+    float minHeadRatio = 0.0f;
+    float minPresenceRatio = 0.0f;
+    uint32_t maxGapMs = 0;
+};
+
+/**
+ * A threshold crossing (raised) or recovery (cleared)
+ */
+struct QualityAlert {
+    const char* metric;
+    bool raised;
+    float value;
+    float threshold;
+};
+
+/**
+ * The last closed second's figures, as the quality topic carries them
+ */
+struct QualitySnapshot {
+    uint64_t timestamp;
+    float rateHz;
+    float gazeRatio;
+    float headRatio;
+    float presenceRatio;
+    uint32_t longestGapMs;
+    uint32_t currentGapMs;
+    uint32_t alerts;            // number of metrics currently raised
+};
+
+class QualityMonitor {
+public:
+    static constexpr size_t MAX_WINDOW = 60;
+    static constexpr size_t GAP_BUCKETS = 9;
+
+    // Upper bucket edges in ms; the last bucket takes everything longer
+    static constexpr uint32_t GAP_EDGES_MS[GAP_BUCKETS - 1] = {16, 33, 66, 125, 250, 500, 1000, 2000};
+
+    struct Counts {
+        uint64_t durationMs = 0;
+        uint32_t ticks = 0;
+        uint32_t samples = 0;           // new tracker gaze samples (distinct gaze timestamps)
+        uint32_t gaze = 0;
+        uint32_t head = 0;
+        uint32_t present = 0;
+        std::array<uint32_t, GAP_BUCKETS> gaps{};
+
+        void add(const Counts& other, int sign) {
+            durationMs += sign * static_cast<int64_t>(other.durationMs);
+            ticks += sign * static_cast<int32_t>(other.ticks);
+            samples += sign * static_cast<int32_t>(other.samples);
+            gaze += sign * static_cast<int32_t>(other.gaze);
+            head += sign * static_cast<int32_t>(other.head);
+            present += sign * static_cast<int32_t>(other.present);
+            for (size_t b = 0; b < GAP_BUCKETS; ++b) gaps[b] += sign * static_cast<int32_t>(other.gaps[b]);
+        }
+    };
+
+private:
+    enum Metric { Rate, GazeRatio, HeadRatio, PresenceRatio, Gap, METRIC_COUNT };
+    static constexpr const char* METRIC_NAMES[METRIC_COUNT] = {
+        "rate_hz", "gaze_ratio", "head_ratio", "presence_ratio", "gap_ms"
+    };
+
+    // Second being filled
+    Counts current;
+    uint64_t secondStart;
+    uint32_t longestGapMs;
+
+    // Closed seconds; window holds the sum of the newest windowSeconds of them
+    std::array<Counts, MAX_WINDOW> history;
+    size_t historyNext;
+    size_t historyCount;
+    size_t windowSeconds;
+    Counts window;
+
+    // Gap in progress and the last tracker sample seen
+    bool inGap;
+    uint64_t gapStart;
+    uint64_t lastGazeTimestamp;
+
+    // Report of the last closed second
+    Counts lastSecond;
+    uint32_t lastLongestGapMs;
+    uint64_t reportTimestamp;
+
+    std::array<bool, METRIC_COUNT> raised;
+
+public:
+    explicit QualityMonitor(size_t windowSeconds = 10)
+        : secondStart(0), longestGapMs(0), historyNext(0), historyCount(0),
+          windowSeconds(clampWindow(windowSeconds)), inGap(false), gapStart(0),
+          lastGazeTimestamp(0), lastLongestGapMs(0), reportTimestamp(0), raised() {}
+
+    /**
+     * Account one tick's sample (timestamp in ms). Returns true when it
+     * closed a second, i.e. a fresh report and alert check are due
+     */
+    bool add(const TobiiDataPacket& sample) {
+        const uint64_t now = sample.timestamp;
+        bool closed = false;
+        if (secondStart == 0) {
+            secondStart = now;
+        } else if (now >= secondStart + 1000) {
+            closeSecond(now);
+            closed = true;
+        }
+
+        current.ticks++;
+        if (sample.hasGaze) {
+            current.gaze++;
+            if (sample.gazeTimestamp != lastGazeTimestamp) {
+                current.samples++;
+                lastGazeTimestamp = sample.gazeTimestamp;
+            }
+            if (inGap) {
+                recordGap(static_cast<uint32_t>(now - gapStart));
+                inGap = false;
+            }
+        } else if (!inGap) {
+            inGap = true;
+            gapStart = now;
+        }
+        if (sample.hasHead) current.head++;
+        if (sample.present) current.present++;
+        return closed;
+    }
+
+    /**
+     * Forget all history and raised alerts, as after a pause in sampling;
+     * the window size is kept
+     */
+    void reset() {
+        *this = QualityMonitor(windowSeconds);
+    }
+
+    /**
+     * Resize the rolling window (seconds, 1..MAX_WINDOW); rebuilt from history
+     */
+    void setWindow(size_t seconds) {
+        seconds = clampWindow(seconds);
+        if (seconds == windowSeconds) return;
+        windowSeconds = seconds;
+        window = Counts();
+        const size_t count = historyCount < windowSeconds ? historyCount : windowSeconds;
+        for (size_t i = 1; i <= count; ++i) {
+            window.add(history[(historyNext + MAX_WINDOW - i) % MAX_WINDOW], 1);
+        }
+    }
+
+    /**
+     * Compare the last closed second against thresholds and report each
+     * metric whose state changed
+     */
+    template <typename Emit>
+    void checkAlerts(const QualityThresholds& thresholds, Emit&& emit) {
+        checkBelow(Rate, rate(window), thresholds.minRateHz, emit);
+        checkBelow(GazeRatio, ratio(window.gaze, window), thresholds.minGazeRatio, emit);
+        checkBelow(HeadRatio, ratio(window.head, window), thresholds.minHeadRatio, emit);
+        checkBelow(PresenceRatio, ratio(window.present, window), thresholds.minPresenceRatio, emit);
+
+        const float gap = static_cast<float>(worstGapMs());
+        const float maxGap = static_cast<float>(thresholds.maxGapMs);
+        const bool gapBad = thresholds.maxGapMs > 0 && gap > maxGap;
+        if (gapBad != raised[Gap]) {
+            raised[Gap] = gapBad;
+            emit(QualityAlert{METRIC_NAMES[Gap], gapBad, gap, maxGap});
+        }
+    }
+
+    /**
+     * JSON object for the last closed second, the rolling window and the
+     * alerts currently raised
+     */
+    void writeJson(FrameWriter& out) const {
+        out.raw("{\"rate_hz\":");
+        out.number(rate(lastSecond));
+        out.raw(",\"tick_hz\":");
+        out.number(lastSecond.durationMs ? 1000.0f * lastSecond.ticks / lastSecond.durationMs : 0.0f);
+        out.raw(",\"gaze_ratio\":");
+        out.number(ratio(lastSecond.gaze, lastSecond));
+        out.raw(",\"head_ratio\":");
+        out.number(ratio(lastSecond.head, lastSecond));
+        out.raw(",\"presence_ratio\":");
+        out.number(ratio(lastSecond.present, lastSecond));
+        out.raw(",\"longest_gap_ms\":");
+        out.number(static_cast<uint64_t>(lastLongestGapMs));
+        out.raw(",\"current_gap_ms\":");
+        out.number(inGap ? reportTimestamp - gapStart : uint64_t(0));
+        out.raw(",\"window\":{\"seconds\":");
+        out.number(static_cast<uint64_t>(historyCount < windowSeconds ? historyCount : windowSeconds));
+        out.raw(",\"rate_hz\":");
+        out.number(rate(window));
+        out.raw(",\"gaze_ratio\":");
+        out.number(ratio(window.gaze, window));
+        out.raw(",\"head_ratio\":");
+        out.number(ratio(window.head, window));
+        out.raw(",\"presence_ratio\":");
+        out.number(ratio(window.present, window));
+        out.raw(",\"gaps\":[");
+        for (size_t b = 0; b < GAP_BUCKETS; ++b) {
+            if (b > 0) out.raw(",");
+            out.number(static_cast<uint64_t>(window.gaps[b]));
+        }
+        out.raw("]},\"alerts\":[");
+        bool first = true;
+        for (size_t m = 0; m < METRIC_COUNT; ++m) {
+            if (!raised[m]) continue;
+            out.raw(first ? "\"" : ",\"");
+            out.raw(METRIC_NAMES[m]);
+            out.raw("\"");
+            first = false;
+        }
+        out.raw("]}");
+    }
+
+    QualitySnapshot snapshot() const {
+        QualitySnapshot snapshot;
+        snapshot.timestamp = reportTimestamp;
+        snapshot.rateHz = rate(lastSecond);
+        snapshot.gazeRatio = ratio(lastSecond.gaze, lastSecond);
+        snapshot.headRatio = ratio(lastSecond.head, lastSecond);
+        snapshot.presenceRatio = ratio(lastSecond.present, lastSecond);
+        snapshot.longestGapMs = lastLongestGapMs;
+        snapshot.currentGapMs = inGap ? static_cast<uint32_t>(reportTimestamp - gapStart) : 0;
+        snapshot.alerts = 0;
+        for (size_t m = 0; m < METRIC_COUNT; ++m) snapshot.alerts += raised[m] ? 1 : 0;
+        return snapshot;
+    }
+
+    uint64_t timestamp() const { return reportTimestamp; }
+    bool hasReport() const { return reportTimestamp != 0; }
+
+private:
+    static size_t clampWindow(size_t seconds) {
+        return seconds < 1 ? 1 : (seconds > MAX_WINDOW ? MAX_WINDOW : seconds);
+    }
+
+    static float ratio(uint32_t count, const Counts& counts) {
+        return counts.ticks ? static_cast<float>(count) / counts.ticks : 0.0f;
+    }
+
+    static float rate(const Counts& counts) {
+        return counts.durationMs ? 1000.0f * counts.samples / counts.durationMs : 0.0f;
+    }
+
+    /**
+     * Longest gap seen in the last second, including one still open
+     */
+    uint64_t worstGapMs() const {
+        const uint64_t open = inGap ? reportTimestamp - gapStart : 0;
+        return open > lastLongestGapMs ? open : lastLongestGapMs;
+    }
+
+    void recordGap(uint32_t lengthMs) {
+        size_t bucket = 0;
+        while (bucket < GAP_BUCKETS - 1 && lengthMs > GAP_EDGES_MS[bucket]) bucket++;
+        current.gaps[bucket]++;
+        if (lengthMs > longestGapMs) longestGapMs = lengthMs;
+    }
+
+    void closeSecond(uint64_t now) {
+        current.durationMs = now - secondStart;
+
+        if (historyCount >= windowSeconds) {
+            window.add(history[(historyNext + MAX_WINDOW - windowSeconds) % MAX_WINDOW], -1);
+        }
+        history[historyNext] = current;
+        historyNext = (historyNext + 1) % MAX_WINDOW;
+        if (historyCount < MAX_WINDOW) historyCount++;
+        window.add(current, 1);
+
+        lastSecond = current;
+        lastLongestGapMs = longestGapMs;
+        reportTimestamp = now;
+
+        current = Counts();
+        longestGapMs = 0;
+        secondStart = now;
+    }
+
+    template <typename Emit>
+    void checkBelow(Metric metric, float value, float threshold, Emit& emit) {
+        const bool bad = threshold > 0.0f && value < threshold;
+        if (bad != raised[metric]) {
+            raised[metric] = bad;
+            emit(QualityAlert{METRIC_NAMES[metric], bad, value, threshold});
+        }
+    }
+};
@@ -0,0 +1,176 @@
+/**
+ * Rate Controller
+ * Per-client output adaptation. Once per interval the bridge reports how
+ * many bytes it queued on the connection and how many are still waiting;
+ * together with ping RTT that gives the client's goodput and whether its
+ * link is building a queue. A congested client steps down a ladder of
+ * cheaper outputs (quantized encoding first, then doubling decimation up to
+ * a bound); a clear one steps back up after a hold-off that doubles each
+ * time a step up has to be undone, so a link at its limit settles instead
+ * of oscillating
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+
+#include "sample-schema.hpp"
+
+struct RateControlSettings {
+    uint32_t maxDecimation = 8;
+    size_t targetQueueBytes = 16 * 1024;    // queued bytes a client may carry
+    uint32_t intervalMs = 500;
+    float rttSlackMs = 80.0f;               // RTT above the link's minimum that counts as queueing
+    bool quantize = true;                   // allow switching to the quantized encoding
+};
+
+class RateController {
+private:
+    static constexpr uint32_t MIN_HOLDOFF = 4;      // intervals clear before stepping up
+    static constexpr uint32_t MAX_HOLDOFF = 64;
+
+    RateControlSettings settings;
+    SampleFormat baseFormat;
+    uint32_t baseDecimation;
+    int level;
+
+    // Estimates
+    double goodput;             // bytes/s drained by the link (EWMA)
+    double rtt;                 // ms (EWMA), 0 until the first pong
+    double minRtt;
+    size_t queue;
+
+    // Previous interval
+    bool started;
+    uint64_t lastMicros;
+    size_t lastQueue;
+    uint64_t lastQueued;
+
+    uint32_t clearIntervals;
+    uint32_t holdoff;
+    bool probing;               // stepped up; undone if the link chokes before the hold-off
+    const char* reason;
+
+public:
+    RateController()
+        : baseFormat(SampleFormat::Json), baseDecimation(1), level(0), goodput(0.0), rtt(0.0), minRtt(0.0),
+          queue(0), started(false), lastMicros(0), lastQueue(0), lastQueued(0), clearIntervals(0),
+          holdoff(MIN_HOLDOFF), probing(false), reason("requested") {}
+
+    void configure(const RateControlSettings& next) {
+        settings = next;
+        level = std::min(level, maxLevel());
+    }
+
+    /**
+     * Start over from the client's requested output
+     */
+    void reset(SampleFormat format, uint32_t decimation) {
+        baseFormat = format;
+        baseDecimation = std::max<uint32_t>(decimation, 1);
+        level = 0;
+        clearIntervals = 0;
+        holdoff = MIN_HOLDOFF;
+        probing = false;
+        reason = "requested";
+    }
+
+    SampleFormat format() const {
+        return level >= formatSteps() ? SampleFormat::Quantized : baseFormat;
+    }
+
+    uint32_t decimation() const {
+        const int doublings = std::max(0, level - formatSteps());
+        const uint64_t scaled = static_cast<uint64_t>(baseDecimation) << std::min(doublings, 16);
+        return static_cast<uint32_t>(std::max<uint64_t>(baseDecimation, std::min<uint64_t>(scaled, settings.maxDecimation)));
+    }
+
+    int currentLevel() const { return level; }
+    double goodputBytesPerSecond() const { return goodput; }
+    double rttMs() const { return rtt; }
+    size_t queueBytes() const { return queue; }
+    const char* lastReason() const { return reason; }
+
+    void observeRtt(double ms) {
+        rtt = rtt > 0.0 ? 0.5 * rtt + 0.5 * ms : ms;
+        // The floor drifts up slowly so a route change is eventually accepted
+        minRtt = minRtt > 0.0 ? std::min(ms, minRtt + 0.01 * (ms - minRtt)) : ms;
+    }
+
+    /**
+     * Feed the connection's queued bytes and the running total of bytes
+     * handed to it. Returns true when the output level changed
+     */
+    bool update(uint64_t nowMicros, size_t queuedNow, uint64_t queuedTotal) {
+        if (!started) {
+            started = true;
+            lastMicros = nowMicros;
+            lastQueue = queue = queuedNow;
+            lastQueued = queuedTotal;
+            return false;
+        }
+        const uint64_t elapsed = nowMicros - lastMicros;
+        if (elapsed < static_cast<uint64_t>(settings.intervalMs) * 1000) return false;
+
+        const int64_t drained = static_cast<int64_t>(queuedTotal - lastQueued) -
+                                (static_cast<int64_t>(queuedNow) - static_cast<int64_t>(lastQueue));
+        const double rate = static_cast<double>(std::max<int64_t>(drained, 0)) * 1e6 / static_cast<double>(elapsed);
+        goodput = goodput > 0.0 ? 0.7 * goodput + 0.3 * rate : rate;
+
+        // A ping waits behind the client's own queue; only delay beyond that
+        // points at buffering further along the path (a VPN, a slow hop)
+        const double queueDelayMs = goodput > 0.0 ? 1000.0 * static_cast<double>(queuedNow) / goodput : 0.0;
+        const bool rttInflated = rtt > 0.0 && rtt - queueDelayMs > minRtt + settings.rttSlackMs;
+
+        // While the queue shrinks the last step is still taking effect
+        const size_t target = settings.targetQueueBytes;
+        const bool draining = queuedNow < lastQueue;
+        const bool growing = queuedNow > lastQueue + target / 4;
+        const bool congested = !draining && (queuedNow > target || growing || rttInflated);
+        const bool clear = queuedNow <= target / 4 && !rttInflated;
+
+        lastMicros = nowMicros;
+        lastQueue = queue = queuedNow;
+        lastQueued = queuedTotal;
+
+        if (congested) {
+            clearIntervals = 0;
+            if (probing) holdoff = std::min(holdoff * 2, MAX_HOLDOFF);
+            probing = false;
+            if (level >= maxLevel()) return false;
+            // A deep backlog skips a rung
+            level = std::min(maxLevel(), level + (queuedNow > 4 * target ? 2 : 1));
+            reason = rttInflated && queuedNow <= target ? "rtt" : "queue";
+            return true;
+        }
+
+        if (!clear) return false;
+        clearIntervals++;
+        if (probing && clearIntervals >= holdoff) {
+            // The last step up held: the next one may come sooner
+            probing = false;
+            holdoff = std::max(holdoff / 2, MIN_HOLDOFF);
+        }
+        if (level > 0 && clearIntervals >= holdoff) {
+            level--;
+            clearIntervals = 0;
+            probing = true;
+            reason = "recovered";
+            return true;
+        }
+        return false;
+    }
+
+private:
+    int formatSteps() const {
+        return settings.quantize && baseFormat != SampleFormat::Quantized ? 1 : 0;
+    }
+
+    int maxLevel() const {
+        int doublings = 0;
+        for (uint64_t d = baseDecimation; d < settings.maxDecimation; d <<= 1) doublings++;
+        return formatSteps() + doublings;
+    }
+};
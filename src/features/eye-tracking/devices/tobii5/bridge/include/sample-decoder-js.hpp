@@ -0,0 +1,228 @@
+/**
+ * Sample Decoder Generator
+ * Emits the JavaScript module remote-client.js uses to decode binary and
+ * quantized tobii-data frames. One straight-line decoder per format and
+ * stream mask, with offsets taken from SAMPLE_FIELDS, produces the same
+ * object shape as the JSON message
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "sample-schema.hpp"
+
+namespace SampleDecoderJs {
+
+struct Node {
+    std::string key;
+    size_t field = SAMPLE_FIELD_COUNT;
+    std::vector<Node> children;
+};
+
+inline Node& child(Node& parent, const std::string& key) {
+    for (Node& node : parent.children) {
+        if (node.key == key) return node;
+    }
+    parent.children.push_back(Node{key, SAMPLE_FIELD_COUNT, {}});
+    return parent.children.back();
+}
+
+inline Node buildTree(uint32_t mask) {
+    Node root;
+    for (size_t i = 0; i < SAMPLE_FIELD_COUNT; ++i) {
+        if (!SampleSchema::included(i, mask)) continue;
+        const std::string_view path = SAMPLE_FIELDS[i].path;
+        Node* node = &root;
+        for (size_t s = 0; s < SampleSchema::depth(path); ++s) {
+            node = &child(*node, std::string(SampleSchema::segment(path, s)));
+        }
+        node->field = i;
+    }
+    return root;
+}
+
+/**
+ * The validity offset shared by every field under node, or NO_VALIDITY
+ */
+inline size_t commonValidity(const Node& node) {
+    if (node.field != SAMPLE_FIELD_COUNT) return SAMPLE_FIELDS[node.field].validOffset;
+    size_t validity = NO_VALIDITY;
+    for (size_t i = 0; i < node.children.size(); ++i) {
+        const size_t childValidity = commonValidity(node.children[i]);
+        if (childValidity == NO_VALIDITY || (i > 0 && childValidity != validity)) return NO_VALIDITY;
+        validity = childValidity;
+    }
+    return validity;
+}
+
+inline std::string number(double value) {
+    char text[32];
+    std::snprintf(text, sizeof(text), "%.9g", value);
+    return text;
+}
+
+inline std::string fieldExpression(size_t field, SampleFormat format, uint32_t mask) {
+    const SampleField& spec = SAMPLE_FIELDS[field];
+    const std::string offset = std::to_string(SampleSchema::wireOffset(field, format, mask));
+
+    switch (spec.type) {
+    case FieldType::Bool:
+        return "view.getUint8(" + offset + ") !== 0";
+    case FieldType::Int32:
+        return "view.getInt32(" + offset + ", true)";
+    case FieldType::UInt64:
+        return "Number(view.getBigUint64(" + offset + ", true))";
+    case FieldType::Tag:
+        return std::string("'") + spec.tag + "'";
+    case FieldType::Float32:
+        break;
+    }
+
+    if (!SampleSchema::quantized(field, format)) {
+        return "view.getFloat32(" + offset + ", true)";
+    }
+    // Divide by whole-number scales so decoded values print cleanly
+    const double scale = 1.0 / static_cast<double>(spec.quantStep);
+    if (std::fabs(scale - std::round(scale)) < 1e-3 * scale) {
+        return "view.getInt16(" + offset + ", true) / " + number(std::round(scale));
+    }
+    return "view.getInt16(" + offset + ", true) * " + number(spec.quantStep);
+}
+
+inline std::string validityExpression(size_t validOffset, SampleFormat format, uint32_t mask) {
+    for (size_t i = 0; i < SAMPLE_FIELD_COUNT; ++i) {
+        if (SAMPLE_FIELDS[i].type == FieldType::Bool && SAMPLE_FIELDS[i].offset == validOffset &&
+            SampleSchema::included(i, mask)) {
+            return fieldExpression(i, format, mask);
+        }
+    }
+    return "true";
+}
+
+inline void writeObject(std::ostringstream& out, const Node& node, size_t parentValidity,
+                        const std::string& indent, SampleFormat format, uint32_t mask) {
+    out << "{\n";
+    for (size_t i = 0; i < node.children.size(); ++i) {
+        const Node& entry = node.children[i];
+        out << indent << "  " << entry.key << ": ";
+
+        if (entry.field != SAMPLE_FIELD_COUNT) {
+            out << fieldExpression(entry.field, format, mask);
+        } else {
+            // Optional objects decode to undefined when their flag is clear, like the JSON omits them
+            const size_t validity = commonValidity(entry);
+            const bool gated = validity != NO_VALIDITY && validity != parentValidity;
+            if (gated) out << validityExpression(validity, format, mask) << " ? ";
+            writeObject(out, entry, validity, indent + "  ", format, mask);
+            if (gated) out << " : undefined";
+        }
+        out << (i + 1 < node.children.size() ? ",\n" : "\n");
+    }
+    out << indent << "}";
+}
+
+inline std::string streamNames(uint32_t mask) {
+    std::string names;
+    for (const SampleStream& stream : SAMPLE_STREAMS) {
+        if (!(mask & stream.bit)) continue;
+        if (!names.empty()) names += ", ";
+        names += stream.name;
+    }
+    return names.empty() ? "none" : names;
+}
+
+inline std::string decoderName(SampleFormat format, uint32_t mask) {
+    std::string name = SAMPLE_FORMAT_NAMES[static_cast<size_t>(format)];
+    name[0] = static_cast<char>(name[0] - 'a' + 'A');
+    return "decode" + name + std::to_string(mask);
+}
+
+} // namespace SampleDecoderJs
+
+/**
+ * The complete decoder module (sample-decoder.js)
+ */
+inline std::string generateSampleDecoderJs() {
+    using namespace SampleDecoderJs;
+    std::ostringstream out;
+
+    out << "/**\n"
+        << " * Tobii Sample Decoder\n"
+        << " * Generated by `tobii_bridge --emit-js-decoder` from bridge/include/sample-schema.hpp.\n"
+        << " * Do not edit: change the schema and regenerate.\n"
+        << " *\n"
+        << " * Decodes binary and quantized tobii-data frames into the same shape as the\n"
+        << " * JSON message. Optional objects (gaze, head) are undefined when their flag is clear\n"
+        << " */\n\n";
+
+    out << "export const SAMPLE_SCHEMA_VERSION = " << static_cast<int>(SAMPLE_SCHEMA_VERSION) << ";\n\n";
+
+    out << "export const SAMPLE_FORMATS = Object.freeze({ ";
+    for (size_t f = 0; f < SAMPLE_FORMAT_COUNT; ++f) {
+        out << SAMPLE_FORMAT_NAMES[f] << ": " << f << (f + 1 < SAMPLE_FORMAT_COUNT ? ", " : " });\n\n");
+    }
+
+    out << "export const SAMPLE_STREAMS = Object.freeze({ ";
+    const size_t streamCount = sizeof(SAMPLE_STREAMS) / sizeof(SAMPLE_STREAMS[0]);
+    for (size_t s = 0; s < streamCount; ++s) {
+        out << SAMPLE_STREAMS[s].name << ": " << SAMPLE_STREAMS[s].bit << (s + 1 < streamCount ? ", " : " });\n");
+    }
+
+    for (size_t f = 1; f < SAMPLE_FORMAT_COUNT; ++f) {
+        const SampleFormat format = static_cast<SampleFormat>(f);
+        for (uint32_t mask = 0; mask < SAMPLE_MASK_COUNT; ++mask) {
+            out << "\n// " << SAMPLE_FORMAT_NAMES[f] << ", streams: " << streamNames(mask) << " ("
+                << SampleSchema::wireLength(format, mask) << " bytes)\n";
+            out << "const " << decoderName(format, mask) << " = (view) => (";
+            writeObject(out, buildTree(mask), NO_VALIDITY, "", format, mask);
+            out << ");\n";
+        }
+    }
+
+    out << "\nconst DECODERS = [\n  null";
+    for (size_t f = 1; f < SAMPLE_FORMAT_COUNT; ++f) {
+        out << ",\n  [";
+        for (uint32_t mask = 0; mask < SAMPLE_MASK_COUNT; ++mask) {
+            out << decoderName(static_cast<SampleFormat>(f), mask) << (mask + 1 < SAMPLE_MASK_COUNT ? ", " : "]");
+        }
+    }
+    out << "\n];\n";
+
+    out << "\nconst FRAME_LENGTHS = [\n  null";
+    for (size_t f = 1; f < SAMPLE_FORMAT_COUNT; ++f) {
+        out << ",\n  [";
+        for (uint32_t mask = 0; mask < SAMPLE_MASK_COUNT; ++mask) {
+            out << SampleSchema::wireLength(static_cast<SampleFormat>(f), mask) << (mask + 1 < SAMPLE_MASK_COUNT ? ", " : "]");
+        }
+    }
+    out << "\n];\n";
+
+    out << "\nconst toDataView = (buffer) => (ArrayBuffer.isView(buffer)\n"
+        << "  ? new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength)\n"
+        << "  : new DataView(buffer));\n"
+        << "\n"
+        << "/**\n"
+        << " * Decode a binary tobii-data frame (ArrayBuffer, Buffer or typed array)\n"
+        << " */\n"
+        << "export const decodeSample = (buffer) => {\n"
+        << "  const view = toDataView(buffer);\n"
+        << "  if (view.byteLength < " << SAMPLE_HEADER_BYTES << " || view.getUint8(0) !== SAMPLE_SCHEMA_VERSION) {\n"
+        << "    throw new Error('Unsupported tobii-data frame version');\n"
+        << "  }\n"
+        << "\n"
+        << "  const format = view.getUint8(1);\n"
+        << "  const mask = view.getUint8(2) & " << STREAM_ALL << ";\n"
+        << "  const decoder = DECODERS[format]?.[mask];\n"
+        << "  if (!decoder || view.byteLength < FRAME_LENGTHS[format][mask]) {\n"
+        << "    throw new Error(`Malformed tobii-data frame (format ${format}, streams ${mask})`);\n"
+        << "  }\n"
+        << "  return decoder(view);\n"
+        << "};\n";
+
+    return out.str();
+}
@@ -0,0 +1,214 @@
+/**
+ * Sample Encoder
+ * Serializers for tobii-data samples, generated from SAMPLE_FIELDS for every
+ * format and stream-mask combination. Field selection, JSON separators and
+ * binary offsets are all resolved at compile time; the only runtime checks
+ * left are JSON's hasGaze/hasHead gates on the optional gaze/head objects,
+ * which existing clients rely on. Binary formats always send every
+ * subscribed field (little-endian) and carry the validity flags inline
+ */
+
+#pragma once
+
+#include <array>
+#include <cstring>
+#include <string_view>
+#include <utility>
+
+#include "frame-writer.hpp"
+#include "sample-schema.hpp"
+#include "tobii-data-packet.hpp"
+
+namespace SampleSchema {
+
+/**
+ * Compile-time JSON text (separators, keys, constant values)
+ */
+struct JsonToken {
+    char text[96];
+    size_t size;
+
+    constexpr void append(std::string_view part) {
+        for (char c : part) text[size++] = c;
+    }
+};
+
+/**
+ * Everything written before a field's value under mask: closing braces,
+ * comma, newly opened objects and the key (plus the value of Tag fields)
+ */
+constexpr JsonToken jsonPrefix(size_t field, uint32_t mask) {
+    JsonToken token{};
+    const std::string_view path = SAMPLE_FIELDS[field].path;
+    const size_t previous = jsonPredecessor(field, mask);
+
+    size_t open = 0;
+    if (previous == SAMPLE_FIELD_COUNT) {
+        token.append("{");
+    } else {
+        const std::string_view previousPath = SAMPLE_FIELDS[previous].path;
+        open = sharedContainers(previousPath, path);
+        for (size_t i = open + 1; i < depth(previousPath); ++i) token.append("}");
+        token.append(",");
+    }
+
+    for (size_t i = open; i + 1 < depth(path); ++i) {
+        token.append("\"");
+        token.append(segment(path, i));
+        token.append("\":{");
+    }
+    token.append("\"");
+    token.append(segment(path, depth(path) - 1));
+    token.append("\":");
+
+    if (SAMPLE_FIELDS[field].type == FieldType::Tag) {
+        token.append("\"");
+        token.append(SAMPLE_FIELDS[field].tag);
+        token.append("\"");
+    }
+    return token;
+}
+
+/**
+ * Braces closing an optional object after its last field
+ */
+constexpr JsonToken jsonObjectClose(size_t field, uint32_t mask) {
+    JsonToken token{};
+    size_t anchor = field;
+    while (anchor-- > 0 && (!included(anchor, mask) || SAMPLE_FIELDS[anchor].validOffset != NO_VALIDITY)) {}
+    for (size_t i = depth(SAMPLE_FIELDS[anchor].path); i < depth(SAMPLE_FIELDS[field].path); ++i) {
+        token.append("}");
+    }
+    return token;
+}
+
+constexpr JsonToken jsonClose(uint32_t mask) {
+    JsonToken token{};
+    for (size_t i = 0; i < depth(SAMPLE_FIELDS[lastIncluded(mask)].path); ++i) token.append("}");
+    return token;
+}
+
+template <typename T>
+inline T readMember(const TobiiDataPacket& data, size_t offset) {
+    T value;
+    std::memcpy(&value, reinterpret_cast<const char*>(&data) + offset, sizeof(T));
+    return value;
+}
+
+/**
+ * round(value / step) saturated to int16; NaN becomes 0
+ */
+inline int16_t quantize(float value, float inverseStep) {
+    float scaled = value * inverseStep;
+    scaled = scaled == scaled ? scaled : 0.0f;
+    scaled = scaled < -32767.0f ? -32767.0f : (scaled > 32767.0f ? 32767.0f : scaled);
+    return static_cast<int16_t>(static_cast<int32_t>(scaled + (scaled < 0.0f ? -0.5f : 0.5f)));
+}
+
+template <size_t I, uint32_t Mask>
+inline void writeJsonField(FrameWriter& out, const TobiiDataPacket& data) {
+    if constexpr (included(I, Mask)) {
+        constexpr SampleField field = SAMPLE_FIELDS[I];
+        if constexpr (field.validOffset != NO_VALIDITY) {
+            if (!readMember<bool>(data, field.validOffset)) return;
+        }
+
+        static constexpr JsonToken prefix = jsonPrefix(I, Mask);
+        out.raw(prefix.text, prefix.size);
+
+        if constexpr (field.type == FieldType::Bool) {
+            out.boolean(readMember<bool>(data, field.offset));
+        } else if constexpr (field.type == FieldType::Int32) {
+            out.number(static_cast<int64_t>(readMember<int32_t>(data, field.offset)));
+        } else if constexpr (field.type == FieldType::Float32) {
+            out.number(readMember<float>(data, field.offset));
+        } else if constexpr (field.type == FieldType::UInt64) {
+            out.number(readMember<uint64_t>(data, field.offset));
+        }
+
+        if constexpr (lastOfOptionalObject(I, Mask)) {
+            static constexpr JsonToken close = jsonObjectClose(I, Mask);
+            out.raw(close.text, close.size);
+        }
+    }
+}
+
+template <size_t I, SampleFormat Format, uint32_t Mask>
+inline void writeWireField(char* bytes, const TobiiDataPacket& data) {
+    if constexpr (included(I, Mask) && SAMPLE_FIELDS[I].type != FieldType::Tag) {
+        constexpr SampleField field = SAMPLE_FIELDS[I];
+        constexpr size_t offset = wireOffset(I, Format, Mask);
+
+        if constexpr (field.type == FieldType::Bool) {
+            bytes[offset] = readMember<bool>(data, field.offset) ? 1 : 0;
+        } else if constexpr (field.type == FieldType::Int32) {
+            const int32_t value = readMember<int32_t>(data, field.offset);
+            std::memcpy(bytes + offset, &value, sizeof(value));
+        } else if constexpr (field.type == FieldType::Float32 && quantized(I, Format)) {
+            const int16_t value = quantize(readMember<float>(data, field.offset), 1.0f / field.quantStep);
+            std::memcpy(bytes + offset, &value, sizeof(value));
+        } else if constexpr (field.type == FieldType::Float32) {
+            const float value = readMember<float>(data, field.offset);
+            std::memcpy(bytes + offset, &value, sizeof(value));
+        } else if constexpr (field.type == FieldType::UInt64) {
+            const uint64_t value = readMember<uint64_t>(data, field.offset);
+            std::memcpy(bytes + offset, &value, sizeof(value));
+        }
+    }
+}
+
+template <uint32_t Mask, size_t... I>
+inline void writeJsonFields(FrameWriter& out, const TobiiDataPacket& data, std::index_sequence<I...>) {
+    (writeJsonField<I, Mask>(out, data), ...);
+}
+
+template <SampleFormat Format, uint32_t Mask, size_t... I>
+inline void writeWireFields(char* bytes, const TobiiDataPacket& data, std::index_sequence<I...>) {
+    (writeWireField<I, Format, Mask>(bytes, data), ...);
+}
+
+} // namespace SampleSchema
+
+using SampleEncodeFn = void (*)(FrameWriter&, const TobiiDataPacket&);
+
+template <SampleFormat Format, uint32_t Mask>
+void encodeSample(FrameWriter& out, const TobiiDataPacket& data) {
+    using namespace SampleSchema;
+
+    if constexpr (Format == SampleFormat::Json) {
+        writeJsonFields<Mask>(out, data, std::make_index_sequence<SAMPLE_FIELD_COUNT>());
+        static constexpr JsonToken close = jsonClose(Mask);
+        out.raw(close.text, close.size);
+    } else {
+        char bytes[wireLength(Format, Mask)];
+        bytes[0] = static_cast<char>(SAMPLE_SCHEMA_VERSION);
+        bytes[1] = static_cast<char>(Format);
+        bytes[2] = static_cast<char>(Mask);
+        bytes[3] = 0;
+        writeWireFields<Format, Mask>(bytes, data, std::make_index_sequence<SAMPLE_FIELD_COUNT>());
+        out.raw(bytes, sizeof(bytes));
+    }
+}
+
+namespace SampleSchema {
+
+template <size_t... I>
+constexpr std::array<SampleEncodeFn, sizeof...(I)> makeEncoders(std::index_sequence<I...>) {
+    return {{&encodeSample<static_cast<SampleFormat>(I / SAMPLE_MASK_COUNT),
+                           static_cast<uint32_t>(I % SAMPLE_MASK_COUNT)>...}};
+}
+
+} // namespace SampleSchema
+
+/**
+ * The specialized serializer for a format and stream mask
+ */
+inline SampleEncodeFn sampleEncoder(SampleFormat format, uint32_t streams) {
+    static constexpr auto encoders =
+        SampleSchema::makeEncoders(std::make_index_sequence<SAMPLE_FORMAT_COUNT * SAMPLE_MASK_COUNT>());
+    return encoders[static_cast<size_t>(format) * SAMPLE_MASK_COUNT + (streams & STREAM_ALL)];
+}
+
+inline void writeSampleJson(FrameWriter& out, const TobiiDataPacket& data, uint32_t streams = STREAM_DEFAULT) {
+    sampleEncoder(SampleFormat::Json, streams)(out, data);
+}
@@ -0,0 +1,227 @@
+/**
+ * Sample Recorder
+ * Writes the session's samples and markers to a JSON-lines file in the
+ * order the main loop produced them. The main loop only copies records
+ * into a bounded single-producer ring; a background thread formats and
+ * writes them, so disk I/O never stalls distribution
+ *
+ *   {"seq":1042,"sample":{"type":"tobii-data",...}}
+ *   {"seq":1043,"marker":{"label":"stimulus-onset","timestamp":...}}
+ *   {"seq":1043,"sample":{...}}
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "frame-writer.hpp"
+#include "sample-encoder.hpp"
+#include "tobii-data-packet.hpp"
+
+/**
+ * An external event stamped on the sample clock. sequence is the first
+ * sample taken at or after timestamp, so an epoch around the marker is a
+ * range of sample sequences
+ */
+struct BridgeMarker {
+    static constexpr size_t MAX_LABEL = 63;
+    static constexpr size_t MAX_SOURCE = 31;
+
+    uint64_t timestamp;         // ms, sample clock (client time + clock offset when synced)
+    uint64_t received;          // ms, sample clock, when the bridge received it
+    uint64_t sequence;
+    double value;
+    bool hasValue;
+    bool clockCorrected;
+    char label[MAX_LABEL + 1];
+    char source[MAX_SOURCE + 1];
+};
+
+/**
+ * JSON object for a marker (label and source are JSON-safe by construction)
+ */
+inline void writeMarkerJson(FrameWriter& out, const BridgeMarker& marker) {
+    out.raw("{\"label\":\"");
+    out.raw(marker.label);
+    out.raw("\",\"timestamp\":");
+    out.number(marker.timestamp);
+    out.raw(",\"received\":");
+    out.number(marker.received);
+    out.raw(",\"sequence\":");
+    out.number(marker.sequence);
+    out.raw(",\"source\":\"");
+    out.raw(marker.source);
+    out.raw("\",\"clock_corrected\":");
+    out.boolean(marker.clockCorrected);
+    if (marker.hasValue) {
+        out.raw(",\"value\":");
+        out.number(static_cast<float>(marker.value));
+    }
+    out.raw("}");
+}
+
+/**
+ * Stamp a marker at the client's own time for it, client_time plus the
+ * offset from the client's last clock-sync. A corrected time before the
+ * sample clock's epoch is ignored and the receipt time stays
+ */
+inline bool applyClientTime(BridgeMarker& marker, double clientTimeMs, double offsetMs) {
+    const double corrected = clientTimeMs + offsetMs;
+    if (!(corrected > 0.0)) return false;
+    marker.timestamp = static_cast<uint64_t>(std::llround(corrected));
+    marker.clockCorrected = true;
+    return true;
+}
+
+/**
+ * Sequence of the first sample taken at or after timestamp, in a ring whose
+ * newest sample is latest (the next sample's when the marker is newer still)
+ */
+template <typename Ring>
+uint64_t markerSequence(const Ring& ring, uint64_t latest, uint64_t timestamp) {
+    if (timestamp > ring.at(latest).timestamp) return latest + 1;
+    uint64_t first = latest;
+    while (first > ring.begin() && ring.at(first - 1).timestamp >= timestamp) first--;
+    return first;
+}
+
+class SampleRecorder {
+private:
+    struct Entry {
+        uint64_t sequence;
+        bool isMarker;
+        TobiiDataPacket sample;
+        BridgeMarker marker;
+    };
+
+    static constexpr size_t CAPACITY = 4096;
+
+    std::unique_ptr<Entry[]> entries;
+    alignas(64) std::atomic<size_t> writePos;
+    alignas(64) std::atomic<size_t> readPos;
+
+    FILE* file;
+    std::string filePath;
+    std::atomic<bool> running;
+    std::atomic<uint64_t> recorded;
+    std::atomic<uint64_t> dropped;
+    std::thread writerThread;
+
+public:
+    SampleRecorder()
+        : entries(new Entry[CAPACITY]), writePos(0), readPos(0), file(nullptr),
+          running(false), recorded(0), dropped(0) {}
+
+    ~SampleRecorder() {
+        stop();
+    }
+
+    bool active() const { return running.load(std::memory_order_relaxed); }
+    const std::string& path() const { return filePath; }
+    uint64_t recordedCount() const { return recorded.load(std::memory_order_relaxed); }
+    uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+    /**
+     * Open path and start the writer; false if the file cannot be created
+     */
+    bool start(const std::string& path) {
+        stop();
+        file = std::fopen(path.c_str(), "wb");
+        if (!file) return false;
+
+        filePath = path;
+        writePos = 0;
+        readPos = 0;
+        recorded = 0;
+        dropped = 0;
+        running = true;
+        writerThread = std::thread(&SampleRecorder::writeLoop, this);
+        return true;
+    }
+
+    /**
+     * Write everything queued, then close the file
+     */
+    void stop() {
+        if (!running.exchange(false)) return;
+        if (writerThread.joinable()) writerThread.join();
+        std::fclose(file);
+        file = nullptr;
+    }
+
+    /**
+     * Queue a sample (main loop only); dropped if the writer has fallen a
+     * full ring behind
+     */
+    void pushSample(uint64_t sequence, const TobiiDataPacket& sample) {
+        Entry* entry = claim();
+        if (!entry) return;
+        entry->sequence = sequence;
+        entry->isMarker = false;
+        entry->sample = sample;
+        publish();
+    }
+
+    void pushMarker(const BridgeMarker& marker) {
+        Entry* entry = claim();
+        if (!entry) return;
+        entry->sequence = marker.sequence;
+        entry->isMarker = true;
+        entry->marker = marker;
+        publish();
+    }
+
+private:
+    Entry* claim() {
+        if (!running.load(std::memory_order_relaxed)) return nullptr;
+        const size_t position = writePos.load(std::memory_order_relaxed);
+        if (position - readPos.load(std::memory_order_acquire) >= CAPACITY) {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &entries[position & (CAPACITY - 1)];
+    }
+
+    void publish() {
+        writePos.store(writePos.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    void writeLoop() {
+        FixedFrameWriter<1024> line;
+        for (;;) {
+            const bool keepRunning = running.load();
+            const size_t end = writePos.load(std::memory_order_acquire);
+            size_t position = readPos.load(std::memory_order_relaxed);
+
+            for (; position != end; ++position) {
+                const Entry& entry = entries[position & (CAPACITY - 1)];
+                line.clear();
+                line.raw("{\"seq\":");
+                line.number(entry.sequence);
+                if (entry.isMarker) {
+                    line.raw(",\"marker\":");
+                    writeMarkerJson(line, entry.marker);
+                } else {
+                    line.raw(",\"sample\":");
+                    writeSampleJson(line, entry.sample);
+                }
+                line.raw("}\n");
+                std::fwrite(line.data(), 1, line.size(), file);
+                readPos.store(position + 1, std::memory_order_release);
+                recorded.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            std::fflush(file);
+            if (!keepRunning) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    }
+};
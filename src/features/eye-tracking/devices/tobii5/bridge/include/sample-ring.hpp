@@ -0,0 +1,54 @@
+/**
+ * Sample Ring
+ * The last Capacity processed samples, addressed by a monotonically
+ * increasing sequence number. Sessions keep a cursor into it, so a
+ * subscriber can catch up on recent history or resume after a stall
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "tobii-data-packet.hpp"
+
+template <size_t Capacity>
+class SampleRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "SampleRing capacity must be a power of two");
+
+private:
+    std::array<TobiiDataPacket, Capacity> samples;
+    uint64_t head;  // sequence of the next sample to be published
+
+public:
+    SampleRing() : samples(), head(0) {}
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    /**
+     * Store a sample; returns its sequence
+     */
+    uint64_t publish(const TobiiDataPacket& sample) {
+        samples[head & (Capacity - 1)] = sample;
+        return head++;
+    }
+
+    /**
+     * Sequence the next publish will get (one past the newest sample)
+     */
+    uint64_t end() const { return head; }
+
+    /**
+     * Oldest sequence still held
+     */
+    uint64_t begin() const { return head > Capacity ? head - Capacity : 0; }
+
+    bool contains(uint64_t sequence) const {
+        return sequence >= begin() && sequence < head;
+    }
+
+    const TobiiDataPacket& at(uint64_t sequence) const {
+        return samples[sequence & (Capacity - 1)];
+    }
+};
@@ -0,0 +1,266 @@
+/**
+ * Sample Schema
+ * The one declaration of the tobii-data sample: which packet member each
+ * field comes from, where it sits in the JSON message, which stream it
+ * belongs to and how it is quantized. The serializers in sample-encoder.hpp
+ * and the JavaScript decoder (--emit-js-decoder) are both generated from
+ * this table, so edit it here and regenerate the decoder
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "tobii-data-packet.hpp"
+
+enum class FieldType : uint8_t { Bool, Int32, Float32, UInt64, Tag };
+
+/**
+ * Wire encodings a client can subscribe to
+ */
+enum class SampleFormat : uint8_t { Json = 0, Binary = 1, Quantized = 2 };
+
+constexpr size_t SAMPLE_FORMAT_COUNT = 3;
+constexpr size_t SAMPLE_MASK_COUNT = STREAM_ALL + 1;
+
+constexpr const char* SAMPLE_FORMAT_NAMES[SAMPLE_FORMAT_COUNT] = {"json", "binary", "quantized"};
+
+/**
+ * Stream names used by subscribe and the decoder
+ */
+struct SampleStream {
+    const char* name;
+    uint32_t bit;
+};
+
+constexpr SampleStream SAMPLE_STREAMS[] = {
+    {"gaze", STREAM_GAZE},
+    {"head", STREAM_HEAD},
+    {"presence", STREAM_PRESENCE},
+    {"screen", STREAM_SCREEN},
+    {"prediction", STREAM_PREDICTION},
+    {"pose", STREAM_POSE},
+};
+
+/**
+ * Binary header: version, format, stream mask, reserved
+ */
+constexpr uint8_t SAMPLE_SCHEMA_VERSION = 1;
+constexpr size_t SAMPLE_HEADER_BYTES = 4;
+
+constexpr size_t NO_VALIDITY = SIZE_MAX;
+
+struct SampleField {
+    const char* path;         // JSON path, '.'-separated
+    uint32_t stream;          // StreamMask bit, 0 = always sent
+    size_t validOffset;       // bool member gating this field's JSON object, or NO_VALIDITY
+    FieldType type;
+    size_t offset;            // packet member
+    float quantStep;          // > 0: the quantized format sends round(value / step) as int16
+    const char* tag;          // constant value of Tag fields
+};
+
+#define SAMPLE_MEMBER(member) offsetof(TobiiDataPacket, member)
+
+/**
+ * Fields in JSON order. Optional objects (gaze, head) follow the always-sent
+ * fields of their parent so omitting them never leaves a dangling comma
+ */
+constexpr SampleField SAMPLE_FIELDS[] = {
+    {"data.hasGaze", 0, NO_VALIDITY, FieldType::Bool, SAMPLE_MEMBER(hasGaze), 0.0f, nullptr},
+    {"data.hasHead", 0, NO_VALIDITY, FieldType::Bool, SAMPLE_MEMBER(hasHead), 0.0f, nullptr},
+    {"data.overallQuality", 0, NO_VALIDITY, FieldType::Float32, SAMPLE_MEMBER(overallQuality), 1.0f / 32767.0f, nullptr},
+    {"data.predicted", STREAM_PREDICTION, NO_VALIDITY, FieldType::Bool, SAMPLE_MEMBER(predicted), 0.0f, nullptr},
+    {"data.predictionHorizonMs", STREAM_PREDICTION, NO_VALIDITY, FieldType::Float32, SAMPLE_MEMBER(predictionHorizonMs), 0.1f, nullptr},
+    {"data.present", STREAM_PRESENCE, NO_VALIDITY, FieldType::Bool, SAMPLE_MEMBER(present), 0.0f, nullptr},
+
+    {"data.gaze.confidence", STREAM_GAZE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeConfidence), 1.0f / 32767.0f, nullptr},
+    {"data.gaze.timestamp", STREAM_GAZE, SAMPLE_MEMBER(hasGaze), FieldType::UInt64, SAMPLE_MEMBER(gazeTimestamp), 0.0f, nullptr},
+    {"data.gaze.x", STREAM_GAZE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeX), 1.0f / 8192.0f, nullptr},
+    {"data.gaze.y", STREAM_GAZE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeY), 1.0f / 8192.0f, nullptr},
+    {"data.gaze.ray.origin.x", STREAM_POSE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeOriginX), 0.1f, nullptr},
+    {"data.gaze.ray.origin.y", STREAM_POSE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeOriginY), 0.1f, nullptr},
+    {"data.gaze.ray.origin.z", STREAM_POSE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeOriginZ), 0.1f, nullptr},
+    {"data.gaze.ray.direction.x", STREAM_POSE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeDirX), 1.0f / 32767.0f, nullptr},
+    {"data.gaze.ray.direction.y", STREAM_POSE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeDirY), 1.0f / 32767.0f, nullptr},
+    {"data.gaze.ray.direction.z", STREAM_POSE, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeDirZ), 1.0f / 32767.0f, nullptr},
+    {"data.gaze.screen.display", STREAM_SCREEN, SAMPLE_MEMBER(hasGaze), FieldType::Int32, SAMPLE_MEMBER(gazeDisplay), 0.0f, nullptr},
+    {"data.gaze.screen.u", STREAM_SCREEN, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeScreenU), 1.0f / 16384.0f, nullptr},
+    {"data.gaze.screen.v", STREAM_SCREEN, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeScreenV), 1.0f / 16384.0f, nullptr},
+    {"data.gaze.screen.x", STREAM_SCREEN, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeScreenX), 1.0f, nullptr},
+    {"data.gaze.screen.y", STREAM_SCREEN, SAMPLE_MEMBER(hasGaze), FieldType::Float32, SAMPLE_MEMBER(gazeScreenY), 1.0f, nullptr},
+
+    {"data.head.confidence", STREAM_HEAD, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headConfidence), 1.0f / 32767.0f, nullptr},
+    {"data.head.orientation.w", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headQuatW), 1.0f / 32767.0f, nullptr},
+    {"data.head.orientation.x", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headQuatX), 1.0f / 32767.0f, nullptr},
+    {"data.head.orientation.y", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headQuatY), 1.0f / 32767.0f, nullptr},
+    {"data.head.orientation.z", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headQuatZ), 1.0f / 32767.0f, nullptr},
+    {"data.head.pitch", STREAM_HEAD, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headPitch), 0.01f, nullptr},
+    {"data.head.position.x", STREAM_HEAD, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headPosX), 0.1f, nullptr},
+    {"data.head.position.y", STREAM_HEAD, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headPosY), 0.1f, nullptr},
+    {"data.head.position.z", STREAM_HEAD, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headPosZ), 0.1f, nullptr},
+    {"data.head.roll", STREAM_HEAD, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRoll), 0.01f, nullptr},
+    {"data.head.rotation.m00", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot00), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m01", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot01), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m02", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot02), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m10", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot10), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m11", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot11), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m12", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot12), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m20", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot20), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m21", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot21), 1.0f / 32767.0f, nullptr},
+    {"data.head.rotation.m22", STREAM_POSE, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headRot22), 1.0f / 32767.0f, nullptr},
+    {"data.head.yaw", STREAM_HEAD, SAMPLE_MEMBER(hasHead), FieldType::Float32, SAMPLE_MEMBER(headYaw), 0.01f, nullptr},
+
+    {"timestamp", 0, NO_VALIDITY, FieldType::UInt64, SAMPLE_MEMBER(timestamp), 0.0f, nullptr},
+    {"type", 0, NO_VALIDITY, FieldType::Tag, 0, 0.0f, "tobii-data"},
+};
+
+#undef SAMPLE_MEMBER
+
+constexpr size_t SAMPLE_FIELD_COUNT = sizeof(SAMPLE_FIELDS) / sizeof(SAMPLE_FIELDS[0]);
+
+namespace SampleSchema {
+
+constexpr bool included(size_t field, uint32_t mask) {
+    return SAMPLE_FIELDS[field].stream == 0 || (SAMPLE_FIELDS[field].stream & mask) != 0;
+}
+
+constexpr bool quantized(size_t field, SampleFormat format) {
+    return format == SampleFormat::Quantized && SAMPLE_FIELDS[field].quantStep > 0.0f;
+}
+
+/**
+ * Bytes a field occupies in a binary format (Tag fields are implied by the frame type)
+ */
+constexpr size_t wireSize(size_t field, SampleFormat format) {
+    switch (SAMPLE_FIELDS[field].type) {
+    case FieldType::Bool: return 1;
+    case FieldType::Int32: return 4;
+    case FieldType::Float32: return quantized(field, format) ? 2 : 4;
+    case FieldType::UInt64: return 8;
+    case FieldType::Tag: return 0;
+    }
+    return 0;
+}
+
+constexpr size_t wireOffset(size_t field, SampleFormat format, uint32_t mask) {
+    size_t offset = SAMPLE_HEADER_BYTES;
+    for (size_t i = 0; i < field; ++i) {
+        if (included(i, mask)) offset += wireSize(i, format);
+    }
+    return offset;
+}
+
+constexpr size_t wireLength(SampleFormat format, uint32_t mask) {
+    return wireOffset(SAMPLE_FIELD_COUNT, format, mask);
+}
+
+/**
+ * Path helpers: segment count and segment access on '.'-separated paths
+ */
+constexpr size_t depth(std::string_view path) {
+    size_t segments = 1;
+    for (char c : path) {
+        if (c == '.') segments++;
+    }
+    return segments;
+}
+
+constexpr std::string_view segment(std::string_view path, size_t index) {
+    size_t start = 0;
+    for (size_t i = 0; i < index; ++i) {
+        start = path.find('.', start) + 1;
+    }
+    const size_t end = path.find('.', start);
+    return path.substr(start, end == std::string_view::npos ? std::string_view::npos : end - start);
+}
+
+/**
+ * Number of enclosing objects two fields share
+ */
+constexpr size_t sharedContainers(std::string_view a, std::string_view b) {
+    const size_t limit = depth(a) < depth(b) ? depth(a) - 1 : depth(b) - 1;
+    size_t shared = 0;
+    while (shared < limit && segment(a, shared) == segment(b, shared)) shared++;
+    return shared;
+}
+
+/**
+ * The field this one's JSON separator is relative to: the previous field
+ * sent under mask that is either always present or in the same optional object
+ */
+constexpr size_t jsonPredecessor(size_t field, uint32_t mask) {
+    for (size_t i = field; i-- > 0;) {
+        if (!included(i, mask)) continue;
+        if (SAMPLE_FIELDS[i].validOffset == NO_VALIDITY ||
+            SAMPLE_FIELDS[i].validOffset == SAMPLE_FIELDS[field].validOffset) {
+            return i;
+        }
+    }
+    return SAMPLE_FIELD_COUNT;
+}
+
+constexpr bool lastOfOptionalObject(size_t field, uint32_t mask) {
+    if (SAMPLE_FIELDS[field].validOffset == NO_VALIDITY) return false;
+    for (size_t i = field + 1; i < SAMPLE_FIELD_COUNT; ++i) {
+        if (included(i, mask)) return SAMPLE_FIELDS[i].validOffset != SAMPLE_FIELDS[field].validOffset;
+    }
+    return true;
+}
+
+constexpr size_t lastIncluded(uint32_t mask) {
+    size_t last = 0;
+    for (size_t i = 0; i < SAMPLE_FIELD_COUNT; ++i) {
+        if (included(i, mask)) last = i;
+    }
+    return last;
+}
+
+/**
+ * Optional objects must be contiguous, never first or last, nest one level
+ * or more inside the container of the field before them (under every mask),
+ * and be gated by an always-sent bool so decoders can read the flag
+ */
+constexpr bool wellFormed() {
+    if (SAMPLE_FIELDS[0].validOffset != NO_VALIDITY || SAMPLE_FIELDS[0].stream != 0) return false;
+    if (SAMPLE_FIELDS[SAMPLE_FIELD_COUNT - 1].validOffset != NO_VALIDITY) return false;
+
+    for (size_t i = 1; i < SAMPLE_FIELD_COUNT; ++i) {
+        const SampleField& field = SAMPLE_FIELDS[i];
+        if (field.validOffset == NO_VALIDITY) continue;
+
+        bool flagSent = false;
+        for (size_t j = 0; j < SAMPLE_FIELD_COUNT; ++j) {
+            if (SAMPLE_FIELDS[j].type == FieldType::Bool && SAMPLE_FIELDS[j].stream == 0 &&
+                SAMPLE_FIELDS[j].offset == field.validOffset) {
+                flagSent = true;
+            }
+        }
+        if (!flagSent) return false;
+
+        const bool first = SAMPLE_FIELDS[i - 1].validOffset != field.validOffset;
+        for (size_t j = i + 1; first && j < SAMPLE_FIELD_COUNT; ++j) {
+            if (SAMPLE_FIELDS[j].validOffset == field.validOffset &&
+                SAMPLE_FIELDS[j - 1].validOffset != field.validOffset) {
+                return false;
+            }
+        }
+
+        for (uint32_t mask = 0; mask < SAMPLE_MASK_COUNT; ++mask) {
+            const size_t previous = jsonPredecessor(i, mask);
+            if (!included(i, mask) || SAMPLE_FIELDS[previous].validOffset == field.validOffset) continue;
+
+            const std::string_view anchor = SAMPLE_FIELDS[previous].path;
+            if (depth(field.path) <= depth(anchor) || sharedContainers(anchor, field.path) != depth(anchor) - 1) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static_assert(wellFormed(), "SAMPLE_FIELDS: optional objects must be contiguous and follow an always-sent field");
+
+} // namespace SampleSchema
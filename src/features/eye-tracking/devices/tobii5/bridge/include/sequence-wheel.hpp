@@ -0,0 +1,100 @@
+/**
+ * Sequence Wheel
+ * Parks waiters until the sample sequence they are due at is published.
+ * Each publish touches only the waiters due at that sequence, so idle and
+ * decimated subscribers cost nothing on the ticks they skip. Waiters due
+ * more than Slots sequences ahead stay parked in their slot and are passed
+ * over once per revolution
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template <typename Waiter, size_t Slots = 64>
+class SequenceWheel {
+private:
+    struct Entry {
+        Waiter waiter;
+        uint64_t due;
+    };
+
+    std::array<std::vector<Entry>, Slots> slots;
+    size_t parked;
+
+public:
+    SequenceWheel() : parked(0) {}
+
+    size_t size() const { return parked; }
+
+    void park(Waiter waiter, uint64_t due) {
+        slots[due % Slots].push_back(Entry{std::move(waiter), due});
+        parked++;
+    }
+
+    /**
+     * Wake every waiter due at sequence. wake(waiter) returns the sequence to
+     * park it at next, or 0 to drop it. Waiters rescheduled into the same
+     * slot are compacted in place, so a steady set of waiters never
+     * reallocates once every slot has grown to its peak
+     */
+    template <typename WakeFn>
+    void advance(uint64_t sequence, WakeFn&& wake) {
+        std::vector<Entry>& slot = slots[sequence % Slots];
+        size_t kept = 0;
+
+        // Waiters parked into this slot while it is being walked land after count
+        const size_t count = slot.size();
+        for (size_t i = 0; i < count; ++i) {
+            if (slot[i].due > sequence) {
+                if (kept != i) slot[kept] = std::move(slot[i]);
+                kept++;
+                continue;
+            }
+
+            Waiter waiter = std::move(slot[i].waiter);
+            parked--;
+            const uint64_t next = wake(waiter);
+            if (next == 0) continue;
+
+            if (next % Slots == sequence % Slots) {
+                slot[kept++] = Entry{std::move(waiter), next};
+                parked++;
+            } else {
+                park(std::move(waiter), next);
+            }
+        }
+
+        // Keep anything parked here during the walk
+        for (size_t i = count; i < slot.size(); ++i) {
+            slot[kept++] = std::move(slot[i]);
+        }
+        slot.resize(kept);
+    }
+
+    /**
+     * Drop a waiter wherever it is parked; returns whether it was. Scans
+     * every slot, so it is for cold paths such as a disconnect, and never
+     * from inside advance()'s wake
+     */
+    bool remove(const Waiter& waiter) {
+        for (auto& slot : slots) {
+            for (size_t i = 0; i < slot.size(); ++i) {
+                if (slot[i].waiter == waiter) {
+                    slot.erase(slot.begin() + static_cast<std::ptrdiff_t>(i));
+                    parked--;
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void clear() {
+        for (auto& slot : slots) slot.clear();
+        parked = 0;
+    }
+};
@@ -0,0 +1,111 @@
+/**
+ * Synthetic Source
+ * Hardware-free tracker source producing plausible fixation/saccade gaze and
+ * slow head sway, so the bridge can be run and load-tested on any platform.
+ * The pursuit motion instead follows a smooth moving target, sampled at a
+ * 90 Hz tracker rate whatever the bridge tick, for exercising prediction
+ */
+
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+
+#include "bridge-clock.hpp"
+#include "tracker-source.hpp"
+
+enum class SyntheticMotion { Saccades, Pursuit };
+
+class SyntheticSource : public TrackerSource {
+private:
+    static constexpr uint64_t PURSUIT_FRAME_MICROS = 11111;    // 90 Hz
+    static constexpr float TWO_PI = 6.28318530718f;
+
+    SyntheticMotion motion;
+    std::mt19937 rng;
+    std::uniform_real_distribution<float> screenDist;
+    std::normal_distribution<float> jitterDist;
+    BridgeClock& clock;
+    uint64_t startMicros;
+
+    uint64_t nowMicros;
+    uint64_t nextSaccadeMicros;
+    float fixationX, fixationY;
+
+    // Pursuit: the latest tracker frame and where it put the gaze
+    uint64_t pursuitFrame;
+    float pursuitX, pursuitY;
+
+public:
+    explicit SyntheticSource(BridgeClock& clock = BridgeClock::system(), uint32_t seed = 5489u,
+                             SyntheticMotion motion = SyntheticMotion::Saccades)
+        : motion(motion), rng(seed), screenDist(0.05f, 0.95f),
+          jitterDist(0.0f, motion == SyntheticMotion::Pursuit ? 0.001f : 0.004f),
+          clock(clock), startMicros(clock.monotonicMicros()), nowMicros(0),
+          nextSaccadeMicros(0), fixationX(0.5f), fixationY(0.5f), pursuitFrame(UINT64_MAX), pursuitX(0.5f),
+          pursuitY(0.5f) {}
+
+    const char* name() const override {
+        return motion == SyntheticMotion::Pursuit ? "synthetic-pursuit" : "synthetic";
+    }
+
+    bool initialize() override {
+        startMicros = clock.monotonicMicros();
+        nowMicros = 0;
+        nextSaccadeMicros = 0;
+        pursuitFrame = UINT64_MAX;
+        return true;
+    }
+
+    void update() override {
+        nowMicros = clock.monotonicMicros() - startMicros;
+
+        if (motion == SyntheticMotion::Pursuit) {
+            // A Lissajous path under 0.5 display widths/s, measured once per tracker frame
+            const uint64_t frame = nowMicros - nowMicros % PURSUIT_FRAME_MICROS;
+            if (frame != pursuitFrame) {
+                const float t = static_cast<float>(frame) * 1e-6f;
+                pursuitFrame = frame;
+                pursuitX = 0.5f + 0.25f * std::cos(TWO_PI * 0.2f * t) + jitterDist(rng);
+                pursuitY = 0.5f + 0.2f * std::sin(TWO_PI * 0.3f * t) + jitterDist(rng);
+            }
+            return;
+        }
+
+        // Hold a fixation for 150-450 ms, then jump to a new target
+        if (nowMicros >= nextSaccadeMicros) {
+            fixationX = screenDist(rng);
+            fixationY = screenDist(rng);
+            nextSaccadeMicros = nowMicros + 150000 + rng() % 300000;
+        }
+    }
+
+    bool getLatestGaze(GazeReading& out) override {
+        if (motion == SyntheticMotion::Pursuit) {
+            out.x = pursuitX;
+            out.y = pursuitY;
+            out.timestamp = pursuitFrame;
+            return true;
+        }
+        out.x = fixationX + jitterDist(rng);
+        out.y = fixationY + jitterDist(rng);
+        out.timestamp = nowMicros;
+        return true;
+    }
+
+    bool getLatestHead(HeadReading& out) override {
+        const float t = static_cast<float>(nowMicros) * 1e-6f;
+        out.yaw = 12.0f * std::sin(0.40f * t);
+        out.pitch = 6.0f * std::sin(0.27f * t + 1.0f);
+        out.roll = 3.0f * std::sin(0.19f * t + 2.0f);
+        out.posX = 20.0f * std::sin(0.11f * t);
+        out.posY = 10.0f * std::sin(0.13f * t + 0.5f);
+        out.posZ = 600.0f + 30.0f * std::sin(0.07f * t);
+        return true;
+    }
+
+    bool isPresent() override {
+        return true;
+    }
+};
@@ -0,0 +1,90 @@
+/**
+ * TGI Source
+ * Tracker source backed by the Tobii Game Integration API (Windows only)
+ */
+
+#pragma once
+
+#include <iostream>
+#include <exception>
+
+#include "tracker-source.hpp"
+#include "tobii_gameintegration.h"
+
+class TgiSource : public TrackerSource {
+private:
+    TobiiGameIntegration::ITobiiGameIntegrationApi* tgiApi;
+    TobiiGameIntegration::IStreamsProvider* streams;
+
+public:
+    TgiSource() : tgiApi(nullptr), streams(nullptr) {}
+
+    const char* name() const override { return "tgi"; }
+
+    bool initialize() override {
+        try {
+            // The watchdog reinitializes a lost tracker; drop the old instance first
+            if (tgiApi) {
+                tgiApi->Shutdown();
+                tgiApi = nullptr;
+                streams = nullptr;
+            }
+
+            tgiApi = TobiiGameIntegration::GetApi("Synopticon Tobii Bridge v1.0");
+            if (!tgiApi) {
+                std::cerr << "Failed to get TGI API instance" << std::endl;
+                return false;
+            }
+
+            streams = tgiApi->GetStreamsProvider();
+            if (!streams) {
+                std::cerr << "Failed to get streams provider" << std::endl;
+                return false;
+            }
+
+            // Setup window tracking (required for TGI)
+            // This would need actual window handle in production
+            // tgiApi->GetTrackerController()->TrackWindow(GetConsoleWindow());
+
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Exception initializing Tobii: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    void update() override {
+        if (tgiApi) tgiApi->Update();
+    }
+
+    bool getLatestGaze(GazeReading& out) override {
+        TobiiGameIntegration::GazePoint gazePoint;
+        if (!streams || !streams->GetLatestGazePoint(gazePoint)) return false;
+
+        out.x = gazePoint.X;
+        out.y = gazePoint.Y;
+        out.timestamp = gazePoint.Timestamp;
+        return true;
+    }
+
+    bool getLatestHead(HeadReading& out) override {
+        TobiiGameIntegration::HeadPose headPose;
+        if (!streams || !streams->GetLatestHeadPose(headPose)) return false;
+
+        out.yaw = headPose.Rotation.YawDegrees;
+        out.pitch = headPose.Rotation.PitchDegrees;
+        out.roll = headPose.Rotation.RollDegrees;
+        out.posX = headPose.Position.X;
+        out.posY = headPose.Position.Y;
+        out.posZ = headPose.Position.Z;
+        return true;
+    }
+
+    bool isPresent() override {
+        return streams && streams->IsPresent();
+    }
+
+    GazeSpace gazeSpace() const override {
+        return GazeSpace::Centered;
+    }
+};
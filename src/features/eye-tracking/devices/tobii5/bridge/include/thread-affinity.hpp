@@ -0,0 +1,29 @@
+/**
+ * Thread Affinity
+ * Pin the calling thread to one CPU (Windows and Linux; no-op elsewhere)
+ */
+
+#pragma once
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+inline bool pinCurrentThread(int cpu) {
+    if (cpu < 0) return true;
+
+#ifdef _WIN32
+    if (cpu >= static_cast<int>(sizeof(DWORD_PTR) * 8)) return false;
+    return SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu) != 0;
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,65 @@
+/**
+ * Tobii Data Packet
+ * The per-tick sample shared by processing, serialization and distribution
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * Tobii data packet structure
+ */
+struct TobiiDataPacket {
+    uint64_t timestamp;
+
+    // Gaze data
+    bool hasGaze;
+    float gazeX, gazeY;
+    uint64_t gazeTimestamp;
+    float gazeConfidence;
+
+    // Gaze mapped onto a client's display geometry (per subscriber)
+    int32_t gazeDisplay;
+    float gazeScreenX, gazeScreenY;
+    float gazeScreenU, gazeScreenV;
+
+    // Head pose data
+    bool hasHead;
+    float headYaw, headPitch, headRoll;
+    float headPosX, headPosY, headPosZ;
+    float headConfidence;
+
+    // Presence detection
+    bool present;
+
+    // Latency compensation (per subscriber): values moved forward by the horizon
+    bool predicted;
+    float predictionHorizonMs;
+
+    // Quality metrics
+    float overallQuality;
+
+    // 3D pose in the configured world frame (pose-math.hpp): head orientation
+    // as a quaternion and a row-major matrix, and the gaze ray
+    float headQuatW, headQuatX, headQuatY, headQuatZ;
+    float headRot00, headRot01, headRot02;
+    float headRot10, headRot11, headRot12;
+    float headRot20, headRot21, headRot22;
+    float gazeOriginX, gazeOriginY, gazeOriginZ;
+    float gazeDirX, gazeDirY, gazeDirZ;
+};
+
+/**
+ * Streams a WebSocket client can subscribe to
+ */
+enum StreamMask : uint32_t {
+    STREAM_GAZE = 1u << 0,
+    STREAM_HEAD = 1u << 1,
+    STREAM_PRESENCE = 1u << 2,
+    STREAM_SCREEN = 1u << 3,    // needs a registered display geometry
+    STREAM_PREDICTION = 1u << 4,    // needs subscribe's predict
+    STREAM_POSE = 1u << 5,          // opt-in: head orientation and the 3D gaze ray
+    STREAM_DEFAULT = STREAM_GAZE | STREAM_HEAD | STREAM_PRESENCE,
+    STREAM_ALL = STREAM_DEFAULT | STREAM_SCREEN | STREAM_PREDICTION | STREAM_POSE
+};
@@ -0,0 +1,247 @@
+/**
+ * Tobii Bridge C API
+ * The bridge core (tracker source, processing, sample ring, gaze rules and
+ * history) for in-process consumers, with no network in between. Plain C
+ * so it can be loaded from any language; a Node addon wraps these calls.
+ *
+ * The ABI is stable within TOBIIBRIDGE_API_VERSION: functions and structs
+ * are only ever added, and tobiibridge_stats grows at its end (callers set
+ * struct_size). All functions are safe to call from any thread; calls
+ * that drive the bridge (tick, start, stop) are serialized
+ */
+
+#ifndef TOBIIBRIDGE_H
+#define TOBIIBRIDGE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#  ifdef TOBIIBRIDGE_BUILD
+#    define TOBIIBRIDGE_API __declspec(dllexport)
+#  else
+#    define TOBIIBRIDGE_API __declspec(dllimport)
+#  endif
+#else
+#  define TOBIIBRIDGE_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TOBIIBRIDGE_API_VERSION 1
+
+/* Return codes; details of the last failure on the calling thread come from tobiibridge_last_error() */
+#define TOBIIBRIDGE_OK 0
+#define TOBIIBRIDGE_ERROR_ARGUMENT (-1)    /* bad argument, options or rules */
+#define TOBIIBRIDGE_ERROR_SOURCE (-2)      /* the tracker source is lost; the watchdog retries it */
+#define TOBIIBRIDGE_ERROR_STATE (-3)       /* tick() while started, start() twice */
+#define TOBIIBRIDGE_TIMEOUT (-4)
+#define TOBIIBRIDGE_OVERWRITTEN (-5)       /* the sequence has left the ring */
+
+/* Sample wire formats and streams for tobiibridge_encode, as the WebSocket server sends them */
+#define TOBIIBRIDGE_FORMAT_JSON 0
+#define TOBIIBRIDGE_FORMAT_BINARY 1
+#define TOBIIBRIDGE_FORMAT_QUANTIZED 2
+
+#define TOBIIBRIDGE_STREAM_GAZE (1u << 0)
+#define TOBIIBRIDGE_STREAM_HEAD (1u << 1)
+#define TOBIIBRIDGE_STREAM_PRESENCE (1u << 2)
+
+#define TOBIIBRIDGE_RING_CAPACITY 256
+#define TOBIIBRIDGE_HISTORY_CHANNELS 9
+
+typedef struct tobiibridge tobiibridge;
+
+/**
+ * One published sample, laid out as the core stores it. Flags are 0 or 1.
+ * Gaze is as the source reports it (see gaze_centered in the stats);
+ * head angles are in degrees and positions in mm
+ */
+typedef struct tobiibridge_sample {
+    uint64_t timestamp;             /* ms, bridge wall clock */
+
+    uint8_t has_gaze;
+    float gaze_x, gaze_y;
+    uint64_t gaze_timestamp;
+    float gaze_confidence;
+
+    /* Display mapping and prediction are per WebSocket subscriber; unset here */
+    int32_t gaze_display;
+    float gaze_screen_x, gaze_screen_y;
+    float gaze_screen_u, gaze_screen_v;
+
+    uint8_t has_head;
+    float head_yaw, head_pitch, head_roll;
+    float head_x, head_y, head_z;
+    float head_confidence;
+
+    uint8_t present;
+
+    uint8_t predicted;
+    float prediction_horizon_ms;
+
+    float quality;
+} tobiibridge_sample;
+
+/**
+ * A sample's 3D pose, in the world frame set by the "pose" option: the head
+ * orientation as a unit quaternion and as a row-major rotation matrix, and
+ * the gaze ray from the head (or the nominal eye position while the head is
+ * not tracked) through the gaze point. The origin is in world units, the
+ * direction unit length. Meaningful where has_head / has_gaze are set
+ */
+typedef struct tobiibridge_pose {
+    uint8_t has_head;
+    uint8_t has_gaze;
+    float orientation[4];           /* w, x, y, z */
+    float rotation[9];
+    float gaze_origin[3];
+    float gaze_direction[3];
+} tobiibridge_pose;
+
+/**
+ * A fired gaze rule; names are NUL-terminated, aoi is empty for rules without one
+ */
+typedef struct tobiibridge_event {
+    char rule[33];
+    char kind[16];
+    char aoi[33];
+    uint64_t timestamp;
+    uint64_t duration_ms;
+    float value;
+} tobiibridge_event;
+
+/**
+ * One history point. Channels are gaze_x, gaze_y, head_yaw, head_pitch,
+ * head_roll, head_x, head_y, head_z and quality; a channel with no
+ * readings in the point has count 0
+ */
+typedef struct tobiibridge_history_point {
+    uint64_t start_ms;
+    uint32_t samples;
+    float present;                  /* share of samples with a user present, 0 without samples */
+    float min[TOBIIBRIDGE_HISTORY_CHANNELS];
+    float max[TOBIIBRIDGE_HISTORY_CHANNELS];
+    float mean[TOBIIBRIDGE_HISTORY_CHANNELS];
+    uint32_t count[TOBIIBRIDGE_HISTORY_CHANNELS];
+} tobiibridge_history_point;
+
+typedef struct tobiibridge_stats {
+    uint32_t struct_size;           /* set by the caller to sizeof(tobiibridge_stats) */
+    uint8_t connected;
+    uint8_t gaze_centered;          /* gaze is -1..1 from the centre, +y up, instead of 0..1 from the top-left */
+    uint64_t samples_processed;
+    uint64_t samples_published;     /* also the next sequence */
+    uint64_t outages;
+    uint64_t outage_ms;
+    uint64_t events_pending;
+    uint64_t events_dropped;
+    uint64_t history_first_ms;
+    uint64_t history_newest_ms;
+} tobiibridge_stats;
+
+TOBIIBRIDGE_API int tobiibridge_api_version(void);
+
+/**
+ * Message for the last failure on the calling thread ("" if none)
+ */
+TOBIIBRIDGE_API const char* tobiibridge_last_error(void);
+
+/**
+ * Open a source ("synthetic", or "tgi" on Windows) and initialize it.
+ * options_json (may be NULL) takes the bridge config keys that apply to the
+ * core (loop_interval_ms, gaze_smoothing, watchdog, prediction, pose) and
+ * "faults", a fault injection spec. A source that is not there yet is
+ * retried by the watchdog, so open succeeds without a tracker. Returns NULL
+ * on bad arguments
+ */
+TOBIIBRIDGE_API tobiibridge* tobiibridge_open(const char* source, const char* options_json);
+
+/**
+ * Stop the driving thread and free the handle; no other call on it may be in flight
+ */
+TOBIIBRIDGE_API void tobiibridge_close(tobiibridge* bridge);
+
+/**
+ * Acquire, process and publish one sample on the calling thread, for
+ * callers with their own loop. Returns the new sample's sequence, or a
+ * negative code. Concurrent calls run one at a time; while started it
+ * fails with TOBIIBRIDGE_ERROR_STATE
+ */
+TOBIIBRIDGE_API int64_t tobiibridge_tick(tobiibridge* bridge);
+
+/**
+ * Tick on a thread of the bridge's own every loop_interval_ms, until stop or close
+ */
+TOBIIBRIDGE_API int tobiibridge_start(tobiibridge* bridge);
+TOBIIBRIDGE_API int tobiibridge_stop(tobiibridge* bridge);
+
+/**
+ * Sequence the next sample will get (one past the newest)
+ */
+TOBIIBRIDGE_API uint64_t tobiibridge_sequence(const tobiibridge* bridge);
+
+/**
+ * Block until the sample with this sequence is published, timeout_ms
+ * passes (negative waits without limit) or the driving thread is stopped.
+ * Returns the new end sequence, or TOBIIBRIDGE_TIMEOUT
+ */
+TOBIIBRIDGE_API int64_t tobiibridge_wait(tobiibridge* bridge, uint64_t sequence, int32_t timeout_ms);
+
+/**
+ * The ring slot of a published sample, without copying it. The slot is
+ * reused TOBIIBRIDGE_RING_CAPACITY samples later: read what you need, then
+ * confirm with tobiibridge_sample_valid. NULL for a sequence not published
+ * yet or already overwritten
+ */
+TOBIIBRIDGE_API const tobiibridge_sample* tobiibridge_sample_at(const tobiibridge* bridge, uint64_t sequence);
+TOBIIBRIDGE_API int tobiibridge_sample_valid(const tobiibridge* bridge, uint64_t sequence);
+
+/**
+ * Copy a sample out, checked; TOBIIBRIDGE_OVERWRITTEN if it left the ring
+ */
+TOBIIBRIDGE_API int tobiibridge_read(const tobiibridge* bridge, uint64_t sequence, tobiibridge_sample* out);
+
+/**
+ * Copy a sample's pose out, checked like tobiibridge_read. The pose lives in
+ * the ring slot after the fields tobiibridge_sample covers
+ */
+TOBIIBRIDGE_API int tobiibridge_read_pose(const tobiibridge* bridge, uint64_t sequence, tobiibridge_pose* out);
+
+/**
+ * Replace the AOIs and gaze rules, in the WebSocket set-rules format, with
+ * AOIs in unit coordinates on the tracked display. NULL clears them
+ */
+TOBIIBRIDGE_API int tobiibridge_set_rules(tobiibridge* bridge, const char* rules_json);
+
+/**
+ * Take up to capacity fired rule events, oldest first; returns the number taken
+ */
+TOBIIBRIDGE_API size_t tobiibridge_poll_events(tobiibridge* bridge, tobiibridge_event* out, size_t capacity);
+
+/**
+ * At most `points` history points over [from_ms, to_ms] (0 for to_ms means
+ * the newest sample), oldest first, skipping points with no samples. The
+ * point width is stored in *point_ms when it is not NULL. Returns the
+ * number written, at most capacity
+ */
+TOBIIBRIDGE_API size_t tobiibridge_history(const tobiibridge* bridge, uint64_t from_ms, uint64_t to_ms, size_t points,
+                                           tobiibridge_history_point* out, size_t capacity, uint64_t* point_ms);
+
+TOBIIBRIDGE_API int tobiibridge_get_stats(const tobiibridge* bridge, tobiibridge_stats* stats);
+
+/**
+ * Serialize a sample into a wire format; returns its length, or 0 if it
+ * does not fit in capacity or the format is unknown. Only the streams above
+ * apply: the sample may be a caller's copy, which ends before the pose
+ */
+TOBIIBRIDGE_API size_t tobiibridge_encode(const tobiibridge_sample* sample, int format, uint32_t streams,
+                                          char* out, size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TOBIIBRIDGE_H */
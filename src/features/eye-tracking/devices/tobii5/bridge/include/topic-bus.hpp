@@ -0,0 +1,313 @@
+/**
+ * Topic Bus
+ * The tick's output split into topics, each with a preallocated ring that
+ * fills at the topic's own rate: gaze and head when their readings change,
+ * presence on transitions, events (markers, quality alerts, tracker
+ * outages) as they happen and quality once per second. Transports keep a
+ * TopicCursor and read only the topics they subscribed to, so a low-rate
+ * topic never costs a frame per tick
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "frame-writer.hpp"
+#include "quality-monitor.hpp"
+#include "tobii-data-packet.hpp"
+
+enum class Topic : uint8_t { Gaze, Head, Presence, Events, Quality };
+
+constexpr size_t TOPIC_COUNT = 5;
+
+constexpr const char* TOPIC_NAMES[TOPIC_COUNT] = {"gaze", "head", "presence", "events", "quality"};
+
+enum TopicMask : uint32_t {
+    TOPIC_GAZE = 1u << 0,
+    TOPIC_HEAD = 1u << 1,
+    TOPIC_PRESENCE = 1u << 2,
+    TOPIC_EVENTS = 1u << 3,
+    TOPIC_QUALITY = 1u << 4,
+    TOPIC_ALL = TOPIC_GAZE | TOPIC_HEAD | TOPIC_PRESENCE | TOPIC_EVENTS | TOPIC_QUALITY
+};
+
+inline uint32_t topicBit(Topic topic) { return 1u << static_cast<uint32_t>(topic); }
+
+struct GazeTopicEntry {
+    uint64_t timestamp;         // ms, sample clock
+    uint64_t gazeTimestamp;     // tracker's own stamp
+    float x, y;
+    float confidence;
+};
+
+struct HeadTopicEntry {
+    uint64_t timestamp;
+    float yaw, pitch, roll;
+    float x, y, z;
+    float confidence;
+};
+
+struct PresenceTopicEntry {
+    uint64_t timestamp;
+    bool present;
+};
+
+enum class TopicEventKind : uint8_t { Marker, QualityAlert, QualityCleared, TrackerLost, TrackerRestored };
+
+constexpr const char* TOPIC_EVENT_NAMES[] = {"marker", "quality-alert", "quality-cleared", "tracker-lost",
+                                             "tracker-restored"};
+
+/**
+ * A derived event. name is the marker label, the quality metric, the
+ * outage reason or the restored source; value the marker value, metric
+ * value or outage length (ms)
+ */
+struct EventTopicEntry {
+    static constexpr size_t MAX_NAME = 63;
+    static constexpr size_t MAX_SOURCE = 31;
+
+    uint64_t timestamp;
+    uint64_t sequence;          // markers: the sample they resolved to
+    double value;
+    float threshold;            // quality alerts
+    bool hasValue;
+    TopicEventKind kind;
+    char name[MAX_NAME + 1];
+    char source[MAX_SOURCE + 1];    // markers: who sent it
+
+    EventTopicEntry() : timestamp(0), sequence(0), value(0.0), threshold(0.0f), hasValue(false),
+                        kind(TopicEventKind::Marker), name(), source() {}
+
+    EventTopicEntry(TopicEventKind eventKind, uint64_t at, const char* eventName)
+        : EventTopicEntry() {
+        kind = eventKind;
+        timestamp = at;
+        std::strncpy(name, eventName ? eventName : "", MAX_NAME);
+    }
+};
+
+/**
+ * JSON member for one entry ("<topic>":value) of a tobii-topic frame; event
+ * names and sources are JSON-safe by construction
+ */
+inline void writeTopicJson(FrameWriter& out, const GazeTopicEntry& gaze) {
+    out.raw("\"gaze\":{\"x\":");
+    out.number(gaze.x);
+    out.raw(",\"y\":");
+    out.number(gaze.y);
+    out.raw(",\"confidence\":");
+    out.number(gaze.confidence);
+    out.raw(",\"timestamp\":");
+    out.number(gaze.gazeTimestamp);
+    out.raw("}");
+}
+
+inline void writeTopicJson(FrameWriter& out, const HeadTopicEntry& head) {
+    out.raw("\"head\":{\"yaw\":");
+    out.number(head.yaw);
+    out.raw(",\"pitch\":");
+    out.number(head.pitch);
+    out.raw(",\"roll\":");
+    out.number(head.roll);
+    out.raw(",\"x\":");
+    out.number(head.x);
+    out.raw(",\"y\":");
+    out.number(head.y);
+    out.raw(",\"z\":");
+    out.number(head.z);
+    out.raw(",\"confidence\":");
+    out.number(head.confidence);
+    out.raw("}");
+}
+
+inline void writeTopicJson(FrameWriter& out, const PresenceTopicEntry& presence) {
+    out.raw("\"present\":");
+    out.boolean(presence.present);
+}
+
+inline void writeTopicJson(FrameWriter& out, const EventTopicEntry& event) {
+    out.raw("\"event\":{\"kind\":\"");
+    out.raw(TOPIC_EVENT_NAMES[static_cast<size_t>(event.kind)]);
+    out.raw("\",\"name\":\"");
+    out.raw(event.name);
+    out.raw("\"");
+    if (event.kind == TopicEventKind::Marker) {
+        out.raw(",\"source\":\"");
+        out.raw(event.source);
+        out.raw("\",\"sequence\":");
+        out.number(event.sequence);
+    }
+    if (event.kind == TopicEventKind::QualityAlert || event.kind == TopicEventKind::QualityCleared) {
+        out.raw(",\"threshold\":");
+        out.number(event.threshold);
+    }
+    if (event.hasValue) {
+        out.raw(",\"value\":");
+        out.number(static_cast<float>(event.value));
+    }
+    out.raw("}");
+}
+
+inline void writeTopicJson(FrameWriter& out, const QualitySnapshot& quality) {
+    out.raw("\"quality\":{\"rate_hz\":");
+    out.number(quality.rateHz);
+    out.raw(",\"gaze_ratio\":");
+    out.number(quality.gazeRatio);
+    out.raw(",\"head_ratio\":");
+    out.number(quality.headRatio);
+    out.raw(",\"presence_ratio\":");
+    out.number(quality.presenceRatio);
+    out.raw(",\"longest_gap_ms\":");
+    out.number(static_cast<uint64_t>(quality.longestGapMs));
+    out.raw(",\"current_gap_ms\":");
+    out.number(static_cast<uint64_t>(quality.currentGapMs));
+    out.raw(",\"alerts\":");
+    out.number(static_cast<uint64_t>(quality.alerts));
+    out.raw("}");
+}
+
+/**
+ * SampleRing's addressing for any entry type
+ */
+template <typename Entry, size_t Capacity>
+class TopicRing {
+    static_assert((Capacity & (Capacity - 1)) == 0, "TopicRing capacity must be a power of two");
+
+private:
+    std::array<Entry, Capacity> entries;
+    uint64_t head;
+
+public:
+    TopicRing() : entries(), head(0) {}
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    uint64_t publish(const Entry& entry) {
+        entries[head & (Capacity - 1)] = entry;
+        return head++;
+    }
+
+    uint64_t end() const { return head; }
+    uint64_t begin() const { return head > Capacity ? head - Capacity : 0; }
+    const Entry& at(uint64_t sequence) const { return entries[sequence & (Capacity - 1)]; }
+};
+
+/**
+ * A subscriber's read position in every topic
+ */
+struct TopicCursor {
+    std::array<uint64_t, TOPIC_COUNT> next{};
+};
+
+class TopicBus {
+public:
+    // Sized for several seconds of each topic at its natural rate
+    using GazeRing = TopicRing<GazeTopicEntry, 256>;
+    using HeadRing = TopicRing<HeadTopicEntry, 256>;
+    using PresenceRing = TopicRing<PresenceTopicEntry, 64>;
+    using EventRing = TopicRing<EventTopicEntry, 64>;
+    using QualityRing = TopicRing<QualitySnapshot, 16>;
+
+private:
+    GazeRing gazeRing;
+    HeadRing headRing;
+    PresenceRing presenceRing;
+    EventRing eventRing;
+    QualityRing qualityRing;
+
+    // Last published values, to publish on change only
+    uint64_t lastGazeTimestamp;
+    HeadTopicEntry lastHead;
+    bool hasLastHead;
+    bool lastPresent;
+    bool hasLastPresence;
+
+public:
+    TopicBus() : lastGazeTimestamp(0), lastHead(), hasLastHead(false), lastPresent(false), hasLastPresence(false) {}
+
+    /**
+     * Split a published sample into the gaze, head and presence topics;
+     * each only takes it when its reading changed
+     */
+    void publishSample(const TobiiDataPacket& sample) {
+        if (sample.hasGaze && sample.gazeTimestamp != lastGazeTimestamp) {
+            lastGazeTimestamp = sample.gazeTimestamp;
+            gazeRing.publish({sample.timestamp, sample.gazeTimestamp, sample.gazeX, sample.gazeY,
+                              sample.gazeConfidence});
+        }
+        if (sample.hasHead) {
+            const HeadTopicEntry head{sample.timestamp, sample.headYaw, sample.headPitch, sample.headRoll,
+                                      sample.headPosX, sample.headPosY, sample.headPosZ, sample.headConfidence};
+            if (!hasLastHead || head.yaw != lastHead.yaw || head.pitch != lastHead.pitch ||
+                head.roll != lastHead.roll || head.x != lastHead.x || head.y != lastHead.y || head.z != lastHead.z) {
+                headRing.publish(head);
+                lastHead = head;
+                hasLastHead = true;
+            }
+        }
+        if (!hasLastPresence || sample.present != lastPresent) {
+            presenceRing.publish({sample.timestamp, sample.present});
+            lastPresent = sample.present;
+            hasLastPresence = true;
+        }
+    }
+
+    uint64_t publishEvent(const EventTopicEntry& event) { return eventRing.publish(event); }
+    uint64_t publishQuality(const QualitySnapshot& quality) { return qualityRing.publish(quality); }
+
+    const GazeRing& gaze() const { return gazeRing; }
+    const HeadRing& head() const { return headRing; }
+    const PresenceRing& presence() const { return presenceRing; }
+    const EventRing& events() const { return eventRing; }
+    const QualityRing& quality() const { return qualityRing; }
+
+    uint64_t end(Topic topic) const {
+        switch (topic) {
+        case Topic::Gaze: return gazeRing.end();
+        case Topic::Head: return headRing.end();
+        case Topic::Presence: return presenceRing.end();
+        case Topic::Events: return eventRing.end();
+        case Topic::Quality: return qualityRing.end();
+        }
+        return 0;
+    }
+
+    /**
+     * A cursor at the current end of every topic (live entries only)
+     */
+    TopicCursor cursorAtEnd() const {
+        TopicCursor cursor;
+        for (size_t t = 0; t < TOPIC_COUNT; ++t) cursor.next[t] = end(static_cast<Topic>(t));
+        return cursor;
+    }
+
+    /**
+     * Hand visit(topic, sequence, entry) every entry published since the
+     * cursor in the topics of mask, topic by topic and oldest first, and
+     * advance the cursor past them (and past unsubscribed topics). Entries a
+     * slow reader let the ring overwrite are skipped
+     */
+    template <typename Visit>
+    void read(TopicCursor& cursor, uint32_t mask, Visit&& visit) const {
+        readRing(Topic::Events, eventRing, cursor, mask, visit);
+        readRing(Topic::Presence, presenceRing, cursor, mask, visit);
+        readRing(Topic::Gaze, gazeRing, cursor, mask, visit);
+        readRing(Topic::Head, headRing, cursor, mask, visit);
+        readRing(Topic::Quality, qualityRing, cursor, mask, visit);
+    }
+
+private:
+    template <typename Ring, typename Visit>
+    static void readRing(Topic topic, const Ring& ring, TopicCursor& cursor, uint32_t mask, Visit& visit) {
+        uint64_t& next = cursor.next[static_cast<size_t>(topic)];
+        if (mask & topicBit(topic)) {
+            for (next = next < ring.begin() ? ring.begin() : next; next < ring.end(); ++next) {
+                visit(topic, next, ring.at(next));
+            }
+        }
+        next = ring.end();
+    }
+};
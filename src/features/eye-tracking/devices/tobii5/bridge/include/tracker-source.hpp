@@ -0,0 +1,50 @@
+/**
+ * Tracker Source
+ * Abstraction over the device the bridge samples each tick, so the server
+ * loop runs the same against TGI hardware or the synthetic generator
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * How a source normalizes gaze on the display it is mounted on
+ */
+enum class GazeSpace {
+    Unit,       // 0..1, origin top-left, +y down
+    Centered    // -1..1, origin at the centre, +y up (TGI GazePoint)
+};
+
+/**
+ * Latest gaze point as reported by a source (normalized display coordinates)
+ */
+struct GazeReading {
+    float x, y;
+    uint64_t timestamp;
+};
+
+/**
+ * Latest head pose as reported by a source (degrees / millimetres)
+ */
+struct HeadReading {
+    float yaw, pitch, roll;
+    float posX, posY, posZ;
+};
+
+/**
+ * Tracker source interface polled once per main loop tick
+ */
+class TrackerSource {
+public:
+    virtual ~TrackerSource() = default;
+
+    virtual const char* name() const = 0;
+    virtual bool initialize() = 0;
+    virtual void update() = 0;
+    virtual bool getLatestGaze(GazeReading& out) = 0;
+    virtual bool getLatestHead(HeadReading& out) = 0;
+    virtual bool isPresent() = 0;
+
+    virtual GazeSpace gazeSpace() const { return GazeSpace::Unit; }
+};
@@ -0,0 +1,149 @@
+/**
+ * Tracker Watchdog
+ * Notices when the tracker source stops delivering: an update() that runs
+ * longer than the stall limit, one that throws, or readings that have not
+ * changed for the stale limit. A lost source is reinitialized on an
+ * exponential backoff schedule while the network side keeps running, and
+ * each outage is kept as a window for status reports
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+struct WatchdogSettings {
+    uint64_t staleMicros = 3000000;     // no fresh reading for this long; 0 = never stale
+    uint64_t stallMicros = 1000000;     // one update() this slow; 0 = never stalled
+    uint64_t retryMicros = 500000;      // first reinitialization attempt after losing the source
+    uint64_t maxRetryMicros = 30000000;
+};
+
+/**
+ * One period without a working source, on the sample clock (ms)
+ */
+struct TrackerOutage {
+    uint64_t startMs = 0;
+    uint64_t endMs = 0;             // 0 while it lasts
+    const char* reason = "";        // stale, stalled or exception
+    uint32_t attempts = 0;          // reinitializations tried
+};
+
+/**
+ * Not thread-safe; the main loop drives it and status readers take the
+ * same lock as its transitions
+ */
+class TrackerWatchdog {
+public:
+    static constexpr size_t HISTORY = 8;
+
+private:
+    WatchdogSettings settings;
+
+    // Running source (main loop only)
+    uint64_t lastFresh;
+
+    // Lost source
+    bool lost;
+    uint64_t retryAt;
+    uint64_t retryDelay;
+
+    // Outage history, newest last
+    std::array<TrackerOutage, HISTORY> history;
+    size_t historyCount;
+    uint64_t outages;
+    uint64_t outageMs;
+
+public:
+    TrackerWatchdog()
+        : lastFresh(0), lost(false), retryAt(0), retryDelay(0), history(), historyCount(0), outages(0), outageMs(0) {}
+
+    void configure(const WatchdogSettings& next) { settings = next; }
+
+    bool sourceLost() const { return lost; }
+    uint64_t outageCount() const { return outages; }
+    uint64_t totalOutageMs() const { return outageMs; }
+    uint64_t retryInMicros(uint64_t nowMicros) const { return lost && retryAt > nowMicros ? retryAt - nowMicros : 0; }
+
+    /**
+     * Outages oldest first, the current one (endMs 0) last
+     */
+    size_t recentOutages() const { return historyCount; }
+    const TrackerOutage& outage(size_t index) const { return history[index]; }
+
+    /**
+     * The source has just been (re)initialized; staleness counts from here
+     */
+    void started(uint64_t nowMicros) {
+        lastFresh = nowMicros;
+    }
+
+    bool stalled(uint64_t updateMicros) const {
+        return settings.stallMicros > 0 && updateMicros > settings.stallMicros;
+    }
+
+    /**
+     * After an update: fresh says whether any reading changed. Returns true
+     * once nothing has for the stale limit
+     */
+    bool stale(uint64_t nowMicros, bool fresh) {
+        if (fresh) {
+            lastFresh = nowMicros;
+            return false;
+        }
+        return settings.staleMicros > 0 && nowMicros - lastFresh > settings.staleMicros;
+    }
+
+    /**
+     * Start an outage; the first reinitialization is due after retryMicros
+     */
+    void markLost(uint64_t nowMicros, uint64_t nowMs, const char* reason) {
+        lost = true;
+        retryDelay = settings.retryMicros;
+        retryAt = nowMicros + retryDelay;
+
+        if (historyCount == HISTORY) {
+            std::move(history.begin() + 1, history.end(), history.begin());
+            historyCount--;
+        }
+        TrackerOutage& current = history[historyCount++];
+        current = TrackerOutage();
+        current.startMs = nowMs;
+        current.reason = reason;
+        outages++;
+    }
+
+    bool retryDue(uint64_t nowMicros) const { return lost && nowMicros >= retryAt; }
+
+    /**
+     * A reinitialization failed: wait twice as long before the next one
+     */
+    void retryFailed(uint64_t nowMicros) {
+        current().attempts++;
+        retryDelay = std::min(std::max<uint64_t>(retryDelay * 2, 1), settings.maxRetryMicros);
+        retryAt = nowMicros + retryDelay;
+    }
+
+    /**
+     * A reinitialization succeeded; returns the finished outage
+     */
+    const TrackerOutage& restored(uint64_t nowMicros, uint64_t nowMs) {
+        TrackerOutage& finished = current();
+        finished.attempts++;
+        finished.endMs = std::max<uint64_t>(nowMs, finished.startMs + 1);
+        outageMs += finished.endMs - finished.startMs;
+        lost = false;
+        lastFresh = nowMicros;
+        return finished;
+    }
+
+    /**
+     * The outage in progress (or the last one); only valid once one has started
+     */
+    const TrackerOutage& lastOutage() const { return history[historyCount - 1]; }
+
+private:
+    TrackerOutage& current() { return history[historyCount - 1]; }
+};
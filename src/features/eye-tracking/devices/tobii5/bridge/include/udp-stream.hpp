@@ -0,0 +1,301 @@
+/**
+ * UDP Sample Stream
+ * Sequence-numbered binary samples over UDP with receiver-driven loss
+ * recovery. A receiver subscribes from its own socket and repeats the
+ * subscribe as a keep-alive; every published sample then goes to it as one
+ * datagram carrying the sample's ring sequence. Gaps come back as compact
+ * NACK ranges, and the bridge resends what its sample ring still holds
+ * inside the retransmit window or reports the rest gone, so recovery only
+ * costs bandwidth while samples are actually lost. Multicast receivers
+ * cannot subscribe, so they report to the group's sender instead, which is
+ * how the bridge knows anyone is listening; an idle bridge announces itself
+ * to the group on its keep-alive ticks so new receivers can find it.
+ *
+ *   request:  'T' 'S' version kind ...
+ *     subscribe    format u8, streams u8
+ *     unsubscribe
+ *     nack         base u64, count u8, count x (offset u16, length u16)
+ *     report       (multicast receiver, to the sender of the group's datagrams)
+ *   reply:    'T' 'S' version kind ...
+ *     sample       sequence u64, encoded sample (binary or quantized frame)
+ *     retransmit   as sample
+ *     gone         first u64, count u16
+ *     parity       multicast FEC symbol (fec-codec.hpp)
+ *     announce     (multicast, idle sender)
+ *
+ * Integers are little-endian, as in the binary sample frames
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "sample-schema.hpp"
+
+namespace UdpStream {
+
+constexpr char MAGIC[2] = {'T', 'S'};
+constexpr uint8_t VERSION = 1;
+
+enum class Kind : uint8_t {
+    Subscribe = 1,
+    Unsubscribe = 2,
+    Nack = 3,
+    Report = 4,
+    Sample = 16,
+    Retransmit = 17,
+    Gone = 18,
+    Parity = 19,
+    Announce = 20
+};
+
+constexpr size_t HEADER_SIZE = 4;
+constexpr size_t SAMPLE_HEADER_SIZE = HEADER_SIZE + 8;
+constexpr size_t MAX_DATAGRAM = 512;
+constexpr size_t MAX_NACK_RANGES = 32;
+constexpr size_t NACK_SIZE = HEADER_SIZE + 8 + 1;   // before the ranges
+
+inline void writeHeader(char* out, Kind kind) {
+    out[0] = MAGIC[0];
+    out[1] = MAGIC[1];
+    out[2] = static_cast<char>(VERSION);
+    out[3] = static_cast<char>(kind);
+}
+
+template <typename T>
+inline void put(char* out, T value) { std::memcpy(out, &value, sizeof(value)); }
+
+template <typename T>
+inline T get(const char* in) {
+    T value;
+    std::memcpy(&value, in, sizeof(value));
+    return value;
+}
+
+/**
+ * Kind of a datagram of this protocol, or 0 when it is not one
+ */
+inline uint8_t kindOf(const char* data, size_t size) {
+    if (size < HEADER_SIZE || data[0] != MAGIC[0] || data[1] != MAGIC[1] ||
+        static_cast<uint8_t>(data[2]) != VERSION) {
+        return 0;
+    }
+    return static_cast<uint8_t>(data[3]);
+}
+
+/**
+ * Missing sequences [first, first + count)
+ */
+struct NackRange {
+    uint64_t first;
+    uint32_t count;
+};
+
+/**
+ * Hand each range of a NACK datagram to visit; false if it is malformed
+ */
+template <typename Visit>
+bool readNack(const char* data, size_t size, Visit&& visit) {
+    if (size < NACK_SIZE || kindOf(data, size) != static_cast<uint8_t>(Kind::Nack)) return false;
+    const uint64_t base = get<uint64_t>(data + HEADER_SIZE);
+    const size_t count = static_cast<uint8_t>(data[HEADER_SIZE + 8]);
+    if (count > MAX_NACK_RANGES || size != NACK_SIZE + count * 4) return false;
+    for (size_t i = 0; i < count; ++i) {
+        const char* range = data + NACK_SIZE + i * 4;
+        const uint16_t length = get<uint16_t>(range + 2);
+        if (length > 0) visit(NackRange{base + get<uint16_t>(range), length});
+    }
+    return true;
+}
+
+inline size_t writeSubscribe(char* out, SampleFormat format, uint32_t streams) {
+    writeHeader(out, Kind::Subscribe);
+    out[HEADER_SIZE] = static_cast<char>(format);
+    out[HEADER_SIZE + 1] = static_cast<char>(streams & STREAM_ALL);
+    return HEADER_SIZE + 2;
+}
+
+inline size_t writeGone(char* out, uint64_t first, uint16_t count) {
+    writeHeader(out, Kind::Gone);
+    put<uint64_t>(out + HEADER_SIZE, first);
+    put<uint16_t>(out + HEADER_SIZE + 8, count);
+    return HEADER_SIZE + 10;
+}
+
+struct ReceiverSettings {
+    uint64_t nackDelayMicros = 0;       // wait this long after a gap opens (reordering)
+    uint64_t retryMicros = 40000;       // re-ask for a sample still missing after this long
+    uint32_t maxAttempts = 3;           // then count it lost
+};
+
+struct ReceiverStats {
+    uint64_t received = 0;              // distinct samples, first copies and recovered ones
+    uint64_t recovered = 0;             // of those, arrived as a retransmit
+    uint64_t duplicates = 0;
+    uint64_t lost = 0;                  // given up on, reported gone or fell out of the window
+    uint64_t nacks = 0;                 // NACK datagrams built
+    uint64_t requested = 0;             // sequences asked for, retries included
+};
+
+/**
+ * Reference receiver side: tracks the last Window sequences, delivers
+ * samples as they arrive (retransmits out of order, flagged) and builds the
+ * NACKs for what is missing. No allocation after construction
+ */
+template <size_t Window = 256>
+class Receiver {
+    static_assert((Window & (Window - 1)) == 0, "Receiver window must be a power of two");
+
+private:
+    enum class Slot : uint8_t { Empty, Received, Missing, Lost };
+
+    std::array<Slot, Window> state;
+    std::array<uint64_t, Window> tag;           // sequence the slot holds
+    std::array<uint64_t, Window> askAt;         // missing: when to ask next
+    std::array<uint8_t, Window> attempts;
+    uint64_t next;                              // one past the newest sequence seen
+    uint64_t oldestMissing;                     // nothing missing below this
+    bool started;
+    ReceiverSettings settings;
+    ReceiverStats counters;
+
+public:
+    explicit Receiver(const ReceiverSettings& receiverSettings = ReceiverSettings())
+        : state(), tag(), askAt(), attempts(), next(0), oldestMissing(0), started(false),
+          settings(receiverSettings), counters() {}
+
+    const ReceiverStats& stats() const { return counters; }
+    uint64_t end() const { return next; }
+
+    /**
+     * Take one datagram from the bridge. Samples go to deliver(sequence,
+     * frame, size, retransmitted) the first time they arrive; returns false
+     * for anything that is not this protocol
+     */
+    template <typename Deliver>
+    bool receive(const char* data, size_t size, uint64_t nowMicros, Deliver&& deliver) {
+        const uint8_t kind = kindOf(data, size);
+        if (kind == static_cast<uint8_t>(Kind::Gone) && size >= HEADER_SIZE + 10) {
+            const uint64_t first = get<uint64_t>(data + HEADER_SIZE);
+            const uint16_t count = get<uint16_t>(data + HEADER_SIZE + 8);
+            for (uint64_t sequence = first; sequence < first + count; ++sequence) {
+                if (holds(sequence) && state[slot(sequence)] == Slot::Missing) {
+                    state[slot(sequence)] = Slot::Lost;
+                    counters.lost++;
+                }
+            }
+            return true;
+        }
+        if ((kind != static_cast<uint8_t>(Kind::Sample) && kind != static_cast<uint8_t>(Kind::Retransmit)) ||
+            size < SAMPLE_HEADER_SIZE) {
+            return kind != 0;
+        }
+        const uint64_t sequence = get<uint64_t>(data + HEADER_SIZE);
+        const bool retransmitted = kind == static_cast<uint8_t>(Kind::Retransmit);
+
+        // First sample, or the bridge restarted and counts from 0 again
+        if (!started || sequence + Window < next) {
+            started = true;
+            state.fill(Slot::Empty);
+            next = oldestMissing = sequence;
+        }
+        if (sequence >= next) {
+            // Everything skipped is missing; slots pushed out of the window are settled
+            uint64_t gap = next;
+            if (sequence - next >= Window) {
+                counters.lost += sequence - (Window - 1) - next;
+                gap = sequence - (Window - 1);
+            }
+            for (; gap < sequence; ++gap) {
+                retire(gap);
+                state[slot(gap)] = Slot::Missing;
+                tag[slot(gap)] = gap;
+                askAt[slot(gap)] = nowMicros + settings.nackDelayMicros;
+                attempts[slot(gap)] = 0;
+            }
+            retire(sequence);
+            next = sequence + 1;
+        } else if (!holds(sequence) || state[slot(sequence)] != Slot::Missing) {
+            counters.duplicates++;
+            return true;
+        }
+        state[slot(sequence)] = Slot::Received;
+        tag[slot(sequence)] = sequence;
+        counters.received++;
+        if (retransmitted) counters.recovered++;
+        deliver(sequence, data + SAMPLE_HEADER_SIZE, size - SAMPLE_HEADER_SIZE, retransmitted);
+        return true;
+    }
+
+    /**
+     * Build a NACK for the sequences due to be asked for (at most
+     * MAX_NACK_RANGES ranges); returns its size, 0 when nothing is due
+     */
+    size_t buildNack(char* out, uint64_t nowMicros) {
+        if (next > Window && oldestMissing < next - Window) oldestMissing = next - Window;
+        while (oldestMissing < next && !(tag[slot(oldestMissing)] == oldestMissing &&
+                                         state[slot(oldestMissing)] == Slot::Missing)) {
+            oldestMissing++;
+        }
+
+        size_t ranges = 0;
+        uint64_t base = 0;
+        uint64_t runStart = 0;
+        uint64_t runEnd = 0;
+        auto flush = [&]() {
+            if (runEnd == runStart) return;
+            char* range = out + NACK_SIZE + ranges * 4;
+            put<uint16_t>(range, static_cast<uint16_t>(runStart - base));
+            put<uint16_t>(range + 2, static_cast<uint16_t>(runEnd - runStart));
+            ranges++;
+        };
+        for (uint64_t sequence = oldestMissing; sequence < next; ++sequence) {
+            const size_t s = slot(sequence);
+            if (tag[s] != sequence || state[s] != Slot::Missing || askAt[s] > nowMicros) continue;
+            if (attempts[s] >= settings.maxAttempts) {
+                state[s] = Slot::Lost;
+                counters.lost++;
+                continue;
+            }
+            // The open run is the last range that fits; the rest waits, unasked, for the next NACK
+            if (runEnd != runStart && sequence != runEnd && ranges + 1 == MAX_NACK_RANGES) break;
+            attempts[s]++;
+            askAt[s] = nowMicros + settings.retryMicros;
+            counters.requested++;
+            if (runEnd == runStart) {
+                base = runStart = sequence;
+            } else if (sequence != runEnd) {
+                flush();
+                runStart = sequence;
+            }
+            runEnd = sequence + 1;
+        }
+        flush();
+        if (ranges == 0) return 0;
+
+        writeHeader(out, Kind::Nack);
+        put<uint64_t>(out + HEADER_SIZE, base);
+        out[HEADER_SIZE + 8] = static_cast<char>(ranges);
+        counters.nacks++;
+        return NACK_SIZE + ranges * 4;
+    }
+
+private:
+    static size_t slot(uint64_t sequence) { return static_cast<size_t>(sequence & (Window - 1)); }
+
+    bool holds(uint64_t sequence) const { return sequence < next && sequence + Window > next; }
+
+    /**
+     * Settle the slot a new sequence is about to take over
+     */
+    void retire(uint64_t sequence) {
+        const size_t s = slot(sequence);
+        if (state[s] == Slot::Missing && tag[s] != sequence) counters.lost++;
+        state[s] = Slot::Empty;
+    }
+};
+
+} // namespace UdpStream
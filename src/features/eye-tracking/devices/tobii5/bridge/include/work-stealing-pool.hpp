@@ -0,0 +1,149 @@
+/**
+ * Work-Stealing Pool
+ * Fixed set of worker threads, each with its own task deque. A worker runs
+ * its newest task first (tasks it spawned itself, still warm in cache) and
+ * when it runs dry steals the oldest task from another worker, so uneven
+ * tasks (a few long sessions among many short ones) still keep every core
+ * busy. Tasks may submit further tasks
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorkStealingPool {
+public:
+    using Task = std::function<void()>;
+
+private:
+    struct Worker {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+
+    // pending counts submitted tasks not yet finished; idle workers sleep on wake
+    std::atomic<size_t> pending;
+    std::atomic<size_t> nextQueue;
+    std::atomic<uint64_t> stolen;
+    std::mutex wakeMutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    bool stopping;
+
+    static inline thread_local WorkStealingPool* currentPool = nullptr;
+    static inline thread_local size_t currentWorker = 0;
+
+public:
+    explicit WorkStealingPool(size_t threadCount = std::thread::hardware_concurrency())
+        : pending(0), nextQueue(0), stolen(0), stopping(false) {
+        if (threadCount == 0) threadCount = 1;
+        for (size_t i = 0; i < threadCount; ++i) workers.push_back(std::make_unique<Worker>());
+        for (size_t i = 0; i < threadCount; ++i) threads.emplace_back(&WorkStealingPool::run, this, i);
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (std::thread& thread : threads) thread.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    size_t size() const { return workers.size(); }
+    uint64_t steals() const { return stolen.load(std::memory_order_relaxed); }
+
+    /**
+     * Queue a task: on the calling worker's own deque when called from a
+     * task, else round-robin across workers
+     */
+    void submit(Task task) {
+        const size_t queue = currentPool == this ? currentWorker
+                                                 : nextQueue.fetch_add(1, std::memory_order_relaxed) % workers.size();
+        pending.fetch_add(1, std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock(workers[queue]->mutex);
+            workers[queue]->tasks.push_back(std::move(task));
+        }
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wake.notify_one();
+    }
+
+    /**
+     * Block until every submitted task (and every task they submitted) ran
+     */
+    void wait() {
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        done.wait(lock, [this] { return pending.load() == 0; });
+    }
+
+private:
+    bool popOwn(size_t index, Task& task) {
+        Worker& worker = *workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if (worker.tasks.empty()) return false;
+        task = std::move(worker.tasks.back());
+        worker.tasks.pop_back();
+        return true;
+    }
+
+    bool steal(size_t thief, Task& task) {
+        for (size_t offset = 1; offset < workers.size(); ++offset) {
+            Worker& victim = *workers[(thief + offset) % workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mutex);
+            if (victim.tasks.empty()) continue;
+            task = std::move(victim.tasks.front());
+            victim.tasks.pop_front();
+            stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+        return false;
+    }
+
+    void run(size_t index) {
+        currentPool = this;
+        currentWorker = index;
+
+        for (;;) {
+            Task task;
+            if (popOwn(index, task) || steal(index, task)) {
+                task();
+                if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    std::lock_guard<std::mutex> lock(wakeMutex);
+                    done.notify_all();
+                }
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(wakeMutex);
+            if (stopping) return;
+            // Recheck under the lock: a submit may have landed since the scan
+            wake.wait(lock, [this] { return stopping || queuedTasks() > 0; });
+            if (stopping) return;
+        }
+    }
+
+    size_t queuedTasks() {
+        size_t queued = 0;
+        for (const auto& worker : workers) {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            queued += worker->tasks.size();
+        }
+        return queued;
+    }
+};
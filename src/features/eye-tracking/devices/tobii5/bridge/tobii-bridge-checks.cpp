@@ -0,0 +1,687 @@
+/**
+ * Tobii Bridge Checks
+ * Known-answer checks for the bridge's header-only building blocks, run
+ * one case per ctest. Each case feeds fixed inputs and compares against
+ * hand-worked results, so a regression names the piece that broke rather
+ * than just moving the replay digest
+ *
+ *   tobii_bridge_checks <case>...      (no case: list them)
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "admission-control.hpp"
+#include "display-mapper.hpp"
+#include "gaze-predictor.hpp"
+#include "gaze-rules.hpp"
+#include "history-pyramid.hpp"
+#include "pose-math.hpp"
+#include "quality-monitor.hpp"
+#include "rate-controller.hpp"
+#include "sample-recorder.hpp"
+#include "sample-ring.hpp"
+#include "tobii-data-packet.hpp"
+#include "topic-bus.hpp"
+#include "tracker-source.hpp"
+#include "udp-stream.hpp"
+
+using json = nlohmann::json;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        std::cerr << "  FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+void expectNear(double actual, double expected, const std::string& what, double tolerance = 1e-4) {
+    if (!(std::fabs(actual - expected) <= tolerance)) {
+        std::cerr << "  FAILED: " << what << " = " << actual << ", expected " << expected << std::endl;
+        failures++;
+    }
+}
+
+TobiiDataPacket gazeAt(float x, float y) {
+    TobiiDataPacket sample{};
+    sample.hasGaze = true;
+    sample.gazeX = x;
+    sample.gazeY = y;
+    return sample;
+}
+
+/**
+ * Caps of three connections and two per address with the rate limits off.
+ * Handshakes are admitted and held before any of them opens, as when they
+ * arrive together on the I/O threads
+ */
+void checkAdmissionPending() {
+    AdmissionSettings settings;
+    settings.maxConnections = 3;
+    settings.maxPerAddress = 2;
+    settings.connectRate = 0.0;
+    settings.addressConnectRate = 0.0;
+    AdmissionController admission;
+    admission.configure(settings);
+    auto admit = [&](const char* address) { return admission.admit(address, false, false, 0); };
+
+    expect(admit("10.0.0.1") == AdmissionVerdict::Admit, "first handshake from 10.0.0.1 admitted");
+    expect(admit("10.0.0.1") == AdmissionVerdict::Admit, "second handshake from 10.0.0.1 admitted");
+    expect(admit("10.0.0.1") == AdmissionVerdict::TooManyFromAddress,
+           "a third handshake from 10.0.0.1 is over max_per_address before either opens");
+    expect(admit("10.0.0.2") == AdmissionVerdict::Admit, "a handshake from 10.0.0.2 takes the last slot");
+    expect(admit("10.0.0.3") == AdmissionVerdict::TooManyConnections,
+           "a fourth pending handshake is over max_connections");
+    expect(admission.pendingHandshakes() == 3 && admission.openConnections() == 0, "three handshakes pending");
+
+    admission.failed("10.0.0.2");
+    expect(admit("10.0.0.3") == AdmissionVerdict::Admit, "a failed handshake gives its slot back");
+    admission.opened("10.0.0.1", 0);
+    admission.opened("10.0.0.1", 0);
+    admission.opened("10.0.0.3", 0);
+    expect(admission.pendingHandshakes() == 0 && admission.openConnections() == 3, "opening moves slots to open");
+    expect(admission.admit("10.0.0.4", true, false, 0) == AdmissionVerdict::Admit, "a critical client bypasses the caps");
+    admission.failed("10.0.0.4");
+    admission.closed("10.0.0.1");
+    expect(admit("10.0.0.1") == AdmissionVerdict::Admit, "a closed connection frees its address's slot");
+    expect(admission.rejectedConnections() == 2, "two handshakes refused");
+}
+
+/**
+ * A 90 Hz tracker whose clock runs 1 s behind the bridge's. Gaze moves at a
+ * constant (0.3, -0.1) display widths/s for 2 s, jumps 0.1 in one frame
+ * (a saccade), moves on, then blinks and comes back holding still
+ */
+void checkGazePredictor() {
+    constexpr uint64_t FRAME = 11111;
+    constexpr uint64_t BRIDGE_OFFSET = 1000000;
+    GazePredictor predictor;
+    predictor.configure(PredictionSettings(), GazeSpace::Unit);
+    uint64_t frameMicros = 0;
+    auto observe = [&](bool hasGaze, float x, float y) {
+        TobiiDataPacket sample = gazeAt(x, y);
+        sample.hasGaze = hasGaze;
+        sample.gazeTimestamp = frameMicros;
+        predictor.observe(sample, frameMicros + BRIDGE_OFFSET);
+        return sample;
+    };
+    auto along = [](uint64_t micros) { return 0.2f + 0.3f * static_cast<float>(micros) * 1e-6f; };
+
+    TobiiDataPacket last;
+    for (; frameMicros <= 2000000; frameMicros += FRAME) {
+        last = observe(true, along(frameMicros), 0.5f - 0.1f * static_cast<float>(frameMicros) * 1e-6f);
+    }
+    const uint64_t lastFrame = frameMicros - FRAME;
+    expect(predictor.predictingGaze(), "steady motion is predicted");
+
+    // Sent 8 ms after the frame arrived, 20 ms ahead: 28 ms past the frame
+    TobiiDataPacket predicted = last;
+    expect(predictor.extrapolate(predicted, 20.0f, lastFrame + BRIDGE_OFFSET + 8000), "the sample is extrapolated");
+    expectNear(predicted.gazeX, along(lastFrame + 28000), "constant velocity x 28 ms on");
+    expectNear(predicted.gazeY, 0.5 - 0.1 * (static_cast<double>(lastFrame + 28000) * 1e-6), "constant velocity y 28 ms on");
+    expectNear(predicted.predictionHorizonMs, 20.0, "the reported horizon is the requested one");
+    predicted = last;
+    expect(!predictor.extrapolate(predicted, 20.0f, lastFrame + BRIDGE_OFFSET + 150000),
+           "gaze not updated for longer than gap_ms is not extrapolated");
+
+    // The saccade suspends prediction until the eye has held steady for settle_ms
+    const float landing = along(frameMicros) + 0.1f;
+    last = observe(true, landing, 0.3f);
+    predicted = last;
+    expect(!predictor.predictingGaze() && !predictor.extrapolate(predicted, 20.0f, frameMicros + BRIDGE_OFFSET),
+           "a saccade suspends prediction");
+    expect(predicted.gazeX == landing && !predicted.predicted, "a suspended sample goes out as measured");
+    for (int i = 0; i < 4; ++i) {
+        frameMicros += FRAME;
+        observe(true, landing, 0.3f);
+    }
+    expect(!predictor.predictingGaze(), "44 ms after the saccade is still settling");
+    frameMicros += FRAME;
+    observe(true, landing, 0.3f);
+    expect(predictor.predictingGaze(), "55 ms after the saccade prediction resumes");
+
+    // A blink drops the filter; the old motion does not carry over
+    frameMicros += FRAME;
+    observe(false, 0.0f, 0.0f);
+    expect(!predictor.predictingGaze(), "a blink suspends prediction");
+    for (int i = 0; i < 6; ++i) {
+        frameMicros += FRAME;
+        last = observe(true, 0.6f, 0.4f);
+    }
+    predicted = last;
+    expect(predictor.extrapolate(predicted, 30.0f, frameMicros + BRIDGE_OFFSET), "prediction resumes after the blink");
+    expectNear(predicted.gazeX, 0.6, "a still eye after the blink stays put");
+}
+
+/**
+ * A 1080p monitor left of a 1440p one at scale 2 that carries the tracker
+ */
+void checkDisplayMapping() {
+    const json layout = {{"displays", {{{"x", 0}, {"y", 0}, {"width", 1920}, {"height", 1080}},
+                                       {{"x", 1920}, {"y", 0}, {"width", 2560}, {"height", 1440}, {"scale", 2}}}},
+                         {"tracked", 1}};
+    const DisplayGeometry physical = DisplayGeometry::fromJson(layout);
+    json logicalLayout = layout;
+    logicalLayout["units"] = "logical";
+    const DisplayGeometry logical = DisplayGeometry::fromJson(logicalLayout);
+
+    DisplayMapper mapper;
+    const int unit = mapper.acquire(physical, GazeSpace::Unit);
+    expect(mapper.acquire(physical, GazeSpace::Unit) == unit, "an identical layout shares its slot");
+    const int scaled = mapper.acquire(logical, GazeSpace::Unit);
+    expect(scaled != unit && mapper.size() == 2, "logical units intern a second layout");
+
+    // Unit gaze at the middle of the tracked display
+    TobiiDataPacket sample = gazeAt(0.5f, 0.5f);
+    mapper.apply(unit, sample);
+    expect(sample.gazeDisplay == 1, "centre lands on the tracked display");
+    expectNear(sample.gazeScreenX, 3200.0, "centre x");
+    expectNear(sample.gazeScreenY, 720.0, "centre y");
+    expectNear(sample.gazeScreenU, 0.5, "centre u");
+    expectNear(sample.gazeScreenV, 0.5, "centre v");
+    mapper.apply(scaled, sample);
+    expectNear(sample.gazeScreenX, 1600.0, "centre x in logical pixels");
+    expectNear(sample.gazeScreenY, 360.0, "centre y in logical pixels");
+
+    // Past the tracked display's left edge onto the neighbour, which has scale 1
+    sample = gazeAt(-0.25f, 0.5f);
+    mapper.apply(scaled, sample);
+    expect(sample.gazeDisplay == 0, "gaze left of the tracker lands on the left display");
+    expectNear(sample.gazeScreenX, 1280.0, "left display x");
+    expectNear(sample.gazeScreenU, 1280.0 / 1920.0, "left display u");
+    expectNear(sample.gazeScreenV, 720.0 / 1080.0, "left display v");
+
+    // Below every monitor: no display, u/v relative to the tracked one
+    sample = gazeAt(0.5f, 1.5f);
+    mapper.apply(unit, sample);
+    expect(sample.gazeDisplay == -1, "gaze below the desktop is on no display");
+    expectNear(sample.gazeScreenY, 2160.0, "off-desktop y");
+    expectNear(sample.gazeScreenV, 1.5, "off-desktop v");
+
+    // Centred gaze (+y up) through the batch path
+    DisplayMapper centred;
+    const int index = centred.acquire(physical, GazeSpace::Centered);
+    centred.mapAll(gazeAt(0.0f, 0.5f));
+    centred.applyMapped(index, sample);
+    expectNear(sample.gazeScreenX, 3200.0, "centred x");
+    expectNear(sample.gazeScreenY, 360.0, "centred y (+y up)");
+
+    sample.hasGaze = false;
+    centred.mapAll(sample);
+    centred.applyMapped(index, sample);
+    expect(sample.gazeDisplay == -1 && sample.gazeScreenX == 0.0f, "no gaze clears the screen fields");
+}
+
+/**
+ * Enter, a 200 ms dwell and leave on one AOI, then a second visit that
+ * re-arms the dwell, at 100 Hz
+ */
+void checkGazeRuleDwell() {
+    GazeRuleSet rules = GazeRuleSet::fromJson(json::parse(R"({
+        "aois": [{"name": "centre", "x": 0.25, "y": 0.25, "width": 0.5, "height": 0.5}],
+        "rules": [{"id": "look", "type": "dwell", "aoi": "centre", "ms": 200},
+                  {"id": "in", "type": "enter", "aoi": "centre"},
+                  {"id": "out", "type": "leave", "aoi": "centre"}]})"));
+
+    struct Fired {
+        std::string rule;
+        uint64_t timestamp;
+        uint64_t duration;
+    };
+    std::vector<Fired> fired;
+    auto feed = [&](uint64_t from, uint64_t to, float x, float y) {
+        for (uint64_t t = from; t < to; t += 10) {
+            rules.evaluate(GazeRulePoint{t, true, true, true, x, y}, [&](const GazeRuleEvent& event) {
+                fired.push_back(Fired{event.rule, event.timestamp, event.duration});
+            });
+        }
+    };
+
+    feed(1000, 1010, 0.1f, 0.1f);       // outside
+    feed(1010, 1310, 0.5f, 0.5f);       // 300 ms inside
+    feed(1310, 1400, 0.9f, 0.9f);       // outside
+    feed(1400, 1550, 0.6f, 0.4f);       // 150 ms inside: too short to dwell
+    feed(1550, 1600, 0.9f, 0.9f);
+    feed(1600, 1810, 0.3f, 0.7f);       // exactly 200 ms inside by the last sample
+
+    const std::vector<Fired> expected = {
+        {"in", 1010, 0}, {"look", 1210, 200}, {"out", 1310, 300},
+        {"in", 1400, 0}, {"out", 1550, 150},
+        {"in", 1600, 0}, {"look", 1800, 200},
+    };
+    expect(fired.size() == expected.size(), "event count " + std::to_string(fired.size()) + ", expected " +
+                                                std::to_string(expected.size()));
+    for (size_t i = 0; i < std::min(fired.size(), expected.size()); ++i) {
+        const std::string at = "event " + std::to_string(i) + " ";
+        expect(fired[i].rule == expected[i].rule, at + "rule " + fired[i].rule + ", expected " + expected[i].rule);
+        expect(fired[i].timestamp == expected[i].timestamp, at + "at " + std::to_string(fired[i].timestamp));
+        expect(fired[i].duration == expected[i].duration, at + "held " + std::to_string(fired[i].duration));
+    }
+}
+
+/**
+ * A marker sent on a synced client's clock lands on the sample clock at
+ * client_time + offset and resolves to the first sample at or after it.
+ * The ring holds 16 of 40 samples taken every 10 ms from 1000 ms
+ */
+void checkMarkerClock() {
+    SampleRing<16> ring;
+    for (uint64_t i = 0; i < 40; ++i) {
+        TobiiDataPacket sample{};
+        sample.timestamp = 1000 + 10 * i;
+        ring.publish(sample);
+    }
+    const uint64_t latest = ring.end() - 1;
+
+    BridgeMarker marker{};
+    marker.timestamp = marker.received = 1395;
+    expect(applyClientTime(marker, 5243.4, -3960.0), "a synced client's time is applied");
+    expect(marker.clockCorrected, "the marker is flagged clock_corrected");
+    expect(marker.received == 1395, "receipt time is kept");
+    expect(marker.timestamp == 1283, "corrected timestamp " + std::to_string(marker.timestamp) + ", expected 1283");
+    expect(markerSequence(ring, latest, marker.timestamp) == 29, "1283 ms resolves to the 1290 ms sample");
+    expect(markerSequence(ring, latest, 1290) == 29, "a marker on a sample resolves to that sample");
+    expect(markerSequence(ring, latest, 1100) == ring.begin(), "a marker older than the ring resolves to its oldest sample");
+
+    BridgeMarker early{};
+    early.timestamp = early.received = 1395;
+    expect(!applyClientTime(early, 100.0, -200.0), "a time before the clock's epoch is ignored");
+    expect(!early.clockCorrected && early.timestamp == 1395, "an ignored correction keeps the receipt time");
+    expect(markerSequence(ring, latest, early.timestamp) == 40, "a marker newer than every sample resolves to the next one");
+}
+
+/**
+ * The ray with no world transform, a 90 degree yaw's matrix, then the
+ * default 527 x 296 mm display placed 1 m along world +x, turned 180 degrees
+ * about +y and scaled to metres, with a head 600 mm out, turned 90 degrees
+ * and looking at the top-right corner (centred gaze 1, 1)
+ */
+void checkPoseMath() {
+    Pose::PoseKernel kernel;
+    TobiiDataPacket sample = gazeAt(0.5f, 0.5f);
+    kernel.apply(sample);
+    expectNear(sample.headQuatW, 1.0, "identity quaternion w");
+    expectNear(sample.gazeOriginZ, 600.0, "an untracked head sits eye_distance_mm in front of the display");
+    expectNear(sample.gazeDirX, 0.0, "centre gaze direction x");
+    expectNear(sample.gazeDirY, 0.0, "centre gaze direction y");
+    expectNear(sample.gazeDirZ, -1.0, "centre gaze looks straight into the display");
+
+    const Pose::Mat3 yaw = Pose::toMatrix(Pose::fromEuler(90.0f, 0.0f, 0.0f));
+    const Pose::Mat3 yawExpected = {0, 0, 1, 0, 1, 0, -1, 0, 0};
+    for (size_t i = 0; i < yaw.size(); ++i) {
+        expectNear(yaw[i], yawExpected[i], "yaw 90 matrix element " + std::to_string(i));
+    }
+
+    Pose::PoseSettings settings;
+    settings.worldOriginMm = {1000.0f, 0.0f, 0.0f};
+    settings.worldRotationDeg = {180.0f, 0.0f, 0.0f};
+    settings.worldScale = 0.001f;
+    kernel.configure(settings, GazeSpace::Centered);
+    sample = gazeAt(1.0f, 1.0f);
+    sample.hasHead = true;
+    sample.headPosZ = 600.0f;
+    sample.headYaw = 90.0f;
+    kernel.apply(sample);
+
+    // World yaw 180 then head yaw 90 is yaw 270
+    expectNear(sample.headQuatW, -0.707107, "head quaternion w");
+    expectNear(sample.headQuatX, 0.0, "head quaternion x");
+    expectNear(sample.headQuatY, 0.707107, "head quaternion y");
+    expectNear(sample.headQuatZ, 0.0, "head quaternion z");
+    const float rotation[] = {sample.headRot00, sample.headRot01, sample.headRot02, sample.headRot10, sample.headRot11,
+                              sample.headRot12, sample.headRot20, sample.headRot21, sample.headRot22};
+    const float rotationExpected[] = {0, 0, -1, 0, 1, 0, 1, 0, 0};
+    for (size_t i = 0; i < 9; ++i) {
+        expectNear(rotation[i], rotationExpected[i], "head rotation element " + std::to_string(i));
+    }
+
+    // 1000 mm plus the head turned to z -600, in metres; (263.5, 148, -600) mm turned about +y
+    expectNear(sample.gazeOriginX, 1.0, "ray origin x");
+    expectNear(sample.gazeOriginY, 0.0, "ray origin y");
+    expectNear(sample.gazeOriginZ, -0.6, "ray origin z");
+    expectNear(sample.gazeDirX, -0.392221, "ray direction x");
+    expectNear(sample.gazeDirY, 0.220299, "ray direction y");
+    expectNear(sample.gazeDirZ, 0.893102, "ray direction z");
+}
+
+/**
+ * Three seconds of 100 Hz ticks on a one-second window: a 100 ms gaze gap
+ * with head on every other tick, a clean second, then gaze lost half way
+ * through the third
+ */
+void checkQualityWindow() {
+    QualityMonitor monitor(1);
+    QualityThresholds thresholds;
+    thresholds.minGazeRatio = 0.95f;
+    thresholds.maxGapMs = 80;
+
+    std::vector<std::string> alerts;
+    auto emit = [&](const QualityAlert& alert) {
+        alerts.push_back(std::string(alert.raised ? "+" : "-") + alert.metric);
+    };
+    size_t closed = 0;
+    auto tick = [&](uint64_t t, bool gaze) {
+        TobiiDataPacket sample{};
+        sample.timestamp = t;
+        sample.hasGaze = gaze;
+        sample.gazeTimestamp = gaze ? t : 0;
+        sample.hasHead = t % 20 == 0;
+        sample.present = true;
+        if (monitor.add(sample)) {
+            closed++;
+            monitor.checkAlerts(thresholds, emit);
+        }
+    };
+
+    for (uint64_t t = 1000; t < 2000; t += 10) tick(t, t < 1200 || t >= 1300);
+    tick(2000, true);
+    expect(closed == 1, "the tick at 2000 ms closes the first second");
+    const QualitySnapshot first = monitor.snapshot();
+    expectNear(first.rateHz, 90.0, "rate over 90 distinct gaze samples");
+    expectNear(first.gazeRatio, 0.9, "gaze ratio");
+    expectNear(first.headRatio, 0.5, "head ratio");
+    expectNear(first.presenceRatio, 1.0, "presence ratio");
+    expect(first.longestGapMs == 100, "longest gap " + std::to_string(first.longestGapMs) + " ms, expected 100");
+    expect(first.alerts == 2, "gaze ratio and gap raised after the first second");
+
+    for (uint64_t t = 2010; t <= 3000; t += 10) tick(t, true);
+    expect(monitor.snapshot().alerts == 0, "both alerts clear after a clean second");
+
+    for (uint64_t t = 3010; t <= 4000; t += 10) tick(t, t < 3500);
+    const QualitySnapshot third = monitor.snapshot();
+    expect(third.currentGapMs == 500, "open gap " + std::to_string(third.currentGapMs) + " ms, expected 500");
+    expect(third.longestGapMs == 0, "an open gap is not a closed one");
+
+    const std::vector<std::string> expected = {"+gaze_ratio", "+gap_ms", "-gaze_ratio", "-gap_ms", "+gaze_ratio", "+gap_ms"};
+    expect(alerts == expected, "alert sequence has " + std::to_string(alerts.size()) + " transitions, expected 6");
+
+    char buffer[1024];
+    FrameWriter out(buffer, sizeof(buffer));
+    monitor.writeJson(out);
+    const json report = json::parse(out.data(), out.data() + out.size());
+    expect(report["window"]["gaps"].size() == QualityMonitor::GAP_BUCKETS, "gap histogram has a count per bucket");
+}
+
+/**
+ * Thirty minutes of samples every 100 ms from t = 1000 s, with the user
+ * present on every other one and a 5 s hole ten minutes in. Plans must never
+ * exceed the points asked for, must cover the range and must start on a
+ * whole point
+ */
+void checkHistoryPlan() {
+    const uint64_t start = 1000000, end = start + 1800000, holeFrom = start + 600000, holeTo = holeFrom + 5000;
+    HistoryPyramid history;
+    for (uint64_t t = start; t < end; t += 100) {
+        if (t >= holeFrom && t < holeTo) continue;
+        TobiiDataPacket sample{};
+        sample.timestamp = t;
+        sample.present = (t / 100) % 2 == 0;
+        history.add(sample);
+    }
+
+    // Half a second either side of a bucket edge fits in one point only if it is widened
+    HistoryPyramid::Query query = history.plan(start + 500, start + 1500, 1);
+    expect(query.points == 1, "one point asked for, " + std::to_string(query.points) + " planned");
+    expect(query.widthMs == 2000 && query.fromMs == start, "the point widens to 2 s from " + std::to_string(query.fromMs));
+
+    // The whole half hour in 60 points: 30 s points would round the start down
+    // to 990 s and need 61, so they widen to 40 s, of which 1000 s is a multiple
+    query = history.plan(start, end - 100, 60);
+    expect(query.level == 1, "a tie between 1 s and 10 s buckets goes to the coarser level");
+    expect(query.widthMs == 40000, "point width " + std::to_string(query.widthMs) + " ms, expected 40000");
+    expect(query.fromMs == start && query.points == 45, "45 points from 1000 s, got " + std::to_string(query.points) +
+                                                             " from " + std::to_string(query.fromMs));
+
+    const uint64_t ranges[][2] = {{start, end}, {start + 123, start + 4567}, {start + 599999, start + 1234567},
+                                  {0, end}, {end - 1, end}, {start + 777777, start + 777777}};
+    for (const auto& range : ranges) {
+        for (size_t points : {1, 2, 3, 7, 59, 60, 61, 300, 1000, 4000}) {
+            query = history.plan(range[0], range[1], points);
+            const std::string at = std::to_string(range[0]) + ".." + std::to_string(range[1]) + " in " +
+                                   std::to_string(points) + ": ";
+            expect(query.points >= 1 && query.points <= points, at + std::to_string(query.points) + " points planned");
+            expect(query.widthMs % HistoryPyramid::LEVELS[query.level].widthMs == 0, at + "points split buckets");
+            expect(query.fromMs % query.widthMs == 0, at + "the first point does not start on a whole point");
+            expect(query.fromMs <= std::max(range[0], start), at + "the first point starts after the range");
+            expect(query.fromMs + query.points * query.widthMs > std::min(range[1], end - 100), at + "the points stop short");
+        }
+    }
+
+    // The hole's 1 s buckets come back empty; a full one has every sample and half present
+    query = history.plan(holeFrom - 2000, holeTo + 1000, 100);
+    expect(query.level == 0 && query.widthMs == 1000, "a 8 s range reads 1 s buckets");
+    const HistoryBucket full = history.point(query, 0);
+    expect(full.samples == 10 && full.present == 5, "a full second has 10 samples, 5 present");
+    const HistoryBucket empty = history.point(query, 3);
+    expect(empty.samples == 0 && empty.present == 0, "a second inside the hole is empty");
+    expect(history.point(query, query.points - 1).samples == 10, "sampling resumes after the hole");
+}
+
+/**
+ * One level digit per interval, from (level, intervals) runs
+ */
+std::string levelRuns(std::initializer_list<std::pair<char, int>> runs) {
+    std::string levels;
+    for (const auto& run : runs) levels.append(static_cast<size_t>(run.second), run.first);
+    return levels;
+}
+
+/**
+ * A JSON client at 90 Hz (45 samples per 500 ms interval, 120 B each, 40 B
+ * quantized) on a 20 kbps link (1250 B per interval), then on a fast one,
+ * with a 2000 B queue target. It steps down to quantized at half rate (880
+ * B per interval) on the first two intervals, drains the backlog, and each
+ * probe back to full rate (1800 B) grows the queue 550 B and is undone, so
+ * the hold-off doubles 4, 8, 16, 32 up to 64 intervals. Once the link
+ * recovers the level climbs back one rung per 64 clear intervals
+ */
+void checkRateLadder() {
+    RateControlSettings settings;
+    settings.targetQueueBytes = 2000;
+    RateController rate;
+    rate.configure(settings);
+    rate.reset(SampleFormat::Json, 1);
+
+    size_t queue = 0;
+    uint64_t queuedTotal = 0;
+    uint64_t nowMicros = 0;
+    rate.update(nowMicros, queue, queuedTotal);
+    auto run = [&](size_t linkBytes, int intervals) {
+        std::string levels;
+        for (int i = 0; i < intervals; ++i) {
+            const size_t samples = 45 / rate.decimation();
+            const size_t offered = samples * (rate.format() == SampleFormat::Quantized ? 40 : 120);
+            queue += offered;
+            queuedTotal += offered;
+            queue -= std::min(queue, linkBytes);
+            nowMicros += 500000;
+            rate.update(nowMicros, queue, queuedTotal);
+            levels += static_cast<char>('0' + rate.currentLevel());
+        }
+        return levels;
+    };
+
+    const std::string slow = run(1250, 80);
+    const std::string slowExpected = levelRuns({{'1', 1}, {'2', 15}, {'1', 1}, {'2', 8}, {'1', 1}, {'2', 16},
+                                                {'1', 1}, {'2', 32}, {'1', 1}, {'2', 4}});
+    expect(slow == slowExpected, "20 kbps levels " + slow + ", expected " + slowExpected);
+    expect(rate.format() == SampleFormat::Quantized && rate.decimation() == 2,
+           "the 20 kbps link settles on quantized samples at half rate");
+
+    const std::string fast = run(50000, 140);
+    const std::string fastExpected = levelRuns({{'2', 60}, {'1', 64}, {'0', 16}});
+    expect(fast == fastExpected, "recovered levels " + fast + ", expected " + fastExpected);
+    expect(rate.format() == SampleFormat::Json && rate.decimation() == 1 &&
+               std::string(rate.lastReason()) == "recovered",
+           "the recovered link gets the requested output back");
+}
+
+/**
+ * 100 ticks of a tracker at half the tick rate: gaze lost for ticks 70-79,
+ * the user away for ticks 30-59 and one head move at tick 40, then enough
+ * fresh gaze to lap the gaze ring behind a reader
+ */
+void checkTopicBus() {
+    TopicBus bus;
+    TopicCursor reader = bus.cursorAtEnd();
+    TopicCursor late = bus.cursorAtEnd();
+    for (uint64_t i = 0; i < 100; ++i) {
+        TobiiDataPacket sample{};
+        sample.timestamp = 1000 + 10 * i;
+        sample.hasGaze = i < 70 || i >= 80;
+        sample.gazeTimestamp = 1000 + 20 * (i / 2);
+        sample.gazeX = static_cast<float>(i) / 100.0f;
+        sample.hasHead = true;
+        sample.headYaw = i < 40 ? 0.0f : 5.0f;
+        sample.headConfidence = static_cast<float>(i % 3);     // not a change of pose
+        sample.present = i < 30 || i >= 60;
+        bus.publishSample(sample);
+    }
+    expect(bus.end(Topic::Gaze) == 45, "gaze entries " + std::to_string(bus.end(Topic::Gaze)) + ", expected 45");
+    expect(bus.end(Topic::Head) == 2, "head entries " + std::to_string(bus.end(Topic::Head)) + ", expected 2");
+    expect(bus.end(Topic::Presence) == 3, "presence entries " + std::to_string(bus.end(Topic::Presence)) + ", expected 3");
+    expect(bus.gaze().at(35).gazeTimestamp == 1800, "gaze resumes with the first new tracker sample after the loss");
+    expect(bus.head().at(1).timestamp == 1400 && bus.head().at(1).yaw == 5.0f, "the head move is published at tick 40");
+    expect(!bus.presence().at(1).present && bus.presence().at(2).timestamp == 1600, "presence entries mark the transitions");
+
+    // Events first, then presence, then gaze, oldest first; head is passed over
+    std::vector<std::pair<Topic, uint64_t>> visited;
+    auto record = [&](Topic topic, uint64_t sequence, const auto&) { visited.emplace_back(topic, sequence); };
+    bus.publishEvent(EventTopicEntry(TopicEventKind::Marker, 1500, "onset"));
+    bus.read(reader, TOPIC_EVENTS | TOPIC_PRESENCE | TOPIC_GAZE, record);
+    expect(visited.size() == 1 + 3 + 45, "read " + std::to_string(visited.size()) + " entries, expected 49");
+    if (visited.size() == 49) {
+        expect(visited[0].first == Topic::Events && visited[1].first == Topic::Presence &&
+                   visited[4].first == Topic::Gaze && visited[4].second == 0 && visited[48].second == 44,
+               "entries come topic by topic, oldest first");
+    }
+    expect(reader.next[static_cast<size_t>(Topic::Head)] == 2, "an unsubscribed topic's cursor moves to its end");
+    visited.clear();
+    bus.read(reader, TOPIC_ALL, record);
+    expect(visited.empty(), "a caught-up reader gets nothing");
+
+    // 300 more gaze samples lap the 256-entry ring; the late reader resumes at the oldest still held
+    for (uint64_t i = 0; i < 300; ++i) {
+        TobiiDataPacket sample{};
+        sample.timestamp = 2000 + 10 * i;
+        sample.hasGaze = true;
+        sample.gazeTimestamp = 2000 + 10 * i;
+        bus.publishSample(sample);
+    }
+    expect(bus.gaze().begin() == 345 - 256, "the gaze ring holds the newest 256 entries");
+    visited.clear();
+    bus.read(late, TOPIC_GAZE, record);
+    expect(visited.size() == 256 && visited.front().second == 89 && visited.back().second == 344,
+           "the late reader skips to sequence 89 and reads 256 entries");
+    expect(bus.gaze().at(89).gazeTimestamp == 2000 + 10 * (89 - 45), "sequence 89 holds the 44th new sample");
+    expect(late.next[static_cast<size_t>(Topic::Gaze)] == 345, "the late reader ends caught up");
+}
+
+/**
+ * A stream receiver that got every other sample of 0-80: 40 single-sample
+ * gaps, more than one NACK can carry. The first NACK asks for the 32 it
+ * holds, the second for the other 8, and retransmits of all 40 close them
+ */
+void checkUdpNackRanges() {
+    UdpStream::Receiver<> receiver;
+    auto sendSample = [&](UdpStream::Kind kind, uint64_t sequence) {
+        char datagram[UdpStream::SAMPLE_HEADER_SIZE + 1] = {};
+        UdpStream::writeHeader(datagram, kind);
+        UdpStream::put<uint64_t>(datagram + UdpStream::HEADER_SIZE, sequence);
+        receiver.receive(datagram, sizeof(datagram), 0, [](uint64_t, const char*, size_t, bool) {});
+    };
+    for (uint64_t sequence = 0; sequence <= 80; sequence += 2) sendSample(UdpStream::Kind::Sample, sequence);
+
+    std::vector<std::vector<UdpStream::NackRange>> nacks;
+    char nack[UdpStream::NACK_SIZE + UdpStream::MAX_NACK_RANGES * 4];
+    for (size_t size; (size = receiver.buildNack(nack, 0)) > 0 && nacks.size() < 4;) {
+        nacks.emplace_back();
+        const bool valid = UdpStream::readNack(nack, size, [&](const UdpStream::NackRange& range) {
+            nacks.back().push_back(range);
+        });
+        expect(valid, "NACK " + std::to_string(nacks.size()) + " is well-formed");
+    }
+    expect(nacks.size() == 2, std::to_string(nacks.size()) + " NACKs, expected 2");
+    if (nacks.size() == 2) {
+        expect(nacks[0].size() == UdpStream::MAX_NACK_RANGES, std::to_string(nacks[0].size()) +
+               " ranges in the first NACK, expected 32");
+        expect(nacks[1].size() == 8, std::to_string(nacks[1].size()) + " ranges in the second NACK, expected 8");
+        expect(nacks[0].front().first == 1 && nacks[0].back().first == 63 && nacks[1].front().first == 65 &&
+                   nacks[1].back().first == 79, "the NACKs ask for 1-63 and 65-79");
+    }
+    expect(receiver.stats().requested == 40, "requested " + std::to_string(receiver.stats().requested) +
+           ", expected 40: nothing is asked for twice before its retry is due");
+
+    for (const auto& ranges : nacks) {
+        for (const UdpStream::NackRange& range : ranges) {
+            for (uint64_t sequence = range.first; sequence < range.first + range.count; ++sequence) {
+                sendSample(UdpStream::Kind::Retransmit, sequence);
+            }
+        }
+    }
+    expect(receiver.stats().received == 81 && receiver.stats().recovered == 40 && receiver.stats().lost == 0,
+           "all 40 gaps are recovered");
+    expect(receiver.buildNack(nack, 1000000) == 0, "nothing is left to ask for");
+}
+
+struct CheckCase {
+    const char* name;
+    void (*run)();
+};
+
+const CheckCase CHECK_CASES[] = {
+    {"admission-pending", checkAdmissionPending},
+    {"display-mapping", checkDisplayMapping},
+    {"gaze-predictor", checkGazePredictor},
+    {"gaze-rule-dwell", checkGazeRuleDwell},
+    {"history-plan", checkHistoryPlan},
+    {"marker-clock", checkMarkerClock},
+    {"pose-math", checkPoseMath},
+    {"quality-window", checkQualityWindow},
+    {"rate-ladder", checkRateLadder},
+    {"topic-bus", checkTopicBus},
+    {"udp-nack-ranges", checkUdpNackRanges},
+};
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        for (const CheckCase& check : CHECK_CASES) std::cout << check.name << std::endl;
+        return 0;
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        const CheckCase* found = nullptr;
+        for (const CheckCase& check : CHECK_CASES) {
+            if (std::strcmp(check.name, argv[i]) == 0) found = &check;
+        }
+        if (!found) {
+            std::cerr << "Unknown check " << argv[i] << std::endl;
+            return 1;
+        }
+
+        const int before = failures;
+        try {
+            found->run();
+        } catch (const std::exception& e) {
+            std::cerr << "  FAILED: threw " << e.what() << std::endl;
+            failures++;
+        }
+        std::cout << (failures == before ? "PASS " : "FAIL ") << found->name << std::endl;
+    }
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,929 @@
+/**
+ * Tobii Bridge Load Generator
+ * Opens thousands of simulated WebSocket clients and any number of UDP
+ * readers (OpenTrack, sample stream receivers recovering losses with NACKs,
+ * or multicast receivers rebuilding them from FEC parity) against a running
+ * bridge and reports rate, latency and drops
+ * Intended to run on the same Linux box as a bridge on the synthetic source
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <array>
+#include <memory>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <mutex>
+
+#include <asio.hpp>
+#include <nlohmann/json.hpp>
+
+#include "udp-stream.hpp"
+#include "fec-codec.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using json = nlohmann::json;
+using asio::ip::tcp;
+using asio::ip::udp;
+
+namespace {
+
+int64_t nowMillis() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    ).count();
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * Latency histogram with 1 ms buckets up to 10 s plus an overflow bucket
+ * Shared by all connections; buckets are relaxed atomics so I/O threads
+ * record without locking
+ */
+class LatencyHistogram {
+private:
+    static constexpr size_t BUCKETS = 10000;
+    std::vector<std::atomic<uint64_t>> counts;
+    std::atomic<uint64_t> total;
+    std::atomic<int64_t> maxSeen;
+
+public:
+    LatencyHistogram() : counts(BUCKETS + 1), total(0), maxSeen(0) {
+        for (auto& bucket : counts) bucket.store(0, std::memory_order_relaxed);
+    }
+
+    void record(int64_t millis) {
+        if (millis < 0) millis = 0;
+        counts[std::min<size_t>(static_cast<size_t>(millis), BUCKETS)].fetch_add(1, std::memory_order_relaxed);
+        total.fetch_add(1, std::memory_order_relaxed);
+
+        int64_t seen = maxSeen.load(std::memory_order_relaxed);
+        while (millis > seen && !maxSeen.compare_exchange_weak(seen, millis, std::memory_order_relaxed)) {}
+    }
+
+    uint64_t count() const { return total.load(); }
+    int64_t max() const { return maxSeen.load(); }
+
+    int64_t percentile(double p) const {
+        const uint64_t samples = total.load();
+        if (samples == 0) return 0;
+        const uint64_t rank = static_cast<uint64_t>(p / 100.0 * static_cast<double>(samples - 1)) + 1;
+        uint64_t seen = 0;
+        for (size_t i = 0; i <= BUCKETS; ++i) {
+            seen += counts[i].load(std::memory_order_relaxed);
+            if (seen >= rank) return static_cast<int64_t>(i);
+        }
+        return maxSeen.load();
+    }
+};
+
+/**
+ * A group of identically configured simulated clients
+ * Spec format: count[:streams[:decimation[:slowBytesPerSec]]]
+ * e.g. "900:gaze,head:1" or "100:gaze:4:2048"
+ */
+struct ClientGroup {
+    int count = 0;
+    std::vector<std::string> streams = {"gaze", "head", "presence"};
+    int decimation = 1;
+    size_t slowBytesPerSec = 0;
+
+    static ClientGroup parse(const std::string& spec) {
+        ClientGroup group;
+        std::vector<std::string> parts;
+        std::stringstream ss(spec);
+        std::string part;
+        while (std::getline(ss, part, ':')) parts.push_back(part);
+
+        if (parts.empty()) throw std::invalid_argument("empty client group");
+        group.count = std::stoi(parts[0]);
+        if (parts.size() > 1 && !parts[1].empty()) {
+            group.streams.clear();
+            std::stringstream streamList(parts[1]);
+            std::string stream;
+            while (std::getline(streamList, stream, ',')) group.streams.push_back(stream);
+        }
+        if (parts.size() > 2) group.decimation = std::max(1, std::stoi(parts[2]));
+        if (parts.size() > 3) group.slowBytesPerSec = std::stoul(parts[3]);
+        return group;
+    }
+};
+
+struct LoadgenConfig {
+    std::string host = "127.0.0.1";
+    int wsPort = 8080;
+    int udpPort = 4242;
+    int udpReaders = 0;
+    int udpStreamPort = 4243;
+    int udpStreamReaders = 0;
+    std::string multicastGroup = "239.255.42.42";
+    int multicastPort = 4244;
+    int multicastReaders = 0;
+    double multicastLoss = 0.0;         // share of datagrams each multicast reader drops on purpose
+    int threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    int connectRate = 500;
+    int durationSeconds = 30;
+    int reportIntervalSeconds = 5;
+    std::vector<ClientGroup> groups;
+};
+
+/**
+ * Minimal RFC 6455 client over a raw asio socket
+ * Owning the read loop lets slow readers throttle at the byte level, which
+ * is what builds real send-queue backpressure on the bridge side
+ */
+class WsConnection : public std::enable_shared_from_this<WsConnection> {
+public:
+    enum class State { Connecting, Handshaking, Open, Closed };
+
+    std::atomic<uint64_t> messages{0};
+    std::atomic<uint64_t> bytes{0};
+    std::atomic<State> state{State::Connecting};
+    std::chrono::steady_clock::time_point openedAt;
+    std::chrono::steady_clock::time_point closedAt;
+    bool failedToConnect = false;
+    bool closedByPeer = false;
+    std::function<void(const std::string&)> onText;
+
+private:
+    asio::strand<asio::io_context::executor_type> strand;
+    tcp::socket socket;
+    asio::steady_timer throttleTimer;
+    const LoadgenConfig& config;
+    LatencyHistogram& latency;
+    json subscription;
+    size_t slowBytesPerSec;
+    double readTokens;
+
+    std::array<uint8_t, 65536> readChunk;
+    std::vector<uint8_t> rx;
+    size_t rxOffset;
+    std::vector<std::vector<uint8_t>> writeQueue;
+    bool writing;
+    std::mt19937 maskRng;
+
+public:
+    WsConnection(asio::io_context& io, const LoadgenConfig& config, LatencyHistogram& latency,
+                 json subscription, size_t slowBytesPerSec, uint32_t seed)
+        : strand(asio::make_strand(io)), socket(strand), throttleTimer(strand),
+          config(config), latency(latency), subscription(std::move(subscription)),
+          slowBytesPerSec(slowBytesPerSec), readTokens(0), rxOffset(0),
+          writing(false), maskRng(seed) {}
+
+    void start(const tcp::endpoint& endpoint) {
+        auto self = shared_from_this();
+        socket.async_connect(endpoint, [this, self](const asio::error_code& ec) {
+            if (ec) {
+                failedToConnect = true;
+                markClosed(false);
+                return;
+            }
+            socket.set_option(tcp::no_delay(true));
+            if (slowBytesPerSec > 0) {
+                // Keep the kernel buffer small so throttling is felt by the bridge
+                socket.set_option(asio::socket_base::receive_buffer_size(4096));
+            }
+            state = State::Handshaking;
+            sendHandshake();
+        });
+    }
+
+    void sendText(const std::string& payload) {
+        auto self = shared_from_this();
+        asio::post(strand, [this, self, payload]() {
+            queueFrame(0x1, payload);
+        });
+    }
+
+    void close() {
+        auto self = shared_from_this();
+        asio::post(strand, [this, self]() {
+            asio::error_code ignored;
+            throttleTimer.cancel();
+            socket.close(ignored);
+            markClosed(false);
+        });
+    }
+
+    double messageRate() const {
+        if (openedAt == std::chrono::steady_clock::time_point{}) return 0;
+        const auto end = state == State::Closed ? closedAt : std::chrono::steady_clock::now();
+        const double seconds = std::chrono::duration<double>(end - openedAt).count();
+        return seconds > 0 ? static_cast<double>(messages.load()) / seconds : 0;
+    }
+
+private:
+    void markClosed(bool byPeer) {
+        if (state == State::Closed) return;
+        closedByPeer = byPeer && state == State::Open;
+        closedAt = std::chrono::steady_clock::now();
+        state = State::Closed;
+    }
+
+    void sendHandshake() {
+        std::string request =
+            "GET / HTTP/1.1\r\n"
+            "Host: " + config.host + ":" + std::to_string(config.wsPort) + "\r\n"
+            "Upgrade: websocket\r\n"
+            "Connection: Upgrade\r\n"
+            "Sec-WebSocket-Key: dGhlIHNhbXBsZSBub25jZQ==\r\n"
+            "Sec-WebSocket-Version: 13\r\n\r\n";
+        writeQueue.emplace_back(request.begin(), request.end());
+        flushWrites();
+        readMore();
+    }
+
+    void queueFrame(uint8_t opcode, const std::string& payload) {
+        if (state == State::Closed) return;
+
+        // Client-to-server frames must be masked
+        std::vector<uint8_t> frame;
+        frame.reserve(payload.size() + 14);
+        frame.push_back(static_cast<uint8_t>(0x80 | opcode));
+        if (payload.size() < 126) {
+            frame.push_back(static_cast<uint8_t>(0x80 | payload.size()));
+        } else {
+            frame.push_back(0x80 | 126);
+            frame.push_back(static_cast<uint8_t>(payload.size() >> 8));
+            frame.push_back(static_cast<uint8_t>(payload.size() & 0xff));
+        }
+        const uint32_t key = maskRng();
+        const uint8_t mask[4] = {
+            static_cast<uint8_t>(key), static_cast<uint8_t>(key >> 8),
+            static_cast<uint8_t>(key >> 16), static_cast<uint8_t>(key >> 24)
+        };
+        frame.insert(frame.end(), mask, mask + 4);
+        for (size_t i = 0; i < payload.size(); ++i) {
+            frame.push_back(static_cast<uint8_t>(payload[i]) ^ mask[i & 3]);
+        }
+
+        writeQueue.push_back(std::move(frame));
+        flushWrites();
+    }
+
+    void flushWrites() {
+        if (writing || writeQueue.empty() || state == State::Closed) return;
+        writing = true;
+
+        auto self = shared_from_this();
+        auto frame = std::make_shared<std::vector<uint8_t>>(std::move(writeQueue.front()));
+        writeQueue.erase(writeQueue.begin());
+        asio::async_write(socket, asio::buffer(*frame),
+            [this, self, frame](const asio::error_code& ec, size_t) {
+                writing = false;
+                if (ec) {
+                    markClosed(true);
+                    return;
+                }
+                flushWrites();
+            });
+    }
+
+    void readMore() {
+        if (state == State::Closed) return;
+
+        size_t budget = readChunk.size();
+        if (slowBytesPerSec > 0 && state == State::Open) {
+            if (readTokens < 1.0) {
+                // Refill every 50 ms at the configured byte rate
+                auto self = shared_from_this();
+                throttleTimer.expires_after(std::chrono::milliseconds(50));
+                throttleTimer.async_wait([this, self](const asio::error_code& ec) {
+                    if (ec) return;
+                    readTokens += static_cast<double>(slowBytesPerSec) * 0.05;
+                    readMore();
+                });
+                return;
+            }
+            budget = std::min(budget, static_cast<size_t>(readTokens));
+        }
+
+        auto self = shared_from_this();
+        socket.async_read_some(asio::buffer(readChunk.data(), budget),
+            [this, self](const asio::error_code& ec, size_t length) {
+                if (ec) {
+                    markClosed(true);
+                    return;
+                }
+                if (slowBytesPerSec > 0 && state == State::Open) {
+                    readTokens -= static_cast<double>(length);
+                }
+                bytes += length;
+                rx.insert(rx.end(), readChunk.begin(), readChunk.begin() + length);
+
+                if (state == State::Handshaking && !parseHandshake()) return;
+                if (state == State::Open) parseFrames();
+
+                // Compact the receive buffer once the consumed prefix dominates
+                if (rxOffset > 0 && rxOffset * 2 >= rx.size()) {
+                    rx.erase(rx.begin(), rx.begin() + rxOffset);
+                    rxOffset = 0;
+                }
+                readMore();
+            });
+    }
+
+    bool parseHandshake() {
+        static const char terminator[] = "\r\n\r\n";
+        auto end = std::search(rx.begin(), rx.end(), terminator, terminator + 4);
+        if (end == rx.end()) return true;
+
+        const std::string header(rx.begin(), end);
+        if (header.compare(0, 12, "HTTP/1.1 101") != 0) {
+            asio::error_code ignored;
+            socket.close(ignored);
+            failedToConnect = true;
+            markClosed(false);
+            return false;
+        }
+
+        rxOffset = static_cast<size_t>(end - rx.begin()) + 4;
+        openedAt = std::chrono::steady_clock::now();
+        state = State::Open;
+        if (!subscription.is_null()) queueFrame(0x1, subscription.dump());
+        return true;
+    }
+
+    void parseFrames() {
+        while (rx.size() - rxOffset >= 2) {
+            const uint8_t* p = rx.data() + rxOffset;
+            const size_t available = rx.size() - rxOffset;
+            const uint8_t opcode = p[0] & 0x0f;
+            uint64_t length = p[1] & 0x7f;
+            size_t header = 2;
+
+            if (length == 126) {
+                if (available < 4) return;
+                length = (static_cast<uint64_t>(p[2]) << 8) | p[3];
+                header = 4;
+            } else if (length == 127) {
+                if (available < 10) return;
+                length = 0;
+                for (int i = 0; i < 8; ++i) length = (length << 8) | p[2 + i];
+                header = 10;
+            }
+            if (p[1] & 0x80) header += 4;
+            if (available < header + length) return;
+
+            const char* payload = reinterpret_cast<const char*>(p + header);
+            rxOffset += header + static_cast<size_t>(length);
+
+            switch (opcode) {
+            case 0x1:
+                handleText(payload, static_cast<size_t>(length));
+                break;
+            case 0x2:
+                messages++;
+                break;
+            case 0x8:
+                markClosed(true);
+                return;
+            case 0x9:
+                queueFrame(0xA, std::string(payload, static_cast<size_t>(length)));
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void handleText(const char* payload, size_t length) {
+        static const char key[] = "\"timestamp\":";
+        const char* end = payload + length;
+
+        // Top-level "timestamp" sorts after "data" so it is the last occurrence
+        const char* found = std::find_end(payload, end, key, key + sizeof(key) - 1);
+        const bool isSample = length > 20 && std::strncmp(payload, "{\"data\":", 8) == 0;
+
+        if (isSample && found != end) {
+            messages++;
+            const int64_t sampleMillis = std::strtoll(found + sizeof(key) - 1, nullptr, 10);
+            latency.record(nowMillis() - sampleMillis);
+        } else if (onText) {
+            onText(std::string(payload, length));
+        }
+    }
+};
+
+/**
+ * Counts OpenTrack UDP packets received on the bridge's UDP port
+ */
+class UdpReader {
+public:
+    std::atomic<uint64_t> packets{0};
+
+private:
+    udp::socket socket;
+    udp::endpoint sender;
+    std::array<uint8_t, 2048> buffer;
+
+public:
+    UdpReader(asio::io_context& io, int port) : socket(io) {
+        socket.open(udp::v4());
+        socket.set_option(asio::socket_base::reuse_address(true));
+        socket.bind(udp::endpoint(udp::v4(), static_cast<unsigned short>(port)));
+    }
+
+    void start() {
+        socket.async_receive_from(asio::buffer(buffer), sender,
+            [this](const asio::error_code& ec, size_t) {
+                if (ec == asio::error::operation_aborted) return;
+                if (!ec) packets++;
+                start();
+            });
+    }
+
+    void stop() {
+        asio::error_code ignored;
+        socket.close(ignored);
+    }
+};
+
+/**
+ * A sample stream receiver: subscribes from its own socket, renews the
+ * subscription every second and sends NACKs for gaps every 10 ms
+ */
+class UdpStreamReader {
+private:
+    udp::socket socket;
+    udp::endpoint bridge;
+    udp::endpoint sender;
+    asio::steady_timer timer;
+    std::array<char, UdpStream::MAX_DATAGRAM> buffer;
+    std::mutex mutex;
+    UdpStream::Receiver<> receiver;
+    int64_t lastSubscribeMs = 0;
+
+public:
+    UdpStreamReader(asio::io_context& io, const std::string& host, int port)
+        : socket(io, udp::endpoint(udp::v4(), 0)), timer(io) {
+        udp::resolver resolver(io);
+        bridge = *resolver.resolve(udp::v4(), host, std::to_string(port)).begin();
+    }
+
+    void start() {
+        subscribe();
+        receive();
+        poll();
+    }
+
+    void stop() {
+        char unsubscribe[UdpStream::HEADER_SIZE];
+        UdpStream::writeHeader(unsubscribe, UdpStream::Kind::Unsubscribe);
+        asio::error_code ignored;
+        socket.send_to(asio::buffer(unsubscribe), bridge, 0, ignored);
+        timer.cancel();
+        socket.close(ignored);
+    }
+
+    UdpStream::ReceiverStats stats() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return receiver.stats();
+    }
+
+private:
+    static uint64_t nowMicros() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    void subscribe() {
+        char datagram[UdpStream::HEADER_SIZE + 2];
+        const size_t size = UdpStream::writeSubscribe(datagram, SampleFormat::Binary, STREAM_GAZE | STREAM_HEAD);
+        asio::error_code ignored;
+        socket.send_to(asio::buffer(datagram, size), bridge, 0, ignored);
+        lastSubscribeMs = nowMillis();
+    }
+
+    void receive() {
+        socket.async_receive_from(asio::buffer(buffer), sender,
+            [this](const asio::error_code& ec, size_t size) {
+                if (ec == asio::error::operation_aborted) return;
+                if (!ec) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    receiver.receive(buffer.data(), size, nowMicros(), [](uint64_t, const char*, size_t, bool) {});
+                }
+                receive();
+            });
+    }
+
+    void poll() {
+        timer.expires_after(std::chrono::milliseconds(10));
+        timer.async_wait([this](const asio::error_code& ec) {
+            if (ec == asio::error::operation_aborted) return;
+            char nack[UdpStream::NACK_SIZE + UdpStream::MAX_NACK_RANGES * 4];
+            size_t size;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                size = receiver.buildNack(nack, nowMicros());
+            }
+            asio::error_code ignored;
+            if (size > 0) socket.send_to(asio::buffer(nack, size), bridge, 0, ignored);
+            if (nowMillis() - lastSubscribeMs >= 1000) subscribe();
+            poll();
+        });
+    }
+};
+
+/**
+ * A multicast receiver: joins the bridge's group, drops a share of the
+ * datagrams itself to simulate a lossy link and rebuilds what it can from
+ * the FEC parity. It reports back to the sender about once a second, which
+ * is what keeps an otherwise unsubscribed bridge out of idle
+ */
+class MulticastReader {
+private:
+    udp::socket socket;
+    udp::endpoint sender;
+    std::array<char, UdpStream::MAX_DATAGRAM> buffer;
+    std::mutex mutex;
+    Fec::Receiver<> receiver;
+    std::mt19937_64 random;
+    std::bernoulli_distribution drop;
+    uint64_t dropped = 0;
+    int64_t lastReportMs = 0;
+
+public:
+    MulticastReader(asio::io_context& io, const std::string& group, int port, double loss, uint64_t seed)
+        : socket(io), random(seed), drop(loss) {
+        socket.open(udp::v4());
+        socket.set_option(asio::socket_base::reuse_address(true));
+        socket.bind(udp::endpoint(udp::v4(), static_cast<unsigned short>(port)));
+        socket.set_option(asio::ip::multicast::join_group(asio::ip::make_address(group)));
+    }
+
+    void start() {
+        socket.async_receive_from(asio::buffer(buffer), sender,
+            [this](const asio::error_code& ec, size_t size) {
+                if (ec == asio::error::operation_aborted) return;
+                if (!ec) {
+                    if (nowMillis() - lastReportMs >= 1000) report();
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (drop(random)) {
+                        dropped++;
+                    } else {
+                        receiver.receive(buffer.data(), size, [](uint64_t, const char*, size_t, bool) {});
+                    }
+                }
+                start();
+            });
+    }
+
+    void stop() {
+        asio::error_code ignored;
+        socket.close(ignored);
+    }
+
+    void report() {
+        char datagram[UdpStream::HEADER_SIZE];
+        UdpStream::writeHeader(datagram, UdpStream::Kind::Report);
+        asio::error_code ignored;
+        socket.send_to(asio::buffer(datagram), sender, 0, ignored);
+        lastReportMs = nowMillis();
+    }
+
+    Fec::ReceiverStats stats(uint64_t* droppedOut = nullptr) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (droppedOut) *droppedOut = dropped;
+        return receiver.stats();
+    }
+};
+
+/**
+ * Drives the whole run: ramps connections, reports periodically, summarizes
+ */
+class LoadGenerator {
+private:
+    LoadgenConfig config;
+    asio::io_context io;
+    asio::executor_work_guard<asio::io_context::executor_type> work;
+    std::vector<std::thread> threads;
+    std::vector<std::shared_ptr<WsConnection>> connections;
+    std::vector<std::unique_ptr<UdpReader>> udpReaders;
+    std::vector<std::unique_ptr<UdpStreamReader>> udpStreamReaders;
+    std::vector<std::unique_ptr<MulticastReader>> multicastReaders;
+    std::shared_ptr<WsConnection> control;
+    LatencyHistogram latency;
+
+    std::mutex statusMutex;
+    std::vector<json> statusReplies;
+
+public:
+    explicit LoadGenerator(LoadgenConfig cfg)
+        : config(std::move(cfg)), work(asio::make_work_guard(io)) {}
+
+    int run() {
+        tcp::resolver resolver(io);
+        const auto endpoints = resolver.resolve(config.host, std::to_string(config.wsPort));
+        const tcp::endpoint endpoint = *endpoints.begin();
+
+        for (int i = 0; i < config.threads; ++i) {
+            threads.emplace_back([this]() { io.run(); });
+        }
+
+        startControlConnection(endpoint);
+        for (int i = 0; i < config.udpReaders; ++i) {
+            udpReaders.push_back(std::make_unique<UdpReader>(io, config.udpPort));
+            udpReaders.back()->start();
+        }
+        for (int i = 0; i < config.udpStreamReaders; ++i) {
+            udpStreamReaders.push_back(std::make_unique<UdpStreamReader>(io, config.host, config.udpStreamPort));
+            udpStreamReaders.back()->start();
+        }
+        for (int i = 0; i < config.multicastReaders; ++i) {
+            multicastReaders.push_back(std::make_unique<MulticastReader>(io, config.multicastGroup, config.multicastPort,
+                                                                         config.multicastLoss, 0x5eed + i));
+            multicastReaders.back()->start();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        rampConnections(endpoint, start);
+
+        auto nextReport = start + std::chrono::seconds(config.reportIntervalSeconds);
+        const auto end = start + std::chrono::seconds(config.durationSeconds);
+        while (std::chrono::steady_clock::now() < end) {
+            std::this_thread::sleep_until(std::min(nextReport, end));
+            if (std::chrono::steady_clock::now() >= nextReport) {
+                printProgress(start);
+                nextReport += std::chrono::seconds(config.reportIntervalSeconds);
+            }
+        }
+
+        requestBridgeStatus();
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+        for (auto& connection : connections) connection->close();
+        for (auto& reader : udpReaders) reader->stop();
+        for (auto& reader : udpStreamReaders) reader->stop();
+        for (auto& reader : multicastReaders) reader->stop();
+        control->close();
+        work.reset();
+        io.stop();
+        for (auto& thread : threads) thread.join();
+
+        printSummary(secondsSince(start));
+        return 0;
+    }
+
+private:
+    void startControlConnection(const tcp::endpoint& endpoint) {
+        json subscription;
+        subscription["type"] = "subscribe";
+        subscription["data"]["streams"] = json::array();
+        subscription["data"]["decimation"] = 1000000;
+
+        control = std::make_shared<WsConnection>(io, config, latency, subscription, 0, 1);
+        control->onText = [this](const std::string& text) {
+            json message = json::parse(text, nullptr, false);
+            if (message.is_discarded() || !message.contains("status")) return;
+            if (!message["status"].contains("packets_dropped")) return;
+            std::lock_guard<std::mutex> lock(statusMutex);
+            statusReplies.push_back(message["status"]);
+        };
+        control->start(endpoint);
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (control->state != WsConnection::State::Open &&
+               control->state != WsConnection::State::Closed &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        if (control->state != WsConnection::State::Open) {
+            std::cerr << "⚠️ Control connection to bridge failed; drop counts unavailable" << std::endl;
+            return;
+        }
+        requestBridgeStatus();
+    }
+
+    void requestBridgeStatus() {
+        if (control && control->state == WsConnection::State::Open) {
+            control->sendText("{\"type\":\"get-status\"}");
+        }
+    }
+
+    void rampConnections(const tcp::endpoint& endpoint, std::chrono::steady_clock::time_point start) {
+        const auto interval = std::chrono::microseconds(1000000 / std::max(1, config.connectRate));
+        auto next = start;
+        uint32_t seed = 2;
+
+        for (const auto& group : config.groups) {
+            json subscription;
+            subscription["type"] = "subscribe";
+            subscription["data"]["streams"] = group.streams;
+            subscription["data"]["decimation"] = group.decimation;
+
+            for (int i = 0; i < group.count; ++i) {
+                auto connection = std::make_shared<WsConnection>(
+                    io, config, latency, subscription, group.slowBytesPerSec, seed++);
+                connections.push_back(connection);
+                connection->start(endpoint);
+
+                next += interval;
+                std::this_thread::sleep_until(next);
+            }
+        }
+    }
+
+    void printProgress(std::chrono::steady_clock::time_point start) {
+        size_t open = 0, closed = 0;
+        uint64_t messages = 0;
+        for (const auto& connection : connections) {
+            if (connection->state == WsConnection::State::Open) open++;
+            if (connection->state == WsConnection::State::Closed) closed++;
+            messages += connection->messages;
+        }
+        uint64_t udpPackets = 0;
+        for (const auto& reader : udpReaders) udpPackets += reader->packets;
+        uint64_t streamSamples = 0;
+        for (const auto& reader : udpStreamReaders) streamSamples += reader->stats().received;
+        uint64_t multicastSamples = 0;
+        for (const auto& reader : multicastReaders) {
+            const Fec::ReceiverStats stats = reader->stats();
+            multicastSamples += stats.received + stats.recovered;
+        }
+
+        std::cout << std::fixed << std::setprecision(1)
+                  << "[" << secondsSince(start) << "s] open=" << open
+                  << " closed=" << closed
+                  << " ws_msgs=" << messages
+                  << " udp_pkts=" << udpPackets
+                  << " udp_stream_samples=" << streamSamples
+                  << " multicast_samples=" << multicastSamples << std::endl;
+    }
+
+    void printSummary(double elapsedSeconds) {
+        std::vector<double> rates;
+        size_t connectFailures = 0, disconnects = 0, slowClients = 0;
+        uint64_t messages = 0, bytes = 0;
+
+        size_t index = 0;
+        for (const auto& group : config.groups) {
+            for (int i = 0; i < group.count; ++i, ++index) {
+                const auto& connection = connections[index];
+                if (connection->failedToConnect) { connectFailures++; continue; }
+                if (connection->closedByPeer) disconnects++;
+                if (group.slowBytesPerSec > 0) slowClients++;
+                rates.push_back(connection->messageRate());
+                messages += connection->messages;
+                bytes += connection->bytes;
+            }
+        }
+        std::sort(rates.begin(), rates.end());
+        auto rateAt = [&rates](double p) {
+            if (rates.empty()) return 0.0;
+            return rates[static_cast<size_t>(p / 100.0 * static_cast<double>(rates.size() - 1))];
+        };
+
+        std::cout << "\n==== Tobii bridge load test summary ====" << std::endl;
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "duration_s=" << elapsedSeconds
+                  << " connections=" << connections.size()
+                  << " slow=" << slowClients
+                  << " connect_failures=" << connectFailures
+                  << " disconnects=" << disconnects << std::endl;
+        std::cout << "ws_messages=" << messages
+                  << " ws_bytes=" << bytes
+                  << " aggregate_msgs_per_s=" << static_cast<double>(messages) / elapsedSeconds << std::endl;
+        std::cout << "per_conn_rate_hz min=" << rateAt(0) << " p10=" << rateAt(10)
+                  << " p50=" << rateAt(50) << " max=" << rateAt(100) << std::endl;
+        std::cout << "latency_ms samples=" << latency.count()
+                  << " p50=" << latency.percentile(50) << " p90=" << latency.percentile(90)
+                  << " p99=" << latency.percentile(99) << " p99.9=" << latency.percentile(99.9)
+                  << " max=" << latency.max() << std::endl;
+
+        for (size_t i = 0; i < udpReaders.size(); ++i) {
+            std::cout << "udp_reader[" << i << "] packets=" << udpReaders[i]->packets
+                      << " rate_hz=" << static_cast<double>(udpReaders[i]->packets) / elapsedSeconds << std::endl;
+        }
+        for (size_t i = 0; i < udpStreamReaders.size(); ++i) {
+            const UdpStream::ReceiverStats stats = udpStreamReaders[i]->stats();
+            std::cout << "udp_stream[" << i << "] samples=" << stats.received
+                      << " recovered=" << stats.recovered << " lost=" << stats.lost
+                      << " duplicates=" << stats.duplicates << " nacks=" << stats.nacks
+                      << " rate_hz=" << static_cast<double>(stats.received) / elapsedSeconds << std::endl;
+        }
+        for (size_t i = 0; i < multicastReaders.size(); ++i) {
+            uint64_t dropped = 0;
+            const Fec::ReceiverStats stats = multicastReaders[i]->stats(&dropped);
+            std::cout << "multicast[" << i << "] samples=" << stats.received
+                      << " rebuilt=" << stats.recovered << " lost=" << stats.lost
+                      << " parity=" << stats.parity << " dropped=" << dropped
+                      << " rate_hz=" << static_cast<double>(stats.received + stats.recovered) / elapsedSeconds
+                      << std::endl;
+        }
+
+        std::lock_guard<std::mutex> lock(statusMutex);
+        if (statusReplies.size() >= 2) {
+            const json& first = statusReplies.front();
+            const json& last = statusReplies.back();
+            std::cout << "bridge packets_distributed_delta="
+                      << last.value("packets_distributed", 0ull) - first.value("packets_distributed", 0ull)
+                      << " packets_dropped_delta="
+                      << last.value("packets_dropped", 0ull) - first.value("packets_dropped", 0ull)
+                      << " clients_at_end=" << last.value("clients", 0ull) << std::endl;
+        } else {
+            std::cout << "bridge status unavailable (no get-status replies)" << std::endl;
+        }
+    }
+};
+
+void raiseFileDescriptorLimit() {
+#if defined(__unix__) || defined(__APPLE__)
+    rlimit limit{};
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+#endif
+}
+
+void printUsage() {
+    std::cout <<
+        "Usage: tobii_bridge_loadgen [options]\n"
+        "  --host <addr>            Bridge host (default 127.0.0.1)\n"
+        "  --ws-port <port>         Bridge WebSocket port (default 8080)\n"
+        "  --udp-port <port>        Bridge OpenTrack UDP port (default 4242)\n"
+        "  --clients <spec>         Client group count[:streams[:decimation[:slowBytesPerSec]]]\n"
+        "                           Repeatable, e.g. --clients 900 --clients 100:gaze:2:2048\n"
+        "  --udp-readers <n>        UDP readers bound to the OpenTrack port (default 0)\n"
+        "  --udp-stream-port <port> Bridge UDP sample stream port (default 4243)\n"
+        "  --udp-stream-readers <n> Sample stream receivers with NACK recovery (default 0)\n"
+        "  --multicast-group <addr> Bridge multicast group (default 239.255.42.42)\n"
+        "  --multicast-port <port>  Bridge multicast port (default 4244)\n"
+        "  --multicast-readers <n>  Multicast receivers with FEC recovery (default 0)\n"
+        "  --multicast-loss <p>     Share of datagrams each multicast receiver drops (default 0)\n"
+        "  --threads <n>            I/O threads (default: hardware concurrency)\n"
+        "  --connect-rate <n>       New connections per second (default 500)\n"
+        "  --duration <s>           Test duration in seconds (default 30)\n"
+        "  --report-interval <s>    Progress report interval (default 5)\n";
+}
+
+} // namespace
+
+/**
+ * Main entry point
+ */
+int main(int argc, char* argv[]) {
+    LoadgenConfig config;
+
+    try {
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--host") config.host = next();
+            else if (arg == "--ws-port") config.wsPort = std::stoi(next());
+            else if (arg == "--udp-port") config.udpPort = std::stoi(next());
+            else if (arg == "--clients") config.groups.push_back(ClientGroup::parse(next()));
+            else if (arg == "--udp-readers") config.udpReaders = std::stoi(next());
+            else if (arg == "--udp-stream-port") config.udpStreamPort = std::stoi(next());
+            else if (arg == "--udp-stream-readers") config.udpStreamReaders = std::stoi(next());
+            else if (arg == "--multicast-group") config.multicastGroup = next();
+            else if (arg == "--multicast-port") config.multicastPort = std::stoi(next());
+            else if (arg == "--multicast-readers") config.multicastReaders = std::stoi(next());
+            else if (arg == "--multicast-loss") config.multicastLoss = std::stod(next());
+            else if (arg == "--threads") config.threads = std::max(1, std::stoi(next()));
+            else if (arg == "--connect-rate") config.connectRate = std::max(1, std::stoi(next()));
+            else if (arg == "--duration") config.durationSeconds = std::max(1, std::stoi(next()));
+            else if (arg == "--report-interval") config.reportIntervalSeconds = std::max(1, std::stoi(next()));
+            else if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+            else throw std::invalid_argument("unknown option " + arg);
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid arguments: " << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    if (config.groups.empty()) {
+        config.groups.push_back(ClientGroup::parse("100"));
+    }
+
+    raiseFileDescriptorLimit();
+
+    try {
+        LoadGenerator generator(config);
+        return generator.run();
+    } catch (const std::exception& e) {
+        std::cerr << "Load generator exception: " << e.what() << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,139 @@
+/**
+ * Tobii Bridge Probe
+ * A minimal in-process consumer of tobiibridge.h, written in C so the
+ * header stays C-clean. Opens a source, follows the sample ring zero-copy
+ * for a number of samples with an AOI rule registered, then prints the
+ * history overview, the last pose and stats. Exits non-zero when no sample
+ * arrives
+ *
+ *   tobii_bridge_probe [--source synthetic] [--samples 300] [--faults spec]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tobiibridge.h"
+
+#define PROBE_HISTORY_POINTS 16
+
+static const char* PROBE_RULES =
+    "{\"aois\":[{\"name\":\"centre\",\"x\":0.25,\"y\":0.25,\"width\":0.5,\"height\":0.5}],"
+    "\"rules\":[{\"id\":\"enter-centre\",\"type\":\"enter\",\"aoi\":\"centre\"},"
+    "{\"id\":\"absent\",\"type\":\"absence\",\"ms\":500}]}";
+
+int main(int argc, char* argv[]) {
+    const char* source = "synthetic";
+    const char* faults = NULL;
+    long samples = 300;
+    char options[512];
+    tobiibridge* bridge;
+    uint64_t next;
+    long received = 0;
+    long overwritten = 0;
+    long events = 0;
+    double gazeSum = 0.0;
+    char frame[512];
+    size_t frameLength = 0;
+    tobiibridge_event fired[32];
+    tobiibridge_history_point points[PROBE_HISTORY_POINTS];
+    size_t pointCount;
+    uint64_t pointMs = 0;
+    tobiibridge_stats stats;
+    tobiibridge_pose pose;
+    int poseRead = 0;
+    int i;
+
+    for (i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--source") == 0 && i + 1 < argc) source = argv[++i];
+        else if (strcmp(argv[i], "--samples") == 0 && i + 1 < argc) samples = atol(argv[++i]);
+        else if (strcmp(argv[i], "--faults") == 0 && i + 1 < argc) faults = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [--source name] [--samples n] [--faults spec]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (tobiibridge_api_version() != TOBIIBRIDGE_API_VERSION) {
+        fprintf(stderr, "tobiibridge API %d, built against %d\n", tobiibridge_api_version(), TOBIIBRIDGE_API_VERSION);
+        return 1;
+    }
+    snprintf(options, sizeof(options), "{\"loop_interval_ms\":5,\"faults\":\"%s\"}", faults ? faults : "");
+    bridge = tobiibridge_open(source, options);
+    if (!bridge) {
+        fprintf(stderr, "open failed: %s\n", tobiibridge_last_error());
+        return 1;
+    }
+    if (tobiibridge_set_rules(bridge, PROBE_RULES) != TOBIIBRIDGE_OK) {
+        fprintf(stderr, "set_rules failed: %s\n", tobiibridge_last_error());
+        tobiibridge_close(bridge);
+        return 1;
+    }
+    if (tobiibridge_start(bridge) != TOBIIBRIDGE_OK) {
+        fprintf(stderr, "start failed: %s\n", tobiibridge_last_error());
+        tobiibridge_close(bridge);
+        return 1;
+    }
+    /* The bridge's own thread drives it now; neither a second start nor a tick may */
+    if (tobiibridge_start(bridge) != TOBIIBRIDGE_ERROR_STATE || tobiibridge_tick(bridge) != TOBIIBRIDGE_ERROR_STATE) {
+        fprintf(stderr, "start or tick was allowed while started\n");
+        tobiibridge_close(bridge);
+        return 1;
+    }
+
+    /* Follow the ring: wait for the next sequence, read the slot in place, check it was not reused */
+    next = tobiibridge_sequence(bridge);
+    while (received < samples) {
+        const int64_t end = tobiibridge_wait(bridge, next, 1000);
+        if (end < 0) break;
+        for (; next < (uint64_t)end; ++next) {
+            const tobiibridge_sample* sample = tobiibridge_sample_at(bridge, next);
+            float gazeX;
+            if (!sample) {
+                overwritten++;
+                continue;
+            }
+            gazeX = sample->has_gaze ? sample->gaze_x : 0.0f;
+            if (frameLength == 0) {
+                frameLength = tobiibridge_encode(sample, TOBIIBRIDGE_FORMAT_JSON,
+                                                 TOBIIBRIDGE_STREAM_GAZE | TOBIIBRIDGE_STREAM_PRESENCE,
+                                                 frame, sizeof(frame) - 1);
+            }
+            if (!tobiibridge_sample_valid(bridge, next)) {
+                overwritten++;
+                continue;
+            }
+            gazeSum += gazeX;
+            received++;
+        }
+        events += (long)tobiibridge_poll_events(bridge, fired, sizeof(fired) / sizeof(fired[0]));
+    }
+    tobiibridge_stop(bridge);
+    events += (long)tobiibridge_poll_events(bridge, fired, sizeof(fired) / sizeof(fired[0]));
+    poseRead = next > 0 && tobiibridge_read_pose(bridge, next - 1, &pose) == TOBIIBRIDGE_OK;
+
+    pointCount = tobiibridge_history(bridge, 0, 0, PROBE_HISTORY_POINTS, points, PROBE_HISTORY_POINTS, &pointMs);
+    memset(&stats, 0, sizeof(stats));
+    stats.struct_size = sizeof(stats);
+    tobiibridge_get_stats(bridge, &stats);
+
+    frame[frameLength] = '\0';
+    printf("Samples: %ld read in place, %ld overwritten before reading, mean gaze x %.3f\n", received, overwritten,
+           received > 0 ? gazeSum / (double)received : 0.0);
+    printf("First frame: %s\n", frameLength > 0 ? frame : "(none)");
+    if (poseRead) {
+        printf("Pose: head (%.3f, %.3f, %.3f, %.3f), gaze ray from (%.1f, %.1f, %.1f) along (%.3f, %.3f, %.3f)\n",
+               pose.orientation[0], pose.orientation[1], pose.orientation[2], pose.orientation[3],
+               pose.gaze_origin[0], pose.gaze_origin[1], pose.gaze_origin[2],
+               pose.gaze_direction[0], pose.gaze_direction[1], pose.gaze_direction[2]);
+    }
+    printf("Rule events: %ld (%llu dropped)\n", events, (unsigned long long)stats.events_dropped);
+    printf("History: %lu points at %llu ms\n", (unsigned long)pointCount, (unsigned long long)pointMs);
+    printf("Stats: %s, %llu processed, %llu published, %llu outages (%llu ms)\n",
+           stats.connected ? "connected" : "source lost", (unsigned long long)stats.samples_processed,
+           (unsigned long long)stats.samples_published, (unsigned long long)stats.outages,
+           (unsigned long long)stats.outage_ms);
+
+    tobiibridge_close(bridge);
+    return received > 0 ? 0 : 1;
+}
@@ -11,9 +11,17 @@
 #include <chrono>
 #include <atomic>
 #include <memory>
-#include <unordered_map>
+#include <map>
+#include <mutex>
+#include <condition_variable>
+#include <array>
+#include <algorithm>
 #include <vector>
 #include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
 
 // WebSocket server (using websocketpp)
 #include <websocketpp/config/asio_no_tls.hpp>
@@ -25,39 +33,104 @@
 // JSON handling
 #include <nlohmann/json.hpp>
 
-// Tobii Game Integration API
-#include "tobii_gameintegration.h"
+// Bridge core
+#include "tobii-data-packet.hpp"
+#include "sample-schema.hpp"
+#include "sample-encoder.hpp"
+#include "sample-decoder-js.hpp"
+#include "sample-ring.hpp"
+#include "sequence-wheel.hpp"
+#include "display-mapper.hpp"
+#include "gaze-rules.hpp"
+#include "gaze-filter.hpp"
+#include "sample-recorder.hpp"
+#include "quality-monitor.hpp"
+#include "topic-bus.hpp"
+#include "udp-stream.hpp"
+#include "fec-codec.hpp"
+#include "rate-controller.hpp"
+#include "admission-control.hpp"
+#include "load-shedder.hpp"
+#include "gaze-predictor.hpp"
+#include "frame-writer.hpp"
+#include "alloc-tracker.hpp"
+#include "async-logger.hpp"
+#include "bridge-config.hpp"
+#include "thread-affinity.hpp"
+#include "bridge-clock.hpp"
+
+// Acquisition, processing and history (tracker sources come through it)
+#include "bridge-core.hpp"
 
 using json = nlohmann::json;
 using websocketpp::lib::placeholders::_1;
 using websocketpp::lib::placeholders::_2;
 using websocketpp::lib::bind;
+using WsMessage = websocketpp::config::asio::message_type;
 
 /**
- * Tobii data packet structure
+ * Per-connection WebSocket client state. A session is parked on the sample
+ * wheel until the sequence it is next due at; sessions that are paused,
+ * closing or closed are not parked at all
  */
-struct TobiiDataPacket {
-    uint64_t timestamp;
-    
-    // Gaze data
-    bool hasGaze;
-    float gazeX, gazeY;
-    uint64_t gazeTimestamp;
-    float gazeConfidence;
-    
-    // Head pose data
-    bool hasHead;
-    float headYaw, headPitch, headRoll;
-    float headPosX, headPosY, headPosZ;
-    float headConfidence;
-    
-    // Presence detection
-    bool present;
-    
-    // Quality metrics
-    float overallQuality;
+struct ClientSession {
+    websocketpp::connection_hdl hdl;
+    std::string id;
+    uint32_t streams = STREAM_DEFAULT;
+    SampleFormat format = SampleFormat::Json;
+    uint32_t decimation = 1;
+    int geometry = -1;              // DisplayMapper index registered with set-display
+    std::unique_ptr<GazeRuleSet> rules;     // set-rules; evaluated on every sample
+    bool markers = true;            // receive tobii-marker echoes
+    bool quality = true;            // receive tobii-quality reports and alerts
+    uint32_t topics = 0;            // TopicMask; non-zero replaces samples, markers and quality with tobii-topic frames
+    
+    // Admission: critical clients are designated at connect, low is requested in subscribe
+    std::string address;
+    ClientPriority priority = ClientPriority::Normal;
+    bool shed = false;              // output currently reduced by load shedding
+    
+    // Adaptive rate: format and decimation above are driven by the controller,
+    // starting from what the client asked for
+    bool adaptive = false;
+    SampleFormat requestedFormat = SampleFormat::Json;
+    uint32_t requestedDecimation = 1;
+    RateController rate;
+    uint64_t bytesQueued = 0;       // payload bytes handed to the connection
+    uint64_t pingSentMicros = 0;    // outstanding ping, 0 = none
+    
+    // Benchmark link model: bytes/s drained from a simulated send queue
+    double benchLinkBytesPerSecond = 0.0;
+    double benchQueueBytes = 0.0;
+    uint64_t benchDrainMicros = 0;
+    
+    // Latency compensation requested with subscribe's predict (null = off)
+    std::unique_ptr<PredictionScore> prediction;
+    float predictHorizonMs = -1.0f;     // < 0 = automatic, from tracker latency and RTT
+    float predictExtraMs = 0.0f;        // added to an automatic horizon
+    
+    // Client clock + offset = sample clock, as reported by the client's last clock-sync
+    bool clockSynced = false;
+    double clockOffsetMs = 0.0;
+    double clockRttMs = 0.0;
+    uint64_t packetsSent = 0;
+    uint64_t packetsDropped = 0;
+    
+    // History replay requested with subscribe's catch_up: [replayNext, replayEnd)
+    uint64_t replayNext = 0;
+    uint64_t replayEnd = 0;
+    
+    bool paused = false;
+    bool parked = false;
+    bool closing = false;           // Disconnect backpressure already issued
+    bool closed = false;            // Connection gone; taken off the wheel on close
 };
 
+/**
+ * Outcome of queueing one frame on a client connection
+ */
+enum class SendResult { Sent, Backpressure, Failed };
+
 /**
  * OpenTrack UDP packet structure
  */
@@ -70,14 +143,130 @@ struct OpenTrackPacket {
     float z;
 };
 
+/**
+ * A receiver of the UDP sample stream, known by the endpoint it subscribed from
+ */
+struct UdpStreamSubscriber {
+    asio::ip::udp::endpoint endpoint;
+    SampleFormat format = SampleFormat::Binary;
+    uint32_t streams = STREAM_DEFAULT;
+    uint64_t lastHeardMicros = 0;   // subscribe keep-alive or NACK
+    TokenBucket retransmitBudget;
+    uint64_t sent = 0;
+    uint64_t nacks = 0;
+    uint64_t retransmitted = 0;
+    uint64_t gone = 0;
+    bool active = false;
+};
+
+/**
+ * Pool of prepared WebSocket text frames
+ * One frame is shared by every client subscribed to the same stream mask and
+ * is reused once websocketpp has released all queued references to it, so a
+ * steady set of healthy clients never allocates on send
+ */
+class FramePool {
+private:
+    static constexpr size_t FRAME_CAPACITY = 1024;
+    std::vector<WsMessage::ptr> frames;
+    size_t next;
+
+public:
+    explicit FramePool(size_t initialFrames = 16) : next(0) {
+        frames.reserve(initialFrames * 2);
+        for (size_t i = 0; i < initialFrames; ++i) {
+            frames.push_back(createFrame());
+        }
+    }
+    
+    WsMessage::ptr acquire(const char* payload, size_t length, bool binary = false) {
+        WsMessage::ptr frame = takeFree();
+        
+        // RFC 6455 server frame header: FIN + opcode, unmasked length
+        char header[10];
+        size_t headerLength = 2;
+        header[0] = static_cast<char>(binary ? 0x82 : 0x81);
+        if (length < 126) {
+            header[1] = static_cast<char>(length);
+        } else if (length < 65536) {
+            header[1] = 126;
+            header[2] = static_cast<char>((length >> 8) & 0xff);
+            header[3] = static_cast<char>(length & 0xff);
+            headerLength = 4;
+        } else {
+            header[1] = 127;
+            for (int i = 0; i < 8; ++i) {
+                header[2 + i] = static_cast<char>((static_cast<uint64_t>(length) >> (56 - 8 * i)) & 0xff);
+            }
+            headerLength = 10;
+        }
+        
+        frame->set_opcode(binary ? websocketpp::frame::opcode::binary : websocketpp::frame::opcode::text);
+        frame->set_header(std::string(header, headerLength));
+        frame->set_payload(payload, length);
+        frame->set_prepared(true);
+        return frame;
+    }
+    
+    size_t size() const { return frames.size(); }
+    
+private:
+    WsMessage::ptr takeFree() {
+        for (size_t i = 0; i < frames.size(); ++i) {
+            const size_t index = (next + i) % frames.size();
+            if (frames[index].use_count() == 1) {
+                next = index + 1;
+                return frames[index];
+            }
+        }
+        // Every frame is still queued somewhere (slow clients): grow
+        frames.push_back(createFrame());
+        return frames.back();
+    }
+    
+    static WsMessage::ptr createFrame() {
+        return std::make_shared<WsMessage>(
+            websocketpp::config::asio::con_msg_manager_type::ptr(),
+            websocketpp::frame::opcode::text, FRAME_CAPACITY
+        );
+    }
+};
+
+/**
+ * Allocation counters for the main loop (populated in tracking builds)
+ */
+struct TickAllocationStats {
+    std::atomic<uint64_t> ticks{0};
+    std::atomic<uint64_t> lastTick{0};
+    std::atomic<uint64_t> maxTick{0};
+    std::atomic<uint64_t> totalTick{0};
+    std::atomic<uint64_t> lastDataPath{0};
+    std::atomic<uint64_t> maxDataPath{0};
+    std::atomic<uint64_t> totalDataPath{0};
+    
+    void record(uint64_t tick, uint64_t dataPath) {
+        ticks++;
+        lastTick = tick;
+        totalTick += tick;
+        if (tick > maxTick) maxTick = tick;
+        lastDataPath = dataPath;
+        totalDataPath += dataPath;
+        if (dataPath > maxDataPath) maxDataPath = dataPath;
+    }
+};
+
 /**
  * Main Tobii Bridge Server class
  */
 class TobiiBridgeServer {
 private:
-    // Tobii Game Integration
-    TobiiGameIntegration::ITobiiGameIntegrationApi* tgiApi;
-    TobiiGameIntegration::IStreamsProvider* streams;
+    // Time for stamps and pacing (system, or virtual for replayable runs)
+    BridgeClock& clock;
+    
+    // Tracker source, processing, sample ring and history. The main loop
+    // drives it; other threads read its ring and latest sample under
+    // dataMutex and clientsMutex
+    BridgeCore core;
     
     // Network servers
     websocketpp::server<websocketpp::config::asio> wsServer;
@@ -87,41 +276,172 @@ private:
     
     // Server state
     std::atomic<bool> running;
-    std::atomic<bool> tobiiConnected;
     std::atomic<bool> recordingEnabled;
     std::thread mainThread;
     std::thread discoveryThread;
+    std::vector<std::thread> ioThreads;
+    std::unique_ptr<asio::executor_work_guard<asio::io_context::executor_type>> ioWork;
     
-    // Configuration
+    // Configuration: `config` is written only by the main loop, between ticks;
+    // reloads are staged in pendingConfig under configMutex
+    ConfigStore configStore;
+    BridgeConfig config;
+    std::unique_ptr<BridgeConfig> pendingConfig;
+    std::atomic<bool> configPending;
+    std::mutex configMutex;
+    std::atomic<int> discoveryIntervalSeconds;
     int wsPort;
     int udpPort;
     int discoveryPort;
     
     // Data processing
-    TobiiDataPacket latestData;
     std::mutex dataMutex;
     
-    // Client management
-    std::unordered_map<websocketpp::connection_hdl, std::string, 
-                      std::owner_less<websocketpp::connection_hdl>> clients;
+    // Client management (sessions, ring and wheel are guarded by clientsMutex)
+    std::map<websocketpp::connection_hdl, std::shared_ptr<ClientSession>,
+             std::owner_less<websocketpp::connection_hdl>> clients;
     std::mutex clientsMutex;
+    uint64_t nextClientId;
+    
+    // Sessions waiting on recent samples in the core's ring
+    SequenceWheel<std::shared_ptr<ClientSession>> sessionWheel;
+    static constexpr size_t CATCH_UP_BURST = 32;
+    
+    // Prepared frame per format and stream mask, encoded lazily each tick
+    FramePool framePool;
+    FixedFrameWriter<1024> frameWriter;
+    std::array<WsMessage::ptr, SAMPLE_FORMAT_COUNT * SAMPLE_MASK_COUNT> tickFrames;
+    
+    // Client display layouts, and prepared screen frames per geometry (valid
+    // while the row's stamp matches the current sequence)
+    DisplayMapper displayMapper;
+    std::array<std::array<WsMessage::ptr, SAMPLE_FORMAT_COUNT * SAMPLE_MASK_COUNT>,
+               DisplayMapper::MAX_GEOMETRIES> screenFrames;
+    std::array<uint64_t, DisplayMapper::MAX_GEOMETRIES> screenFrameSequence;
+    
+    // Sessions with gaze rules (evaluated every tick, whatever their sample subscription)
+    std::vector<std::shared_ptr<ClientSession>> ruleSessions;
+    
+    // Sessions with adaptive rate, re-evaluated once per adaptive_rate.interval_ms
+    std::vector<std::shared_ptr<ClientSession>> adaptiveSessions;
+    uint64_t nextRateCheckMicros = 0;
+    
+    // Sessions receiving predicted samples; their scores see every tick
+    std::vector<std::shared_ptr<ClientSession>> predictionSessions;
+    
+    // The tick's output split per topic; WebSocket topic subscribers share
+    // one cursor, the OpenTrack sender follows the head topic on its own
+    TopicBus topicBus;
+    TopicCursor wsTopicCursor;
+    uint64_t udpHeadNext = 0;
+    std::vector<std::shared_ptr<ClientSession>> topicSessions;
+    
+    // Connection limits and tick-budget shedding (clientsMutex); handshakes
+    // admitted but not yet open, with the address their slot was held for
+    AdmissionController admission;
+    std::map<websocketpp::connection_hdl, std::string,
+             std::owner_less<websocketpp::connection_hdl>> pendingHandshakes;
+    LoadShedder loadShedder;
+    size_t lowPrioritySessions = 0;
+    
+    // Idle power saving: with nobody consuming samples the main loop parks
+    // between keep-alive ticks, and a connect or command wakes it. Sessions
+    // count while they take samples, topics or rule events (clientsMutex to
+    // recount); any connect or command counts as busy for one tick
+    std::atomic<bool> idle{false};
+    std::atomic<size_t> activeSessions{0};
+    std::atomic<bool> activityPending{false};
+    uint64_t lastBusyMicros = 0;
+    uint64_t idleSinceMicros = 0;
+    std::atomic<uint64_t> idleMicros{0};
+    std::atomic<uint64_t> idlePeriods{0};
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    bool wakeRequested = false;
+    
+    // Markers received since the last tick (clientsMutex) and the recording they go into
+    std::vector<BridgeMarker> pendingMarkers;
+    static constexpr size_t MAX_PENDING_MARKERS = 256;
+    SampleRecorder recorder;
+    
+    // Tracking quality of the published samples (main loop, clientsMutex held)
+    QualityMonitor qualityMonitor;
+    
+    // UDP sample stream: the main loop sends each sample, the network thread
+    // answers NACKs from the core's ring (subscribers under clientsMutex)
+    static constexpr size_t MAX_UDP_STREAM_SUBSCRIBERS = 64;
+    std::unique_ptr<asio::ip::udp::socket> udpStreamSocket;
+    asio::ip::udp::endpoint udpStreamSender;
+    std::array<char, UdpStream::MAX_DATAGRAM> udpStreamInbox;
+    std::array<UdpStreamSubscriber, MAX_UDP_STREAM_SUBSCRIBERS> udpStreamSubscribers;
+    std::atomic<size_t> udpStreamCount{0};
+    uint64_t udpStreamRetransmits = 0;
+    uint64_t udpStreamGone = 0;
+    
+    // Multicast sample stream: every sample to one group, with FEC parity
+    // after each multicast.fec.group of them (main loop, clientsMutex held)
+    std::unique_ptr<asio::ip::udp::socket> multicastSocket;
+    asio::ip::udp::endpoint multicastEndpoint;
+    asio::ip::udp::endpoint multicastReporter;
+    std::array<char, UdpStream::MAX_DATAGRAM> multicastInbox;
+    std::atomic<uint64_t> multicastHeardMicros{0};     // last receiver report (network thread)
+    Fec::Encoder multicastFec;
+    bool multicastEnabled = false;
+    uint64_t multicastSent = 0;
+    uint64_t multicastParitySent = 0;
+    
+    // Benchmark mode replaces WebSocket sends with a byte counter
+    bool benchmarkMode;
+    uint64_t benchmarkBytes;
+    uint64_t benchmarkDigest;
+    TickAllocationStats allocationStats;
+    
+    // Simulated UDP stream receivers behind links losing benchUdpLoss of the
+    // datagrams each way, indexed like their subscriber slots
+    std::vector<UdpStream::Receiver<>> benchUdpReceivers;
+    double benchUdpLoss = 0.0;
+    uint64_t benchUdpRandom = 0x9e3779b97f4a7c15ull;
+    
+    // The idle-wake run's scheduled event: at benchWakeAtMicros (0 = none)
+    // benchWakeHandle connects, or with benchWakeByCommand a command arrives
+    uint64_t benchWakeAtMicros = 0;
+    bool benchWakeByCommand = false;
+    std::shared_ptr<size_t> benchWakeHandle;
+    
+    // Simulated multicast receivers, receiver i behind a link losing
+    // benchMulticastLoss[i % rates] of the datagrams, and what the FEC
+    // encoder and their decoders cost
+    std::vector<Fec::Receiver<>> benchMulticastReceivers;
+    std::vector<double> benchMulticastLoss;
+    uint64_t benchMulticastRandom = 0x2545f4914f6cdd1dull;
+    uint64_t benchFecEncodeNanos = 0;
+    uint64_t benchFecDecodeNanos = 0;
     
     // Statistics
-    std::atomic<uint64_t> packetsProcessed;
     std::atomic<uint64_t> packetsDistributed;
+    std::atomic<uint64_t> packetsDropped;
     std::atomic<uint64_t> clientCount;
 
 public:
-    TobiiBridgeServer(int wsPort = 8080, int udpPort = 4242, int discoveryPort = 8083) 
-        : tgiApi(nullptr), streams(nullptr), running(false), tobiiConnected(false), 
-          recordingEnabled(false), wsPort(wsPort), udpPort(udpPort), 
-          discoveryPort(discoveryPort), packetsProcessed(0), packetsDistributed(0),
-          clientCount(0) {
+    explicit TobiiBridgeServer(std::unique_ptr<TrackerSource> trackerSource,
+                               ConfigStore store = ConfigStore(), const BridgeConfig& initialConfig = BridgeConfig(),
+                               BridgeClock& bridgeClock = BridgeClock::system()) 
+        : clock(bridgeClock), core(std::move(trackerSource), bridgeClock), running(false), 
+          recordingEnabled(false), configStore(std::move(store)), config(initialConfig),
+          configPending(false), discoveryIntervalSeconds(initialConfig.discoveryIntervalSeconds),
+          wsPort(initialConfig.wsPort), udpPort(initialConfig.udpPort),
+          discoveryPort(initialConfig.discoveryPort), nextClientId(0), benchmarkMode(false),
+          benchmarkBytes(0), benchmarkDigest(0),
+          packetsDistributed(0), packetsDropped(0), clientCount(0) {
         
         ioContext = std::make_unique<asio::io_context>();
         
-        // Initialize latest data structure
-        memset(&latestData, 0, sizeof(latestData));
+        core.configure(config);
+        screenFrameSequence.fill(UINT64_MAX);
+        pendingMarkers.reserve(MAX_PENDING_MARKERS);
+        qualityMonitor.setWindow(static_cast<size_t>(config.qualityWindowSeconds));
+        admission.configure(admissionSettings());
+        loadShedder.configure(shedSettings());
     }
     
     ~TobiiBridgeServer() {
@@ -134,11 +454,15 @@ public:
     bool start() {
         std::cout << "Starting Tobii Bridge Server..." << std::endl;
         
-        // Initialize Tobii Game Integration
-        if (!initializeTobii()) {
-            std::cerr << "Failed to initialize Tobii Game Integration" << std::endl;
+        // Initialize Tobii Game Integration; a tracker that is not there yet is retried by the watchdog
+        if (!core.hasSource()) {
+            std::cerr << "No tracker source configured" << std::endl;
             return false;
         }
+        if (!initializeTobii()) {
+            std::cerr << "Failed to initialize Tobii Game Integration, retrying in the background" << std::endl;
+            loseSource("unavailable");
+        }
         
         // Setup WebSocket server
         if (!setupWebSocketServer()) {
@@ -152,11 +476,32 @@ public:
             return false;
         }
         
+        if (config.udpStreamPort != 0 && !setupUdpStream()) {
+            std::cerr << "Failed to setup UDP sample stream" << std::endl;
+            return false;
+        }
+        
+        if (!config.multicastGroup.empty() && !setupMulticast()) {
+            std::cerr << "Failed to setup multicast sample stream" << std::endl;
+            return false;
+        }
+        
         // Setup discovery beacon
         setupDiscoveryBeacon();
         
         running = true;
         
+        // Dedicated network threads; otherwise the main loop polls between ticks
+        if (config.ioThreads > 0) {
+            ioWork = std::make_unique<asio::executor_work_guard<asio::io_context::executor_type>>(
+                asio::make_work_guard(*ioContext)
+            );
+            for (int i = 0; i < config.ioThreads; ++i) {
+                const int cpu = i < static_cast<int>(config.ioThreadCpus.size()) ? config.ioThreadCpus[i] : -1;
+                ioThreads.emplace_back(&TobiiBridgeServer::ioLoop, this, cpu);
+            }
+        }
+        
         // Start main processing thread
         mainThread = std::thread(&TobiiBridgeServer::mainLoop, this);
         
@@ -166,6 +511,12 @@ public:
         std::cout << "✅ Tobii Bridge Server started" << std::endl;
         std::cout << "   WebSocket: ws://localhost:" << wsPort << std::endl;
         std::cout << "   UDP (OpenTrack): localhost:" << udpPort << std::endl;
+        if (udpStreamSocket) {
+            std::cout << "   UDP (samples, NACK recovery): localhost:" << config.udpStreamPort << std::endl;
+        }
+        if (multicastSocket) {
+            std::cout << "   Multicast (samples, FEC): " << config.multicastGroup << ":" << config.multicastPort << std::endl;
+        }
         std::cout << "   Discovery: UDP:" << discoveryPort << std::endl;
         
         return true;
@@ -179,6 +530,7 @@ public:
         
         std::cout << "Stopping Tobii Bridge Server..." << std::endl;
         running = false;
+        wakeMainLoop();
         
         // Stop threads
         if (mainThread.joinable()) {
@@ -189,14 +541,377 @@ public:
             discoveryThread.join();
         }
         
-        // Cleanup Tobii API
-        if (tgiApi) {
-            // TGI cleanup would go here
+        recorder.stop();
+        recordingEnabled = false;
+        
+        if (!ioThreads.empty()) {
+            ioWork.reset();
+            ioContext->stop();
+            for (auto& thread : ioThreads) {
+                thread.join();
+            }
+            ioThreads.clear();
         }
         
         std::cout << "✅ Tobii Bridge Server stopped" << std::endl;
     }
     
+    /**
+     * Steady-state figures from runBenchmark
+     */
+    struct BenchmarkResult {
+        bool started = false;
+        uint64_t allocations = 0;
+        double p99Micros = 0.0;     // bridge-side tick latency, source update() excluded
+        uint64_t digest = 0;        // order-independent hash of every frame sent
+        uint64_t sessionsShed = 0;  // low and normal sessions degraded or dropped by load shedding
+        bool criticalHeld = true;   // every critical session kept its full output
+        uint64_t outages = 0;       // times the watchdog lost the source
+        uint64_t restored = 0;      // and got it back
+        double udpDelivery = 1.0;   // share of UDP stream samples that reached the simulated receivers
+        double multicastDelivery = 1.0;     // multicast share after FEC, at the worst simulated loss rate
+        PredictionError prediction;         // of the predicting clients, against the samples that followed
+    };
+    
+    struct IdleWakeResult {
+        static constexpr uint64_t NEVER = ~0ull;
+        bool started = false;
+        uint64_t idleAfterMicros = NEVER;       // from the last activity to the idle period starting
+        uint64_t connectWakeMicros = NEVER;     // from a connect during the idle wait to the next sample
+        uint64_t commandWakeMicros = NEVER;     // likewise for a command
+    };
+    
+    /**
+     * Drive the data path in-process against a fixed set of simulated clients
+     * with sends replaced by a null sink. Allocations and latencies are
+     * counted after warm-up. On a virtual clock each tick is paced like the
+     * main loop, so the frames sent (and their digest) repeat exactly. With
+     * linkKbps, one client in eight is adaptive behind a simulated link of
+     * that capacity. One client in sixteen is critical and one in four low
+     * priority, for load shedding, and one in eight predicts 30 ms ahead.
+     * With udpLoss, two UDP stream receivers sit behind links losing that
+     * share of datagrams each way and recover them with NACKs. With
+     * multicastLoss, multicastReceivers (at least one per rate) take the
+     * multicast stream behind links losing those shares in turn and rebuild
+     * what they can from its FEC parity
+     */
+    BenchmarkResult runBenchmark(uint64_t ticks, size_t simulatedClients, double linkKbps = 0.0,
+                                 double udpLoss = 0.0, const std::vector<double>& multicastLoss = {},
+                                 size_t multicastReceivers = 0) {
+        BenchmarkResult result;
+        benchmarkMode = true;
+        if (!initializeTobii()) return result;
+        result.started = true;
+        
+        // A spread of subscriptions, as a steady production fan-out would have,
+        // with every other client mapping gaze onto one of two desktop layouts
+        // and one in sixteen evaluating gaze rules over a 3x3 AOI grid
+        json ruleSpec = {{"aois", json::array()}, {"rules", {
+            {{"id", "fixate"}, {"type", "dwell"}, {"aoi", "cell4"}, {"ms", 200}},
+            {{"id", "saccade"}, {"type", "velocity"}, {"threshold", 20.0}},
+            {{"id", "away"}, {"type", "offscreen"}, {"ms", 500}}
+        }}};
+        for (int cell = 0; cell < 9; ++cell) {
+            ruleSpec["aois"].push_back({{"name", "cell" + std::to_string(cell)}, {"x", (cell % 3) / 3.0},
+                                        {"y", (cell / 3) / 3.0}, {"width", 1 / 3.0}, {"height", 1 / 3.0}});
+            ruleSpec["rules"].push_back({{"id", "enter" + std::to_string(cell)}, {"type", "enter"},
+                                         {"aoi", "cell" + std::to_string(cell)}});
+        }
+        
+        DisplayGeometry layouts[2];
+        layouts[0].displays = {{0.0f, 0.0f, 1920.0f, 1080.0f, 1.0f}};
+        layouts[1].displays = {{0.0f, 0.0f, 2560.0f, 1440.0f, 1.25f}, {2560.0f, 0.0f, 1920.0f, 1080.0f, 1.0f}};
+        layouts[1].logical = true;
+        
+        std::vector<std::shared_ptr<size_t>> handles;
+        for (size_t i = 0; i < simulatedClients; ++i) {
+            handles.push_back(std::make_shared<size_t>(i));
+            ClientSession& session = addSession(handles.back(), "bench_" + std::to_string(i));
+            // Prediction and pose are opt-in below, so the spread covers the other streams
+            const uint32_t spread = STREAM_ALL & ~(STREAM_PREDICTION | STREAM_POSE);
+            session.streams = static_cast<uint32_t>(i % spread) + 1;
+            if (i % 4 == 3) session.streams |= STREAM_POSE;
+            session.decimation = static_cast<uint32_t>(1 + i % 3);
+            session.format = static_cast<SampleFormat>((i / spread) % SAMPLE_FORMAT_COUNT);
+            if (i % 2 == 0) {
+                session.geometry = displayMapper.acquire(layouts[(i / 2) % 2], core.gazeSpace());
+            }
+            if (i % 16 == 1) {
+                session.rules = std::make_unique<GazeRuleSet>(GazeRuleSet::fromJson(ruleSpec));
+                ruleSessions.push_back(clients[handles.back()]);
+            }
+            session.requestedFormat = session.format;
+            session.requestedDecimation = session.decimation;
+            if (i % 16 == 0) {
+                session.priority = ClientPriority::Critical;
+            } else if (i % 4 == 2) {
+                session.priority = ClientPriority::Low;
+                lowPrioritySessions++;
+            }
+            if (i % 8 == 6) {
+                setPrediction(clients[handles.back()], {{"horizon_ms", 30}});
+                session.streams |= STREAM_PREDICTION;
+            }
+            if (i % 32 == 5) {
+                setTopics(clients[handles.back()], TOPIC_GAZE | TOPIC_PRESENCE | TOPIC_EVENTS | TOPIC_QUALITY);
+            }
+            if (linkKbps > 0.0 && i % 8 == 3) {
+                session.benchLinkBytesPerSecond = linkKbps * 125.0;
+                setAdaptive(clients[handles.back()], true);
+                session.rate.reset(session.format, session.decimation);
+            }
+        }
+        clientCount = clients.size();
+        refreshActiveSessions();
+        
+        if (udpLoss > 0.0) {
+            benchUdpLoss = udpLoss;
+            benchUdpReceivers.resize(2);
+            subscribeBenchUdpReceivers(false);
+        }
+        if (!multicastLoss.empty()) {
+            benchMulticastLoss = multicastLoss;
+            benchMulticastReceivers.resize(std::max(multicastReceivers, multicastLoss.size()));
+            multicastEnabled = true;
+        }
+        
+        const uint64_t warmupTicks = std::min<uint64_t>(ticks / 10 + 1, 1000);
+        for (uint64_t i = 0; i < warmupTicks; ++i) {
+            benchmarkTick();
+        }
+        
+        std::vector<uint64_t> latencies(ticks);
+        const auto start = std::chrono::steady_clock::now();
+        const uint64_t before = AllocTracker::threadAllocations();
+        for (uint64_t i = 0; i < ticks; ++i) {
+            latencies[i] = benchmarkTick();
+        }
+        const uint64_t allocations = AllocTracker::threadAllocations() - before;
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        
+        auto percentile = [&](double fraction) {
+            auto at = latencies.begin() + static_cast<std::ptrdiff_t>(fraction * static_cast<double>(ticks - 1));
+            std::nth_element(latencies.begin(), at, latencies.end());
+            return static_cast<double>(*at) / 1000.0;
+        };
+        const double p50 = percentile(0.5);
+        result.p99Micros = percentile(0.99);
+        const double worst = percentile(1.0);
+        result.allocations = allocations;
+        result.digest = benchmarkDigest;
+        size_t shedByPriority[3] = {0, 0, 0};
+        for (const auto& entry : clients) {
+            const ClientSession& session = *entry.second;
+            const bool reduced = session.shed || session.closing;
+            if (reduced) shedByPriority[static_cast<size_t>(session.priority)]++;
+            if (session.priority == ClientPriority::Critical &&
+                (reduced || session.decimation != session.requestedDecimation || session.packetsDropped > 0)) {
+                result.criticalHeld = false;
+            }
+        }
+        result.sessionsShed = shedByPriority[0] + shedByPriority[1];
+        result.outages = core.watchdog().outageCount();
+        result.restored = result.outages - (core.watchdog().sourceLost() ? 1 : 0);
+        
+        std::cout << "Benchmark: " << ticks << " ticks, " << simulatedClients << " clients, "
+                  << (seconds * 1e6 / static_cast<double>(ticks)) << " us/tick, "
+                  << benchmarkBytes << " bytes encoded" << std::endl;
+        std::cout << "   Tick latency: p50 " << p50 << " us, p99 " << result.p99Micros << " us, max "
+                  << worst << " us" << std::endl;
+        if (!adaptiveSessions.empty()) {
+            std::cout << "   Adaptive clients (" << linkKbps << " kbps links):";
+            for (const auto& session : adaptiveSessions) {
+                std::cout << " " << SAMPLE_FORMAT_NAMES[static_cast<size_t>(session->format)] << "/"
+                          << session->decimation << "@" << static_cast<uint64_t>(session->benchQueueBytes) << "B";
+            }
+            std::cout << std::endl;
+        }
+        PredictionError predictionError;
+        for (const auto& session : predictionSessions) {
+            predictionError.add(session->prediction->totals());
+        }
+        result.prediction = predictionError;
+        if (predictionError.gazeSamples + predictionError.headSamples > 0) {
+            std::cout << "   Prediction (" << predictionSessions.size() << " clients, 30 ms): gaze error "
+                      << predictionError.meanGaze() << " vs " << predictionError.meanGazeUnpredicted() << " unpredicted, head "
+                      << predictionError.meanHead() << " vs " << predictionError.meanHeadUnpredicted() << " deg" << std::endl;
+        }
+        {
+            // An overview plot of the whole run, as a dashboard would ask for it
+            const auto queryStart = std::chrono::steady_clock::now();
+            const json overview = historyJson({{"points", 300}, {"from_ms", core.historyFirst()}});
+            const double queryMicros = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - queryStart).count();
+            std::cout << "   History: " << overview["t"].size() << " points at " << overview["point_ms"].get<uint64_t>()
+                      << " ms from the " << overview["level_ms"].get<uint64_t>() << " ms level in " << queryMicros << " us" << std::endl;
+        }
+        if (!topicSessions.empty()) {
+            std::cout << "   Topics (" << topicSessions.size() << " clients), entries over " << core.ring().end() << " samples:";
+            for (size_t t = 0; t < TOPIC_COUNT; ++t) {
+                std::cout << " " << TOPIC_NAMES[t] << " " << topicBus.end(static_cast<Topic>(t));
+            }
+            std::cout << std::endl;
+        }
+        if (!benchUdpReceivers.empty()) {
+            uint64_t sent = 0;
+            UdpStream::ReceiverStats received;
+            for (size_t i = 0; i < benchUdpReceivers.size(); ++i) {
+                sent += udpStreamSubscribers[i].sent;
+                const UdpStream::ReceiverStats& stats = benchUdpReceivers[i].stats();
+                received.received += stats.received;
+                received.recovered += stats.recovered;
+                received.lost += stats.lost;
+                received.nacks += stats.nacks;
+            }
+            result.udpDelivery = sent > 0 ? static_cast<double>(received.received) / static_cast<double>(sent) : 0.0;
+            std::cout << "   UDP stream (" << benchUdpReceivers.size() << " receivers, " << udpLoss * 100.0
+                      << "% loss each way): " << sent << " samples sent, " << result.udpDelivery * 100.0
+                      << "% delivered, " << received.recovered << " recovered by " << received.nacks << " NACKs, "
+                      << udpStreamRetransmits << " retransmitted, " << udpStreamGone << " reported gone" << std::endl;
+        }
+        if (!benchMulticastReceivers.empty()) {
+            const size_t receivers = benchMulticastReceivers.size();
+            const size_t rates = benchMulticastLoss.size();
+            const uint64_t datagrams = multicastSent + multicastParitySent;
+            std::cout << "   Multicast FEC (" << receivers << " receivers, " << config.multicastFecGroup << "+"
+                      << config.multicastFecParity << " groups, " << Fec::kernelName() << "): " << multicastSent
+                      << " samples, " << multicastParitySent << " parity ("
+                      << (multicastSent > 0 ? 100.0 * static_cast<double>(multicastParitySent) / static_cast<double>(multicastSent) : 0.0)
+                      << "% overhead), encode " << (multicastSent > 0 ? benchFecEncodeNanos / multicastSent : 0)
+                      << " ns/sample, receive " << (datagrams > 0 ? benchFecDecodeNanos / (datagrams * receivers) : 0)
+                      << " ns/datagram" << std::endl;
+            for (size_t rate = 0; rate < rates; ++rate) {
+                Fec::ReceiverStats received;
+                uint64_t sent = 0;
+                for (size_t i = rate; i < receivers; i += rates) {
+                    const Fec::ReceiverStats& stats = benchMulticastReceivers[i].stats();
+                    received.received += stats.received;
+                    received.recovered += stats.recovered;
+                    sent += multicastSent;
+                }
+                const double arrived = sent > 0 ? static_cast<double>(received.received) / static_cast<double>(sent) : 0.0;
+                const double delivered = sent > 0 ? static_cast<double>(received.received + received.recovered) /
+                                                        static_cast<double>(sent) : 0.0;
+                result.multicastDelivery = std::min(result.multicastDelivery, delivered);
+                std::cout << "      " << benchMulticastLoss[rate] * 100.0 << "% loss: " << arrived * 100.0
+                          << "% arrived, " << delivered * 100.0 << "% after FEC (" << received.recovered
+                          << " rebuilt)" << std::endl;
+            }
+        }
+        if (result.outages > 0) {
+            std::cout << "   Tracker outages: " << result.outages << ", " << result.restored << " restored, "
+                      << core.watchdog().totalOutageMs() << " ms without a source" << std::endl;
+        }
+        if (loadShedder.ticksOverBudget() > 0) {
+            std::cout << "   Load shedding: stage " << loadShedder.currentStage() << ", "
+                      << loadShedder.ticksOverBudget() << " ticks over " << config.shedTickBudgetUs << " us, shed "
+                      << shedByPriority[0] << " low / " << shedByPriority[1] << " normal / "
+                      << shedByPriority[2] << " critical" << std::endl;
+        }
+        if (clock.isVirtual()) {
+            char digest[17];
+            std::snprintf(digest, sizeof(digest), "%016llx", static_cast<unsigned long long>(benchmarkDigest));
+            std::cout << "   Virtual time: " << clock.monotonicMicros() / 1000 << " ms, output digest " << digest << std::endl;
+        }
+        if (AllocTracker::enabled()) {
+            std::cout << "   Steady-state allocations: " << allocations << " ("
+                      << static_cast<double>(allocations) / static_cast<double>(ticks) << " per tick)" << std::endl;
+        } else {
+            std::cout << "   Allocation tracking disabled (build with TOBII_BRIDGE_ALLOC_TRACKING=ON)" << std::endl;
+        }
+        
+        sessionWheel.clear();
+        ruleSessions.clear();
+        adaptiveSessions.clear();
+        predictionSessions.clear();
+        topicSessions.clear();
+        for (auto& subscriber : udpStreamSubscribers) subscriber.active = false;
+        udpStreamCount = 0;
+        benchUdpReceivers.clear();
+        benchMulticastReceivers.clear();
+        multicastEnabled = multicastSocket != nullptr;
+        lowPrioritySessions = 0;
+        for (auto& entry : clients) {
+            displayMapper.release(entry.second->geometry);
+        }
+        clients.clear();
+        activeSessions = 0;
+        return result;
+    }
+    
+    /**
+     * Drive main-loop ticks on a virtual clock with one client connected but
+     * subscribed to nothing, which must let the bridge go idle. A second
+     * client then connects halfway through a keep-alive wait; once that one
+     * has unsubscribed and the bridge is idle again, a command arrives the
+     * same way. Each must bring the next sample within one loop interval
+     */
+    IdleWakeResult runIdleWake() {
+        IdleWakeResult result;
+        benchmarkMode = true;
+        if (!initializeTobii()) return result;
+        result.started = true;
+        
+        const uint64_t patience = static_cast<uint64_t>(config.powerIdleAfterMs + 2 * config.powerKeepaliveMs) * 1000;
+        auto waitForIdle = [this, patience] {
+            const uint64_t periods = idlePeriods;
+            const uint64_t from = clock.monotonicMicros();
+            while (idlePeriods == periods && clock.monotonicMicros() - from < patience) idleWakeTick();
+            return idlePeriods != periods;
+        };
+        auto measureWake = [this](bool byCommand) {
+            // Halfway through the keep-alive wait, off the loop interval grid
+            const uint64_t at = clock.monotonicMicros() + static_cast<uint64_t>(config.powerKeepaliveMs) * 500 +
+                                static_cast<uint64_t>(config.loopIntervalMs) * 500;
+            benchWakeByCommand = byCommand;
+            benchWakeAtMicros = at;
+            while (clock.monotonicMicros() < at + static_cast<uint64_t>(config.powerKeepaliveMs) * 2000) {
+                uint64_t publishedAt;
+                if (idleWakeTick(&publishedAt)) return publishedAt >= at ? publishedAt - at : IdleWakeResult::NEVER;
+            }
+            return IdleWakeResult::NEVER;
+        };
+        
+        auto idleHandle = std::make_shared<size_t>(0);
+        {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            addSession(idleHandle, "bench_idle").streams = 0;
+        }
+        onClientActivity();
+        const uint64_t start = clock.monotonicMicros();
+        if (!waitForIdle()) return result;
+        result.idleAfterMicros = idleSinceMicros - start;
+        
+        benchWakeHandle = std::make_shared<size_t>(1);
+        result.connectWakeMicros = measureWake(false);
+        {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            auto it = clients.find(benchWakeHandle);
+            if (it != clients.end()) it->second->streams = 0;
+        }
+        onClientActivity();
+        if (waitForIdle()) {
+            result.commandWakeMicros = measureWake(true);
+        }
+        
+        auto ms = [](uint64_t micros) {
+            if (micros == IdleWakeResult::NEVER) return std::string("never");
+            char text[32];
+            std::snprintf(text, sizeof(text), "%.1f ms", static_cast<double>(micros) / 1000.0);
+            return std::string(text);
+        };
+        std::cout << "📊 Idle wake (virtual time, loop interval " << config.loopIntervalMs << " ms, keep-alive "
+                  << config.powerKeepaliveMs << " ms)" << std::endl;
+        std::cout << "   Idle after " << ms(result.idleAfterMicros) << "; a connect woke it in "
+                  << ms(result.connectWakeMicros) << ", a command in " << ms(result.commandWakeMicros) << std::endl;
+        
+        for (auto& entry : clients) {
+            displayMapper.release(entry.second->geometry);
+        }
+        clients.clear();
+        activeSessions = 0;
+        return result;
+    }
+    
     /**
      * Wait for server to finish
      */
@@ -211,36 +926,23 @@ public:
     
 private:
     /**
-     * Initialize Tobii Game Integration API
+     * Initialize the tracker source
      */
     bool initializeTobii() {
-        try {
-            std::cout << "Initializing Tobii Game Integration..." << std::endl;
-            
-            tgiApi = TobiiGameIntegration::GetApi("Synopticon Tobii Bridge v1.0");
-            if (!tgiApi) {
-                std::cerr << "Failed to get TGI API instance" << std::endl;
-                return false;
-            }
-            
-            streams = tgiApi->GetStreamsProvider();
-            if (!streams) {
-                std::cerr << "Failed to get streams provider" << std::endl;
-                return false;
-            }
-            
-            // Setup window tracking (required for TGI)
-            // This would need actual window handle in production
-            // tgiApi->GetTrackerController()->TrackWindow(GetConsoleWindow());
-            
-            tobiiConnected = true;
-            std::cout << "✅ Tobii Game Integration initialized" << std::endl;
-            
-            return true;
-        } catch (const std::exception& e) {
-            std::cerr << "Exception initializing Tobii: " << e.what() << std::endl;
+        if (!core.hasSource()) {
+            std::cerr << "No tracker source configured" << std::endl;
+            return false;
+        }
+        
+        std::cout << "Initializing tracker source (" << core.sourceName() << ")..." << std::endl;
+        
+        if (!core.initialize()) {
             return false;
         }
+        
+        std::cout << "✅ Tracker source initialized" << std::endl;
+        
+        return true;
     }
     
     /**
@@ -248,8 +950,8 @@ private:
      */
     bool setupWebSocketServer() {
         try {
-            wsServer.set_access_channels(websocketpp::log::alevel::all);
-            wsServer.clear_access_channels(websocketpp::log::alevel::frame_payload);
+            // Connection events are logged asynchronously by the handlers below
+            wsServer.clear_access_channels(websocketpp::log::alevel::all);
             
             wsServer.init_asio(ioContext.get());
             wsServer.set_reuse_addr(true);
@@ -258,8 +960,11 @@ private:
             wsServer.set_message_handler(bind(&TobiiBridgeServer::onWebSocketMessage, this, _1, _2));
             
             // Set connection handlers
+            wsServer.set_validate_handler(bind(&TobiiBridgeServer::onWebSocketValidate, this, _1));
             wsServer.set_open_handler(bind(&TobiiBridgeServer::onWebSocketOpen, this, _1));
+            wsServer.set_fail_handler(bind(&TobiiBridgeServer::onWebSocketFail, this, _1));
             wsServer.set_close_handler(bind(&TobiiBridgeServer::onWebSocketClose, this, _1));
+            wsServer.set_pong_handler(bind(&TobiiBridgeServer::onPong, this, _1, _2));
             
             wsServer.listen(wsPort);
             wsServer.start_accept();
@@ -278,9 +983,15 @@ private:
      */
     bool setupUDPServer() {
         try {
-            udpSocket = std::make_unique<asio::ip::udp::socket>(
-                *ioContext, asio::ip::udp::endpoint(asio::ip::udp::v4(), udpPort)
-            );
+            // Shared so local OpenTrack readers (and the load generator) can bind the same port
+            udpSocket = std::make_unique<asio::ip::udp::socket>(*ioContext);
+            udpSocket->open(asio::ip::udp::v4());
+            udpSocket->set_option(asio::socket_base::reuse_address(true));
+            udpSocket->set_option(asio::socket_base::broadcast(true));
+            if (config.udpSendBufferBytes > 0) {
+                udpSocket->set_option(asio::socket_base::send_buffer_size(config.udpSendBufferBytes));
+            }
+            udpSocket->bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), udpPort));
             
             std::cout << "✅ UDP server setup on port " << udpPort << std::endl;
             
@@ -292,248 +1003,1766 @@ private:
     }
     
     /**
-     * Setup discovery beacon
+     * Setup the UDP sample stream port; receivers subscribe to it
      */
-    void setupDiscoveryBeacon() {
+    bool setupUdpStream() {
         try {
-            discoverySocket = std::make_unique<asio::ip::udp::socket>(
-                *ioContext, asio::ip::udp::endpoint(asio::ip::udp::v4(), 0)
-            );
-            discoverySocket->set_option(asio::socket_base::broadcast(true));
+            udpStreamSocket = std::make_unique<asio::ip::udp::socket>(*ioContext);
+            udpStreamSocket->open(asio::ip::udp::v4());
+            if (config.udpSendBufferBytes > 0) {
+                udpStreamSocket->set_option(asio::socket_base::send_buffer_size(config.udpSendBufferBytes));
+            }
+            udpStreamSocket->bind(asio::ip::udp::endpoint(asio::ip::udp::v4(),
+                                                          static_cast<unsigned short>(config.udpStreamPort)));
+            receiveUdpStream();
             
-            std::cout << "✅ Discovery beacon setup" << std::endl;
+            std::cout << "✅ UDP sample stream setup on port " << config.udpStreamPort << std::endl;
+            
+            return true;
         } catch (const std::exception& e) {
-            std::cerr << "Exception setting up discovery: " << e.what() << std::endl;
+            std::cerr << "Exception setting up UDP sample stream: " << e.what() << std::endl;
+            return false;
         }
     }
     
+    void receiveUdpStream() {
+        udpStreamSocket->async_receive_from(asio::buffer(udpStreamInbox), udpStreamSender,
+            [this](const asio::error_code& ec, size_t size) {
+                if (ec == asio::error::operation_aborted) return;
+                if (!ec) onUdpStreamRequest(udpStreamSender, udpStreamInbox.data(), size);
+                receiveUdpStream();
+            });
+    }
+    
     /**
-     * Main processing loop
+     * A datagram on the stream port: subscribe (also the keep-alive),
+     * unsubscribe or NACK. Anything else, and NACKs from endpoints that did
+     * not subscribe, is ignored (network thread)
      */
-    void mainLoop() {
-        std::cout << "Main processing loop started" << std::endl;
-        
-        auto lastUpdate = std::chrono::high_resolution_clock::now();
-        const auto targetInterval = std::chrono::milliseconds(16); // ~60Hz
-        
-        while (running) {
-            auto now = std::chrono::high_resolution_clock::now();
+    void onUdpStreamRequest(const asio::ip::udp::endpoint& from, const char* data, size_t size) {
+        using UdpStream::Kind;
+        const uint8_t kind = UdpStream::kindOf(data, size);
+        if (kind == static_cast<uint8_t>(Kind::Nack)) {
+            answerNack(from, data, size);
+            return;
+        }
+        if (kind == static_cast<uint8_t>(Kind::Subscribe) && size >= UdpStream::HEADER_SIZE + 2) {
+            // Sample frames only; screen and prediction fields are per WebSocket session
+            const uint8_t format = static_cast<uint8_t>(data[UdpStream::HEADER_SIZE]);
+            uint32_t streams = static_cast<uint8_t>(data[UdpStream::HEADER_SIZE + 1]) & (STREAM_DEFAULT | STREAM_POSE);
             
-            try {
-                // Update Tobii API
-                if (tgiApi && tobiiConnected) {
-                    tgiApi->Update();
-                    
-                    // Process Tobii data
-                    processTobiiData();
-                    
-                    // Distribute data to clients
-                    distributeData();
+            bool joined = false;
+            {
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                UdpStreamSubscriber* subscriber = findUdpSubscriber(from);
+                if (!subscriber) {
+                    for (size_t i = 0; i < static_cast<size_t>(config.udpStreamMaxSubscribers) && !subscriber; ++i) {
+                        if (!udpStreamSubscribers[i].active) subscriber = &udpStreamSubscribers[i];
+                    }
+                    if (!subscriber) {
+                        BRIDGE_LOG(LogLevel::Warn, "udp_stream.full", {"endpoint", from.address().to_string()},
+                                   {"max_subscribers", config.udpStreamMaxSubscribers});
+                        return;
+                    }
+                    *subscriber = UdpStreamSubscriber();
+                    subscriber->endpoint = from;
+                    subscriber->active = true;
+                    udpStreamCount++;
+                    joined = true;
                 }
-                
-                // Process network events
-                ioContext->poll();
-                
-            } catch (const std::exception& e) {
-                std::cerr << "Exception in main loop: " << e.what() << std::endl;
+                subscriber->format = format == static_cast<uint8_t>(SampleFormat::Quantized) ? SampleFormat::Quantized
+                                                                                             : SampleFormat::Binary;
+                subscriber->streams = streams ? streams : STREAM_DEFAULT;
+                subscriber->lastHeardMicros = clock.monotonicMicros();
             }
-            
-            // Maintain target frame rate
-            auto elapsed = std::chrono::high_resolution_clock::now() - now;
-            if (elapsed < targetInterval) {
-                std::this_thread::sleep_for(targetInterval - elapsed);
+            if (joined) {
+                BRIDGE_LOG(LogLevel::Info, "udp_stream.subscribed", {"endpoint", from.address().to_string()},
+                           {"port", static_cast<uint64_t>(from.port())});
+                wakeMainLoop();
+            }
+        } else if (kind == static_cast<uint8_t>(Kind::Unsubscribe)) {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            if (UdpStreamSubscriber* subscriber = findUdpSubscriber(from)) {
+                dropUdpSubscriber(*subscriber, "udp_stream.unsubscribed");
             }
         }
-        
-        std::cout << "Main processing loop ended" << std::endl;
     }
     
-    /**
-     * Discovery beacon loop
-     */
-    void discoveryLoop() {
-        std::cout << "Discovery beacon loop started" << std::endl;
-        
-        while (running) {
-            try {
-                broadcastDiscovery();
-                std::this_thread::sleep_for(std::chrono::seconds(5));
-            } catch (const std::exception& e) {
-                std::cerr << "Exception in discovery loop: " << e.what() << std::endl;
-            }
+    UdpStreamSubscriber* findUdpSubscriber(const asio::ip::udp::endpoint& endpoint) {
+        for (auto& subscriber : udpStreamSubscribers) {
+            if (subscriber.active && subscriber.endpoint == endpoint) return &subscriber;
         }
-        
-        std::cout << "Discovery beacon loop ended" << std::endl;
+        return nullptr;
     }
     
-    /**
-     * Process Tobii data from TGI API
-     */
-    void processTobiiData() {
-        if (!streams) return;
-        
-        std::lock_guard<std::mutex> lock(dataMutex);
-        
-        // Update timestamp
-        latestData.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(
-            std::chrono::system_clock::now().time_since_epoch()
-        ).count();
-        
-        // Get gaze data
-        TobiiGameIntegration::GazePoint gazePoint;
-        if (streams->GetLatestGazePoint(gazePoint)) {
-            latestData.hasGaze = true;
-            latestData.gazeX = gazePoint.X;
-            latestData.gazeY = gazePoint.Y;
-            latestData.gazeTimestamp = gazePoint.Timestamp;
-            latestData.gazeConfidence = 0.9f; // TGI doesn't provide confidence
-        } else {
-            latestData.hasGaze = false;
-        }
-        
-        // Get head pose data
-        TobiiGameIntegration::HeadPose headPose;
-        if (streams->GetLatestHeadPose(headPose)) {
-            latestData.hasHead = true;
-            latestData.headYaw = headPose.Rotation.YawDegrees;
-            latestData.headPitch = headPose.Rotation.PitchDegrees;
-            latestData.headRoll = headPose.Rotation.RollDegrees;
-            latestData.headPosX = headPose.Position.X;
-            latestData.headPosY = headPose.Position.Y;
-            latestData.headPosZ = headPose.Position.Z;
-            latestData.headConfidence = 0.9f; // TGI doesn't provide confidence
-        } else {
-            latestData.hasHead = false;
-        }
-        
-        // Get presence data
-        latestData.present = streams->IsPresent();
-        
-        // Calculate overall quality
-        float qualitySum = 0;
-        int qualityCount = 0;
-        
-        if (latestData.hasGaze) {
-            qualitySum += latestData.gazeConfidence;
-            qualityCount++;
-        }
-        
-        if (latestData.hasHead) {
-            qualitySum += latestData.headConfidence;
-            qualityCount++;
-        }
-        
-        if (latestData.present) {
-            qualitySum += 0.9f;
-            qualityCount++;
-        }
-        
-        latestData.overallQuality = qualityCount > 0 ? qualitySum / qualityCount : 0;
-        
-        packetsProcessed++;
+    void dropUdpSubscriber(UdpStreamSubscriber& subscriber, const char* event) {
+        subscriber.active = false;
+        udpStreamCount--;
+        BRIDGE_LOG(LogLevel::Info, event, {"endpoint", subscriber.endpoint.address().to_string()},
+                   {"port", static_cast<uint64_t>(subscriber.endpoint.port())}, {"sent", subscriber.sent},
+                   {"retransmitted", subscriber.retransmitted}, {"gone", subscriber.gone});
     }
     
     /**
-     * Distribute data to all connected clients
+     * Resend what a NACK asks for while the ring still holds it, inside the
+     * retransmit window and the subscriber's retransmit budget; report the
+     * rest gone so the receiver stops asking
      */
-    void distributeData() {
+    void answerNack(const asio::ip::udp::endpoint& from, const char* data, size_t size) {
         std::lock_guard<std::mutex> dataLock(dataMutex);
         std::lock_guard<std::mutex> clientLock(clientsMutex);
+        UdpStreamSubscriber* subscriber = findUdpSubscriber(from);
+        if (!subscriber) return;
         
-        if (clients.empty()) return;
-        
-        // Create WebSocket JSON message
-        json wsMessage = createWebSocketMessage(latestData);
-        std::string wsData = wsMessage.dump();
+        const uint64_t now = clock.monotonicMicros();
+        subscriber->lastHeardMicros = now;
+        subscriber->nacks++;
+        const uint64_t end = core.ring().end();
+        const uint64_t windowMs = static_cast<uint64_t>(config.udpStreamRetransmitWindowMs);
+        const uint64_t oldestMs = core.latest().timestamp > windowMs ? core.latest().timestamp - windowMs : 0;
+        const double rate = config.udpStreamMaxRetransmitsPerSecond;
+        const double burst = std::max(1.0, rate / 4.0);
         
-        // Send to WebSocket clients
-        for (auto& client : clients) {
-            try {
-                wsServer.send(client.first, wsData, websocketpp::frame::opcode::text);
-            } catch (const std::exception& e) {
-                std::cerr << "Failed to send to WebSocket client: " << e.what() << std::endl;
+        // Gone sequences are reported as runs
+        uint64_t goneStart = 0;
+        uint64_t goneEnd = 0;
+        auto flushGone = [&]() {
+            while (goneEnd > goneStart) {
+                const uint16_t count = static_cast<uint16_t>(std::min<uint64_t>(goneEnd - goneStart, UINT16_MAX));
+                char gone[UdpStream::HEADER_SIZE + 10];
+                sendUdpStream(*subscriber, gone, UdpStream::writeGone(gone, goneStart, count));
+                subscriber->gone += count;
+                udpStreamGone += count;
+                goneStart += count;
             }
-        }
-        
-        // Send OpenTrack UDP data
-        if (latestData.hasHead) {
-            OpenTrackPacket udpPacket;
-            udpPacket.yaw = latestData.headYaw;
-            udpPacket.pitch = latestData.headPitch;
-            udpPacket.roll = latestData.headRoll;
-            udpPacket.x = latestData.headPosX;
-            udpPacket.y = latestData.headPosY;
-            udpPacket.z = latestData.headPosZ;
-            
-            try {
-                // Broadcast to OpenTrack port (simplified - would need proper client management)
-                asio::ip::udp::endpoint endpoint(asio::ip::address_v4::broadcast(), udpPort);
-                udpSocket->send_to(asio::buffer(&udpPacket, sizeof(udpPacket)), endpoint);
-            } catch (const std::exception& e) {
-                // UDP errors are non-critical
+        };
+        auto markGone = [&](uint64_t first, uint64_t last) {
+            if (first >= last) return;
+            if (goneEnd != first) {
+                flushGone();
+                goneStart = first;
             }
-        }
+            goneEnd = last;
+        };
         
-        packetsDistributed++;
+        UdpStream::readNack(data, size, [&](const UdpStream::NackRange& range) {
+            // Not yet published: nothing to resend; out of the ring: gone without looking
+            const uint64_t last = std::min<uint64_t>(range.first + range.count, end);
+            const uint64_t held = std::max(range.first, core.ring().begin());
+            markGone(range.first, std::min(held, last));
+            for (uint64_t sequence = held; sequence < last; ++sequence) {
+                const TobiiDataPacket& sample = core.ring().at(sequence);
+                if (sample.timestamp < oldestMs || !subscriber->retransmitBudget.take(now, rate, burst)) {
+                    markGone(sequence, sequence + 1);
+                    continue;
+                }
+                sendUdpSample(*subscriber, UdpStream::Kind::Retransmit, sequence, sample);
+                subscriber->retransmitted++;
+                udpStreamRetransmits++;
+            }
+        });
+        flushGone();
     }
     
     /**
-     * Create WebSocket message from Tobii data
+     * Send the tick's sample to every UDP stream subscriber, dropping those
+     * that stopped sending keep-alives (clientsMutex and dataMutex held)
      */
-    json createWebSocketMessage(const TobiiDataPacket& data) {
-        json message;
-        message["type"] = "tobii-data";
-        message["timestamp"] = data.timestamp;
-        
-        // Gaze data
-        if (data.hasGaze) {
-            message["data"]["gaze"]["x"] = data.gazeX;
-            message["data"]["gaze"]["y"] = data.gazeY;
-            message["data"]["gaze"]["timestamp"] = data.gazeTimestamp;
-            message["data"]["gaze"]["confidence"] = data.gazeConfidence;
+    void streamUdpSample(uint64_t sequence, const TobiiDataPacket& sample) {
+        const uint64_t now = clock.monotonicMicros();
+        const uint64_t timeout = static_cast<uint64_t>(config.udpStreamTimeoutMs) * 1000;
+        for (auto& subscriber : udpStreamSubscribers) {
+            if (!subscriber.active) continue;
+            if (now - subscriber.lastHeardMicros > timeout) {
+                dropUdpSubscriber(subscriber, "udp_stream.expired");
+                continue;
+            }
+            sendUdpSample(subscriber, UdpStream::Kind::Sample, sequence, sample);
+            subscriber.sent++;
         }
-        message["data"]["hasGaze"] = data.hasGaze;
-        
-        // Head pose data
-        if (data.hasHead) {
-            message["data"]["head"]["yaw"] = data.headYaw;
-            message["data"]["head"]["pitch"] = data.headPitch;
-            message["data"]["head"]["roll"] = data.headRoll;
-            message["data"]["head"]["position"]["x"] = data.headPosX;
-            message["data"]["head"]["position"]["y"] = data.headPosY;
-            message["data"]["head"]["position"]["z"] = data.headPosZ;
-            message["data"]["head"]["confidence"] = data.headConfidence;
+    }
+    
+    void sendUdpSample(UdpStreamSubscriber& subscriber, UdpStream::Kind kind, uint64_t sequence,
+                       const TobiiDataPacket& sample) {
+        char datagram[UdpStream::MAX_DATAGRAM];
+        UdpStream::writeHeader(datagram, kind);
+        UdpStream::put<uint64_t>(datagram + UdpStream::HEADER_SIZE, sequence);
+        const size_t length = BridgeCore::encode(sample, subscriber.format, subscriber.streams,
+                                                 datagram + UdpStream::SAMPLE_HEADER_SIZE,
+                                                 sizeof(datagram) - UdpStream::SAMPLE_HEADER_SIZE);
+        if (length > 0) sendUdpStream(subscriber, datagram, UdpStream::SAMPLE_HEADER_SIZE + length);
+    }
+    
+    void sendUdpStream(UdpStreamSubscriber& subscriber, const char* data, size_t size) {
+        if (benchmarkMode) {
+            const size_t index = static_cast<size_t>(&subscriber - udpStreamSubscribers.data());
+            if (index < benchUdpReceivers.size() && !benchUdpLost()) {
+                benchUdpReceivers[index].receive(data, size, clock.monotonicMicros(),
+                                                 [](uint64_t, const char*, size_t, bool) {});
+            }
+            return;
         }
-        message["data"]["hasHead"] = data.hasHead;
-        
-        // Presence data
-        message["data"]["present"] = data.present;
-        message["data"]["overallQuality"] = data.overallQuality;
-        
-        return message;
+        // Loss is what the NACKs are for; a failed send is not worth more than that
+        asio::error_code ignored;
+        udpStreamSocket->send_to(asio::buffer(data, size), subscriber.endpoint, 0, ignored);
     }
     
     /**
-     * Broadcast discovery announcement
+     * Setup the multicast sample stream; receivers join the group themselves
      */
-    void broadcastDiscovery() {
+    bool setupMulticast() {
         try {
-            json announcement;
-            announcement["type"] = "tobii-bridge-announcement";
-            announcement["service"] = "tobii-bridge";
-            announcement["version"] = "1.0";
-            announcement["websocket_port"] = wsPort;
-            announcement["udp_port"] = udpPort;
-            announcement["config_port"] = 8081; // Would be configurable
-            announcement["capabilities"] = json::array({"gaze-tracking", "head-tracking", "presence-detection"});
-            announcement["timestamp"] = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch()
-            ).count();
+            multicastEndpoint = asio::ip::udp::endpoint(asio::ip::make_address(config.multicastGroup),
+                                                        static_cast<unsigned short>(config.multicastPort));
+            multicastSocket = std::make_unique<asio::ip::udp::socket>(*ioContext);
+            multicastSocket->open(asio::ip::udp::v4());
+            multicastSocket->set_option(asio::ip::multicast::hops(config.multicastTtl));
+            multicastSocket->set_option(asio::ip::multicast::enable_loopback(true));
+            if (config.udpSendBufferBytes > 0) {
+                multicastSocket->set_option(asio::socket_base::send_buffer_size(config.udpSendBufferBytes));
+            }
+            multicastSocket->bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), 0));
+            receiveMulticastReports();
+            multicastEnabled = true;
+            
+            std::cout << "✅ Multicast sample stream setup on " << config.multicastGroup << ":" << config.multicastPort
+                      << std::endl;
+            
+            return true;
+        } catch (const std::exception& e) {
+            std::cerr << "Exception setting up multicast sample stream: " << e.what() << std::endl;
+            return false;
+        }
+    }
+    
+    /**
+     * Receivers report to the socket the group's datagrams come from; that
+     * is all the bridge hears of them (network thread)
+     */
+    void receiveMulticastReports() {
+        multicastSocket->async_receive_from(asio::buffer(multicastInbox), multicastReporter,
+            [this](const asio::error_code& ec, size_t size) {
+                if (ec == asio::error::operation_aborted) return;
+                if (!ec && UdpStream::kindOf(multicastInbox.data(), size) == static_cast<uint8_t>(UdpStream::Kind::Report)) {
+                    const bool wasQuiet = !multicastHeard(clock.monotonicMicros());
+                    multicastHeardMicros = clock.monotonicMicros();
+                    if (wasQuiet) {
+                        BRIDGE_LOG(LogLevel::Info, "multicast.receiver", {"endpoint", multicastReporter.address().to_string()});
+                        noteActivity();
+                    }
+                }
+                receiveMulticastReports();
+            });
+    }
+    
+    /**
+     * Whether a multicast receiver reported within udp_stream.timeout_ms
+     */
+    bool multicastHeard(uint64_t now) const {
+        const uint64_t heard = multicastHeardMicros.load();
+        return heard != 0 && now - heard < static_cast<uint64_t>(config.udpStreamTimeoutMs) * 1000;
+    }
+    
+    /**
+     * Send the tick's sample to the multicast group, followed by the FEC
+     * parity of its group when it completes one (clientsMutex and dataMutex
+     * held)
+     */
+    void streamMulticastSample(uint64_t sequence, const TobiiDataPacket& sample) {
+        const size_t k = static_cast<size_t>(config.multicastFecGroup);
+        const size_t m = static_cast<size_t>(config.multicastFecParity);
+        if (multicastFec.k() != k || multicastFec.m() != m) multicastFec.configure(k, m);
+        const SampleFormat format = config.multicastFormat == "quantized" ? SampleFormat::Quantized : SampleFormat::Binary;
+        
+        char datagram[UdpStream::MAX_DATAGRAM];
+        UdpStream::writeHeader(datagram, UdpStream::Kind::Sample);
+        UdpStream::put<uint64_t>(datagram + UdpStream::HEADER_SIZE, sequence);
+        char* frame = datagram + UdpStream::SAMPLE_HEADER_SIZE;
+        const size_t length = BridgeCore::encode(sample, format, STREAM_DEFAULT, frame,
+                                                 sizeof(datagram) - UdpStream::SAMPLE_HEADER_SIZE);
+        if (length == 0) return;
+        sendMulticast(datagram, UdpStream::SAMPLE_HEADER_SIZE + length);
+        multicastSent++;
+        
+        const auto encodeStart = benchmarkMode ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+        const bool groupComplete = multicastFec.add(sequence, frame, length);
+        if (benchmarkMode) benchFecEncodeNanos += elapsedNanos(encodeStart);
+        if (!groupComplete) return;
+        for (size_t j = 0; j < m; ++j) {
+            sendMulticast(datagram, multicastFec.writeParity(datagram, j));
+            multicastParitySent++;
+        }
+    }
+    
+    void sendMulticast(const char* data, size_t size) {
+        if (benchmarkMode) {
+            const auto decodeStart = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < benchMulticastReceivers.size(); ++i) {
+                if (benchLinkDrops(benchMulticastRandom, benchMulticastLoss[i % benchMulticastLoss.size()])) continue;
+                benchMulticastReceivers[i].receive(data, size, [](uint64_t, const char*, size_t, bool) {});
+            }
+            benchFecDecodeNanos += elapsedNanos(decodeStart);
+            return;
+        }
+        // Parity covers the loss; a failed send is one more erasure
+        asio::error_code ignored;
+        multicastSocket->send_to(asio::buffer(data, size), multicastEndpoint, 0, ignored);
+    }
+    
+    /**
+     * Setup discovery beacon
+     */
+    void setupDiscoveryBeacon() {
+        try {
+            discoverySocket = std::make_unique<asio::ip::udp::socket>(
+                *ioContext, asio::ip::udp::endpoint(asio::ip::udp::v4(), 0)
+            );
+            discoverySocket->set_option(asio::socket_base::broadcast(true));
+            
+            std::cout << "✅ Discovery beacon setup" << std::endl;
+        } catch (const std::exception& e) {
+            std::cerr << "Exception setting up discovery: " << e.what() << std::endl;
+        }
+    }
+    
+    /**
+     * Main processing loop
+     */
+    void mainLoop() {
+        std::cout << "Main processing loop started" << std::endl;
+        AllocTracker::nameThread("main");
+        pinCurrentThread(config.mainThreadCpu);
+        
+        uint64_t lastConfigCheck = clock.monotonicMicros();
+        lastBusyMicros = lastConfigCheck;
+        
+        while (running) {
+            const uint64_t tickStart = clock.monotonicMicros();
+            
+            // Config changes land here, between ticks, never mid-distribution
+            if (configPending.load(std::memory_order_acquire)) {
+                applyPendingConfig();
+            }
+            updateIdle(tickStart);
+            if (clock.monotonicMicros() - lastConfigCheck >= 1000000) {
+                lastConfigCheck = clock.monotonicMicros();
+                pollConfigFile();
+            }
+            
+            const uint64_t tickAllocsStart = AllocTracker::threadAllocations();
+            uint64_t dataPathAllocs = 0;
+            
+            try {
+                // Update tracker source
+                uint64_t bridgeStart = clock.monotonicMicros();
+                if (core.hasSource()) {
+                    const uint64_t dataPathStart = AllocTracker::threadAllocations();
+                    if (updateSource()) {
+                        bridgeStart = clock.monotonicMicros();
+                        
+                        // Process Tobii data and distribute it to clients
+                        publishReadings();
+                    }
+                    dataPathAllocs = AllocTracker::threadAllocations() - dataPathStart;
+                }
+                
+                // Process network events
+                if (ioThreads.empty()) {
+                    ioContext->poll();
+                }
+                
+                // The tracker's own update() time is not the bridge's to shed
+                shedLoad(clock.monotonicMicros() - bridgeStart);
+                
+            } catch (const std::exception& e) {
+                BRIDGE_LOG(LogLevel::Error, "loop.exception", {"what", e.what()});
+            }
+            
+            allocationStats.record(AllocTracker::threadAllocations() - tickAllocsStart, dataPathAllocs);
+            
+            paceTick(tickStart);
+        }
+        
+        std::cout << "Main processing loop ended" << std::endl;
+    }
+    
+    /**
+     * Maintain the target loop rate: sleep out the rest of the tick on the
+     * bridge clock, or out to the next keep-alive while idle
+     */
+    void paceTick(uint64_t tickStart) {
+        const int intervalMs = idle ? config.powerKeepaliveMs : config.loopIntervalMs;
+        const uint64_t interval = static_cast<uint64_t>(intervalMs) * 1000;
+        const uint64_t elapsed = clock.monotonicMicros() - tickStart;
+        if (elapsed >= interval) return;
+        if (idle) {
+            idleWait(interval - elapsed);
+        } else {
+            clock.sleepFor(interval - elapsed);
+        }
+    }
+    
+    /**
+     * Go idle once nothing has been subscribed, heard from a multicast
+     * receiver, recorded or asked of the bridge for power.idle_after_ms;
+     * wake as soon as any of that changes
+     */
+    void updateIdle(uint64_t now) {
+        const bool busy = activityPending.exchange(false) || activeSessions > 0 || udpStreamCount > 0 ||
+                          multicastHeard(now) || recorder.active() || config.powerIdleAfterMs == 0;
+        if (busy) {
+            lastBusyMicros = now;
+            if (idle) {
+                idle = false;
+                const uint64_t idleFor = now - idleSinceMicros;
+                idleMicros += idleFor;
+                BRIDGE_LOG(LogLevel::Info, "power.wake", {"idle_ms", idleFor / 1000});
+            }
+            return;
+        }
+        if (!idle && now - lastBusyMicros >= static_cast<uint64_t>(config.powerIdleAfterMs) * 1000) {
+            idle = true;
+            idleSinceMicros = now;
+            idlePeriods++;
+            {
+                // Keep-alive ticks are not a tracking rate worth reporting
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                qualityMonitor.reset();
+            }
+            BRIDGE_LOG(LogLevel::Info, "power.idle", {"keepalive_ms", config.powerKeepaliveMs});
+        }
+    }
+    
+    /**
+     * Wait up to micros for something that needs the loop. Without I/O
+     * threads the network runs here, so the wait is the reactor's own
+     */
+    void idleWait(uint64_t micros) {
+        const uint64_t until = clock.monotonicMicros() + micros;
+        if (clock.isVirtual()) {
+            // Virtual sleeps return at once; step through the wait a loop interval at a time
+            const uint64_t step = static_cast<uint64_t>(config.loopIntervalMs) * 1000;
+            for (uint64_t now = clock.monotonicMicros(); now < until; now = clock.monotonicMicros()) {
+                if (benchmarkMode) benchWakeEvent(now);
+                if (wakeDue()) return;
+                clock.sleepFor(std::min(step, until - now));
+            }
+            return;
+        }
+        if (ioThreads.empty()) {
+            while (running && !wakeDue() && !ioContext->stopped()) {
+                const uint64_t now = clock.monotonicMicros();
+                if (now >= until) return;
+                ioContext->run_one_for(std::chrono::microseconds(until - now));
+            }
+            const uint64_t now = clock.monotonicMicros();
+            if (running && !wakeDue() && now < until) clock.sleepFor(until - now);
+            return;
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeCondition.wait_for(lock, std::chrono::microseconds(micros),
+                               [this] { return wakeRequested || !running || wakeDue(); });
+        wakeRequested = false;
+    }
+    
+    bool wakeDue() const {
+        return activityPending || activeSessions > 0 || udpStreamCount > 0;
+    }
+    
+    /**
+     * Count the sessions that take samples, topics or rule events; a
+     * connected client that subscribed to nothing, or paused, does not
+     * keep the bridge awake (clientsMutex held)
+     */
+    void refreshActiveSessions() {
+        size_t active = 0;
+        for (const auto& entry : clients) {
+            const ClientSession& session = *entry.second;
+            if (!session.closed && !session.closing &&
+                (session.rules || (!session.paused && (session.streams || session.topics)))) {
+                active++;
+            }
+        }
+        activeSessions = active;
+    }
+    
+    /**
+     * A connect or command: recount what is subscribed and keep the loop
+     * awake for at least one more tick (clientsMutex not held)
+     */
+    void onClientActivity() {
+        {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            refreshActiveSessions();
+        }
+        noteActivity();
+    }
+    
+    void noteActivity() {
+        activityPending = true;
+        wakeMainLoop();
+    }
+    
+    /**
+     * Cut an idle wait short (any thread)
+     */
+    void wakeMainLoop() {
+        if (!idle) return;
+        if (ioThreads.empty()) {
+            asio::post(*ioContext, [] {});
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            wakeRequested = true;
+        }
+        wakeCondition.notify_one();
+    }
+    
+    /**
+     * Update the source, supervised by the core's watchdog. Returns whether
+     * this tick has readings; while the source is lost it is only
+     * reinitialized, on the backoff schedule
+     */
+    bool updateSource() {
+        if (!core.connected()) {
+            if (core.retryDue()) reinitializeSource();
+            return false;
+        }
+        
+        std::string error;
+        const char* lost = core.pollSource(error);
+        if (!lost) return true;
+        if (!error.empty()) {
+            BRIDGE_LOG(LogLevel::Error, "tracker.exception", {"what", error});
+        }
+        loseSource(lost);
+        return false;
+    }
+    
+    /**
+     * Publish the updated readings, unless they have stopped changing for
+     * long enough that the source counts as lost. An idle keep-alive only
+     * reads them, for the watchdog, and announces the bridge to the
+     * multicast group so that a receiver joining now can report in
+     */
+    void publishReadings() {
+        bool fresh;
+        {
+            std::lock_guard<std::mutex> lock(dataMutex);
+            fresh = core.process();
+        }
+        if (core.stale(fresh)) {
+            loseSource("stale");
+        } else if (!idle) {
+            distributeData();
+        } else if (multicastEnabled) {
+            char announce[UdpStream::HEADER_SIZE];
+            UdpStream::writeHeader(announce, UdpStream::Kind::Announce);
+            sendMulticast(announce, sizeof(announce));
+        }
+    }
+    
+    /**
+     * Stop publishing, tell clients and schedule a reinitialization. The
+     * network side and client sessions are left as they are
+     */
+    void loseSource(const char* reason) {
+        std::lock_guard<std::mutex> dataLock(dataMutex);
+        std::lock_guard<std::mutex> clientLock(clientsMutex);
+        
+        core.markLost(reason);
+        BRIDGE_LOG(LogLevel::Error, "tracker.lost", {"source", core.sourceName()}, {"reason", reason},
+                   {"retry_ms", static_cast<uint64_t>(config.watchdogRetryMs)});
+        queueOutageMarker("tracker-lost", core.watchdog().lastOutage().startMs, nullptr);
+        topicBus.publishEvent(EventTopicEntry(TopicEventKind::TrackerLost, core.watchdog().lastOutage().startMs, reason));
+        deliverTopics();
+        sendTrackerStatus();
+    }
+    
+    void reinitializeSource() {
+        std::string error;
+        const bool initialized = core.reinitialize(error);
+        if (!error.empty()) {
+            BRIDGE_LOG(LogLevel::Warn, "tracker.init_exception", {"what", error});
+        }
+        
+        std::lock_guard<std::mutex> dataLock(dataMutex);
+        std::lock_guard<std::mutex> clientLock(clientsMutex);
+        if (!initialized) {
+            core.retryFailed();
+            BRIDGE_LOG(LogLevel::Warn, "tracker.retry_failed", {"source", core.sourceName()},
+                       {"attempts", core.watchdog().lastOutage().attempts},
+                       {"retry_ms", core.watchdog().retryInMicros(clock.monotonicMicros()) / 1000});
+            return;
+        }
+        
+        const TrackerOutage& outage = core.restored();
+        BRIDGE_LOG(LogLevel::Info, "tracker.restored", {"source", core.sourceName()},
+                   {"outage_ms", outage.endMs - outage.startMs}, {"attempts", outage.attempts});
+        queueOutageMarker("tracker-restored", outage.endMs, &outage);
+        EventTopicEntry event(TopicEventKind::TrackerRestored, outage.endMs, core.sourceName());
+        event.value = static_cast<double>(outage.endMs - outage.startMs);
+        event.hasValue = true;
+        topicBus.publishEvent(event);
+        deliverTopics();
+        sendTrackerStatus();
+    }
+    
+    /**
+     * Outage edges go into the recording (and to marker subscribers) as
+     * bridge markers; the restore carries the outage length in ms as its
+     * value. Both resolve to the first sample after the outage
+     */
+    void queueOutageMarker(const char* label, uint64_t nowMs, const TrackerOutage* finished) {
+        if (pendingMarkers.size() >= MAX_PENDING_MARKERS) return;
+        BridgeMarker marker{};
+        marker.timestamp = marker.received = nowMs;
+        copyMarkerText(label, marker.label, sizeof(marker.label));
+        copyMarkerText("bridge", marker.source, sizeof(marker.source));
+        if (finished) {
+            marker.hasValue = true;
+            marker.value = static_cast<double>(finished->endMs - finished->startMs);
+        }
+        pendingMarkers.push_back(marker);
+    }
+    
+    /**
+     * Tell every client the source was lost or restored (clientsMutex held)
+     */
+    void sendTrackerStatus() {
+        const TrackerOutage& outage = core.watchdog().lastOutage();
+        frameWriter.clear();
+        frameWriter.raw("{\"type\":\"tobii-status\",\"status\":{\"tracker\":{\"connected\":");
+        frameWriter.boolean(!core.watchdog().sourceLost());
+        frameWriter.raw(",\"reason\":\"");
+        frameWriter.raw(outage.reason);
+        frameWriter.raw("\",\"start\":");
+        frameWriter.number(outage.startMs);
+        if (outage.endMs != 0) {
+            frameWriter.raw(",\"end\":");
+            frameWriter.number(outage.endMs);
+            frameWriter.raw(",\"outage_ms\":");
+            frameWriter.number(outage.endMs - outage.startMs);
+        }
+        frameWriter.raw(",\"attempts\":");
+        frameWriter.number(static_cast<uint64_t>(outage.attempts));
+        frameWriter.raw("}}}");
+        const WsMessage::ptr frame = framePool.acquire(frameWriter.data(), frameWriter.size());
+        for (const auto& entry : clients) {
+            ClientSession& session = *entry.second;
+            if (!session.closed && !session.closing) deliver(session, frame);
+        }
+    }
+    
+    /**
+     * Answer a get-history query: { from_ms, to_ms, span_ms, points, channels }
+     * on the sample clock. The points are merged under the core's history
+     * lock and serialized after it is released
+     */
+    json historyJson(const json& request) {
+        const size_t points = request.value("points", size_t(300));
+        const uint64_t spanMs = request.value("span_ms", uint64_t(3600000));
+        uint32_t groups = request.contains("channels") ? 0u : static_cast<uint32_t>(HISTORY_GROUP_ALL);
+        for (const auto& name : request.value("channels", json::array())) {
+            if (name == "gaze") groups |= HISTORY_GROUP_GAZE;
+            else if (name == "head") groups |= HISTORY_GROUP_HEAD;
+            else if (name == "quality") groups |= HISTORY_GROUP_QUALITY;
+        }
+        
+        const uint64_t toMs = request.value("to_ms", core.historyNewest());
+        const uint64_t fromMs = request.value("from_ms", toMs > spanMs ? toMs - spanMs : 0);
+        std::vector<HistoryBucket> buckets;
+        buckets.reserve(std::min(points, HistoryPyramid::MAX_POINTS));
+        const HistoryPyramid::Query query =
+            core.readHistory(fromMs, toMs, points, [&buckets](const HistoryBucket& bucket) { buckets.push_back(bucket); });
+        
+        json result;
+        result["level_ms"] = HistoryPyramid::LEVELS[query.level].widthMs;
+        result["point_ms"] = query.widthMs;
+        result["from"] = query.fromMs;
+        result["to"] = query.toMs;
+        json& t = result["t"] = json::array();
+        json& samples = result["samples"] = json::array();
+        json& present = result["present"] = json::array();
+        for (const auto& bucket : buckets) {
+            t.push_back(bucket.startMs);
+            samples.push_back(bucket.samples);
+            present.push_back(bucket.samples ? json(static_cast<float>(bucket.present) / bucket.samples) : json(nullptr));
+        }
+        for (size_t c = 0; c < HISTORY_CHANNEL_COUNT; ++c) {
+            if (!(groups & historyChannelGroup(c))) continue;
+            json& channel = result[HISTORY_CHANNEL_NAMES[c]];
+            json& min = channel["min"] = json::array();
+            json& max = channel["max"] = json::array();
+            json& mean = channel["mean"] = json::array();
+            for (const auto& bucket : buckets) {
+                const HistoryStat& stat = bucket.channels[c];
+                min.push_back(stat.count ? json(stat.min) : json(nullptr));
+                max.push_back(stat.count ? json(stat.max) : json(nullptr));
+                mean.push_back(stat.count ? json(stat.mean()) : json(nullptr));
+            }
+        }
+        return result;
+    }
+    
+    /**
+     * Source health and recent outage windows for get-status (clientsMutex held)
+     */
+    json trackerStatusJson() {
+        json tracker;
+        tracker["source"] = core.sourceName();
+        tracker["connected"] = !core.watchdog().sourceLost();
+        tracker["outages"] = core.watchdog().outageCount();
+        tracker["outage_ms"] = core.watchdog().totalOutageMs();
+        if (core.watchdog().sourceLost()) {
+            tracker["reason"] = core.watchdog().lastOutage().reason;
+            tracker["retry_in_ms"] = core.watchdog().retryInMicros(clock.monotonicMicros()) / 1000;
+        }
+        tracker["recent"] = json::array();
+        for (size_t i = 0; i < core.watchdog().recentOutages(); ++i) {
+            const TrackerOutage& outage = core.watchdog().outage(i);
+            tracker["recent"].push_back({{"start", outage.startMs},
+                                         {"end", outage.endMs ? json(outage.endMs) : json(nullptr)},
+                                         {"reason", outage.reason},
+                                         {"attempts", outage.attempts}});
+        }
+        return tracker;
+    }
+    
+    /**
+     * Discovery beacon loop
+     */
+    void discoveryLoop() {
+        std::cout << "Discovery beacon loop started" << std::endl;
+        AllocTracker::nameThread("discovery");
+        
+        while (running) {
+            try {
+                broadcastDiscovery();
+                std::this_thread::sleep_for(std::chrono::seconds(discoveryIntervalSeconds.load()));
+            } catch (const std::exception& e) {
+                BRIDGE_LOG(LogLevel::Error, "discovery.exception", {"what", e.what()});
+            }
+        }
+        
+        std::cout << "Discovery beacon loop ended" << std::endl;
+    }
+    
+    /**
+     * Network event thread (io_threads > 0)
+     */
+    void ioLoop(int cpu) {
+        AllocTracker::nameThread("io");
+        pinCurrentThread(cpu);
+        
+        while (running) {
+            try {
+                ioContext->run();
+                break;
+            } catch (const std::exception& e) {
+                BRIDGE_LOG(LogLevel::Error, "io.exception", {"what", e.what()});
+            }
+        }
+    }
+    
+    /**
+     * Swap in the staged config's hot settings (main loop only)
+     */
+    void applyPendingConfig() {
+        {
+            std::lock_guard<std::mutex> lock(configMutex);
+            if (!pendingConfig) return;
+            config = config.withHotSettingsFrom(*pendingConfig);
+            pendingConfig.reset();
+            configPending = false;
+        }
+        
+        AsyncLogger::instance().setLevel(AsyncLogger::parseLevel(config.logLevel));
+        pinCurrentThread(config.mainThreadCpu);
+        discoveryIntervalSeconds = config.discoveryIntervalSeconds;
+        {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            qualityMonitor.setWindow(static_cast<size_t>(config.qualityWindowSeconds));
+            const RateControlSettings settings = rateSettings();
+            for (const auto& session : adaptiveSessions) {
+                session->rate.configure(settings);
+            }
+            admission.configure(admissionSettings());
+            loadShedder.configure(shedSettings());
+            applyShedding();
+            core.configure(config);
+        }
+        
+        BRIDGE_LOG(LogLevel::Info, "config.applied", {"loop_interval_ms", config.loopIntervalMs},
+                   {"backpressure", BridgeConfig::policyName(config.backpressure)},
+                   {"ws_max_send_bytes", config.wsMaxSendBytes},
+                   {"gaze_smoothing", config.gazeSmoothing}, {"log_level", config.logLevel});
+    }
+    
+    /**
+     * Re-read the config, optionally with a runtime patch, and stage it for
+     * the main loop. Throws if the result is invalid (nothing is staged).
+     * Returns the config that will be in effect; restartRequired receives
+     * the restart-only settings that changed and will not take effect
+     */
+    BridgeConfig reloadConfig(const json* patch, std::vector<std::string>& restartRequired) {
+        std::lock_guard<std::mutex> lock(configMutex);
+        const BridgeConfig next = patch ? configStore.loadWithPatch(*patch) : configStore.load();
+        pendingConfig = std::make_unique<BridgeConfig>(next);
+        configPending.store(true, std::memory_order_release);
+        
+        restartRequired = config.restartOnlyChanges(next);
+        for (const auto& setting : restartRequired) {
+            BRIDGE_LOG(LogLevel::Warn, "config.restart_required", {"setting", setting});
+        }
+        return config.withHotSettingsFrom(next);
+    }
+    
+    /**
+     * Reload when the config file changes on disk
+     */
+    void pollConfigFile() {
+        {
+            std::lock_guard<std::mutex> lock(configMutex);
+            if (!configStore.fileChanged()) return;
+        }
+        
+        try {
+            std::vector<std::string> restartRequired;
+            reloadConfig(nullptr, restartRequired);
+            BRIDGE_LOG(LogLevel::Info, "config.file_reloaded", {"path", configStore.filePath()});
+        } catch (const std::exception& e) {
+            BRIDGE_LOG(LogLevel::Error, "config.reload_failed", {"what", e.what()});
+        }
+    }
+    
+    /**
+     * Publish the tick's sample and wake the sessions due at it
+     */
+    void distributeData() {
+        std::lock_guard<std::mutex> dataLock(dataMutex);
+        std::lock_guard<std::mutex> clientLock(clientsMutex);
+        
+        const uint64_t sequence = core.publish();
+        const TobiiDataPacket& latest = core.latest();
+        topicBus.publishSample(latest);
+        
+        // Markers precede the sample in the recording, whether or not anyone is connected
+        if (!pendingMarkers.empty()) {
+            distributeMarkers(sequence);
+        }
+        if (recorder.active()) {
+            recorder.pushSample(sequence, latest);
+        }
+        if (qualityMonitor.add(latest)) {
+            publishQuality();
+        }
+        deliverTopics();
+        if (udpStreamCount > 0) {
+            streamUdpSample(sequence, latest);
+        }
+        if (multicastEnabled) {
+            streamMulticastSample(sequence, latest);
+        }
+        if (clients.empty()) return;
+        
+        tickFrames.fill(nullptr);
+        displayMapper.mapAll(latest);
+        
+        // Every published sample settles earlier predictions, sent to the client or not
+        for (const auto& session : predictionSessions) {
+            session->prediction->observe(core.latestMicros(), latest);
+        }
+        
+        // Only sessions due at this sequence are visited
+        sessionWheel.advance(sequence, [this, sequence](const std::shared_ptr<ClientSession>& session) {
+            return serviceSession(*session, sequence);
+        });
+        
+        for (const auto& session : ruleSessions) {
+            evaluateRules(*session);
+        }
+        if (!adaptiveSessions.empty()) {
+            controlRates();
+        }
+        
+        // Send OpenTrack UDP data: the newest pose, only when the head topic has a new one
+        if (udpSocket && topicBus.head().end() > udpHeadNext) {
+            udpHeadNext = topicBus.head().end();
+            const HeadTopicEntry& head = topicBus.head().at(udpHeadNext - 1);
+            OpenTrackPacket udpPacket;
+            udpPacket.yaw = head.yaw;
+            udpPacket.pitch = head.pitch;
+            udpPacket.roll = head.roll;
+            udpPacket.x = head.x;
+            udpPacket.y = head.y;
+            udpPacket.z = head.z;
             
-            std::string message = announcement.dump();
+            try {
+                // Broadcast to OpenTrack port (simplified - would need proper client management)
+                asio::ip::udp::endpoint endpoint(asio::ip::address_v4::broadcast(), udpPort);
+                udpSocket->send_to(asio::buffer(&udpPacket, sizeof(udpPacket)), endpoint);
+            } catch (const std::exception& e) {
+                // UDP errors are non-critical
+            }
+        }
+        
+        packetsDistributed++;
+    }
+    
+    /**
+     * One wake of a parked session: replay any requested history, send the
+     * current sample, and return the sequence to park at next (0 = unpark)
+     */
+    uint64_t serviceSession(ClientSession& session, uint64_t sequence) {
+        if (session.closed || session.closing || session.paused || session.topics) {
+            session.parked = false;
+            return 0;
+        }
+        
+        // Screen coordinates need a registered display geometry, prediction fields a predict subscription
+        uint32_t mask = session.streams & STREAM_ALL;
+        if (session.geometry < 0) mask &= ~STREAM_SCREEN;
+        if (!session.prediction) mask &= ~STREAM_PREDICTION;
+        
+        // Catch-up runs in bounded bursts, one per tick, before live samples resume
+        if (session.replayNext < session.replayEnd) {
+            session.replayNext = std::max(session.replayNext, core.ring().begin());
+            for (size_t burst = 0; burst < CATCH_UP_BURST && session.replayNext < session.replayEnd; ++burst) {
+                TobiiDataPacket sample = core.ring().at(session.replayNext++);
+                if (mask & STREAM_SCREEN) displayMapper.apply(session.geometry, sample);
+                frameWriter.clear();
+                sampleEncoder(session.format, mask)(frameWriter, sample);
+                deliver(session, framePool.acquire(frameWriter.data(), frameWriter.size(),
+                                                   session.format != SampleFormat::Json));
+            }
+            if (session.replayNext < session.replayEnd) return sequence + 1;
+        }
+        
+        // Predicted frames depend on the session's horizon, so they are not shared
+        if (mask & STREAM_PREDICTION) {
+            TobiiDataPacket sample = core.ring().at(sequence);
+            if (core.predictor().extrapolate(sample, predictionHorizon(session), core.latestMicros())) {
+                const uint64_t target = core.latestMicros() + static_cast<uint64_t>(sample.predictionHorizonMs * 1000.0f);
+                session.prediction->expect(target, sample, core.latest(), core.predictor().predictingGaze(),
+                                           core.predictor().predictingHead());
+            }
+            if (mask & STREAM_POSE) core.pose().apply(sample);
+            if (mask & STREAM_SCREEN) displayMapper.apply(session.geometry, sample);
+            frameWriter.clear();
+            sampleEncoder(session.format, mask)(frameWriter, sample);
+            deliver(session, framePool.acquire(frameWriter.data(), frameWriter.size(),
+                                               session.format != SampleFormat::Json));
+            return sequence + session.decimation;
+        }
+        
+        const size_t frameIndex = static_cast<size_t>(session.format) * SAMPLE_MASK_COUNT + mask;
+        WsMessage::ptr& frame = (mask & STREAM_SCREEN) ? screenFrame(session.geometry, sequence, frameIndex)
+                                                       : tickFrames[frameIndex];
+        if (!frame) {
+            TobiiDataPacket sample = core.ring().at(sequence);
+            if (mask & STREAM_SCREEN) displayMapper.applyMapped(session.geometry, sample);
+            frameWriter.clear();
+            sampleEncoder(session.format, mask)(frameWriter, sample);
+            frame = framePool.acquire(frameWriter.data(), frameWriter.size(), session.format != SampleFormat::Json);
+        }
+        deliver(session, frame);
+        
+        return sequence + session.decimation;
+    }
+    
+    /**
+     * Once per interval: measure each adaptive session's link, move its output
+     * level if the controller says so, and ping it for the next RTT sample
+     */
+    void controlRates() {
+        const uint64_t now = clock.monotonicMicros();
+        if (now < nextRateCheckMicros) return;
+        nextRateCheckMicros = now + static_cast<uint64_t>(config.adaptiveIntervalMs) * 1000;
+        
+        for (const auto& entry : adaptiveSessions) {
+            ClientSession& session = *entry;
+            if (session.closed || session.closing) continue;
+            
+            if (session.rate.update(now, queuedBytes(session), session.bytesQueued)) {
+                applyRate(session);
+            }
+            pingSession(session, now);
+        }
+    }
+    
+    /**
+     * Bytes still waiting on a session's connection
+     */
+    size_t queuedBytes(ClientSession& session) {
+        if (benchmarkMode) {
+            drainBenchLink(session);
+            return static_cast<size_t>(session.benchQueueBytes);
+        }
+        websocketpp::lib::error_code ec;
+        auto connection = wsServer.get_con_from_hdl(session.hdl, ec);
+        return ec ? 0 : connection->get_buffered_amount();
+    }
+    
+    void pingSession(ClientSession& session, uint64_t now) {
+        if (benchmarkMode) {
+            // Simulated link: 20 ms base RTT plus the time to drain its queue
+            if (session.benchLinkBytesPerSecond > 0.0) {
+                session.rate.observeRtt(20.0 + 1000.0 * session.benchQueueBytes / session.benchLinkBytesPerSecond);
+            }
+            return;
+        }
+        // One ping in flight; a pong that never comes leaves the RTT estimate as it was
+        if (session.pingSentMicros != 0 && now - session.pingSentMicros < 10000000) return;
+        websocketpp::lib::error_code ec;
+        auto connection = wsServer.get_con_from_hdl(session.hdl, ec);
+        if (ec) return;
+        connection->ping("rate", ec);
+        session.pingSentMicros = ec ? 0 : now;
+    }
+    
+    void drainBenchLink(ClientSession& session) {
+        const uint64_t now = clock.monotonicMicros();
+        if (session.benchLinkBytesPerSecond > 0.0 && session.benchDrainMicros != 0) {
+            const double drained = session.benchLinkBytesPerSecond * static_cast<double>(now - session.benchDrainMicros) * 1e-6;
+            session.benchQueueBytes = std::max(0.0, session.benchQueueBytes - drained);
+        }
+        session.benchDrainMicros = now;
+    }
+    
+    /**
+     * Switch a session to its controller's level and tell the client
+     */
+    void applyRate(ClientSession& session) {
+        const RateController& rate = session.rate;
+        refreshOutput(session);
+        
+        BRIDGE_LOG(LogLevel::Info, "rate.changed", {"client", session.id}, {"decimation", session.decimation},
+                   {"format", SAMPLE_FORMAT_NAMES[static_cast<size_t>(session.format)]},
+                   {"reason", rate.lastReason()}, {"goodput_bps", static_cast<uint64_t>(rate.goodputBytesPerSecond())},
+                   {"rtt_ms", rate.rttMs()}, {"queue_bytes", rate.queueBytes()});
+        
+        frameWriter.clear();
+        frameWriter.raw("{\"type\":\"tobii-status\",\"status\":{\"rate\":");
+        writeRate(frameWriter, session);
+        frameWriter.raw("}}");
+        deliver(session, framePool.acquire(frameWriter.data(), frameWriter.size()));
+    }
+    
+    static void writeRate(FrameWriter& out, const ClientSession& session) {
+        const RateController& rate = session.rate;
+        out.raw("{\"adaptive\":");
+        out.boolean(session.adaptive);
+        out.raw(",\"decimation\":");
+        out.number(static_cast<uint64_t>(session.decimation));
+        out.raw(",\"format\":\"");
+        out.raw(SAMPLE_FORMAT_NAMES[static_cast<size_t>(session.format)]);
+        out.raw("\",\"level\":");
+        out.number(rate.currentLevel());
+        out.raw(",\"reason\":\"");
+        out.raw(rate.lastReason());
+        out.raw("\",\"goodput_bps\":");
+        out.number(static_cast<uint64_t>(rate.goodputBytesPerSecond()));
+        out.raw(",\"rtt_ms\":");
+        out.number(static_cast<float>(rate.rttMs()));
+        out.raw(",\"queue_bytes\":");
+        out.number(static_cast<uint64_t>(rate.queueBytes()));
+        out.raw("}");
+    }
+    
+    RateControlSettings rateSettings() const {
+        RateControlSettings settings;
+        settings.maxDecimation = static_cast<uint32_t>(config.adaptiveMaxDecimation);
+        settings.targetQueueBytes = config.adaptiveTargetQueueBytes;
+        settings.intervalMs = static_cast<uint32_t>(config.adaptiveIntervalMs);
+        settings.rttSlackMs = config.adaptiveRttSlackMs;
+        settings.quantize = config.adaptiveQuantize;
+        return settings;
+    }
+    
+    /**
+     * Pong for a rate ping (I/O thread)
+     */
+    void onPong(websocketpp::connection_hdl hdl, std::string) {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        auto it = clients.find(hdl);
+        if (it == clients.end() || it->second->pingSentMicros == 0) return;
+        ClientSession& session = *it->second;
+        session.rate.observeRtt(static_cast<double>(clock.monotonicMicros() - session.pingSentMicros) / 1000.0);
+        session.pingSentMicros = 0;
+    }
+    
+    /**
+     * Set a session's format and decimation from its request, its rate
+     * controller and the shedding stage (clientsMutex held). Only adaptive
+     * sessions, which decode any encoding, are switched to quantized.
+     * Returns true when the output changed
+     */
+    bool refreshOutput(ClientSession& session) {
+        SampleFormat format = session.adaptive ? session.rate.format() : session.requestedFormat;
+        uint32_t decimation = session.adaptive ? session.rate.decimation() : session.requestedDecimation;
+        
+        const ShedAction action = loadShedder.action(session.priority);
+        if (action.quantize && session.adaptive) {
+            format = SampleFormat::Quantized;
+        }
+        if (action.decimationFactor > 1) {
+            const uint32_t bound = static_cast<uint32_t>(config.shedMaxDecimation);
+            decimation = std::max(decimation, std::min(decimation * action.decimationFactor, bound));
+        }
+        session.shed = action.any();
+        
+        const bool changed = format != session.format || decimation != session.decimation;
+        session.format = format;
+        session.decimation = decimation;
+        return changed;
+    }
+    
+    /**
+     * Feed the tick's bridge-side cost to the shedder
+     */
+    void shedLoad(uint64_t costMicros) {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        if (!loadShedder.observe(clock.monotonicMicros(), costMicros, lowPrioritySessions > 0)) return;
+        
+        BRIDGE_LOG(loadShedder.active() ? LogLevel::Warn : LogLevel::Info, "load.shedding",
+                   {"stage", loadShedder.currentStage()}, {"tick_cost_us", loadShedder.averageCostMicros()},
+                   {"budget_us", config.shedTickBudgetUs});
+        applyShedding();
+    }
+    
+    /**
+     * Bring every session in line with the shedding stage (clientsMutex held)
+     */
+    void applyShedding() {
+        for (auto& entry : clients) {
+            ClientSession& session = *entry.second;
+            if (session.closed || session.closing) continue;
+            if (loadShedder.action(session.priority).disconnect) {
+                disconnectShed(session);
+            } else if (refreshOutput(session)) {
+                sendLoadStatus(session);
+            }
+        }
+    }
+    
+    void disconnectShed(ClientSession& session) {
+        session.closing = true;
+        BRIDGE_LOG(LogLevel::Warn, "load.disconnect", {"client", session.id},
+                   {"priority", priorityName(session.priority)});
+        if (benchmarkMode) return;
+        
+        websocketpp::lib::error_code ec;
+        auto connection = wsServer.get_con_from_hdl(session.hdl, ec);
+        if (!ec) {
+            connection->close(websocketpp::close::status::try_again_later, "bridge overloaded", ec);
+        }
+    }
+    
+    void sendLoadStatus(ClientSession& session) {
+        frameWriter.clear();
+        frameWriter.raw("{\"type\":\"tobii-status\",\"status\":{\"load\":{\"shed\":");
+        frameWriter.boolean(session.shed);
+        frameWriter.raw(",\"stage\":");
+        frameWriter.number(loadShedder.currentStage());
+        frameWriter.raw(",\"priority\":\"");
+        frameWriter.raw(priorityName(session.priority));
+        frameWriter.raw("\",\"format\":\"");
+        frameWriter.raw(SAMPLE_FORMAT_NAMES[static_cast<size_t>(session.format)]);
+        frameWriter.raw("\",\"decimation\":");
+        frameWriter.number(static_cast<uint64_t>(session.decimation));
+        frameWriter.raw("}}}");
+        deliver(session, framePool.acquire(frameWriter.data(), frameWriter.size()));
+    }
+    
+    AdmissionSettings admissionSettings() const {
+        AdmissionSettings settings;
+        settings.maxConnections = static_cast<size_t>(config.admissionMaxConnections);
+        settings.maxPerAddress = static_cast<size_t>(config.admissionMaxPerAddress);
+        settings.connectRate = config.admissionConnectRate;
+        settings.connectBurst = config.admissionConnectBurst;
+        settings.addressConnectRate = config.admissionAddressConnectRate;
+        settings.addressConnectBurst = config.admissionAddressConnectBurst;
+        settings.criticalAddresses = config.criticalAddresses;
+        settings.criticalToken = config.criticalToken;
+        return settings;
+    }
+    
+    LoadShedSettings shedSettings() const {
+        LoadShedSettings settings;
+        settings.tickBudgetMicros = static_cast<uint64_t>(config.shedTickBudgetUs);
+        settings.maxDecimation = static_cast<uint32_t>(config.shedMaxDecimation);
+        settings.escalateMicros = static_cast<uint64_t>(config.shedEscalateMs) * 1000;
+        settings.recoverMicros = static_cast<uint64_t>(config.shedRecoverMs) * 1000;
+        return settings;
+    }
+    
+    bool isCritical(websocketpp::connection_hdl hdl) {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        auto it = clients.find(hdl);
+        return it != clients.end() && it->second->priority == ClientPriority::Critical;
+    }
+    
+    /**
+     * Remote IP as text; IPv4-mapped addresses are given in dotted form so
+     * config entries such as 127.0.0.1 match on a dual-stack listener
+     */
+    template <typename Connection>
+    static std::string remoteAddress(Connection& connection) {
+        asio::error_code ec;
+        const auto endpoint = connection.get_raw_socket().remote_endpoint(ec);
+        if (ec) return "unknown";
+        asio::ip::address address = endpoint.address();
+        if (address.is_v6() && address.to_v6().is_v4_mapped()) {
+            address = asio::ip::make_address_v4(asio::ip::v4_mapped, address.to_v6());
+        }
+        return address.to_string();
+    }
+    
+    /**
+     * Value of name in the request's query string ("" if absent)
+     */
+    static std::string queryParameter(const std::string& resource, const std::string& name) {
+        size_t start = resource.find('?');
+        while (start != std::string::npos) {
+            start++;
+            const size_t end = std::min(resource.find('&', start), resource.size());
+            if (resource.compare(start, name.size(), name) == 0 && start + name.size() < end &&
+                resource[start + name.size()] == '=') {
+                return resource.substr(start + name.size() + 1, end - start - name.size() - 1);
+            }
+            start = end < resource.size() ? end : std::string::npos;
+        }
+        return "";
+    }
+    
+    /**
+     * Resolve queued markers to sample sequences, record them and echo them
+     * to subscribers (clientsMutex and dataMutex held)
+     */
+    void distributeMarkers(uint64_t sequence) {
+        for (BridgeMarker& marker : pendingMarkers) {
+            marker.sequence = markerSequence(core.ring(), sequence, marker.timestamp);
+            
+            if (recorder.active()) {
+                recorder.pushMarker(marker);
+            }
+            
+            frameWriter.clear();
+            frameWriter.raw("{\"type\":\"tobii-marker\",\"timestamp\":");
+            frameWriter.number(marker.received);
+            frameWriter.raw(",\"marker\":");
+            writeMarkerJson(frameWriter, marker);
+            frameWriter.raw("}");
+            const WsMessage::ptr frame = framePool.acquire(frameWriter.data(), frameWriter.size());
+            for (const auto& entry : clients) {
+                ClientSession& session = *entry.second;
+                if (session.markers && !session.topics && !session.closed && !session.closing) deliver(session, frame);
+            }
+            
+            // The bridge's own outage markers are on the events topic as tracker-lost/restored already
+            if (std::strcmp(marker.source, "bridge") != 0) {
+                EventTopicEntry event(TopicEventKind::Marker, marker.timestamp, marker.label);
+                std::memcpy(event.source, marker.source, sizeof(event.source));
+                event.sequence = marker.sequence;
+                event.value = marker.value;
+                event.hasValue = marker.hasValue;
+                topicBus.publishEvent(event);
+            }
+            
+            BRIDGE_LOG(LogLevel::Debug, "marker", {"label", marker.label}, {"source", marker.source},
+                       {"sequence", marker.sequence});
+        }
+        pendingMarkers.clear();
+    }
+    
+    /**
+     * Send alerts that changed state with the second that just closed, then
+     * its report, to sessions taking quality updates (clientsMutex and
+     * dataMutex held)
+     */
+    void publishQuality() {
+        QualityThresholds thresholds;
+        thresholds.minRateHz = config.qualityMinRateHz;
+        thresholds.minGazeRatio = config.qualityMinGazeRatio;
+        thresholds.minHeadRatio = config.qualityMinHeadRatio;
+        thresholds.minPresenceRatio = config.qualityMinPresenceRatio;
+        thresholds.maxGapMs = static_cast<uint32_t>(config.qualityMaxGapMs);
+        
+        qualityMonitor.checkAlerts(thresholds, [this](const QualityAlert& alert) {
+            if (alert.raised) {
+                BRIDGE_LOG(LogLevel::Warn, "quality.alert", {"metric", alert.metric},
+                           {"value", alert.value}, {"threshold", alert.threshold});
+            } else {
+                BRIDGE_LOG(LogLevel::Info, "quality.recovered", {"metric", alert.metric},
+                           {"value", alert.value}, {"threshold", alert.threshold});
+            }
+            
+            frameWriter.clear();
+            frameWriter.raw("{\"type\":\"tobii-quality-alert\",\"timestamp\":");
+            frameWriter.number(qualityMonitor.timestamp());
+            frameWriter.raw(",\"alert\":{\"metric\":\"");
+            frameWriter.raw(alert.metric);
+            frameWriter.raw(alert.raised ? "\",\"state\":\"raised\"" : "\",\"state\":\"cleared\"");
+            frameWriter.raw(",\"value\":");
+            frameWriter.number(alert.value);
+            frameWriter.raw(",\"threshold\":");
+            frameWriter.number(alert.threshold);
+            frameWriter.raw("}}");
+            sendQualityFrame(framePool.acquire(frameWriter.data(), frameWriter.size()));
+            
+            EventTopicEntry event(alert.raised ? TopicEventKind::QualityAlert : TopicEventKind::QualityCleared,
+                                  qualityMonitor.timestamp(), alert.metric);
+            event.value = alert.value;
+            event.hasValue = true;
+            event.threshold = alert.threshold;
+            topicBus.publishEvent(event);
+        });
+        topicBus.publishQuality(qualityMonitor.snapshot());
+        
+        frameWriter.clear();
+        frameWriter.raw("{\"type\":\"tobii-quality\",\"timestamp\":");
+        frameWriter.number(qualityMonitor.timestamp());
+        frameWriter.raw(",\"quality\":");
+        qualityMonitor.writeJson(frameWriter);
+        frameWriter.raw("}");
+        sendQualityFrame(framePool.acquire(frameWriter.data(), frameWriter.size()));
+    }
+    
+    /**
+     * Send topic subscribers what the bus took since the last call, one
+     * frame per entry shared by every subscriber of its topic (clientsMutex
+     * and dataMutex held)
+     */
+    void deliverTopics() {
+        if (topicSessions.empty()) {
+            wsTopicCursor = topicBus.cursorAtEnd();
+            return;
+        }
+        uint32_t subscribed = 0;
+        for (const auto& session : topicSessions) subscribed |= session->topics;
+        
+        topicBus.read(wsTopicCursor, subscribed, [this](Topic topic, uint64_t sequence, const auto& entry) {
+            frameWriter.clear();
+            frameWriter.raw("{\"type\":\"tobii-topic\",\"topic\":\"");
+            frameWriter.raw(TOPIC_NAMES[static_cast<size_t>(topic)]);
+            frameWriter.raw("\",\"seq\":");
+            frameWriter.number(sequence);
+            frameWriter.raw(",\"timestamp\":");
+            frameWriter.number(entry.timestamp);
+            frameWriter.raw(",");
+            writeTopicJson(frameWriter, entry);
+            frameWriter.raw("}");
+            const WsMessage::ptr frame = framePool.acquire(frameWriter.data(), frameWriter.size());
+            for (const auto& session : topicSessions) {
+                if ((session->topics & topicBit(topic)) && !session->paused && !session->closed && !session->closing) {
+                    deliver(*session, frame);
+                }
+            }
+        });
+    }
+    
+    void sendQualityFrame(const WsMessage::ptr& frame) {
+        for (const auto& entry : clients) {
+            ClientSession& session = *entry.second;
+            if (session.quality && !session.topics && !session.closed && !session.closing) deliver(session, frame);
+        }
+    }
+    
+    /**
+     * Copy a client-supplied label into fixed storage; false unless it is
+     * 1..capacity-1 characters of [A-Za-z0-9_.:-] (written to frames verbatim)
+     */
+    static bool copyMarkerText(const std::string& text, char* out, size_t capacity) {
+        if (text.empty() || text.size() >= capacity) return false;
+        for (char c : text) {
+            const bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+                            c == '_' || c == '-' || c == '.' || c == ':';
+            if (!ok) return false;
+        }
+        std::memcpy(out, text.c_str(), text.size() + 1);
+        return true;
+    }
+    
+    /**
+     * Recording file for a set-recording name (default: timestamped)
+     */
+    std::string recordingPath(const std::string& name) {
+        std::string directory;
+        {
+            std::lock_guard<std::mutex> lock(configMutex);
+            directory = config.recordingDirectory;
+        }
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+        
+        char fallback[32];
+        std::snprintf(fallback, sizeof(fallback), "tobii-%llu",
+                      static_cast<unsigned long long>(core.sampleClockMicros() / 1000));
+        return (std::filesystem::path(directory) / ((name.empty() ? std::string(fallback) : name) + ".jsonl")).string();
+    }
+    
+    /**
+     * Run a session's gaze rules against the tick's sample and send whatever fired
+     */
+    void evaluateRules(ClientSession& session) {
+        if (session.closed || session.closing) return;
+        
+        const TobiiDataPacket& latest = core.latest();
+        GazeRulePoint point;
+        point.timestamp = latest.timestamp;
+        point.hasGaze = latest.hasGaze;
+        point.present = latest.present;
+        if (session.geometry >= 0) {
+            // AOIs in the client's desktop coordinates
+            TobiiDataPacket mapped = latest;
+            displayMapper.applyMapped(session.geometry, mapped);
+            point.x = mapped.gazeScreenX;
+            point.y = mapped.gazeScreenY;
+            point.onScreen = mapped.gazeDisplay >= 0;
+        } else {
+            // AOIs in unit coordinates on the tracked display
+            point.x = latest.gazeX;
+            point.y = latest.gazeY;
+            unitGaze(core.gazeSpace(), point.x, point.y);
+            point.onScreen = point.x >= 0.0f && point.x <= 1.0f && point.y >= 0.0f && point.y <= 1.0f;
+        }
+        
+        session.rules->evaluate(point, [this, &session](const GazeRuleEvent& event) {
+            frameWriter.clear();
+            frameWriter.raw("{\"type\":\"tobii-event\",\"timestamp\":");
+            frameWriter.number(event.timestamp);
+            frameWriter.raw(",\"event\":{\"rule\":\"");
+            frameWriter.raw(event.rule);
+            frameWriter.raw("\",\"kind\":\"");
+            frameWriter.raw(event.kind);
+            frameWriter.raw("\"");
+            if (event.aoi) {
+                frameWriter.raw(",\"aoi\":\"");
+                frameWriter.raw(event.aoi);
+                frameWriter.raw("\"");
+            }
+            frameWriter.raw(",\"duration\":");
+            frameWriter.number(event.duration);
+            if (event.value > 0.0f) {
+                frameWriter.raw(",\"value\":");
+                frameWriter.number(event.value);
+            }
+            frameWriter.raw("}}");
+            deliver(session, framePool.acquire(frameWriter.data(), frameWriter.size()));
+        });
+    }
+    
+    /**
+     * The shared screen frame slot for a geometry, format and mask this tick
+     */
+    WsMessage::ptr& screenFrame(int geometry, uint64_t sequence, size_t frameIndex) {
+        auto& row = screenFrames[geometry];
+        if (screenFrameSequence[geometry] != sequence) {
+            row.fill(nullptr);
+            screenFrameSequence[geometry] = sequence;
+        }
+        return row[frameIndex];
+    }
+    
+    /**
+     * Send a frame to a session and account for the outcome
+     */
+    void deliver(ClientSession& session, const WsMessage::ptr& frame) {
+        switch (sendFrame(session.hdl, frame, session)) {
+        case SendResult::Sent:
+            session.packetsSent++;
+            session.bytesQueued += frame->get_payload().size();
+            break;
+        case SendResult::Backpressure:
+            session.packetsDropped++;
+            packetsDropped++;
+            BRIDGE_LOG(LogLevel::Warn, "ws.backpressure", {"client", session.id},
+                       {"policy", BridgeConfig::policyName(config.backpressure)},
+                       {"dropped", session.packetsDropped});
+            break;
+        case SendResult::Failed:
+            session.packetsDropped++;
+            packetsDropped++;
+            BRIDGE_LOG(LogLevel::Warn, "ws.send_failed",
+                       {"client", session.id}, {"dropped", session.packetsDropped});
+            break;
+        }
+    }
+    
+    /**
+     * Register a session and park it for the next published sample
+     * (clientsMutex held)
+     */
+    ClientSession& addSession(websocketpp::connection_hdl hdl, std::string id) {
+        auto session = std::make_shared<ClientSession>();
+        session->hdl = hdl;
+        session->id = std::move(id);
+        clients[hdl] = session;
+        clientCount = clients.size();
+        
+        parkSession(session);
+        return *session;
+    }
+    
+    /**
+     * Replace a session's topic subscription, joining or leaving the topic
+     * set (clientsMutex held). Topics start at the bus's live end
+     */
+    void setTopics(const std::shared_ptr<ClientSession>& session, uint32_t topics) {
+        const bool had = session->topics != 0;
+        session->topics = topics & TOPIC_ALL;
+        if (session->topics && !had) {
+            topicSessions.push_back(session);
+        } else if (!session->topics && had) {
+            topicSessions.erase(std::find(topicSessions.begin(), topicSessions.end(), session));
+        }
+    }
+    
+    /**
+     * Join or leave the adaptive set (clientsMutex held)
+     */
+    void setAdaptive(const std::shared_ptr<ClientSession>& session, bool adaptive) {
+        if (session->adaptive == adaptive) return;
+        session->adaptive = adaptive;
+        if (adaptive) {
+            session->rate = RateController();
+            session->rate.configure(rateSettings());
+            adaptiveSessions.push_back(session);
+        } else {
+            adaptiveSessions.erase(std::find(adaptiveSessions.begin(), adaptiveSessions.end(), session));
+        }
+    }
+    
+    /**
+     * Start, retune or stop prediction from subscribe's predict: false,
+     * true (automatic horizon) or {"horizon_ms": ms | "auto", "extra_ms": ms}
+     * (clientsMutex held)
+     */
+    void setPrediction(const std::shared_ptr<ClientSession>& session, const json& spec) {
+        const bool predict = spec.is_object() || (spec.is_boolean() && spec.get<bool>());
+        if (!predict) {
+            if (!session->prediction) return;
+            session->prediction.reset();
+            predictionSessions.erase(std::find(predictionSessions.begin(), predictionSessions.end(), session));
+            return;
+        }
+        
+        const json horizon = spec.is_object() ? spec.value("horizon_ms", json("auto")) : json("auto");
+        session->predictHorizonMs = horizon.is_number() ? std::max(0.0f, horizon.get<float>()) : -1.0f;
+        session->predictExtraMs = spec.is_object() ? spec.value("extra_ms", 0.0f) : 0.0f;
+        if (!session->prediction) {
+            session->prediction = std::make_unique<PredictionScore>(
+                gazeUnitScale(core.gazeSpace()));
+            predictionSessions.push_back(session);
+        }
+    }
+    
+    /**
+     * How far ahead a session's samples are moved: its own horizon, or the
+     * age a sample has when it reaches the client (tracker latency plus
+     * half the clock-sync or ping RTT), bounded by prediction.max_horizon_ms
+     */
+    float predictionHorizon(const ClientSession& session) const {
+        float horizon = session.predictHorizonMs;
+        if (horizon < 0.0f) {
+            const double rtt = session.clockSynced ? session.clockRttMs : session.rate.rttMs();
+            horizon = config.predictionTrackerLatencyMs + static_cast<float>(rtt / 2.0) + session.predictExtraMs;
+        }
+        return std::min(std::max(horizon, 0.0f), config.predictionMaxHorizonMs);
+    }
+    
+    static json predictionErrorJson(const PredictionError& error) {
+        return {{"gaze_samples", error.gazeSamples},
+                {"gaze_error", error.meanGaze()},
+                {"gaze_error_unpredicted", error.meanGazeUnpredicted()},
+                {"head_samples", error.headSamples},
+                {"head_error_deg", error.meanHead()},
+                {"head_error_unpredicted_deg", error.meanHeadUnpredicted()}};
+    }
+    
+    void parkSession(const std::shared_ptr<ClientSession>& session) {
+        if (session->parked) return;
+        session->parked = true;
+        sessionWheel.park(session, core.ring().end());
+    }
+    
+    /**
+     * Send a prepared frame to one client without copying it, applying the
+     * backpressure policy once the client's queued bytes exceed the limit
+     */
+    SendResult sendFrame(websocketpp::connection_hdl hdl, const WsMessage::ptr& frame, ClientSession& session) {
+        if (benchmarkMode) {
+            benchmarkBytes += frame->get_payload().size();
+            if (session.benchLinkBytesPerSecond > 0.0) {
+                drainBenchLink(session);
+                session.benchQueueBytes += static_cast<double>(frame->get_payload().size());
+            }
+            if (clock.isVirtual()) {
+                // Summed per (client, frame) so the order clients are visited in does not matter
+                benchmarkDigest += fnv1a(frame->get_payload().data(), frame->get_payload().size(),
+                                         fnv1a(session.id.data(), session.id.size(), 14695981039346656037ull));
+            }
+            return SendResult::Sent;
+        }
+        
+        websocketpp::lib::error_code ec;
+        auto connection = wsServer.get_con_from_hdl(hdl, ec);
+        if (ec) return SendResult::Failed;
+        
+        if (config.backpressure != BackpressurePolicy::None &&
+            connection->get_buffered_amount() > config.wsMaxSendBytes) {
+            if (config.backpressure == BackpressurePolicy::Disconnect) {
+                session.closing = true;
+                connection->close(websocketpp::close::status::try_again_later, "send backlog", ec);
+            }
+            return SendResult::Backpressure;
+        }
+        
+        return connection->send(frame) ? SendResult::Failed : SendResult::Sent;
+    }
+    
+    /**
+     * One data-path iteration as the main loop runs it, minus network polling.
+     * Returns the bridge's share in nanoseconds, so a stalling source does not
+     * count against it
+     */
+    /**
+     * One main-loop tick of the idle-wake run; true with the tick's start
+     * when it published a sample
+     */
+    bool idleWakeTick(uint64_t* publishedAt = nullptr) {
+        const uint64_t tickStart = clock.monotonicMicros();
+        benchWakeEvent(tickStart);
+        updateIdle(tickStart);
+        const uint64_t published = core.ring().end();
+        if (updateSource()) {
+            publishReadings();
+        }
+        paceTick(tickStart);
+        if (core.ring().end() == published) return false;
+        if (publishedAt) *publishedAt = tickStart;
+        return true;
+    }
+    
+    /**
+     * The idle-wake run's connect or command, once it is due; both take
+     * the paths a real client's would after the WebSocket layer
+     */
+    void benchWakeEvent(uint64_t now) {
+        if (benchWakeAtMicros == 0 || now < benchWakeAtMicros) return;
+        benchWakeAtMicros = 0;
+        if (!benchWakeByCommand) {
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            addSession(benchWakeHandle, "bench_connect");
+        }
+        onClientActivity();
+    }
+    
+    uint64_t benchmarkTick() {
+        const uint64_t tickStart = clock.monotonicMicros();
+        // An experiment-control marker every 256 samples
+        if (core.ring().end() % 256 == 0) {
+            BridgeMarker marker{};
+            marker.timestamp = marker.received = core.sampleClockMicros() / 1000;
+            copyMarkerText("bench-onset", marker.label, sizeof(marker.label));
+            copyMarkerText("bench", marker.source, sizeof(marker.source));
+            pendingMarkers.push_back(marker);
+        }
+        
+        const bool updated = updateSource();
+        const auto start = std::chrono::steady_clock::now();
+        if (updated) {
+            publishReadings();
+        }
+        const auto cost = std::chrono::steady_clock::now() - start;
+        
+        // Simulated receivers ask for what their lossy links dropped, once per
+        // tick, and renew their subscriptions about once a second
+        if (core.ring().end() % 64 == 0) {
+            subscribeBenchUdpReceivers(true);
+        }
+        for (size_t i = 0; i < benchUdpReceivers.size(); ++i) {
+            char nack[UdpStream::NACK_SIZE + UdpStream::MAX_NACK_RANGES * 4];
+            const size_t size = benchUdpReceivers[i].buildNack(nack, clock.monotonicMicros());
+            if (size > 0 && !benchUdpLost()) {
+                answerNack(udpStreamSubscribers[i].endpoint, nack, size);
+            }
+        }
+        shedLoad(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(cost).count()));
+        
+        if (clock.isVirtual()) {
+            paceTick(tickStart);
+        }
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(cost).count());
+    }
+    
+    /**
+     * Subscribe (or keep alive) the simulated UDP receivers, one binary and
+     * one quantized; keep-alives cross the lossy link
+     */
+    void subscribeBenchUdpReceivers(bool keepalive) {
+        for (size_t i = 0; i < benchUdpReceivers.size(); ++i) {
+            if (keepalive && benchUdpLost()) continue;
+            char subscribe[UdpStream::HEADER_SIZE + 2];
+            const size_t size = UdpStream::writeSubscribe(subscribe, i == 0 ? SampleFormat::Binary : SampleFormat::Quantized,
+                                                          STREAM_DEFAULT);
+            onUdpStreamRequest(asio::ip::udp::endpoint(asio::ip::address_v4::loopback(),
+                                                       static_cast<unsigned short>(40000 + i)), subscribe, size);
+        }
+    }
+    
+    /**
+     * Whether the simulated UDP link drops the next datagram
+     */
+    bool benchUdpLost() { return benchLinkDrops(benchUdpRandom, benchUdpLoss); }
+    
+    /**
+     * Whether a simulated link losing share loss of its datagrams drops the
+     * next one, drawn from the xorshift state random
+     */
+    static bool benchLinkDrops(uint64_t& random, double loss) {
+        random ^= random << 13;
+        random ^= random >> 7;
+        random ^= random << 17;
+        return static_cast<double>(random >> 11) * 0x1.0p-53 < loss;
+    }
+    
+    static uint64_t elapsedNanos(std::chrono::steady_clock::time_point since) {
+        return static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - since).count());
+    }
+    
+    static uint64_t fnv1a(const void* data, size_t size, uint64_t hash) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+        return hash;
+    }
+    
+    /**
+     * Broadcast discovery announcement
+     */
+    void broadcastDiscovery() {
+        try {
+            FixedFrameWriter<512> announcement;
+            announcement.raw("{\"type\":\"tobii-bridge-announcement\",\"service\":\"tobii-bridge\",\"version\":\"1.0\"");
+            announcement.raw(",\"websocket_port\":");
+            announcement.number(wsPort);
+            announcement.raw(",\"udp_port\":");
+            announcement.number(udpPort);
+            announcement.raw(",\"config_port\":8081"); // Would be configurable
+            announcement.raw(",\"capabilities\":[\"gaze-tracking\",\"head-tracking\",\"presence-detection\"]");
+            announcement.raw(",\"timestamp\":");
+            announcement.number(static_cast<int64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::system_clock::now().time_since_epoch()
+            ).count()));
+            announcement.raw("}");
             
             asio::ip::udp::endpoint endpoint(asio::ip::address_v4::broadcast(), discoveryPort);
-            discoverySocket->send_to(asio::buffer(message), endpoint);
+            discoverySocket->send_to(asio::buffer(announcement.data(), announcement.size()), endpoint);
             
         } catch (const std::exception& e) {
             // Discovery errors are non-critical
@@ -543,20 +2772,107 @@ private:
     /**
      * WebSocket event handlers
      */
+    /**
+     * Admission check before the handshake completes; a refused client
+     * gets HTTP 503 and never becomes a session
+     */
+    bool onWebSocketValidate(websocketpp::connection_hdl hdl) {
+        websocketpp::lib::error_code ec;
+        auto connection = wsServer.get_con_from_hdl(hdl, ec);
+        if (ec) return false;
+        const std::string address = remoteAddress(*connection);
+        const std::string token = queryParameter(connection->get_resource(), "token");
+        
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        const bool critical = admission.isCritical(address, token);
+        const AdmissionVerdict verdict = admission.admit(address, critical, loadShedder.refusing(ClientPriority::Normal),
+                                                         clock.monotonicMicros());
+        if (verdict == AdmissionVerdict::Admit) {
+            pendingHandshakes[hdl] = address;
+            return true;
+        }
+        
+        connection->set_status(websocketpp::http::status_code::service_unavailable);
+        connection->append_header("Retry-After", "5");
+        BRIDGE_LOG(LogLevel::Warn, "ws.rejected", {"remote", address}, {"reason", verdictName(verdict)},
+                   {"rejected", admission.rejectedConnections()});
+        return false;
+    }
+    
     void onWebSocketOpen(websocketpp::connection_hdl hdl) {
+        websocketpp::lib::error_code ec;
+        auto connection = wsServer.get_con_from_hdl(hdl, ec);
+        const std::string address = ec ? std::string("unknown") : remoteAddress(*connection);
+        const std::string token = ec ? std::string() : queryParameter(connection->get_resource(), "token");
+        
         std::lock_guard<std::mutex> lock(clientsMutex);
-        clients[hdl] = "client_" + std::to_string(clients.size());
-        clientCount = clients.size();
+        ClientSession& session = addSession(hdl, "client_" + std::to_string(nextClientId++));
+        session.address = address;
+        session.priority = admission.isCritical(address, token) ? ClientPriority::Critical : ClientPriority::Normal;
+        auto pending = pendingHandshakes.find(hdl);
+        if (pending != pendingHandshakes.end()) {
+            session.address = pending->second;
+            pendingHandshakes.erase(pending);
+        }
+        admission.opened(session.address, clock.monotonicMicros());
+        refreshActiveSessions();
+        noteActivity();
         
-        std::cout << "WebSocket client connected. Total clients: " << clientCount << std::endl;
+        BRIDGE_LOG(LogLevel::Info, "ws.connect", {"client", session.id},
+                   {"remote", ec ? std::string("unknown") : connection->get_remote_endpoint()},
+                   {"priority", priorityName(session.priority)}, {"clients", clientCount.load()});
+    }
+    
+    /**
+     * A handshake that failed after validation gives its admission slot
+     * back; refused ones never held one
+     */
+    void onWebSocketFail(websocketpp::connection_hdl hdl) {
+        std::lock_guard<std::mutex> lock(clientsMutex);
+        auto pending = pendingHandshakes.find(hdl);
+        if (pending == pendingHandshakes.end()) return;
+        admission.failed(pending->second);
+        pendingHandshakes.erase(pending);
     }
     
     void onWebSocketClose(websocketpp::connection_hdl hdl) {
         std::lock_guard<std::mutex> lock(clientsMutex);
-        clients.erase(hdl);
-        clientCount = clients.size();
+        auto it = clients.find(hdl);
+        if (it == clients.end()) return;
+        
+        ClientSession& session = *it->second;
+        BRIDGE_LOG(LogLevel::Info, "ws.disconnect", {"client", session.id},
+                   {"sent", session.packetsSent}, {"dropped", session.packetsDropped},
+                   {"clients", clients.size() - 1});
         
-        std::cout << "WebSocket client disconnected. Total clients: " << clientCount << std::endl;
+        // Take the session off the wheel now rather than at its next wake,
+        // which can be up to a revolution away
+        session.closed = true;
+        if (session.parked) {
+            sessionWheel.remove(it->second);
+            session.parked = false;
+        }
+        displayMapper.release(session.geometry);
+        session.geometry = -1;
+        if (session.rules) {
+            ruleSessions.erase(std::find(ruleSessions.begin(), ruleSessions.end(), it->second));
+        }
+        if (session.adaptive) {
+            adaptiveSessions.erase(std::find(adaptiveSessions.begin(), adaptiveSessions.end(), it->second));
+        }
+        if (session.prediction) {
+            predictionSessions.erase(std::find(predictionSessions.begin(), predictionSessions.end(), it->second));
+        }
+        if (session.topics) {
+            topicSessions.erase(std::find(topicSessions.begin(), topicSessions.end(), it->second));
+        }
+        if (session.priority == ClientPriority::Low) {
+            lowPrioritySessions--;
+        }
+        admission.closed(session.address);
+        clients.erase(it);
+        clientCount = clients.size();
+        refreshActiveSessions();
     }
     
     void onWebSocketMessage(websocketpp::connection_hdl hdl, websocketpp::server<websocketpp::config::asio>::message_ptr msg) {
@@ -564,8 +2880,9 @@ private:
             json command = json::parse(msg->get_payload());
             handleCommand(hdl, command);
         } catch (const std::exception& e) {
-            std::cerr << "Failed to parse WebSocket message: " << e.what() << std::endl;
+            BRIDGE_LOG(LogLevel::Warn, "ws.bad_command", {"what", e.what()});
         }
+        onClientActivity();
     }
     
     /**
@@ -591,28 +2908,453 @@ private:
             wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
         }
         else if (type == "set-recording") {
-            recordingEnabled = command.value("data", json::object()).value("enabled", false);
+            const json data = command.value("data", json::object());
+            const bool enabled = data.value("enabled", false);
+            const std::string name = data.value("name", "");
             
             json response;
             response["type"] = "tobii-status";
+            
+            char checkedName[BridgeMarker::MAX_LABEL + 1];
+            if (enabled && !name.empty() && !copyMarkerText(name, checkedName, sizeof(checkedName))) {
+                response["status"]["recording_error"] = "name may only use letters, digits and _-.: (max 63)";
+            } else {
+                const std::string path = enabled ? recordingPath(name) : std::string();
+                
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                if (enabled && !recorder.active()) {
+                    if (recorder.start(path)) {
+                        BRIDGE_LOG(LogLevel::Info, "recording.started", {"path", recorder.path()});
+                    } else {
+                        response["status"]["recording_error"] = "cannot create " + path;
+                    }
+                } else if (!enabled && recorder.active()) {
+                    recorder.stop();
+                    BRIDGE_LOG(LogLevel::Info, "recording.stopped", {"path", recorder.path()},
+                               {"records", recorder.recordedCount()}, {"dropped", recorder.droppedCount()});
+                }
+                recordingEnabled = recorder.active();
+                if (recorder.active()) response["status"]["recording_file"] = recorder.path();
+            }
             response["status"]["recording"] = recordingEnabled.load();
             
             wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
         }
+        else if (type == "clock-sync") {
+            // NTP-style: the client computes offset = bridge_time - (sent + received) / 2 and
+            // reports its best estimate (lowest rtt) in later clock-sync commands
+            const double bridgeTime = static_cast<double>(core.sampleClockMicros()) / 1000.0;
+            const json data = command.value("data", json::object());
+            
+            json response;
+            response["type"] = "tobii-status";
+            {
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                auto it = clients.find(hdl);
+                if (it == clients.end()) return;
+                ClientSession& session = *it->second;
+                
+                if (data.contains("offset") && data["offset"].is_number()) {
+                    session.clockSynced = true;
+                    session.clockOffsetMs = data["offset"].get<double>();
+                    session.clockRttMs = data.value("rtt", 0.0);
+                }
+                response["status"]["clock"]["client_time"] = data.value("client_time", 0.0);
+                response["status"]["clock"]["bridge_time"] = bridgeTime;
+                response["status"]["clock"]["synced"] = session.clockSynced;
+                response["status"]["clock"]["offset"] = session.clockOffsetMs;
+            }
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
+        else if (type == "marker") {
+            const uint64_t received = core.sampleClockMicros() / 1000;
+            const json data = command.value("data", json::object());
+            
+            BridgeMarker marker{};
+            marker.received = received;
+            marker.timestamp = received;
+            const bool labelOk = copyMarkerText(data.value("label", ""), marker.label, sizeof(marker.label));
+            if (data.contains("value") && data["value"].is_number()) {
+                marker.hasValue = true;
+                marker.value = data["value"].get<double>();
+            }
+            
+            const char* error = labelOk ? nullptr : "label must be 1-63 letters, digits or _-.:";
+            if (labelOk) {
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                auto it = clients.find(hdl);
+                if (it == clients.end()) return;
+                ClientSession& session = *it->second;
+                copyMarkerText(session.id, marker.source, sizeof(marker.source));
+                
+                // Stimulus time on the client's clock beats receipt time once the clocks are synced
+                if (session.clockSynced && data.contains("client_time") && data["client_time"].is_number()) {
+                    applyClientTime(marker, data["client_time"].get<double>(), session.clockOffsetMs);
+                }
+                
+                if (pendingMarkers.size() < MAX_PENDING_MARKERS) {
+                    pendingMarkers.push_back(marker);
+                } else {
+                    error = "marker queue full";
+                }
+            }
+            
+            if (error) {
+                BRIDGE_LOG(LogLevel::Warn, "marker.rejected", {"what", error});
+                json response;
+                response["type"] = "tobii-status";
+                response["status"]["marker_error"] = error;
+                wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+            }
+        }
+        else if (type == "subscribe") {
+            const json data = command.value("data", json::object());
+            
+            std::lock_guard<std::mutex> lock(clientsMutex);
+            auto it = clients.find(hdl);
+            if (it == clients.end()) return;
+            ClientSession& session = *it->second;
+            
+            // Settings left out of the command keep their current values
+            if (data.contains("streams") && data["streams"].is_array()) {
+                session.streams = 0;
+                for (const auto& stream : data["streams"]) {
+                    const std::string name = stream.is_string() ? stream.get<std::string>() : "";
+                    for (const SampleStream& known : SAMPLE_STREAMS) {
+                        if (name == known.name) session.streams |= known.bit;
+                    }
+                }
+            }
+            if (data.contains("decimation")) {
+                session.requestedDecimation = static_cast<uint32_t>(std::max(1, data.value("decimation", 1)));
+            }
+            if (data.contains("format")) {
+                const std::string format = data.value("format", "");
+                for (size_t f = 0; f < SAMPLE_FORMAT_COUNT; ++f) {
+                    if (format == SAMPLE_FORMAT_NAMES[f]) session.requestedFormat = static_cast<SampleFormat>(f);
+                }
+            }
+            if (data.contains("adaptive")) {
+                setAdaptive(it->second, data.value("adaptive", false));
+            }
+            if (data.contains("predict")) {
+                setPrediction(it->second, data["predict"]);
+            }
+            // Predicted samples always carry their flag
+            session.streams = session.prediction ? session.streams | STREAM_PREDICTION
+                                                 : session.streams & ~STREAM_PREDICTION;
+            // A client may lower its own priority; critical is only granted at connect
+            if (data.contains("priority") && session.priority != ClientPriority::Critical) {
+                const bool low = data.value("priority", std::string("normal")) == "low";
+                if (low != (session.priority == ClientPriority::Low)) {
+                    session.priority = low ? ClientPriority::Low : ClientPriority::Normal;
+                    lowPrioritySessions = low ? lowPrioritySessions + 1 : lowPrioritySessions - 1;
+                }
+            }
+            // Adaptive sessions start over from the (possibly new) request
+            session.rate.reset(session.requestedFormat, session.requestedDecimation);
+            refreshOutput(session);
+            if (loadShedder.action(session.priority).disconnect) {
+                disconnectShed(session);
+            }
+            if (data.contains("paused")) {
+                session.paused = data.value("paused", false);
+            }
+            if (data.contains("markers")) {
+                session.markers = data.value("markers", true);
+            }
+            if (data.contains("quality")) {
+                session.quality = data.value("quality", true);
+            }
+            // topics: [] goes back to the sample stream
+            if (data.contains("topics") && data["topics"].is_array()) {
+                uint32_t topics = 0;
+                for (const auto& topic : data["topics"]) {
+                    const std::string name = topic.is_string() ? topic.get<std::string>() : "";
+                    for (size_t t = 0; t < TOPIC_COUNT; ++t) {
+                        if (name == TOPIC_NAMES[t]) topics |= topicBit(static_cast<Topic>(t));
+                    }
+                }
+                setTopics(it->second, topics);
+            }
+            
+            // Replay up to catch_up recent samples (bounded by the ring) before live data
+            const uint64_t catchUp = std::min<uint64_t>(data.value("catch_up", 0u), core.ring().capacity());
+            if (catchUp > 0) {
+                session.replayEnd = core.ring().end();
+                session.replayNext = std::max(core.ring().begin(), session.replayEnd - std::min(catchUp, session.replayEnd));
+            }
+            if (!session.paused && !session.topics) {
+                parkSession(it->second);
+            }
+            
+            json response;
+            response["type"] = "tobii-status";
+            response["status"]["subscription"]["client"] = session.id;
+            response["status"]["subscription"]["streams"] = session.streams;
+            response["status"]["subscription"]["decimation"] = session.decimation;
+            response["status"]["subscription"]["format"] = SAMPLE_FORMAT_NAMES[static_cast<size_t>(session.format)];
+            response["status"]["subscription"]["schema_version"] = SAMPLE_SCHEMA_VERSION;
+            response["status"]["subscription"]["paused"] = session.paused;
+            response["status"]["subscription"]["markers"] = session.markers;
+            response["status"]["subscription"]["quality"] = session.quality;
+            response["status"]["subscription"]["topics"] = json::array();
+            for (size_t t = 0; t < TOPIC_COUNT; ++t) {
+                if (session.topics & topicBit(static_cast<Topic>(t))) {
+                    response["status"]["subscription"]["topics"].push_back(TOPIC_NAMES[t]);
+                }
+            }
+            response["status"]["subscription"]["adaptive"] = session.adaptive;
+            response["status"]["subscription"]["priority"] = priorityName(session.priority);
+            if (session.prediction) {
+                json& predict = response["status"]["subscription"]["predict"];
+                predict["horizon_ms"] = session.predictHorizonMs >= 0.0f ? json(session.predictHorizonMs) : json("auto");
+                predict["extra_ms"] = session.predictExtraMs;
+                predict["effective_horizon_ms"] = predictionHorizon(session);
+            } else {
+                response["status"]["subscription"]["predict"] = false;
+            }
+            response["status"]["subscription"]["catch_up"] = session.replayEnd - session.replayNext;
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
+        else if (type == "set-display") {
+            json response;
+            response["type"] = "tobii-status";
+            try {
+                const json data = command.value("data", json::object());
+                const DisplayGeometry geometry = data.is_null() ? DisplayGeometry() : DisplayGeometry::fromJson(data);
+                
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                auto it = clients.find(hdl);
+                if (it == clients.end()) return;
+                ClientSession& session = *it->second;
+                
+                // Acquire before releasing so an unchanged layout keeps its slot
+                int index = -1;
+                if (!geometry.displays.empty()) {
+                    index = displayMapper.acquire(geometry, core.gazeSpace());
+                    if (index < 0) throw std::invalid_argument("too many distinct display layouts");
+                }
+                displayMapper.release(session.geometry);
+                session.geometry = index;
+                if (index >= 0) {
+                    session.streams |= STREAM_SCREEN;
+                    response["status"]["display"] = geometry.toJson();
+                } else {
+                    session.streams &= ~STREAM_SCREEN;
+                    response["status"]["display"] = nullptr;
+                }
+                response["status"]["subscription"]["streams"] = session.streams;
+            } catch (const std::exception& e) {
+                BRIDGE_LOG(LogLevel::Warn, "display.rejected", {"what", e.what()});
+                response["status"]["display_error"] = e.what();
+            }
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
+        else if (type == "set-rules") {
+            json response;
+            response["type"] = "tobii-status";
+            try {
+                const json data = command.value("data", json::object());
+                std::unique_ptr<GazeRuleSet> rules;
+                if (!data.is_null()) {
+                    rules = std::make_unique<GazeRuleSet>(GazeRuleSet::fromJson(data));
+                }
+                
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                auto it = clients.find(hdl);
+                if (it == clients.end()) return;
+                ClientSession& session = *it->second;
+                
+                const bool hadRules = static_cast<bool>(session.rules);
+                session.rules = (rules && rules->ruleCount() > 0) ? std::move(rules) : nullptr;
+                if (session.rules && !hadRules) {
+                    ruleSessions.push_back(it->second);
+                } else if (!session.rules && hadRules) {
+                    ruleSessions.erase(std::find(ruleSessions.begin(), ruleSessions.end(), it->second));
+                }
+                
+                response["status"]["rules"]["aois"] = session.rules ? session.rules->aoiCount() : 0;
+                response["status"]["rules"]["rules"] = session.rules ? session.rules->ruleCount() : 0;
+                response["status"]["rules"]["units"] = session.geometry >= 0 ? "display" : "unit";
+            } catch (const std::exception& e) {
+                BRIDGE_LOG(LogLevel::Warn, "rules.rejected", {"what", e.what()});
+                response["status"]["rules_error"] = e.what();
+            }
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
+        else if (type == "get-alloc-stats") {
+            json response;
+            response["type"] = "tobii-status";
+            json& allocations = response["status"]["allocations"];
+            allocations["tracking"] = AllocTracker::enabled();
+            
+            const uint64_t ticks = allocationStats.ticks.load();
+            allocations["ticks"] = ticks;
+            allocations["last_tick"] = allocationStats.lastTick.load();
+            allocations["max_tick"] = allocationStats.maxTick.load();
+            allocations["avg_tick"] = ticks ? static_cast<double>(allocationStats.totalTick.load()) / ticks : 0.0;
+            allocations["last_data_path"] = allocationStats.lastDataPath.load();
+            allocations["max_data_path"] = allocationStats.maxDataPath.load();
+            allocations["avg_data_path"] = ticks ? static_cast<double>(allocationStats.totalDataPath.load()) / ticks : 0.0;
+            {
+                std::lock_guard<std::mutex> lock(dataMutex);
+                allocations["frame_pool_size"] = framePool.size();
+            }
+            
+            AllocTracker::ThreadStats threads[AllocTracker::MAX_THREADS];
+            const size_t threadCount = AllocTracker::snapshot(threads, AllocTracker::MAX_THREADS);
+            allocations["threads"] = json::array();
+            for (size_t i = 0; i < threadCount; ++i) {
+                allocations["threads"].push_back({
+                    {"name", threads[i].name},
+                    {"allocations", threads[i].allocations},
+                    {"frees", threads[i].frees},
+                    {"bytes", threads[i].bytes}
+                });
+            }
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
+        else if (type == "get-history") {
+            json response;
+            response["type"] = "tobii-status";
+            response["status"]["history"] = historyJson(command.value("data", json::object()));
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
+        else if (type == "get-config") {
+            json response;
+            response["type"] = "tobii-status";
+            {
+                std::lock_guard<std::mutex> lock(configMutex);
+                response["status"]["config"] = (pendingConfig ? config.withHotSettingsFrom(*pendingConfig) : config).toJson();
+            }
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
+        else if (type == "set-config" || type == "reload-config") {
+            json response;
+            response["type"] = "tobii-status";
+            try {
+                const json patch = command.value("data", json::object());
+                if (type == "set-config") {
+                    // Every setting is bridge-wide (per-session ones go with subscribe), so
+                    // otherwise any client could lift the limits or retune everyone's output
+                    if (!isCritical(hdl)) {
+                        throw std::invalid_argument("set-config can only be sent by a critical client");
+                    }
+                    // Recordings are written wherever it points, so only the operator sets it
+                    if (patch.contains("recording") && patch["recording"].is_object() &&
+                        patch["recording"].contains("directory")) {
+                        throw std::invalid_argument("recording.directory can only be set in the config file "
+                                                    "or on the command line");
+                    }
+                }
+                std::vector<std::string> restartRequired;
+                const BridgeConfig applied = reloadConfig(type == "set-config" ? &patch : nullptr, restartRequired);
+                
+                response["status"]["config"] = applied.toJson();
+                response["status"]["restart_required"] = restartRequired;
+            } catch (const std::exception& e) {
+                BRIDGE_LOG(LogLevel::Warn, "config.rejected", {"what", e.what()});
+                response["status"]["config_error"] = e.what();
+            }
+            
+            wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
+        }
         else if (type == "get-status") {
             json response;
             response["type"] = "tobii-status";
-            response["status"]["connected"] = tobiiConnected.load();
+            response["status"]["connected"] = core.connected();
             response["status"]["recording"] = recordingEnabled.load();
             response["status"]["clients"] = clientCount.load();
-            response["status"]["packets_processed"] = packetsProcessed.load();
+            response["status"]["packets_processed"] = core.processedCount();
             response["status"]["packets_distributed"] = packetsDistributed.load();
+            response["status"]["packets_dropped"] = packetsDropped.load();
+            {
+                std::lock_guard<std::mutex> lock(clientsMutex);
+                response["status"]["sessions_waiting"] = sessionWheel.size();
+                response["status"]["sample_sequence"] = core.ring().end();
+                response["status"]["display_layouts"] = displayMapper.size();
+                response["status"]["rule_sessions"] = ruleSessions.size();
+                response["status"]["adaptive_sessions"] = adaptiveSessions.size();
+                response["status"]["udp_stream"] = {{"port", udpStreamSocket ? config.udpStreamPort : 0},
+                                                     {"subscribers", udpStreamCount.load()},
+                                                     {"retransmitted", udpStreamRetransmits},
+                                                     {"gone", udpStreamGone}};
+                response["status"]["multicast"] = {{"group", multicastSocket ? config.multicastGroup : ""},
+                                                   {"port", multicastSocket ? config.multicastPort : 0},
+                                                   {"fec", {{"group", config.multicastFecGroup},
+                                                            {"parity", config.multicastFecParity}}},
+                                                   {"sent", multicastSent},
+                                                   {"parity_sent", multicastParitySent}};
+                for (size_t t = 0; t < TOPIC_COUNT; ++t) {
+                    size_t subscribers = 0;
+                    for (const auto& session : topicSessions) {
+                        if (session->topics & topicBit(static_cast<Topic>(t))) subscribers++;
+                    }
+                    response["status"]["topics"][TOPIC_NAMES[t]] = {{"published", topicBus.end(static_cast<Topic>(t))},
+                                                                    {"subscribers", subscribers}};
+                }
+                response["status"]["connections_rejected"] = admission.rejectedConnections();
+                response["status"]["load_shedding"]["stage"] = loadShedder.currentStage();
+                response["status"]["load_shedding"]["tick_cost_us"] = loadShedder.averageCostMicros();
+                response["status"]["load_shedding"]["budget_us"] = config.shedTickBudgetUs;
+                PredictionError predictionError;
+                for (const auto& session : predictionSessions) {
+                    predictionError.add(session->prediction->totals());
+                }
+                response["status"]["tracker"] = trackerStatusJson();
+                response["status"]["power"] = {{"idle", idle.load()},
+                                               {"idle_ms", idleMicros.load() / 1000},
+                                               {"idle_periods", idlePeriods.load()}};
+                response["status"]["prediction"] = predictionErrorJson(predictionError);
+                response["status"]["prediction"]["sessions"] = predictionSessions.size();
+                auto self = clients.find(hdl);
+                if (self != clients.end() && self->second->prediction) {
+                    json& own = response["status"]["prediction"]["own"];
+                    own = predictionErrorJson(self->second->prediction->totals());
+                    own["horizon_ms"] = predictionHorizon(*self->second);
+                }
+                response["status"]["recording_records"] = recorder.recordedCount();
+                response["status"]["recording_dropped"] = recorder.droppedCount();
+                if (qualityMonitor.hasReport()) {
+                    FixedFrameWriter<1024> quality;
+                    qualityMonitor.writeJson(quality);
+                    response["status"]["quality"] = json::parse(quality.data(), quality.data() + quality.size());
+                }
+            }
             
             wsServer.send(hdl, response.dump(), websocketpp::frame::opcode::text);
         }
     }
 };
 
+/**
+ * Apply a dotted-path override such as buffers.ws_max_send_bytes=65536;
+ * values are parsed as JSON, falling back to a plain string
+ */
+static void applyOverride(json& overrides, const std::string& assignment) {
+    const size_t equals = assignment.find('=');
+    if (equals == std::string::npos || equals == 0) {
+        throw std::invalid_argument("expected key=value, got '" + assignment + "'");
+    }
+    
+    std::string pointer = "/" + assignment.substr(0, equals);
+    std::replace(pointer.begin(), pointer.end(), '.', '/');
+    
+    const std::string text = assignment.substr(equals + 1);
+    json value = json::parse(text, nullptr, false);
+    if (value.is_discarded()) value = text;
+    
+    overrides[json::json_pointer(pointer)] = value;
+}
+
 /**
  * Main entry point
  */
@@ -620,8 +3362,266 @@ int main(int argc, char* argv[]) {
     std::cout << "Synopticon Tobii Bridge Server v1.0" << std::endl;
     std::cout << "====================================" << std::endl;
     
+#ifdef TOBII_BRIDGE_HAS_TGI
+    std::string sourceName = "tgi";
+#else
+    std::string sourceName = "synthetic";
+#endif
+    
+    // config.json sits next to the executable in the deployment folder
+    std::string configPath = std::filesystem::exists("config.json") ? "config.json" : "";
+    std::vector<std::string> overrides;
+    uint64_t benchTicks = 0;
+    size_t benchClients = 64;
+    double benchLinkKbps = 0.0;
+    double benchUdpLoss = 0.0;
+    double assertUdpDelivery = 0.0;
+    std::vector<double> benchMulticastLoss;
+    size_t benchMulticastReceivers = 16;
+    double assertMulticastDelivery = 0.0;
+    std::string emitDecoderPath;
+    std::string checkDecoderPath;
+    bool assertZeroAlloc = false;
+    double assertP99Micros = 0.0;
+    bool assertShedding = false;
+    bool assertRecovery = false;
+    bool assertPredictionGain = false;
+    bool assertIdleWake = false;
+    std::string faultSpec;
+    bool virtualTime = false;
+    std::string assertDigest;
+    
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if (arg == "--source" && i + 1 < argc) {
+            sourceName = argv[++i];
+        } else if (arg == "--synthetic") {
+            sourceName = "synthetic";
+        } else if (arg == "--bench-ticks" && i + 1 < argc) {
+            benchTicks = std::stoull(argv[++i]);
+        } else if (arg == "--bench-clients" && i + 1 < argc) {
+            benchClients = std::stoul(argv[++i]);
+        } else if (arg == "--bench-link-kbps" && i + 1 < argc) {
+            benchLinkKbps = std::stod(argv[++i]);
+        } else if (arg == "--bench-udp-loss" && i + 1 < argc) {
+            benchUdpLoss = std::stod(argv[++i]);
+        } else if (arg == "--assert-udp-delivery" && i + 1 < argc) {
+            assertUdpDelivery = std::stod(argv[++i]);
+        } else if (arg == "--bench-multicast-loss" && i + 1 < argc) {
+            // One rate or a comma-separated list, spread over the receivers
+            std::stringstream rates(argv[++i]);
+            std::string rate;
+            while (std::getline(rates, rate, ',')) benchMulticastLoss.push_back(std::stod(rate));
+        } else if (arg == "--bench-multicast-receivers" && i + 1 < argc) {
+            benchMulticastReceivers = std::stoul(argv[++i]);
+        } else if (arg == "--assert-multicast-delivery" && i + 1 < argc) {
+            assertMulticastDelivery = std::stod(argv[++i]);
+        } else if (arg == "--assert-zero-alloc") {
+            assertZeroAlloc = true;
+        } else if (arg == "--assert-p99-us" && i + 1 < argc) {
+            assertP99Micros = std::stod(argv[++i]);
+        } else if (arg == "--assert-shedding") {
+            assertShedding = true;
+        } else if (arg == "--assert-recovery") {
+            assertRecovery = true;
+        } else if (arg == "--assert-prediction-gain") {
+            assertPredictionGain = true;
+        } else if (arg == "--assert-idle-wake") {
+            assertIdleWake = true;
+        } else if (arg == "--faults" && i + 1 < argc) {
+            faultSpec = argv[++i];
+        } else if (arg == "--virtual-time") {
+            virtualTime = true;
+        } else if (arg == "--assert-digest" && i + 1 < argc) {
+            assertDigest = argv[++i];
+        } else if (arg == "--emit-js-decoder" && i + 1 < argc) {
+            emitDecoderPath = argv[++i];
+        } else if (arg == "--check-js-decoder" && i + 1 < argc) {
+            checkDecoderPath = argv[++i];
+        } else if (arg == "--config" && i + 1 < argc) {
+            configPath = argv[++i];
+        } else if (arg == "--no-config") {
+            configPath.clear();
+        } else if (arg == "--set" && i + 1 < argc) {
+            overrides.push_back(argv[++i]);
+        } else if (arg == "--log-level" && i + 1 < argc) {
+            overrides.push_back(std::string("log_level=\"") + argv[++i] + "\"");
+        } else if (arg == "--ws-port" && i + 1 < argc) {
+            overrides.push_back(std::string("websocket_port=") + argv[++i]);
+        } else if (arg == "--udp-port" && i + 1 < argc) {
+            overrides.push_back(std::string("udp_port=") + argv[++i]);
+        } else if (arg == "--discovery-port" && i + 1 < argc) {
+            overrides.push_back(std::string("discovery_port=") + argv[++i]);
+        } else if (arg == "--loop-interval-ms" && i + 1 < argc) {
+            overrides.push_back(std::string("loop_interval_ms=") + argv[++i]);
+        } else if (arg == "--io-threads" && i + 1 < argc) {
+            overrides.push_back(std::string("io_threads=") + argv[++i]);
+        } else if (arg == "--main-cpu" && i + 1 < argc) {
+            overrides.push_back(std::string("cpu_affinity.main=") + argv[++i]);
+        } else if (arg == "--backpressure" && i + 1 < argc) {
+            overrides.push_back(std::string("backpressure.policy=\"") + argv[++i] + "\"");
+        }
+    }
+    
+    // Decoder generation for remote-client.js (build step and drift check)
+    if (!emitDecoderPath.empty()) {
+        std::ofstream file(emitDecoderPath, std::ios::binary);
+        file << generateSampleDecoderJs();
+        if (!file) {
+            std::cerr << "Cannot write " << emitDecoderPath << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote " << emitDecoderPath << std::endl;
+        return 0;
+    }
+    if (!checkDecoderPath.empty()) {
+        std::ifstream file(checkDecoderPath, std::ios::binary);
+        std::stringstream contents;
+        contents << file.rdbuf();
+        if (!file || contents.str() != generateSampleDecoderJs()) {
+            std::cerr << "❌ " << checkDecoderPath << " is out of date; regenerate with --emit-js-decoder" << std::endl;
+            return 1;
+        }
+        std::cout << "✅ " << checkDecoderPath << " matches the sample schema" << std::endl;
+        return 0;
+    }
+    
+    // Defaults < config file < command line; command-line values survive reloads
+    ConfigStore configStore(configPath);
+    BridgeConfig config;
+    try {
+        for (const auto& assignment : overrides) {
+            applyOverride(configStore.overrides(), assignment);
+        }
+        config = configStore.load();
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid configuration: " << e.what() << std::endl;
+        return 1;
+    }
+    if (!configPath.empty()) {
+        std::cout << "Configuration: " << configPath << std::endl;
+    }
+    
+    AsyncLogger::instance().setLevel(AsyncLogger::parseLevel(config.logLevel));
+    AsyncLogger::instance().start();
+    
+    if (assertZeroAlloc && !AllocTracker::enabled()) {
+        std::cerr << "--assert-zero-alloc requires a TOBII_BRIDGE_ALLOC_TRACKING build" << std::endl;
+        return 1;
+    }
+    
+    // Virtual time steps only when the main loop sleeps, for replayable runs
+    VirtualClock virtualClock;
+    BridgeClock& clock = virtualTime ? static_cast<BridgeClock&>(virtualClock) : BridgeClock::system();
+    if (virtualTime && benchTicks == 0 && !assertIdleWake) {
+        std::cerr << "--virtual-time applies to --bench-ticks and --assert-idle-wake runs" << std::endl;
+        return 1;
+    }
+    if (assertIdleWake && !virtualTime) {
+        // Idle waits are keep-alives long; wall time would make the run that slow
+        std::cerr << "--assert-idle-wake needs --virtual-time" << std::endl;
+        return 1;
+    }
+    if (benchLinkKbps > 0.0 && !virtualTime) {
+        // Unpaced benchmark ticks would outrun a link drained in wall time
+        std::cerr << "--bench-link-kbps needs --virtual-time" << std::endl;
+        return 1;
+    }
+    if (benchUdpLoss > 0.0 && !virtualTime) {
+        // Unpaced ticks would cycle the ring before a NACK retry came due
+        std::cerr << "--bench-udp-loss needs --virtual-time" << std::endl;
+        return 1;
+    }
+    
     try {
-        TobiiBridgeServer server;
+        // Misbehaving-hardware simulation on top of whichever source was chosen
+        FaultInjectingSource* faulty = nullptr;
+        std::unique_ptr<TrackerSource> source;
+        try {
+            source = makeTrackerSource(sourceName, faultSpec, clock, &faulty);
+        } catch (const std::invalid_argument& e) {
+            std::cerr << e.what() << std::endl;
+            return 1;
+        }
+        if (faulty) {
+            std::cout << "⚠️  Injecting tracker faults: " << faultSpec << std::endl;
+        }
+        
+        TobiiBridgeServer server(std::move(source), std::move(configStore), config, clock);
+        
+        if (assertIdleWake) {
+            const auto result = server.runIdleWake();
+            if (!result.started) return 1;
+            const uint64_t interval = static_cast<uint64_t>(config.loopIntervalMs) * 1000;
+            if (result.idleAfterMicros == TobiiBridgeServer::IdleWakeResult::NEVER) {
+                std::cerr << "❌ The bridge never went idle with no subscriptions" << std::endl;
+                return 1;
+            }
+            if (result.connectWakeMicros > interval || result.commandWakeMicros > interval) {
+                std::cerr << "❌ Waking from idle took longer than one loop interval (" << config.loopIntervalMs
+                          << " ms)" << std::endl;
+                return 1;
+            }
+            return 0;
+        }
+        
+        if (benchTicks > 0) {
+            const auto result = server.runBenchmark(benchTicks, benchClients, benchLinkKbps, benchUdpLoss,
+                                                    benchMulticastLoss, benchMulticastReceivers);
+            if (!result.started) return 1;
+            if (faulty) {
+                const FaultCounts& counts = faulty->faults();
+                std::cout << "   Faults: " << counts.dropouts << " dropouts, " << counts.stalls << " stalls, "
+                          << counts.clockSteps << " clock steps, " << counts.presenceFlaps << " presence flaps, "
+                          << counts.nanReadings << " NaN readings, " << counts.disconnects << " disconnects" << std::endl;
+            }
+            if (assertZeroAlloc && result.allocations != 0) {
+                std::cerr << "❌ Steady-state data path allocated " << result.allocations << " times" << std::endl;
+                return 1;
+            }
+            if (!assertDigest.empty()) {
+                char digest[17];
+                std::snprintf(digest, sizeof(digest), "%016llx", static_cast<unsigned long long>(result.digest));
+                if (!virtualTime || assertDigest != digest) {
+                    std::cerr << "❌ Output digest " << digest << " does not match " << assertDigest
+                              << (virtualTime ? "" : " (needs --virtual-time)") << std::endl;
+                    return 1;
+                }
+            }
+            if (assertShedding && (result.sessionsShed == 0 || !result.criticalHeld)) {
+                std::cerr << "❌ Load shedding " << (result.sessionsShed == 0 ? "never engaged" : "reached a critical client")
+                          << std::endl;
+                return 1;
+            }
+            if (assertRecovery && result.restored == 0) {
+                std::cerr << "❌ Tracker source " << (result.outages == 0 ? "was never lost" : "was never restored") << std::endl;
+                return 1;
+            }
+            if (assertPredictionGain && (result.prediction.gazeSamples == 0 ||
+                                         result.prediction.meanGaze() >= result.prediction.meanGazeUnpredicted())) {
+                std::cerr << "❌ Predicted gaze error " << result.prediction.meanGaze() << " is not below the unpredicted "
+                          << result.prediction.meanGazeUnpredicted() << " (" << result.prediction.gazeSamples
+                          << " samples scored)" << std::endl;
+                return 1;
+            }
+            if (assertUdpDelivery > 0.0 && result.udpDelivery < assertUdpDelivery) {
+                std::cerr << "❌ UDP stream delivered " << result.udpDelivery * 100.0 << "% of samples, below "
+                          << assertUdpDelivery * 100.0 << "%" << (benchUdpLoss > 0.0 ? "" : " (needs --bench-udp-loss)")
+                          << std::endl;
+                return 1;
+            }
+            if (assertMulticastDelivery > 0.0 && result.multicastDelivery < assertMulticastDelivery) {
+                std::cerr << "❌ Multicast FEC delivered " << result.multicastDelivery * 100.0 << "% of samples, below "
+                          << assertMulticastDelivery * 100.0 << "%"
+                          << (benchMulticastLoss.empty() ? " (needs --bench-multicast-loss)" : "") << std::endl;
+                return 1;
+            }
+            if (assertP99Micros > 0.0 && result.p99Micros > assertP99Micros) {
+                std::cerr << "❌ Tick latency p99 " << result.p99Micros << " us exceeds " << assertP99Micros << " us" << std::endl;
+                return 1;
+            }
+            return 0;
+        }
         
         if (!server.start()) {
             std::cerr << "Failed to start server" << std::endl;
@@ -635,8 +3635,10 @@ int main(int argc, char* argv[]) {
         
     } catch (const std::exception& e) {
         std::cerr << "Server exception: " << e.what() << std::endl;
+        AsyncLogger::instance().stop();
         return 1;
     }
     
+    AsyncLogger::instance().stop();
     return 0;
-}
\ No newline at end of file
+}
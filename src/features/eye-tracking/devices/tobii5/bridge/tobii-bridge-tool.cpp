@@ -0,0 +1,928 @@
+/**
+ * Tobii Bridge Tool
+ * Offline companion to the bridge. `analyze` re-runs the bridge's gaze
+ * filter, fixation/saccade classifier and AOI engine over recorded sessions
+ * (set-recording JSONL files) on a work-stealing pool. Long files are split
+ * into byte-range chunks; each chunk warms its filters up on the samples
+ * just before it and reads past its end until the events it started close,
+ * so chunked results match a single pass over the file. `--columns` also
+ * writes one row per session and AOI to a columnar table, and `groupby`
+ * aggregates such tables by participant, condition, AOI or session
+ */
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <filesystem>
+#include <stdexcept>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <cstdint>
+#include <charconv>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+
+#include "columnar-table.hpp"
+#include "display-mapper.hpp"
+#include "gaze-classifier.hpp"
+#include "gaze-filter.hpp"
+#include "gaze-rules.hpp"
+#include "tracker-source.hpp"
+#include "work-stealing-pool.hpp"
+
+using json = nlohmann::json;
+
+namespace {
+
+struct AnalyzeConfig {
+    std::vector<std::string> inputs;
+    std::string outPath;                // empty = stdout
+    std::string rulesPath;              // set-rules JSON (AOIs in 0-1 display units)
+    std::string columnsPath;            // per-session AOI table; empty = none
+    std::string manifestPath;           // participant/condition per file; empty = from paths
+    std::string expectPath;             // JSON the report must contain; empty = no check
+    size_t threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t chunkBytes = 8u << 20;       // 0 = one chunk per file
+    uint64_t overlapMs = 2000;
+    GazeSpace gazeSpace = GazeSpace::Unit;
+    float gazeSmoothing = 0.0f;
+    GazeClassifierSettings classifier;
+};
+
+/**
+ * Additive per-chunk counts; sessions and the aggregate are sums of these
+ */
+struct Metrics {
+    uint64_t samples = 0;
+    uint64_t gazeSamples = 0;
+    uint64_t presentSamples = 0;
+    uint64_t markers = 0;
+    uint64_t durationMs = 0;            // filled per session, summed in the aggregate
+    uint64_t firstTimestamp = UINT64_MAX;
+    uint64_t lastTimestamp = 0;
+
+    uint64_t fixations = 0;
+    uint64_t fixationMs = 0;
+    uint64_t saccades = 0;
+    double saccadeAmplitude = 0.0;
+    double saccadePeakVelocity = 0.0;
+
+    std::vector<uint64_t> aoiFixations, aoiDwellMs;
+    std::vector<uint64_t> aoiFirstFixation;     // start timestamp, UINT64_MAX = none
+    std::vector<uint64_t> ruleEvents, ruleMs;
+
+    void resize(size_t aois, size_t rules) {
+        aoiFixations.assign(aois, 0);
+        aoiDwellMs.assign(aois, 0);
+        aoiFirstFixation.assign(aois, UINT64_MAX);
+        ruleEvents.assign(rules, 0);
+        ruleMs.assign(rules, 0);
+    }
+
+    void add(const Metrics& other) {
+        samples += other.samples;
+        gazeSamples += other.gazeSamples;
+        presentSamples += other.presentSamples;
+        markers += other.markers;
+        durationMs += other.durationMs;
+        firstTimestamp = std::min(firstTimestamp, other.firstTimestamp);
+        lastTimestamp = std::max(lastTimestamp, other.lastTimestamp);
+        fixations += other.fixations;
+        fixationMs += other.fixationMs;
+        saccades += other.saccades;
+        saccadeAmplitude += other.saccadeAmplitude;
+        saccadePeakVelocity += other.saccadePeakVelocity;
+        for (size_t i = 0; i < aoiFixations.size(); ++i) {
+            aoiFixations[i] += other.aoiFixations[i];
+            aoiDwellMs[i] += other.aoiDwellMs[i];
+            aoiFirstFixation[i] = std::min(aoiFirstFixation[i], other.aoiFirstFixation[i]);
+        }
+        for (size_t i = 0; i < ruleEvents.size(); ++i) {
+            ruleEvents[i] += other.ruleEvents[i];
+            ruleMs[i] += other.ruleMs[i];
+        }
+    }
+
+    /**
+     * Milliseconds from the session's first sample to the first fixation on
+     * an AOI; negative when it was never fixated
+     */
+    int64_t timeToFirstFixation(size_t aoi) const {
+        if (aoiFirstFixation[aoi] == UINT64_MAX || firstTimestamp == UINT64_MAX) return -1;
+        return static_cast<int64_t>(aoiFirstFixation[aoi] - std::min(firstTimestamp, aoiFirstFixation[aoi]));
+    }
+
+    json toJson(const GazeRuleSet& rules, bool session) const {
+        const double minutes = static_cast<double>(durationMs) / 60000.0;
+        json out;
+        out["samples"] = samples;
+        out["markers"] = markers;
+        out["duration_ms"] = durationMs;
+        out["gaze_ratio"] = samples ? static_cast<double>(gazeSamples) / samples : 0.0;
+        out["presence_ratio"] = samples ? static_cast<double>(presentSamples) / samples : 0.0;
+        out["fixations"] = {
+            {"count", fixations},
+            {"total_ms", fixationMs},
+            {"mean_ms", fixations ? static_cast<double>(fixationMs) / fixations : 0.0},
+            {"per_minute", minutes > 0.0 ? fixations / minutes : 0.0}
+        };
+        out["saccades"] = {
+            {"count", saccades},
+            {"mean_amplitude", saccades ? saccadeAmplitude / saccades : 0.0},
+            {"mean_peak_velocity", saccades ? saccadePeakVelocity / saccades : 0.0}
+        };
+        out["aois"] = json::object();
+        for (size_t i = 0; i < aoiFixations.size(); ++i) {
+            out["aois"][rules.aoiName(i)] = {
+                {"fixations", aoiFixations[i]},
+                {"dwell_ms", aoiDwellMs[i]},
+                {"dwell_ratio", fixationMs ? static_cast<double>(aoiDwellMs[i]) / fixationMs : 0.0}
+            };
+            if (session) {
+                const int64_t ttff = timeToFirstFixation(i);
+                out["aois"][rules.aoiName(i)]["time_to_first_fixation_ms"] = ttff >= 0 ? json(ttff) : json(nullptr);
+            }
+        }
+        out["rules"] = json::object();
+        for (size_t i = 0; i < ruleEvents.size(); ++i) {
+            out["rules"][rules.ruleId(i)] = {{"count", ruleEvents[i]}, {"total_ms", ruleMs[i]}};
+        }
+        return out;
+    }
+};
+
+struct Chunk {
+    uint64_t begin, end;                // byte range of the lines this chunk owns
+    Metrics metrics;
+};
+
+struct Session {
+    std::string path;
+    std::string participant;
+    std::string condition;
+    uint64_t bytes = 0;
+    std::vector<Chunk> chunks;
+    std::atomic<size_t> remaining{0};
+    std::mutex errorMutex;
+    std::string error;
+    Metrics total;
+};
+
+/**
+ * Buffered line reader over a byte range of a file, reporting each line's
+ * starting offset
+ */
+class LineReader {
+private:
+    static constexpr size_t BLOCK = 1 << 20;
+
+    std::ifstream file;
+    std::vector<char> buffer;
+    uint64_t bufferOffset;              // file offset of buffer[0]
+    size_t position;
+    bool eof;
+
+public:
+    LineReader(const std::string& path, uint64_t offset)
+        : file(path, std::ios::binary), bufferOffset(offset), position(0), eof(false) {
+        if (!file) throw std::runtime_error("cannot open " + path);
+        file.seekg(static_cast<std::streamoff>(offset));
+    }
+
+    /**
+     * Skip to the start of the next line (when offset may be mid-line)
+     */
+    void skipPartialLine() {
+        const char* begin;
+        const char* end;
+        uint64_t offset;
+        next(begin, end, offset);
+    }
+
+    bool next(const char*& begin, const char*& end, uint64_t& offset) {
+        for (;;) {
+            const char* data = buffer.data();
+            const void* newline = position < buffer.size()
+                ? std::memchr(data + position, '\n', buffer.size() - position) : nullptr;
+            if (newline || (eof && position < buffer.size())) {
+                begin = data + position;
+                end = newline ? static_cast<const char*>(newline) : data + buffer.size();
+                offset = bufferOffset + position;
+                position = static_cast<size_t>(end - data) + (newline ? 1 : 0);
+                return true;
+            }
+            if (eof) return false;
+            fill();
+        }
+    }
+
+private:
+    void fill() {
+        buffer.erase(buffer.begin(), buffer.begin() + static_cast<std::ptrdiff_t>(position));
+        bufferOffset += position;
+        position = 0;
+
+        const size_t kept = buffer.size();
+        buffer.resize(kept + BLOCK);
+        file.read(buffer.data() + kept, static_cast<std::streamsize>(BLOCK));
+        const size_t got = static_cast<size_t>(file.gcount());
+        buffer.resize(kept + got);
+        if (got < BLOCK) eof = true;
+    }
+};
+
+/**
+ * One recorded line: a sample or a marker
+ */
+struct RecordLine {
+    bool isSample = false;
+    bool isMarker = false;
+    uint64_t sequence = 0;
+    uint64_t timestamp = 0;
+    bool hasGaze = false;
+    bool present = false;
+    float x = 0.0f, y = 0.0f;
+};
+
+template <typename T>
+bool scanNumber(std::string_view text, size_t at, T& value) {
+    if (at >= text.size()) return false;
+    return std::from_chars(text.data() + at, text.data() + text.size(), value).ec == std::errc();
+}
+
+/**
+ * Fast path for lines in the layout SampleRecorder writes (keys in schema
+ * order); returns false for anything else
+ */
+bool scanLine(std::string_view text, RecordLine& line) {
+    constexpr std::string_view SEQ = "{\"seq\":";
+    if (text.substr(0, SEQ.size()) != SEQ) return false;
+
+    line = RecordLine();
+    if (!scanNumber(text, SEQ.size(), line.sequence)) return false;
+    if (text.find(",\"marker\":") != std::string_view::npos) {
+        line.isMarker = true;
+        return true;
+    }
+
+    // The sample's own timestamp follows its data object; gaze.timestamp does not
+    constexpr std::string_view TIMESTAMP = "},\"timestamp\":";
+    const size_t timestamp = text.rfind(TIMESTAMP);
+    const size_t hasGaze = text.find("\"hasGaze\":");
+    const size_t present = text.find("\"present\":");
+    if (timestamp == std::string_view::npos || hasGaze == std::string_view::npos ||
+        present == std::string_view::npos || !scanNumber(text, timestamp + TIMESTAMP.size(), line.timestamp)) {
+        return false;
+    }
+    line.isSample = true;
+    line.hasGaze = text.compare(hasGaze + 10, 4, "true") == 0;
+    line.present = text.compare(present + 10, 4, "true") == 0;
+    if (line.hasGaze) {
+        const size_t gaze = text.find("\"gaze\":{");
+        const size_t x = text.find("\"x\":", gaze);
+        const size_t y = text.find("\"y\":", gaze);
+        if (gaze == std::string_view::npos || !scanNumber(text, x + 4, line.x) || !scanNumber(text, y + 4, line.y)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool parseLine(const char* begin, const char* end, RecordLine& line) {
+    if (scanLine(std::string_view(begin, static_cast<size_t>(end - begin)), line)) return true;
+
+    const json record = json::parse(begin, end, nullptr, false);
+    if (record.is_discarded() || !record.is_object()) return false;
+
+    line = RecordLine();
+    line.sequence = record.value("seq", uint64_t(0));
+    if (record.contains("marker")) {
+        line.isMarker = true;
+        return true;
+    }
+    if (!record.contains("sample")) return false;
+
+    const json& sample = record["sample"];
+    const json data = sample.value("data", json::object());
+    line.isSample = true;
+    line.timestamp = sample.value("timestamp", uint64_t(0));
+    line.present = data.value("present", false);
+    line.hasGaze = data.value("hasGaze", false) && data.contains("gaze");
+    if (line.hasGaze) {
+        line.x = data["gaze"].value("x", 0.0f);
+        line.y = data["gaze"].value("y", 0.0f);
+    }
+    return true;
+}
+
+/**
+ * Timestamp of the first sample at or after offset (UINT64_MAX if none)
+ */
+uint64_t firstSampleTimestamp(const std::string& path, uint64_t offset, bool partial) {
+    LineReader reader(path, offset);
+    if (partial) reader.skipPartialLine();
+    const char* begin;
+    const char* end;
+    uint64_t lineOffset;
+    RecordLine line;
+    while (reader.next(begin, end, lineOffset)) {
+        if (parseLine(begin, end, line) && line.isSample) return line.timestamp;
+    }
+    return UINT64_MAX;
+}
+
+class Analyzer {
+private:
+    const AnalyzeConfig& config;
+    const json& rulesSpec;
+    const GazeRuleSet& rulesTemplate;
+
+public:
+    Analyzer(const AnalyzeConfig& config, const json& rulesSpec, const GazeRuleSet& rulesTemplate)
+        : config(config), rulesSpec(rulesSpec), rulesTemplate(rulesTemplate) {}
+
+    /**
+     * Split a session into chunks at line boundaries and queue them
+     */
+    void plan(WorkStealingPool& pool, Session& session) {
+        session.bytes = std::filesystem::file_size(session.path);
+
+        std::vector<uint64_t> bounds{0};
+        if (config.chunkBytes > 0) {
+            for (uint64_t cut = config.chunkBytes; cut < session.bytes; cut += config.chunkBytes) {
+                LineReader reader(session.path, cut - 1);
+                const char* begin;
+                const char* end;
+                uint64_t offset;
+                reader.next(begin, end, offset);            // rest of the line cut falls in
+                if (!reader.next(begin, end, offset)) break;
+                if (offset > bounds.back()) bounds.push_back(offset);
+            }
+        }
+        bounds.push_back(session.bytes);
+
+        session.chunks.resize(bounds.size() - 1);
+        for (size_t i = 0; i + 1 < bounds.size(); ++i) {
+            session.chunks[i].begin = bounds[i];
+            session.chunks[i].end = bounds[i + 1];
+        }
+        session.remaining = session.chunks.size();
+        for (Chunk& chunk : session.chunks) {
+            pool.submit([this, &session, &chunk] { runChunk(session, chunk); });
+        }
+    }
+
+private:
+    void runChunk(Session& session, Chunk& chunk) {
+        try {
+            analyzeChunk(session.path, chunk);
+        } catch (const std::exception& e) {
+            std::lock_guard<std::mutex> lock(session.errorMutex);
+            if (session.error.empty()) session.error = e.what();
+        }
+
+        // The last chunk to finish folds the session together
+        if (session.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            session.total.resize(rulesTemplate.aoiCount(), rulesTemplate.ruleCount());
+            for (const Chunk& part : session.chunks) session.total.add(part.metrics);
+            if (session.total.samples > 0) {
+                session.total.durationMs = session.total.lastTimestamp - session.total.firstTimestamp;
+            }
+        }
+    }
+
+    /**
+     * Where to start reading so the filters see overlapMs of samples before
+     * the chunk (doubling the look-back until it covers that much)
+     */
+    uint64_t warmupStart(const std::string& path, const Chunk& chunk) {
+        if (chunk.begin == 0 || config.overlapMs == 0) return chunk.begin;
+        const uint64_t ownStart = firstSampleTimestamp(path, chunk.begin, false);
+        if (ownStart == UINT64_MAX) return chunk.begin;
+
+        for (uint64_t lookBack = 64 << 10;; lookBack *= 2) {
+            if (lookBack >= chunk.begin) return 0;
+            const uint64_t start = chunk.begin - lookBack;
+            const uint64_t first = firstSampleTimestamp(path, start, true);
+            if (first == UINT64_MAX || first + config.overlapMs <= ownStart) return start;
+        }
+    }
+
+    void analyzeChunk(const std::string& path, Chunk& chunk) {
+        Metrics& metrics = chunk.metrics;
+        metrics.resize(rulesTemplate.aoiCount(), rulesTemplate.ruleCount());
+
+        GazeRuleSet rules = GazeRuleSet::fromJson(rulesSpec);
+        GazeSmoother smoother(config.gazeSmoothing);
+        GazeClassifier classifier(config.classifier);
+
+        // Events belong to the chunk holding the sample they started at
+        uint64_t ownFirst = UINT64_MAX, ownEnd = UINT64_MAX;
+        auto owns = [&](uint64_t sequence) { return sequence >= ownFirst && sequence < ownEnd; };
+        auto onEvent = [&](const GazeEvent& event) {
+            if (!owns(event.startSequence)) return;
+            if (event.kind == GazeEventKind::Fixation) {
+                const uint64_t duration = event.endTimestamp - event.startTimestamp;
+                metrics.fixations++;
+                metrics.fixationMs += duration;
+                const int aoi = rules.aoiAt(event.x, event.y);
+                if (aoi >= 0) {
+                    metrics.aoiFixations[aoi]++;
+                    metrics.aoiDwellMs[aoi] += duration;
+                    metrics.aoiFirstFixation[aoi] = std::min(metrics.aoiFirstFixation[aoi], event.startTimestamp);
+                }
+            } else {
+                metrics.saccades++;
+                metrics.saccadeAmplitude += event.amplitude;
+                metrics.saccadePeakVelocity += event.peakVelocity;
+            }
+        };
+
+        const uint64_t start = warmupStart(path, chunk);
+        LineReader reader(path, start);
+        if (start < chunk.begin && start > 0) reader.skipPartialLine();
+
+        const char* begin;
+        const char* end;
+        uint64_t offset;
+        RecordLine line;
+        while (reader.next(begin, end, offset)) {
+            if (!parseLine(begin, end, line)) continue;
+            const bool owned = offset >= chunk.begin && offset < chunk.end;
+
+            if (offset >= chunk.end) {
+                // Past the range: keep going only while an event this chunk owns is open
+                if (line.isSample && ownEnd == UINT64_MAX) ownEnd = line.sequence;
+                uint64_t openSince;
+                if (!classifier.open(openSince) || !owns(openSince)) break;
+            }
+            if (line.isMarker) {
+                if (owned) metrics.markers++;
+                continue;
+            }
+            if (owned && ownFirst == UINT64_MAX) ownFirst = line.sequence;
+
+            float x = line.x, y = line.y;
+            unitGaze(config.gazeSpace, x, y);
+            smoother.apply(line.hasGaze, x, y);
+            classifier.add(GazeClassifierSample{line.sequence, line.timestamp, line.hasGaze, x, y}, onEvent);
+
+            GazeRulePoint point{line.timestamp, line.hasGaze,
+                                line.hasGaze && x >= 0.0f && x <= 1.0f && y >= 0.0f && y <= 1.0f,
+                                line.present, x, y};
+            rules.evaluate(point, [&](const GazeRuleEvent& event) {
+                if (!owned) return;
+                for (size_t i = 0; i < rules.ruleCount(); ++i) {
+                    if (rules.ruleId(i).c_str() != event.rule) continue;
+                    metrics.ruleEvents[i]++;
+                    metrics.ruleMs[i] += event.duration;
+                }
+            });
+
+            if (owned) {
+                metrics.samples++;
+                metrics.gazeSamples += line.hasGaze ? 1 : 0;
+                metrics.presentSamples += line.present ? 1 : 0;
+                metrics.firstTimestamp = std::min(metrics.firstTimestamp, line.timestamp);
+                metrics.lastTimestamp = std::max(metrics.lastTimestamp, line.timestamp);
+            }
+        }
+        classifier.flush(onEvent);
+    }
+};
+
+void collectInputs(const std::string& input, std::vector<std::string>& files) {
+    if (std::filesystem::is_directory(input)) {
+        for (const auto& entry : std::filesystem::recursive_directory_iterator(input)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".jsonl") files.push_back(entry.path().string());
+        }
+    } else {
+        files.push_back(input);
+    }
+}
+
+/**
+ * Participant and condition for each session: from the manifest when it
+ * lists the file (by path or file name), else the file's stem and the name
+ * of the directory it sits in
+ */
+void labelSessions(const std::string& manifestPath, std::vector<std::unique_ptr<Session>>& sessions) {
+    json manifest = json::array();
+    if (!manifestPath.empty()) {
+        std::ifstream file(manifestPath);
+        if (!file) throw std::runtime_error("cannot open " + manifestPath);
+        manifest = json::parse(file);
+        if (manifest.is_object()) manifest = manifest.value("sessions", json::array());
+        if (!manifest.is_array()) throw std::invalid_argument("manifest must be an array of sessions");
+    }
+
+    for (auto& session : sessions) {
+        const std::filesystem::path path(session->path);
+        session->participant = path.stem().string();
+        session->condition = path.parent_path().filename().string();
+        for (const json& entry : manifest) {
+            const std::string file = entry.value("file", "");
+            if (file != session->path && file != path.filename().string()) continue;
+            session->participant = entry.value("participant", session->participant);
+            session->condition = entry.value("condition", session->condition);
+            break;
+        }
+    }
+}
+
+/**
+ * One row per session and AOI
+ */
+void writeColumns(const std::string& path, const std::vector<std::unique_ptr<Session>>& sessions,
+                  const GazeRuleSet& rules) {
+    ColumnarTable table;
+    Column& participant = table.addColumn("participant", ColumnType::Dictionary);
+    Column& condition = table.addColumn("condition", ColumnType::Dictionary);
+    Column& sessionName = table.addColumn("session", ColumnType::Dictionary);
+    Column& aoi = table.addColumn("aoi", ColumnType::Dictionary);
+    Column& fixations = table.addColumn("fixations", ColumnType::UInt64);
+    Column& dwell = table.addColumn("dwell_ms", ColumnType::UInt64);
+    Column& ttff = table.addColumn("ttff_ms", ColumnType::Float64);
+    Column& duration = table.addColumn("duration_ms", ColumnType::UInt64);
+    Column& fixationMs = table.addColumn("fixation_ms", ColumnType::UInt64);
+
+    for (const auto& session : sessions) {
+        if (!session->error.empty()) continue;
+        const Metrics& metrics = session->total;
+        for (size_t i = 0; i < rules.aoiCount(); ++i) {
+            participant.push(session->participant);
+            condition.push(session->condition);
+            sessionName.push(session->path);
+            aoi.push(rules.aoiName(i));
+            fixations.push(metrics.aoiFixations[i]);
+            dwell.push(metrics.aoiDwellMs[i]);
+            const int64_t first = metrics.timeToFirstFixation(i);
+            ttff.push(first >= 0 ? static_cast<double>(first) : std::numeric_limits<double>::quiet_NaN());
+            duration.push(metrics.durationMs);
+            fixationMs.push(metrics.fixationMs);
+        }
+    }
+    table.write(path);
+}
+
+std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw std::runtime_error("cannot open " + path);
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+/**
+ * Every value in expected must be in actual: objects by key, arrays by
+ * position and numbers to a relative 1e-9. Mismatches are listed by path
+ */
+void compareReport(const json& expected, const json& actual, const std::string& path, std::vector<std::string>& mismatches) {
+    if (expected.is_object()) {
+        if (!actual.is_object()) {
+            mismatches.push_back(path + ": expected an object");
+            return;
+        }
+        for (auto it = expected.begin(); it != expected.end(); ++it) {
+            if (!actual.contains(it.key())) mismatches.push_back(path + "." + it.key() + ": missing");
+            else compareReport(it.value(), actual[it.key()], path + "." + it.key(), mismatches);
+        }
+    } else if (expected.is_array()) {
+        if (!actual.is_array() || actual.size() != expected.size()) {
+            mismatches.push_back(path + ": expected an array of " + std::to_string(expected.size()));
+            return;
+        }
+        for (size_t i = 0; i < expected.size(); ++i) {
+            compareReport(expected[i], actual[i], path + "[" + std::to_string(i) + "]", mismatches);
+        }
+    } else if (expected.is_number() && actual.is_number()) {
+        const double want = expected.get<double>(), got = actual.get<double>();
+        if (!(std::fabs(got - want) <= 1e-9 * std::max(1.0, std::fabs(want)))) {
+            mismatches.push_back(path + ": " + actual.dump() + ", expected " + expected.dump());
+        }
+    } else if (expected != actual) {
+        mismatches.push_back(path + ": " + actual.dump() + ", expected " + expected.dump());
+    }
+}
+
+int runAnalyze(const AnalyzeConfig& config) {
+    json rulesSpec = {{"aois", json::array()}, {"rules", json::array()}};
+    if (!config.rulesPath.empty()) {
+        std::ifstream file(config.rulesPath);
+        if (!file) throw std::runtime_error("cannot open " + config.rulesPath);
+        rulesSpec = json::parse(file);
+    }
+    const GazeRuleSet rulesTemplate = GazeRuleSet::fromJson(rulesSpec);
+
+    std::vector<std::string> files;
+    for (const std::string& input : config.inputs) collectInputs(input, files);
+    if (files.empty()) throw std::invalid_argument("no session files given");
+
+    // Largest first, so the long sessions are not the ones left running at the end
+    std::vector<std::unique_ptr<Session>> sessions;
+    for (const std::string& path : files) {
+        sessions.push_back(std::make_unique<Session>());
+        sessions.back()->path = path;
+        sessions.back()->bytes = std::filesystem::file_size(path);
+    }
+    std::stable_sort(sessions.begin(), sessions.end(),
+                     [](const auto& a, const auto& b) { return a->bytes > b->bytes; });
+    labelSessions(config.manifestPath, sessions);
+
+    const auto started = std::chrono::steady_clock::now();
+    Analyzer analyzer(config, rulesSpec, rulesTemplate);
+    uint64_t steals = 0;
+    {
+        WorkStealingPool pool(config.threads);
+        for (auto& session : sessions) {
+            Session* target = session.get();
+            pool.submit([&analyzer, &pool, target] {
+                try {
+                    analyzer.plan(pool, *target);
+                } catch (const std::exception& e) {
+                    target->error = e.what();
+                }
+            });
+        }
+        pool.wait();
+        steals = pool.steals();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    Metrics aggregate;
+    aggregate.resize(rulesTemplate.aoiCount(), rulesTemplate.ruleCount());
+    json report;
+    report["sessions"] = json::array();
+    size_t chunks = 0, failed = 0;
+    for (const auto& session : sessions) {
+        json entry = {{"file", session->path}, {"participant", session->participant}, {"condition", session->condition}};
+        if (!session->error.empty()) {
+            entry["error"] = session->error;
+            failed++;
+        } else {
+            entry.update(session->total.toJson(rulesTemplate, true));
+            entry["chunks"] = session->chunks.size();
+            aggregate.add(session->total);
+        }
+        chunks += session->chunks.size();
+        report["sessions"].push_back(entry);
+    }
+    report["aggregate"] = aggregate.toJson(rulesTemplate, false);
+    report["aggregate"]["sessions"] = sessions.size() - failed;
+    report["aggregate"]["failed"] = failed;
+    report["run"] = {
+        {"threads", config.threads},
+        {"chunks", chunks},
+        {"steals", steals},
+        {"seconds", seconds},
+        {"samples_per_second", seconds > 0.0 ? aggregate.samples / seconds : 0.0}
+    };
+
+    if (config.outPath.empty()) {
+        std::cout << report.dump(2) << std::endl;
+    } else {
+        std::ofstream out(config.outPath);
+        if (!out) throw std::runtime_error("cannot write " + config.outPath);
+        out << report.dump(2) << std::endl;
+    }
+    if (!config.columnsPath.empty()) writeColumns(config.columnsPath, sessions, rulesTemplate);
+    std::cerr << "Analyzed " << sessions.size() - failed << " sessions (" << chunks << " chunks, "
+              << aggregate.samples << " samples) in " << seconds << " s on " << config.threads << " threads"
+              << (failed ? ", " + std::to_string(failed) + " failed" : std::string()) << std::endl;
+
+    if (!config.expectPath.empty()) {
+        std::vector<std::string> mismatches;
+        compareReport(json::parse(readFile(config.expectPath)), report, "report", mismatches);
+        for (const std::string& mismatch : mismatches) std::cerr << "Mismatch: " << mismatch << std::endl;
+        if (!mismatches.empty()) return 1;
+    }
+    return failed ? 2 : 0;
+}
+
+struct GroupByConfig {
+    std::string input;
+    std::string outPath;                // empty = stdout
+    std::string format = "table";       // table, csv, json or columns
+    std::string expectPath;             // text the printed result must equal; empty = no check
+    std::vector<std::string> keys;
+    std::vector<GroupAggregate> aggregates;
+};
+
+std::vector<std::string> splitList(const std::string& text) {
+    std::vector<std::string> items;
+    size_t start = 0;
+    while (start <= text.size()) {
+        const size_t comma = std::min(text.find(',', start), text.size());
+        if (comma > start) items.push_back(text.substr(start, comma - start));
+        start = comma + 1;
+    }
+    return items;
+}
+
+void printTable(std::ostream& out, const ColumnarTable& table, const std::string& format) {
+    if (format == "json") {
+        json rows = json::array();
+        for (size_t row = 0; row < table.rows(); ++row) {
+            json entry = json::object();
+            for (size_t c = 0; c < table.columnCount(); ++c) {
+                const Column& column = table.column(c);
+                if (column.type == ColumnType::Dictionary) entry[column.name] = column.text(row);
+                else if (column.type == ColumnType::UInt64) entry[column.name] = column.integers[row];
+                else entry[column.name] = std::isnan(column.reals[row]) ? json(nullptr) : json(column.reals[row]);
+            }
+            rows.push_back(entry);
+        }
+        out << rows.dump(2) << std::endl;
+        return;
+    }
+
+    std::vector<std::vector<std::string>> cells(table.rows() + 1);
+    std::vector<size_t> widths(table.columnCount(), 0);
+    for (size_t c = 0; c < table.columnCount(); ++c) {
+        cells[0].push_back(table.column(c).name);
+        for (size_t row = 0; row < table.rows(); ++row) cells[row + 1].push_back(table.column(c).text(row));
+        for (const auto& line : cells) widths[c] = std::max(widths[c], line[c].size());
+    }
+    for (const auto& line : cells) {
+        for (size_t c = 0; c < line.size(); ++c) {
+            if (format == "csv") {
+                out << (c ? "," : "") << line[c];
+            } else {
+                out << (c ? "  " : "") << line[c] << std::string(c + 1 < line.size() ? widths[c] - line[c].size() : 0, ' ');
+            }
+        }
+        out << '\n';
+    }
+}
+
+int runGroupBy(const GroupByConfig& config) {
+    const auto started = std::chrono::steady_clock::now();
+    const ColumnarTable table = ColumnarTable::read(config.input);
+    const ColumnarTable result = groupBy(table, config.keys, config.aggregates);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+
+    if (config.format == "columns") {
+        if (config.outPath.empty()) throw std::invalid_argument("--format columns needs --out");
+        result.write(config.outPath);
+    } else if (config.outPath.empty()) {
+        printTable(std::cout, result, config.format);
+    } else {
+        std::ofstream out(config.outPath);
+        if (!out) throw std::runtime_error("cannot write " + config.outPath);
+        printTable(out, result, config.format);
+    }
+    std::cerr << "Grouped " << table.rows() << " rows into " << result.rows() << " groups in " << seconds << " s" << std::endl;
+
+    if (!config.expectPath.empty()) {
+        std::ostringstream printed;
+        printTable(printed, result, config.format);
+        if (printed.str() != readFile(config.expectPath)) {
+            std::cerr << "Mismatch: result differs from " << config.expectPath << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void printUsage() {
+    std::cout <<
+        "Usage: tobii_bridge_tool analyze [options] <session.jsonl | directory>...\n"
+        "  --rules <file>             set-rules JSON; AOIs in 0-1 display units\n"
+        "  --out <file>               Write the report here (default stdout)\n"
+        "  --columns <file>           Also write one row per session and AOI as a columnar table\n"
+        "  --manifest <file>          JSON list of {file, participant, condition} (default: file stem, directory)\n"
+        "  --threads <n>              Worker threads (default: hardware concurrency)\n"
+        "  --chunk-mb <n>             Split files into chunks of about n MB (default 8, 0 = whole files)\n"
+        "  --overlap-ms <n>           Samples replayed before each chunk to warm up (default 2000)\n"
+        "  --gaze-space <unit|centered>  How the recording's source normalized gaze (default unit)\n"
+        "  --gaze-smoothing <f>       Exponential smoothing as filters.gaze_smoothing (default 0)\n"
+        "  --velocity-threshold <f>   Saccade velocity in display widths per second (default 0.7)\n"
+        "  --min-fixation-ms <n>      Shortest fixation reported (default 100)\n"
+        "  --max-gap-ms <n>           Longest tracking gap bridged inside an event (default 75)\n"
+        "  --expect <file>            Fail unless the report contains every value in this JSON\n"
+        "\n"
+        "       tobii_bridge_tool groupby [options] <table>\n"
+        "  --by <col,...>             Group by these dictionary columns (default: none, one group)\n"
+        "  --agg <spec,...>           count, or sum|mean|min|max:<column> (default count)\n"
+        "  --format <table|csv|json|columns>  Output format (default table; columns needs --out)\n"
+        "  --out <file>               Write the result here (default stdout)\n"
+        "  --expect <file>            Fail unless the printed result equals this file\n";
+}
+
+int groupByMain(int argc, char* argv[]) {
+    GroupByConfig config;
+    try {
+        for (int i = 2; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--by") {
+                for (const std::string& key : splitList(next())) config.keys.push_back(key);
+            }
+            else if (arg == "--agg") {
+                for (const std::string& spec : splitList(next())) config.aggregates.push_back(GroupAggregate::parse(spec));
+            }
+            else if (arg == "--out") config.outPath = next();
+            else if (arg == "--expect") config.expectPath = next();
+            else if (arg == "--format") {
+                config.format = next();
+                if (config.format != "table" && config.format != "csv" && config.format != "json" && config.format != "columns") {
+                    throw std::invalid_argument("format must be table, csv, json or columns");
+                }
+            }
+            else if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+            else if (arg.rfind("--", 0) == 0) throw std::invalid_argument("unknown option " + arg);
+            else if (config.input.empty()) config.input = arg;
+            else throw std::invalid_argument("groupby takes one table");
+        }
+        if (config.input.empty()) throw std::invalid_argument("no table given");
+        if (config.aggregates.empty()) config.aggregates.push_back(GroupAggregate::parse("count"));
+        if (!config.expectPath.empty() && config.format == "columns") {
+            throw std::invalid_argument("--expect needs a table, csv or json result");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid arguments: " << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    try {
+        return runGroupBy(config);
+    } catch (const std::exception& e) {
+        std::cerr << "Group-by failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
+
+} // namespace
+
+/**
+ * Main entry point
+ */
+int main(int argc, char* argv[]) {
+    const std::string command = argc < 2 ? "" : argv[1];
+    if (command == "groupby") return groupByMain(argc, argv);
+    if (command != "analyze") {
+        printUsage();
+        return argc < 2 ? 0 : 1;
+    }
+
+    AnalyzeConfig config;
+    try {
+        for (int i = 2; i < argc; ++i) {
+            const std::string arg = argv[i];
+            auto next = [&]() -> std::string {
+                if (i + 1 >= argc) throw std::invalid_argument("missing value for " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "--rules") config.rulesPath = next();
+            else if (arg == "--out") config.outPath = next();
+            else if (arg == "--columns") config.columnsPath = next();
+            else if (arg == "--manifest") config.manifestPath = next();
+            else if (arg == "--expect") config.expectPath = next();
+            else if (arg == "--threads") config.threads = static_cast<size_t>(std::max(1, std::stoi(next())));
+            else if (arg == "--chunk-mb") config.chunkBytes = static_cast<size_t>(std::max(0, std::stoi(next()))) << 20;
+            else if (arg == "--overlap-ms") config.overlapMs = static_cast<uint64_t>(std::max(0, std::stoi(next())));
+            else if (arg == "--gaze-smoothing") config.gazeSmoothing = std::stof(next());
+            else if (arg == "--velocity-threshold") config.classifier.velocityThreshold = std::stof(next());
+            else if (arg == "--min-fixation-ms") config.classifier.minFixationMs = static_cast<uint64_t>(std::max(0, std::stoi(next())));
+            else if (arg == "--max-gap-ms") config.classifier.maxGapMs = static_cast<uint64_t>(std::max(0, std::stoi(next())));
+            else if (arg == "--gaze-space") {
+                const std::string space = next();
+                if (space != "unit" && space != "centered") throw std::invalid_argument("gaze space must be unit or centered");
+                config.gazeSpace = space == "centered" ? GazeSpace::Centered : GazeSpace::Unit;
+            }
+            else if (arg == "--help" || arg == "-h") { printUsage(); return 0; }
+            else if (arg.rfind("--", 0) == 0) throw std::invalid_argument("unknown option " + arg);
+            else config.inputs.push_back(arg);
+        }
+        if (config.gazeSmoothing < 0.0f || config.gazeSmoothing >= 1.0f) {
+            throw std::invalid_argument("gaze smoothing must be in [0, 1)");
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Invalid arguments: " << e.what() << std::endl;
+        printUsage();
+        return 1;
+    }
+
+    try {
+        return runAnalyze(config);
+    } catch (const std::exception& e) {
+        std::cerr << "Analyze failed: " << e.what() << std::endl;
+        return 1;
+    }
+}
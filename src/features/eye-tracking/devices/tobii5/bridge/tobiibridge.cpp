@@ -0,0 +1,424 @@
+/**
+ * Tobii Bridge C API
+ * The handle behind include/tobiibridge.h: a BridgeCore driven by the
+ * caller's tick() or a thread of its own, gaze rules on every published
+ * sample and a bounded queue of their events. No exception crosses the API
+ */
+
+#include "tobiibridge.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <nlohmann/json.hpp>
+
+#include "bridge-core.hpp"
+#include "display-mapper.hpp"
+#include "gaze-rules.hpp"
+
+// The sample struct is the start of the ring slot itself, so tobiibridge_sample_at hands
+// out core memory; the pose after it is read with tobiibridge_read_pose
+#define TOBIIBRIDGE_SAME_FIELD(c, cpp) \
+    static_assert(offsetof(tobiibridge_sample, c) == offsetof(TobiiDataPacket, cpp), "tobiibridge_sample." #c " moved")
+static_assert(sizeof(bool) == 1, "flags are bytes in tobiibridge_sample");
+static_assert(sizeof(tobiibridge_sample) <= sizeof(TobiiDataPacket), "tobiibridge_sample outgrew the ring slot");
+static_assert(offsetof(tobiibridge_sample, quality) + sizeof(float) <= offsetof(TobiiDataPacket, headQuatW),
+              "tobiibridge_sample overlaps the pose");
+TOBIIBRIDGE_SAME_FIELD(timestamp, timestamp);
+TOBIIBRIDGE_SAME_FIELD(has_gaze, hasGaze);
+TOBIIBRIDGE_SAME_FIELD(gaze_x, gazeX);
+TOBIIBRIDGE_SAME_FIELD(gaze_y, gazeY);
+TOBIIBRIDGE_SAME_FIELD(gaze_timestamp, gazeTimestamp);
+TOBIIBRIDGE_SAME_FIELD(gaze_confidence, gazeConfidence);
+TOBIIBRIDGE_SAME_FIELD(gaze_display, gazeDisplay);
+TOBIIBRIDGE_SAME_FIELD(gaze_screen_x, gazeScreenX);
+TOBIIBRIDGE_SAME_FIELD(gaze_screen_y, gazeScreenY);
+TOBIIBRIDGE_SAME_FIELD(gaze_screen_u, gazeScreenU);
+TOBIIBRIDGE_SAME_FIELD(gaze_screen_v, gazeScreenV);
+TOBIIBRIDGE_SAME_FIELD(has_head, hasHead);
+TOBIIBRIDGE_SAME_FIELD(head_yaw, headYaw);
+TOBIIBRIDGE_SAME_FIELD(head_pitch, headPitch);
+TOBIIBRIDGE_SAME_FIELD(head_roll, headRoll);
+TOBIIBRIDGE_SAME_FIELD(head_x, headPosX);
+TOBIIBRIDGE_SAME_FIELD(head_y, headPosY);
+TOBIIBRIDGE_SAME_FIELD(head_z, headPosZ);
+TOBIIBRIDGE_SAME_FIELD(head_confidence, headConfidence);
+TOBIIBRIDGE_SAME_FIELD(present, present);
+TOBIIBRIDGE_SAME_FIELD(predicted, predicted);
+TOBIIBRIDGE_SAME_FIELD(prediction_horizon_ms, predictionHorizonMs);
+TOBIIBRIDGE_SAME_FIELD(quality, overallQuality);
+#undef TOBIIBRIDGE_SAME_FIELD
+
+static_assert(TOBIIBRIDGE_RING_CAPACITY == BridgeCore::RING_CAPACITY, "ring capacity differs");
+static_assert(TOBIIBRIDGE_HISTORY_CHANNELS == HISTORY_CHANNEL_COUNT, "history channels differ");
+static_assert(TOBIIBRIDGE_STREAM_GAZE == STREAM_GAZE && TOBIIBRIDGE_STREAM_HEAD == STREAM_HEAD &&
+              TOBIIBRIDGE_STREAM_PRESENCE == STREAM_PRESENCE, "stream bits differ");
+static_assert(sizeof(tobiibridge_event::rule) > GazeRuleSet::MAX_NAME &&
+              sizeof(tobiibridge_event::aoi) > GazeRuleSet::MAX_NAME, "rule names do not fit");
+
+struct tobiibridge {
+    static constexpr size_t MAX_EVENTS = 256;
+
+    BridgeCore core;
+    const int loopIntervalMs;
+
+    // Driving state: watchdog, rules and events are touched under stateMutex
+    // (the source update itself runs outside it); `published` is signalled
+    // with every sample and on stop
+    mutable std::mutex stateMutex;
+    std::condition_variable published;
+    GazeRuleSet rules;
+    bool hasRules = false;
+    std::array<tobiibridge_event, MAX_EVENTS> events;
+    size_t eventHead = 0;
+    size_t eventCount = 0;
+    uint64_t eventsDropped = 0;
+
+    // Who drives: tick() holds driveMutex for its whole step, start() and
+    // stop() while they launch or join the thread, so a caller's tick never
+    // overlaps another or the bridge's own. `started` is set once the
+    // thread runs
+    std::mutex driveMutex;
+    std::thread thread;
+    std::atomic<bool> started{false};
+    bool stopping = false;
+
+    tobiibridge(std::unique_ptr<TrackerSource> source, const BridgeConfig& config)
+        : core(std::move(source)), loopIntervalMs(config.loopIntervalMs) {
+        core.configure(config);
+    }
+};
+
+namespace {
+
+thread_local std::string lastError;
+
+int fail(int code, const std::string& message) {
+    lastError = message;
+    return code;
+}
+
+/**
+ * Run body, turning an escaping exception into `failure` and the last error
+ */
+template <typename Result, typename Body>
+Result guarded(Result failure, Body&& body) {
+    try {
+        return body();
+    } catch (const std::exception& e) {
+        lastError = e.what();
+    } catch (...) {
+        lastError = "unknown error";
+    }
+    return failure;
+}
+
+void copyName(char* out, size_t size, const char* name) {
+    std::strncpy(out, name ? name : "", size - 1);
+    out[size - 1] = '\0';
+}
+
+void queueEvent(tobiibridge& bridge, const GazeRuleEvent& event) {
+    if (bridge.eventCount == tobiibridge::MAX_EVENTS) {
+        // A consumer that stopped polling loses the oldest events, not the newest
+        bridge.eventHead = (bridge.eventHead + 1) % tobiibridge::MAX_EVENTS;
+        bridge.eventCount--;
+        bridge.eventsDropped++;
+    }
+    tobiibridge_event& out = bridge.events[(bridge.eventHead + bridge.eventCount++) % tobiibridge::MAX_EVENTS];
+    copyName(out.rule, sizeof(out.rule), event.rule);
+    copyName(out.kind, sizeof(out.kind), event.kind);
+    copyName(out.aoi, sizeof(out.aoi), event.aoi);
+    out.timestamp = event.timestamp;
+    out.duration_ms = event.duration;
+    out.value = event.value;
+}
+
+/**
+ * Rules see gaze in unit coordinates on the tracked display (stateMutex held)
+ */
+void evaluateRules(tobiibridge& bridge) {
+    const TobiiDataPacket& sample = bridge.core.latest();
+    GazeRulePoint point;
+    point.timestamp = sample.timestamp;
+    point.hasGaze = sample.hasGaze;
+    point.present = sample.present;
+    point.x = sample.gazeX;
+    point.y = sample.gazeY;
+    unitGaze(bridge.core.gazeSpace(), point.x, point.y);
+    point.onScreen = point.x >= 0.0f && point.x <= 1.0f && point.y >= 0.0f && point.y <= 1.0f;
+    bridge.rules.evaluate(point, [&bridge](const GazeRuleEvent& event) { queueEvent(bridge, event); });
+}
+
+/**
+ * One tick on the driving thread, as the server's main loop does it
+ */
+int64_t step(tobiibridge& bridge) {
+    BridgeCore& core = bridge.core;
+    std::string error;
+    if (!core.connected()) {
+        if (!core.retryDue()) return fail(TOBIIBRIDGE_ERROR_SOURCE, "tracker source lost");
+        const bool initialized = core.reinitialize(error);
+        std::lock_guard<std::mutex> lock(bridge.stateMutex);
+        if (!initialized) {
+            core.retryFailed();
+            return fail(TOBIIBRIDGE_ERROR_SOURCE, error.empty() ? "tracker source did not reinitialize" : error);
+        }
+        core.restored();
+    }
+
+    const char* lost = core.pollSource(error);
+    std::unique_lock<std::mutex> lock(bridge.stateMutex);
+    if (!lost && core.stale(core.process())) lost = "stale";
+    if (lost) {
+        core.markLost(lost);
+        return fail(TOBIIBRIDGE_ERROR_SOURCE, std::string("tracker source lost (") + lost + ")" +
+                                                  (error.empty() ? "" : ": " + error));
+    }
+
+    const uint64_t sequence = core.publish();
+    if (bridge.hasRules) evaluateRules(bridge);
+    lock.unlock();
+    bridge.published.notify_all();
+    return static_cast<int64_t>(sequence);
+}
+
+void driveLoop(tobiibridge* bridge) {
+    const auto interval = std::chrono::milliseconds(bridge->loopIntervalMs);
+    auto next = std::chrono::steady_clock::now();
+    std::unique_lock<std::mutex> lock(bridge->stateMutex);
+    while (!bridge->stopping) {
+        lock.unlock();
+        step(*bridge);
+        next += interval;
+        // A late tick does not cause a burst of catch-up ticks
+        next = std::max(next, std::chrono::steady_clock::now());
+        lock.lock();
+        bridge->published.wait_until(lock, next, [bridge] { return bridge->stopping; });
+    }
+}
+
+} // namespace
+
+extern "C" {
+
+int tobiibridge_api_version(void) {
+    return TOBIIBRIDGE_API_VERSION;
+}
+
+const char* tobiibridge_last_error(void) {
+    return lastError.c_str();
+}
+
+tobiibridge* tobiibridge_open(const char* source, const char* options_json) {
+    return guarded<tobiibridge*>(nullptr, [&]() -> tobiibridge* {
+        if (!source) {
+            fail(TOBIIBRIDGE_ERROR_ARGUMENT, "source is required");
+            return nullptr;
+        }
+        nlohmann::json options = options_json ? nlohmann::json::parse(options_json) : nlohmann::json::object();
+        if (!options.is_object()) throw std::invalid_argument("options must be a JSON object");
+        const std::string faults = options.value("faults", "");
+        options.erase("faults");
+
+        BridgeConfig config;
+        config.merge(options);
+        config.validate();
+
+        auto bridge = std::make_unique<tobiibridge>(makeTrackerSource(source, faults, BridgeClock::system()), config);
+        // A tracker that is not there yet is retried by the watchdog
+        if (!bridge->core.initialize()) bridge->core.markLost("unavailable");
+        lastError.clear();
+        return bridge.release();
+    });
+}
+
+void tobiibridge_close(tobiibridge* bridge) {
+    if (!bridge) return;
+    tobiibridge_stop(bridge);
+    delete bridge;
+}
+
+int64_t tobiibridge_tick(tobiibridge* bridge) {
+    if (!bridge) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "bridge is NULL");
+    std::lock_guard<std::mutex> drive(bridge->driveMutex);
+    if (bridge->started) return fail(TOBIIBRIDGE_ERROR_STATE, "the bridge ticks on its own thread");
+    return guarded<int64_t>(TOBIIBRIDGE_ERROR_SOURCE, [bridge] { return step(*bridge); });
+}
+
+int tobiibridge_start(tobiibridge* bridge) {
+    if (!bridge) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "bridge is NULL");
+    std::lock_guard<std::mutex> drive(bridge->driveMutex);
+    if (bridge->started) return fail(TOBIIBRIDGE_ERROR_STATE, "already started");
+    {
+        std::lock_guard<std::mutex> lock(bridge->stateMutex);
+        bridge->stopping = false;
+    }
+    return guarded<int>(TOBIIBRIDGE_ERROR_STATE, [bridge] {
+        bridge->thread = std::thread(driveLoop, bridge);
+        bridge->started = true;
+        return TOBIIBRIDGE_OK;
+    });
+}
+
+int tobiibridge_stop(tobiibridge* bridge) {
+    if (!bridge) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "bridge is NULL");
+    std::lock_guard<std::mutex> drive(bridge->driveMutex);
+    if (!bridge->started) return TOBIIBRIDGE_OK;
+    {
+        std::lock_guard<std::mutex> lock(bridge->stateMutex);
+        bridge->stopping = true;
+    }
+    bridge->published.notify_all();
+    if (bridge->thread.joinable()) bridge->thread.join();
+    bridge->started = false;
+    return TOBIIBRIDGE_OK;
+}
+
+uint64_t tobiibridge_sequence(const tobiibridge* bridge) {
+    return bridge ? bridge->core.end() : 0;
+}
+
+int64_t tobiibridge_wait(tobiibridge* bridge, uint64_t sequence, int32_t timeout_ms) {
+    if (!bridge) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "bridge is NULL");
+    std::unique_lock<std::mutex> lock(bridge->stateMutex);
+    auto due = [bridge, sequence] { return bridge->core.end() > sequence || bridge->stopping; };
+    if (timeout_ms < 0) {
+        bridge->published.wait(lock, due);
+    } else if (!bridge->published.wait_for(lock, std::chrono::milliseconds(timeout_ms), due)) {
+        return TOBIIBRIDGE_TIMEOUT;
+    }
+    return bridge->core.end() > sequence ? static_cast<int64_t>(bridge->core.end()) : TOBIIBRIDGE_TIMEOUT;
+}
+
+const tobiibridge_sample* tobiibridge_sample_at(const tobiibridge* bridge, uint64_t sequence) {
+    if (!bridge || !bridge->core.readable(sequence)) return nullptr;
+    return reinterpret_cast<const tobiibridge_sample*>(&bridge->core.ring().at(sequence));
+}
+
+int tobiibridge_sample_valid(const tobiibridge* bridge, uint64_t sequence) {
+    return bridge && bridge->core.readable(sequence) ? 1 : 0;
+}
+
+int tobiibridge_read(const tobiibridge* bridge, uint64_t sequence, tobiibridge_sample* out) {
+    if (!bridge || !out) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "bridge and out are required");
+    if (sequence >= bridge->core.end()) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "sequence not published yet");
+    std::memcpy(out, &bridge->core.ring().at(sequence), sizeof(*out));
+    return bridge->core.readable(sequence) ? TOBIIBRIDGE_OK : fail(TOBIIBRIDGE_OVERWRITTEN, "sample was overwritten");
+}
+
+int tobiibridge_read_pose(const tobiibridge* bridge, uint64_t sequence, tobiibridge_pose* out) {
+    if (!bridge || !out) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "bridge and out are required");
+    if (sequence >= bridge->core.end()) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "sequence not published yet");
+    const TobiiDataPacket sample = bridge->core.ring().at(sequence);
+    if (!bridge->core.readable(sequence)) return fail(TOBIIBRIDGE_OVERWRITTEN, "sample was overwritten");
+
+    out->has_head = sample.hasHead ? 1 : 0;
+    out->has_gaze = sample.hasGaze ? 1 : 0;
+    const float orientation[4] = {sample.headQuatW, sample.headQuatX, sample.headQuatY, sample.headQuatZ};
+    const float rotation[9] = {sample.headRot00, sample.headRot01, sample.headRot02,
+                               sample.headRot10, sample.headRot11, sample.headRot12,
+                               sample.headRot20, sample.headRot21, sample.headRot22};
+    const float origin[3] = {sample.gazeOriginX, sample.gazeOriginY, sample.gazeOriginZ};
+    const float direction[3] = {sample.gazeDirX, sample.gazeDirY, sample.gazeDirZ};
+    std::memcpy(out->orientation, orientation, sizeof(orientation));
+    std::memcpy(out->rotation, rotation, sizeof(rotation));
+    std::memcpy(out->gaze_origin, origin, sizeof(origin));
+    std::memcpy(out->gaze_direction, direction, sizeof(direction));
+    return TOBIIBRIDGE_OK;
+}
+
+int tobiibridge_set_rules(tobiibridge* bridge, const char* rules_json) {
+    if (!bridge) return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "bridge is NULL");
+    return guarded<int>(TOBIIBRIDGE_ERROR_ARGUMENT, [bridge, rules_json] {
+        GazeRuleSet rules = rules_json ? GazeRuleSet::fromJson(nlohmann::json::parse(rules_json)) : GazeRuleSet();
+        std::lock_guard<std::mutex> lock(bridge->stateMutex);
+        bridge->rules = std::move(rules);
+        bridge->hasRules = rules_json != nullptr;
+        return TOBIIBRIDGE_OK;
+    });
+}
+
+size_t tobiibridge_poll_events(tobiibridge* bridge, tobiibridge_event* out, size_t capacity) {
+    if (!bridge || !out) return 0;
+    std::lock_guard<std::mutex> lock(bridge->stateMutex);
+    const size_t taken = std::min(capacity, bridge->eventCount);
+    for (size_t i = 0; i < taken; ++i) {
+        out[i] = bridge->events[(bridge->eventHead + i) % tobiibridge::MAX_EVENTS];
+    }
+    bridge->eventHead = (bridge->eventHead + taken) % tobiibridge::MAX_EVENTS;
+    bridge->eventCount -= taken;
+    return taken;
+}
+
+size_t tobiibridge_history(const tobiibridge* bridge, uint64_t from_ms, uint64_t to_ms, size_t points,
+                           tobiibridge_history_point* out, size_t capacity, uint64_t* point_ms) {
+    if (!bridge || (!out && capacity > 0)) return 0;
+    size_t written = 0;
+    const HistoryPyramid::Query query = bridge->core.readHistory(
+        from_ms, to_ms ? to_ms : bridge->core.historyNewest(), points, [&](const HistoryBucket& bucket) {
+            if (written == capacity) return;
+            tobiibridge_history_point& point = out[written++];
+            point.start_ms = bucket.startMs;
+            point.samples = bucket.samples;
+            point.present = bucket.samples ? static_cast<float>(bucket.present) / bucket.samples : 0.0f;
+            for (size_t c = 0; c < HISTORY_CHANNEL_COUNT; ++c) {
+                const HistoryStat& stat = bucket.channels[c];
+                point.count[c] = stat.count;
+                point.min[c] = stat.count ? stat.min : 0.0f;
+                point.max[c] = stat.count ? stat.max : 0.0f;
+                point.mean[c] = static_cast<float>(stat.mean());
+            }
+        });
+    if (point_ms) *point_ms = query.widthMs;
+    return written;
+}
+
+int tobiibridge_get_stats(const tobiibridge* bridge, tobiibridge_stats* stats) {
+    if (!bridge || !stats || stats->struct_size < offsetof(tobiibridge_stats, samples_processed)) {
+        return fail(TOBIIBRIDGE_ERROR_ARGUMENT, "stats.struct_size must be set");
+    }
+    tobiibridge_stats current;
+    std::memset(&current, 0, sizeof(current));
+    {
+        std::lock_guard<std::mutex> lock(bridge->stateMutex);
+        const TrackerWatchdog& watchdog = bridge->core.watchdog();
+        current.connected = !watchdog.sourceLost();
+        current.outages = watchdog.outageCount();
+        current.outage_ms = watchdog.totalOutageMs();
+        current.events_pending = bridge->eventCount;
+        current.events_dropped = bridge->eventsDropped;
+    }
+    current.gaze_centered = bridge->core.gazeSpace() == GazeSpace::Centered;
+    current.samples_processed = bridge->core.processedCount();
+    current.samples_published = bridge->core.end();
+    current.history_first_ms = bridge->core.historyFirst();
+    current.history_newest_ms = bridge->core.historyNewest();
+
+    // Callers built against an older, shorter struct get its prefix
+    const uint32_t size = std::min<uint32_t>(stats->struct_size, sizeof(current));
+    current.struct_size = size;
+    std::memcpy(stats, &current, size);
+    return TOBIIBRIDGE_OK;
+}
+
+size_t tobiibridge_encode(const tobiibridge_sample* sample, int format, uint32_t streams, char* out, size_t capacity) {
+    if (!sample || !out || format < 0 || format >= static_cast<int>(SAMPLE_FORMAT_COUNT)) return 0;
+    // The caller's struct is only the slot's prefix; the pose after it is not encoded
+    TobiiDataPacket packet{};
+    std::memcpy(&packet, sample, sizeof(tobiibridge_sample));
+    return BridgeCore::encode(packet, static_cast<SampleFormat>(format), streams & STREAM_ALL & ~STREAM_POSE, out,
+                              capacity);
+}
+
+} // extern "C"
@@ -432,7 +432,8 @@ export const createTobii5CognitiveIntegration = (tobiiDevice, cognitiveSystem) =
    * Calculate attention area from gaze position
    */
   const calculateAttentionArea = (gaze) => {
-    if (!gaze || !gaze.valid) return null;
+    // Needs the bridge's display mapping (remote client `displays` config)
+    if (!gaze || !gaze.valid || !gaze.screen) return null;
 
     // Define attention regions (example for typical screen layout)
     const regions = {
@@ -443,10 +444,9 @@ export const createTobii5CognitiveIntegration = (tobiiDevice, cognitiveSystem) =
       'bottom': { x: 0, y: 0.7, width: 1, height: 0.3 }
     };
 
-    // Convert gaze to normalized coordinates (0-1)
-    // This would need actual screen dimensions in a real implementation
-    const normalizedX = gaze.x / 1920; // Assuming 1920px width
-    const normalizedY = gaze.y / 1080; // Assuming 1080px height
+    // Position within the display the gaze is on (0-1)
+    const normalizedX = gaze.screen.u;
+    const normalizedY = gaze.screen.v;
 
     for (const [region, bounds] of Object.entries(regions)) {
       if (normalizedX >= bounds.x && normalizedX <= bounds.x + bounds.width &&
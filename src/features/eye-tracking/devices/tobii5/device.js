@@ -81,6 +81,7 @@ export const createTobii5Device = (config = {}) => {
       gaze: tobiiData.gaze ? {
         x: tobiiData.gaze.x,
         y: tobiiData.gaze.y,
+        screen: tobiiData.gaze.screen,
         valid: tobiiData.gaze.valid,
         confidence: tobiiData.quality.gazeConfidence
       } : null,
@@ -234,7 +235,8 @@ export const createTobii5Device = (config = {}) => {
       }
 
       try {
-        const result = remoteClient.enableRecording(true);
+        const recordingName = String(recordingId).replace(/[^A-Za-z0-9_.:-]/g, '_').slice(0, 63);
+        const result = remoteClient.enableRecording(true, recordingName);
         
         if (result.success) {
           state.recordingSession = {
@@ -314,6 +316,9 @@ export const createTobii5Device = (config = {}) => {
       };
     },
 
+    // Stamp an external event into the gaze timeline and any active recording
+    sendMarker: (label, options) => remoteClient.sendMarker(label, options),
+
     // Calibration interface (for calibration controller)
     startCalibration: async (calibrationConfig = {}) => {
       logger.info(`Starting Tobii 5 calibration: ${deviceId}`);
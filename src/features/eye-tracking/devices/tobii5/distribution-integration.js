@@ -330,14 +330,12 @@ export const createTobii5DistributionIntegration = (tobiiDevice, distributionSys
    * Calculate attention area from gaze position
    */
   const calculateAttentionArea = (gaze) => {
-    if (!gaze || !gaze.valid) return null;
+    // Needs the bridge's display mapping (remote client `displays` config)
+    if (!gaze || !gaze.valid || !gaze.screen) return null;
 
-    // Simple screen region calculation
-    const screenWidth = 1920; // Would be configurable
-    const screenHeight = 1080;
-    
-    const normalizedX = gaze.x / screenWidth;
-    const normalizedY = gaze.y / screenHeight;
+    // Position within the display the gaze is on (0-1)
+    const normalizedX = gaze.screen.u;
+    const normalizedY = gaze.screen.v;
 
     if (normalizedX >= 0.3 && normalizedX <= 0.7 && normalizedY >= 0.3 && normalizedY <= 0.7) {
       return 'center';
@@ -6,6 +6,7 @@
 
 import { EventEmitter } from 'events';
 import { createLogger } from '../../../../shared/utils/logger.js';
+import { decodeSample, SAMPLE_FORMATS } from './sample-decoder.js';
 
 const logger = createLogger({ level: 2, component: 'Tobii5RemoteClient' });
 
@@ -17,18 +18,42 @@ const TOBII_MESSAGE_TYPES = {
   STATUS: 'tobii-status', 
   CALIBRATION: 'tobii-calibration',
   ERROR: 'tobii-error',
-  HEARTBEAT: 'tobii-heartbeat'
+  HEARTBEAT: 'tobii-heartbeat',
+  EVENT: 'tobii-event',
+  MARKER: 'tobii-marker',
+  QUALITY: 'tobii-quality',
+  QUALITY_ALERT: 'tobii-quality-alert',
+  TOPIC: 'tobii-topic'
 };
 
+const CLOCK_SYNC_ROUNDS = 8;
+const CLOCK_SYNC_SPACING = 50;
+const CLOCK_SYNC_INTERVAL = 30000;
+
+// Sub-millisecond wall clock, comparable with the bridge's sample clock
+const clientNow = () => performance.timeOrigin + performance.now();
+
 export const createRemoteTobiiClient = (config = {}) => {
   const {
     host = 'localhost',
     port = 8080,
     reconnectInterval = 5000,
     heartbeatTimeout = 10000,
-    dataBufferSize = 100
+    dataBufferSize = 100,
+    encoding = 'json', // 'json' | 'binary' | 'quantized' sample frames
+    adaptive = false, // let the bridge lower encoding and rate when this link falls behind
+    priority = 'normal', // 'low' volunteers to be shed first when the bridge is overloaded
+    predict = false, // true or { horizonMs, extraMs }: latency-compensated samples, flagged data.predicted
+    token = null, // the bridge's admission.critical.token, to connect as a critical client
+    displays = null, // { displays: [{ x, y, width, height, scale }], tracked, units } for gaze.screen
+    topics = null, // ['gaze', 'head', 'presence', 'events', 'quality']: per-topic frames instead of samples
+    rules = null // { aois: [{ name, x, y, width, height }], rules: [{ id, type, aoi, ms, threshold }] }
   } = config;
 
+  if (!(encoding in SAMPLE_FORMATS)) {
+    throw new Error(`Unknown Tobii sample encoding: ${encoding}`);
+  }
+
   const emitter = new EventEmitter();
   const state = {
     ws: null,
@@ -43,15 +68,30 @@ export const createRemoteTobiiClient = (config = {}) => {
       packetsReceived: 0,
       packetsLost: 0,
       avgLatency: 0,
-      dataRate: 0
-    }
+      dataRate: 0 // achieved tracker rate, from the bridge's tobii-quality reports
+    },
+    quality: null,
+    qualityAlerts: {},
+    rate: null, // the bridge's current output for this client, when adaptive
+    load: null, // load shedding applied to this client, from the bridge
+    tracker: null // the bridge's tracker source health, from its watchdog
+  };
+
+  // Offset from this client's clock to the bridge's sample clock (bridge = client + offset)
+  const clockSync = {
+    synced: false,
+    offset: 0,
+    rtt: Infinity,
+    rounds: [],
+    collecting: false,
+    timer: null
   };
 
   const latencyBuffer = [];
-  let lastSecondPackets = 0;
-  let dataRateTimer = null;
 
-  const wsUrl = `ws://${host}:${port}`;
+  const wsUrl = token ? `ws://${host}:${port}/?token=${encodeURIComponent(token)}` : `ws://${host}:${port}`;
+  let displayGeometry = displays;
+  let gazeRules = rules;
 
   /**
    * Connect to Tobii bridge
@@ -70,6 +110,7 @@ export const createRemoteTobiiClient = (config = {}) => {
       const WebSocket = WebSocketModule.default || WebSocketModule.WebSocket;
 
       state.ws = new WebSocket(wsUrl);
+      state.ws.binaryType = 'arraybuffer';
 
       return new Promise((resolve, reject) => {
         const timeout = setTimeout(() => {
@@ -84,8 +125,25 @@ export const createRemoteTobiiClient = (config = {}) => {
           state.lastHeartbeat = Date.now();
           
           logger.info('✅ Connected to Tobii bridge');
+          if (encoding !== 'json' || adaptive || priority !== 'normal' || predict || topics) {
+            sendCommand('subscribe', {
+              format: encoding,
+              ...(topics && { topics }),
+              ...(adaptive && { adaptive: true }),
+              ...(priority !== 'normal' && { priority }),
+              ...(predict && {
+                predict: predict === true ? true : { horizon_ms: predict.horizonMs ?? 'auto', extra_ms: predict.extraMs ?? 0 }
+              })
+            });
+          }
+          if (displayGeometry) {
+            sendCommand('set-display', displayGeometry);
+          }
+          if (gazeRules) {
+            sendCommand('set-rules', gazeRules);
+          }
+          startClockSync();
           setupHeartbeatMonitor();
-          startDataRateMonitoring();
           emitter.emit('connected');
           
           resolve({ success: true });
@@ -128,10 +186,7 @@ export const createRemoteTobiiClient = (config = {}) => {
       state.heartbeatTimer = null;
     }
 
-    if (dataRateTimer) {
-      clearInterval(dataRateTimer);
-      dataRateTimer = null;
-    }
+    stopClockSync();
 
     if (state.ws) {
       state.ws.close();
@@ -149,7 +204,8 @@ export const createRemoteTobiiClient = (config = {}) => {
    */
   const handleMessage = (data) => {
     try {
-      const message = JSON.parse(data);
+      // Text frames are JSON; binary frames are sample-decoder.js encodings
+      const message = typeof data === 'string' ? JSON.parse(data) : decodeSample(data);
       const receiveTime = Date.now();
       
       // Calculate latency
@@ -162,7 +218,6 @@ export const createRemoteTobiiClient = (config = {}) => {
       }
 
       state.stats.packetsReceived++;
-      lastSecondPackets++;
 
       switch (message.type) {
       case TOBII_MESSAGE_TYPES.DATA:
@@ -177,6 +232,33 @@ export const createRemoteTobiiClient = (config = {}) => {
         handleCalibrationMessage(message);
         break;
           
+      case TOBII_MESSAGE_TYPES.MARKER:
+        emitter.emit('marker', message.marker);
+        break;
+          
+      case TOBII_MESSAGE_TYPES.QUALITY:
+        state.quality = { ...message.quality, timestamp: message.timestamp };
+        state.stats.dataRate = message.quality.rate_hz;
+        // Reports list the raised alerts, so state missed while disconnected catches up
+        for (const metric of Object.keys(state.qualityAlerts)) {
+          if (!message.quality.alerts.includes(metric)) delete state.qualityAlerts[metric];
+        }
+        emitter.emit('quality', state.quality);
+        break;
+          
+      case TOBII_MESSAGE_TYPES.QUALITY_ALERT:
+        handleQualityAlert(message);
+        break;
+          
+      case TOBII_MESSAGE_TYPES.TOPIC:
+        emitter.emit('topic', message);
+        emitter.emit(`topic:${message.topic}`, message);
+        break;
+          
+      case TOBII_MESSAGE_TYPES.EVENT:
+        emitter.emit('gaze-event', { ...message.event, timestamp: message.timestamp });
+        break;
+          
       case TOBII_MESSAGE_TYPES.HEARTBEAT:
         state.lastHeartbeat = receiveTime;
         break;
@@ -218,6 +300,8 @@ export const createRemoteTobiiClient = (config = {}) => {
         x: data.gaze.x,
         y: data.gaze.y,
         timestamp: data.gaze.timestamp,
+        // Bridge-mapped position on the registered display layout (setDisplayGeometry)
+        screen: data.gaze.screen || null,
         valid: data.hasGaze || false
       } : null,
       
@@ -261,10 +345,58 @@ export const createRemoteTobiiClient = (config = {}) => {
    * Handle status messages from bridge
    */
   const handleStatusMessage = (message) => {
+    if (message.status?.clock) {
+      handleClockSyncReply(message.status.clock);
+    }
+    if (message.status?.rate) {
+      handleRateChange(message.status.rate);
+    }
+    if (message.status?.load) {
+      state.load = { ...message.status.load, timestamp: Date.now() };
+      if (state.load.shed) {
+        logger.warn(`Tobii bridge overloaded, output reduced to ${state.load.format} 1/${state.load.decimation}`);
+      }
+      emitter.emit('load', state.load);
+    }
+    if (message.status?.tracker) {
+      state.tracker = { ...message.status.tracker, timestamp: Date.now() };
+      if (!state.tracker.connected) {
+        logger.warn(`Tobii tracker lost (${state.tracker.reason}), bridge is retrying`);
+      }
+      emitter.emit('tracker', state.tracker);
+    }
+    if (message.status?.marker_error) {
+      logger.warn('Tobii bridge rejected marker:', message.status.marker_error);
+    }
     logger.debug('Tobii bridge status update:', message.status);
     emitter.emit('status', message.status);
   };
 
+  /**
+   * Follow the output the bridge chose for this link; binary frames decode
+   * whichever encoding it switches to
+   */
+  const handleRateChange = (rate) => {
+    state.rate = { ...rate, timestamp: Date.now() };
+    logger.info(`Tobii bridge output now ${rate.format} 1/${rate.decimation} (${rate.reason})`);
+    emitter.emit('rate', state.rate);
+  };
+
+  /**
+   * Track raised quality alerts and pass changes on
+   */
+  const handleQualityAlert = (message) => {
+    const { alert } = message;
+    if (alert.state === 'raised') {
+      state.qualityAlerts[alert.metric] = { ...alert, timestamp: message.timestamp };
+      logger.warn(`Tobii tracking quality alert: ${alert.metric} ${alert.value} (threshold ${alert.threshold})`);
+    } else {
+      delete state.qualityAlerts[alert.metric];
+      logger.info(`Tobii tracking quality recovered: ${alert.metric}`);
+    }
+    emitter.emit('quality-alert', { ...alert, timestamp: message.timestamp });
+  };
+
   /**
    * Handle calibration messages
    */
@@ -310,6 +442,7 @@ export const createRemoteTobiiClient = (config = {}) => {
       state.heartbeatTimer = null;
     }
 
+    stopClockSync();
     emitter.emit('disconnected');
     
     // Auto-reconnect
@@ -342,13 +475,53 @@ export const createRemoteTobiiClient = (config = {}) => {
   };
 
   /**
-   * Monitor data rate
+   * Estimate the clock offset to the bridge (NTP-style, keeping the round
+   * with the lowest round trip) and report it so markers can be stamped
+   * with client time. Repeats periodically to follow drift
    */
-  const startDataRateMonitoring = () => {
-    dataRateTimer = setInterval(() => {
-      state.stats.dataRate = lastSecondPackets;
-      lastSecondPackets = 0;
-    }, 1000);
+  const startClockSync = () => {
+    const runRounds = () => {
+      if (!state.connected) return;
+      clockSync.rounds = [];
+      clockSync.collecting = true;
+      for (let i = 0; i < CLOCK_SYNC_ROUNDS; i++) {
+        setTimeout(() => {
+          if (state.connected) {
+            sendCommand('clock-sync', { client_time: clientNow() });
+          }
+        }, i * CLOCK_SYNC_SPACING);
+      }
+    };
+
+    stopClockSync();
+    runRounds();
+    clockSync.timer = setInterval(runRounds, CLOCK_SYNC_INTERVAL);
+  };
+
+  const stopClockSync = () => {
+    if (clockSync.timer) {
+      clearInterval(clockSync.timer);
+      clockSync.timer = null;
+    }
+    clockSync.collecting = false;
+    clockSync.synced = false;
+  };
+
+  const handleClockSyncReply = (clock) => {
+    if (!clockSync.collecting || typeof clock.bridge_time !== 'number') return;
+
+    const received = clientNow();
+    const rtt = received - clock.client_time;
+    clockSync.rounds.push({ rtt, offset: clock.bridge_time - (clock.client_time + received) / 2 });
+    if (clockSync.rounds.length < CLOCK_SYNC_ROUNDS) return;
+
+    const best = clockSync.rounds.reduce((a, b) => (b.rtt < a.rtt ? b : a));
+    clockSync.collecting = false;
+    clockSync.synced = true;
+    clockSync.offset = best.offset;
+    clockSync.rtt = best.rtt;
+    sendCommand('clock-sync', { client_time: clientNow(), offset: best.offset, rtt: best.rtt });
+    emitter.emit('clockSync', { offset: best.offset, rtt: best.rtt });
   };
 
   /**
@@ -395,6 +568,43 @@ export const createRemoteTobiiClient = (config = {}) => {
     });
   };
 
+  /**
+   * Downsampled history for overview plots: min/max/mean per channel at
+   * roughly `points` points over the last spanMs (or fromMs-toMs on the
+   * bridge's sample clock). channels picks from 'gaze', 'head', 'quality'
+   */
+  const requestHistory = async ({ spanMs = 3600000, fromMs, toMs, points = 300, channels } = {}) => {
+    return new Promise((resolve, reject) => {
+      const timeout = setTimeout(() => {
+        emitter.off('status', handler);
+        reject(new Error('History request timeout'));
+      }, 10000);
+
+      const handler = (status) => {
+        if (!status.history) return;
+        clearTimeout(timeout);
+        emitter.off('status', handler);
+        resolve(status.history);
+      };
+
+      emitter.on('status', handler);
+
+      try {
+        sendCommand('get-history', {
+          span_ms: spanMs,
+          points,
+          ...(fromMs !== undefined && { from_ms: fromMs }),
+          ...(toMs !== undefined && { to_ms: toMs }),
+          ...(channels && { channels })
+        });
+      } catch (error) {
+        clearTimeout(timeout);
+        emitter.off('status', handler);
+        reject(error);
+      }
+    });
+  };
+
   /**
    * Stop calibration
    */
@@ -408,11 +618,63 @@ export const createRemoteTobiiClient = (config = {}) => {
   };
 
   /**
-   * Enable/disable recording on bridge
+   * Enable/disable recording on bridge; name sets the recording file name
    */
-  const enableRecording = (enabled) => {
+  const enableRecording = (enabled, name) => {
     try {
-      sendCommand('set-recording', { enabled });
+      sendCommand('set-recording', name ? { enabled, name } : { enabled });
+      return { success: true };
+    } catch (error) {
+      return { success: false, error: error.message };
+    }
+  };
+
+  /**
+   * Register the desktop layout gaze.screen is mapped onto (null clears it).
+   * Re-sent automatically on reconnect
+   */
+  const setDisplayGeometry = (geometry) => {
+    displayGeometry = geometry;
+    if (!state.connected) {
+      return { success: true };
+    }
+    try {
+      sendCommand('set-display', geometry);
+      return { success: true };
+    } catch (error) {
+      return { success: false, error: error.message };
+    }
+  };
+
+  /**
+   * Stamp an external event (e.g. stimulus onset) into the gaze timeline.
+   * Call it at the moment of the event: the bridge converts the client time
+   * to its sample clock once clocks are synced, else uses receipt time
+   */
+  const sendMarker = (label, { value } = {}) => {
+    const clientTime = clientNow();
+    try {
+      sendCommand('marker', value === undefined
+        ? { label, client_time: clientTime }
+        : { label, client_time: clientTime, value });
+      return { success: true, clientTime, clockSynced: clockSync.synced };
+    } catch (error) {
+      return { success: false, error: error.message };
+    }
+  };
+
+  /**
+   * Register gaze rules evaluated by the bridge (null clears them); fired
+   * rules arrive as 'gaze-event'. AOIs are in display pixels when a display
+   * geometry is set, else 0-1 on the tracked display. Re-sent on reconnect
+   */
+  const setGazeRules = (ruleSet) => {
+    gazeRules = ruleSet;
+    if (!state.connected) {
+      return { success: true };
+    }
+    try {
+      sendCommand('set-rules', ruleSet);
       return { success: true };
     } catch (error) {
       return { success: false, error: error.message };
@@ -431,7 +693,13 @@ export const createRemoteTobiiClient = (config = {}) => {
       connecting: state.connecting,
       host,
       port,
-      stats: { ...state.stats }
+      stats: { ...state.stats },
+      quality: state.quality,
+      qualityAlerts: Object.values(state.qualityAlerts),
+      rate: state.rate,
+      load: state.load,
+      tracker: state.tracker,
+      clock: { synced: clockSync.synced, offset: clockSync.offset, rtt: clockSync.rtt }
     }),
     
     // Data access
@@ -442,7 +710,11 @@ export const createRemoteTobiiClient = (config = {}) => {
     // Commands
     requestCalibration,
     stopCalibration,
+    requestHistory,
     enableRecording,
+    setDisplayGeometry,
+    setGazeRules,
+    sendMarker,
     sendCommand,
     
     // Events
@@ -461,6 +733,48 @@ export const createRemoteTobiiClient = (config = {}) => {
       return () => emitter.off('status', callback);
     },
     
+    onMarker: (callback) => {
+      emitter.on('marker', callback);
+      return () => emitter.off('marker', callback);
+    },
+    
+    onQuality: (callback) => {
+      emitter.on('quality', callback);
+      return () => emitter.off('quality', callback);
+    },
+    
+    onQualityAlert: (callback) => {
+      emitter.on('quality-alert', callback);
+      return () => emitter.off('quality-alert', callback);
+    },
+    
+    // Topic frames ({ topic, seq, timestamp, <topic>: ... }) for the topics subscribed at connect
+    onTopic: (topic, callback) => {
+      const event = topic ? `topic:${topic}` : 'topic';
+      emitter.on(event, callback);
+      return () => emitter.off(event, callback);
+    },
+    
+    onTracker: (callback) => {
+      emitter.on('tracker', callback);
+      return () => emitter.off('tracker', callback);
+    },
+    
+    onRateChange: (callback) => {
+      emitter.on('rate', callback);
+      return () => emitter.off('rate', callback);
+    },
+    
+    onLoadShedding: (callback) => {
+      emitter.on('load', callback);
+      return () => emitter.off('load', callback);
+    },
+    
+    onGazeEvent: (callback) => {
+      emitter.on('gaze-event', callback);
+      return () => emitter.off('gaze-event', callback);
+    },
+    
     onError: (callback) => {
       emitter.on('error', callback);
       return () => emitter.off('error', callback);
@@ -0,0 +1,5200 @@
+/**
+ * Tobii Sample Decoder
+ * Generated by `tobii_bridge --emit-js-decoder` from bridge/include/sample-schema.hpp.
+ * Do not edit: change the schema and regenerate.
+ *
+ * Decodes binary and quantized tobii-data frames into the same shape as the
+ * JSON message. Optional objects (gaze, head) are undefined when their flag is clear
+ */
+
+export const SAMPLE_SCHEMA_VERSION = 1;
+
+export const SAMPLE_FORMATS = Object.freeze({ json: 0, binary: 1, quantized: 2 });
+
+export const SAMPLE_STREAMS = Object.freeze({ gaze: 1, head: 2, presence: 4, screen: 8, prediction: 16, pose: 32 });
+
+// binary, streams: none (18 bytes)
+const decodeBinary0 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true)
+  },
+  timestamp: Number(view.getBigUint64(10, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze (38 bytes)
+const decodeBinary1 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(30, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head (46 bytes)
+const decodeBinary2 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      pitch: view.getFloat32(14, true),
+      position: {
+        x: view.getFloat32(18, true),
+        y: view.getFloat32(22, true),
+        z: view.getFloat32(26, true)
+      },
+      roll: view.getFloat32(30, true),
+      yaw: view.getFloat32(34, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(38, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head (66 bytes)
+const decodeBinary3 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true)
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(30, true),
+      pitch: view.getFloat32(34, true),
+      position: {
+        x: view.getFloat32(38, true),
+        y: view.getFloat32(42, true),
+        z: view.getFloat32(46, true)
+      },
+      roll: view.getFloat32(50, true),
+      yaw: view.getFloat32(54, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(58, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence (19 bytes)
+const decodeBinary4 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0
+  },
+  timestamp: Number(view.getBigUint64(11, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence (39 bytes)
+const decodeBinary5 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(31, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence (47 bytes)
+const decodeBinary6 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      pitch: view.getFloat32(15, true),
+      position: {
+        x: view.getFloat32(19, true),
+        y: view.getFloat32(23, true),
+        z: view.getFloat32(27, true)
+      },
+      roll: view.getFloat32(31, true),
+      yaw: view.getFloat32(35, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(39, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence (67 bytes)
+const decodeBinary7 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true)
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(31, true),
+      pitch: view.getFloat32(35, true),
+      position: {
+        x: view.getFloat32(39, true),
+        y: view.getFloat32(43, true),
+        z: view.getFloat32(47, true)
+      },
+      roll: view.getFloat32(51, true),
+      yaw: view.getFloat32(55, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(59, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: screen (38 bytes)
+const decodeBinary8 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(10, true),
+        u: view.getFloat32(14, true),
+        v: view.getFloat32(18, true),
+        x: view.getFloat32(22, true),
+        y: view.getFloat32(26, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(30, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, screen (58 bytes)
+const decodeBinary9 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true),
+      screen: {
+        display: view.getInt32(30, true),
+        u: view.getFloat32(34, true),
+        v: view.getFloat32(38, true),
+        x: view.getFloat32(42, true),
+        y: view.getFloat32(46, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(50, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, screen (66 bytes)
+const decodeBinary10 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(10, true),
+        u: view.getFloat32(14, true),
+        v: view.getFloat32(18, true),
+        x: view.getFloat32(22, true),
+        y: view.getFloat32(26, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(30, true),
+      pitch: view.getFloat32(34, true),
+      position: {
+        x: view.getFloat32(38, true),
+        y: view.getFloat32(42, true),
+        z: view.getFloat32(46, true)
+      },
+      roll: view.getFloat32(50, true),
+      yaw: view.getFloat32(54, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(58, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, screen (86 bytes)
+const decodeBinary11 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true),
+      screen: {
+        display: view.getInt32(30, true),
+        u: view.getFloat32(34, true),
+        v: view.getFloat32(38, true),
+        x: view.getFloat32(42, true),
+        y: view.getFloat32(46, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(50, true),
+      pitch: view.getFloat32(54, true),
+      position: {
+        x: view.getFloat32(58, true),
+        y: view.getFloat32(62, true),
+        z: view.getFloat32(66, true)
+      },
+      roll: view.getFloat32(70, true),
+      yaw: view.getFloat32(74, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(78, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence, screen (39 bytes)
+const decodeBinary12 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(11, true),
+        u: view.getFloat32(15, true),
+        v: view.getFloat32(19, true),
+        x: view.getFloat32(23, true),
+        y: view.getFloat32(27, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(31, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence, screen (59 bytes)
+const decodeBinary13 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true),
+      screen: {
+        display: view.getInt32(31, true),
+        u: view.getFloat32(35, true),
+        v: view.getFloat32(39, true),
+        x: view.getFloat32(43, true),
+        y: view.getFloat32(47, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(51, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence, screen (67 bytes)
+const decodeBinary14 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(11, true),
+        u: view.getFloat32(15, true),
+        v: view.getFloat32(19, true),
+        x: view.getFloat32(23, true),
+        y: view.getFloat32(27, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(31, true),
+      pitch: view.getFloat32(35, true),
+      position: {
+        x: view.getFloat32(39, true),
+        y: view.getFloat32(43, true),
+        z: view.getFloat32(47, true)
+      },
+      roll: view.getFloat32(51, true),
+      yaw: view.getFloat32(55, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(59, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence, screen (87 bytes)
+const decodeBinary15 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true),
+      screen: {
+        display: view.getInt32(31, true),
+        u: view.getFloat32(35, true),
+        v: view.getFloat32(39, true),
+        x: view.getFloat32(43, true),
+        y: view.getFloat32(47, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(51, true),
+      pitch: view.getFloat32(55, true),
+      position: {
+        x: view.getFloat32(59, true),
+        y: view.getFloat32(63, true),
+        z: view.getFloat32(67, true)
+      },
+      roll: view.getFloat32(71, true),
+      yaw: view.getFloat32(75, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(79, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: prediction (23 bytes)
+const decodeBinary16 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true)
+  },
+  timestamp: Number(view.getBigUint64(15, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, prediction (43 bytes)
+const decodeBinary17 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(35, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, prediction (51 bytes)
+const decodeBinary18 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      pitch: view.getFloat32(19, true),
+      position: {
+        x: view.getFloat32(23, true),
+        y: view.getFloat32(27, true),
+        z: view.getFloat32(31, true)
+      },
+      roll: view.getFloat32(35, true),
+      yaw: view.getFloat32(39, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(43, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, prediction (71 bytes)
+const decodeBinary19 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true)
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(35, true),
+      pitch: view.getFloat32(39, true),
+      position: {
+        x: view.getFloat32(43, true),
+        y: view.getFloat32(47, true),
+        z: view.getFloat32(51, true)
+      },
+      roll: view.getFloat32(55, true),
+      yaw: view.getFloat32(59, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(63, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence, prediction (24 bytes)
+const decodeBinary20 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0
+  },
+  timestamp: Number(view.getBigUint64(16, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence, prediction (44 bytes)
+const decodeBinary21 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(36, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence, prediction (52 bytes)
+const decodeBinary22 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      pitch: view.getFloat32(20, true),
+      position: {
+        x: view.getFloat32(24, true),
+        y: view.getFloat32(28, true),
+        z: view.getFloat32(32, true)
+      },
+      roll: view.getFloat32(36, true),
+      yaw: view.getFloat32(40, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(44, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence, prediction (72 bytes)
+const decodeBinary23 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true)
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(36, true),
+      pitch: view.getFloat32(40, true),
+      position: {
+        x: view.getFloat32(44, true),
+        y: view.getFloat32(48, true),
+        z: view.getFloat32(52, true)
+      },
+      roll: view.getFloat32(56, true),
+      yaw: view.getFloat32(60, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(64, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: screen, prediction (43 bytes)
+const decodeBinary24 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(15, true),
+        u: view.getFloat32(19, true),
+        v: view.getFloat32(23, true),
+        x: view.getFloat32(27, true),
+        y: view.getFloat32(31, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(35, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, screen, prediction (63 bytes)
+const decodeBinary25 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true),
+      screen: {
+        display: view.getInt32(35, true),
+        u: view.getFloat32(39, true),
+        v: view.getFloat32(43, true),
+        x: view.getFloat32(47, true),
+        y: view.getFloat32(51, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(55, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, screen, prediction (71 bytes)
+const decodeBinary26 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(15, true),
+        u: view.getFloat32(19, true),
+        v: view.getFloat32(23, true),
+        x: view.getFloat32(27, true),
+        y: view.getFloat32(31, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(35, true),
+      pitch: view.getFloat32(39, true),
+      position: {
+        x: view.getFloat32(43, true),
+        y: view.getFloat32(47, true),
+        z: view.getFloat32(51, true)
+      },
+      roll: view.getFloat32(55, true),
+      yaw: view.getFloat32(59, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(63, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, screen, prediction (91 bytes)
+const decodeBinary27 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true),
+      screen: {
+        display: view.getInt32(35, true),
+        u: view.getFloat32(39, true),
+        v: view.getFloat32(43, true),
+        x: view.getFloat32(47, true),
+        y: view.getFloat32(51, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(55, true),
+      pitch: view.getFloat32(59, true),
+      position: {
+        x: view.getFloat32(63, true),
+        y: view.getFloat32(67, true),
+        z: view.getFloat32(71, true)
+      },
+      roll: view.getFloat32(75, true),
+      yaw: view.getFloat32(79, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(83, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence, screen, prediction (44 bytes)
+const decodeBinary28 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(16, true),
+        u: view.getFloat32(20, true),
+        v: view.getFloat32(24, true),
+        x: view.getFloat32(28, true),
+        y: view.getFloat32(32, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(36, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence, screen, prediction (64 bytes)
+const decodeBinary29 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true),
+      screen: {
+        display: view.getInt32(36, true),
+        u: view.getFloat32(40, true),
+        v: view.getFloat32(44, true),
+        x: view.getFloat32(48, true),
+        y: view.getFloat32(52, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(56, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence, screen, prediction (72 bytes)
+const decodeBinary30 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(16, true),
+        u: view.getFloat32(20, true),
+        v: view.getFloat32(24, true),
+        x: view.getFloat32(28, true),
+        y: view.getFloat32(32, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(36, true),
+      pitch: view.getFloat32(40, true),
+      position: {
+        x: view.getFloat32(44, true),
+        y: view.getFloat32(48, true),
+        z: view.getFloat32(52, true)
+      },
+      roll: view.getFloat32(56, true),
+      yaw: view.getFloat32(60, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(64, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence, screen, prediction (92 bytes)
+const decodeBinary31 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true),
+      screen: {
+        display: view.getInt32(36, true),
+        u: view.getFloat32(40, true),
+        v: view.getFloat32(44, true),
+        x: view.getFloat32(48, true),
+        y: view.getFloat32(52, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(56, true),
+      pitch: view.getFloat32(60, true),
+      position: {
+        x: view.getFloat32(64, true),
+        y: view.getFloat32(68, true),
+        z: view.getFloat32(72, true)
+      },
+      roll: view.getFloat32(76, true),
+      yaw: view.getFloat32(80, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(84, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: pose (94 bytes)
+const decodeBinary32 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(10, true),
+          y: view.getFloat32(14, true),
+          z: view.getFloat32(18, true)
+        },
+        direction: {
+          x: view.getFloat32(22, true),
+          y: view.getFloat32(26, true),
+          z: view.getFloat32(30, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(34, true),
+        x: view.getFloat32(38, true),
+        y: view.getFloat32(42, true),
+        z: view.getFloat32(46, true)
+      },
+      rotation: {
+        m00: view.getFloat32(50, true),
+        m01: view.getFloat32(54, true),
+        m02: view.getFloat32(58, true),
+        m10: view.getFloat32(62, true),
+        m11: view.getFloat32(66, true),
+        m12: view.getFloat32(70, true),
+        m20: view.getFloat32(74, true),
+        m21: view.getFloat32(78, true),
+        m22: view.getFloat32(82, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(86, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, pose (114 bytes)
+const decodeBinary33 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(30, true),
+          y: view.getFloat32(34, true),
+          z: view.getFloat32(38, true)
+        },
+        direction: {
+          x: view.getFloat32(42, true),
+          y: view.getFloat32(46, true),
+          z: view.getFloat32(50, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(54, true),
+        x: view.getFloat32(58, true),
+        y: view.getFloat32(62, true),
+        z: view.getFloat32(66, true)
+      },
+      rotation: {
+        m00: view.getFloat32(70, true),
+        m01: view.getFloat32(74, true),
+        m02: view.getFloat32(78, true),
+        m10: view.getFloat32(82, true),
+        m11: view.getFloat32(86, true),
+        m12: view.getFloat32(90, true),
+        m20: view.getFloat32(94, true),
+        m21: view.getFloat32(98, true),
+        m22: view.getFloat32(102, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(106, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, pose (122 bytes)
+const decodeBinary34 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(10, true),
+          y: view.getFloat32(14, true),
+          z: view.getFloat32(18, true)
+        },
+        direction: {
+          x: view.getFloat32(22, true),
+          y: view.getFloat32(26, true),
+          z: view.getFloat32(30, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(34, true),
+      orientation: {
+        w: view.getFloat32(38, true),
+        x: view.getFloat32(42, true),
+        y: view.getFloat32(46, true),
+        z: view.getFloat32(50, true)
+      },
+      pitch: view.getFloat32(54, true),
+      position: {
+        x: view.getFloat32(58, true),
+        y: view.getFloat32(62, true),
+        z: view.getFloat32(66, true)
+      },
+      roll: view.getFloat32(70, true),
+      rotation: {
+        m00: view.getFloat32(74, true),
+        m01: view.getFloat32(78, true),
+        m02: view.getFloat32(82, true),
+        m10: view.getFloat32(86, true),
+        m11: view.getFloat32(90, true),
+        m12: view.getFloat32(94, true),
+        m20: view.getFloat32(98, true),
+        m21: view.getFloat32(102, true),
+        m22: view.getFloat32(106, true)
+      },
+      yaw: view.getFloat32(110, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(114, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, pose (142 bytes)
+const decodeBinary35 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(30, true),
+          y: view.getFloat32(34, true),
+          z: view.getFloat32(38, true)
+        },
+        direction: {
+          x: view.getFloat32(42, true),
+          y: view.getFloat32(46, true),
+          z: view.getFloat32(50, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(54, true),
+      orientation: {
+        w: view.getFloat32(58, true),
+        x: view.getFloat32(62, true),
+        y: view.getFloat32(66, true),
+        z: view.getFloat32(70, true)
+      },
+      pitch: view.getFloat32(74, true),
+      position: {
+        x: view.getFloat32(78, true),
+        y: view.getFloat32(82, true),
+        z: view.getFloat32(86, true)
+      },
+      roll: view.getFloat32(90, true),
+      rotation: {
+        m00: view.getFloat32(94, true),
+        m01: view.getFloat32(98, true),
+        m02: view.getFloat32(102, true),
+        m10: view.getFloat32(106, true),
+        m11: view.getFloat32(110, true),
+        m12: view.getFloat32(114, true),
+        m20: view.getFloat32(118, true),
+        m21: view.getFloat32(122, true),
+        m22: view.getFloat32(126, true)
+      },
+      yaw: view.getFloat32(130, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(134, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence, pose (95 bytes)
+const decodeBinary36 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(11, true),
+          y: view.getFloat32(15, true),
+          z: view.getFloat32(19, true)
+        },
+        direction: {
+          x: view.getFloat32(23, true),
+          y: view.getFloat32(27, true),
+          z: view.getFloat32(31, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(35, true),
+        x: view.getFloat32(39, true),
+        y: view.getFloat32(43, true),
+        z: view.getFloat32(47, true)
+      },
+      rotation: {
+        m00: view.getFloat32(51, true),
+        m01: view.getFloat32(55, true),
+        m02: view.getFloat32(59, true),
+        m10: view.getFloat32(63, true),
+        m11: view.getFloat32(67, true),
+        m12: view.getFloat32(71, true),
+        m20: view.getFloat32(75, true),
+        m21: view.getFloat32(79, true),
+        m22: view.getFloat32(83, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(87, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence, pose (115 bytes)
+const decodeBinary37 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(31, true),
+          y: view.getFloat32(35, true),
+          z: view.getFloat32(39, true)
+        },
+        direction: {
+          x: view.getFloat32(43, true),
+          y: view.getFloat32(47, true),
+          z: view.getFloat32(51, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(55, true),
+        x: view.getFloat32(59, true),
+        y: view.getFloat32(63, true),
+        z: view.getFloat32(67, true)
+      },
+      rotation: {
+        m00: view.getFloat32(71, true),
+        m01: view.getFloat32(75, true),
+        m02: view.getFloat32(79, true),
+        m10: view.getFloat32(83, true),
+        m11: view.getFloat32(87, true),
+        m12: view.getFloat32(91, true),
+        m20: view.getFloat32(95, true),
+        m21: view.getFloat32(99, true),
+        m22: view.getFloat32(103, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(107, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence, pose (123 bytes)
+const decodeBinary38 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(11, true),
+          y: view.getFloat32(15, true),
+          z: view.getFloat32(19, true)
+        },
+        direction: {
+          x: view.getFloat32(23, true),
+          y: view.getFloat32(27, true),
+          z: view.getFloat32(31, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(35, true),
+      orientation: {
+        w: view.getFloat32(39, true),
+        x: view.getFloat32(43, true),
+        y: view.getFloat32(47, true),
+        z: view.getFloat32(51, true)
+      },
+      pitch: view.getFloat32(55, true),
+      position: {
+        x: view.getFloat32(59, true),
+        y: view.getFloat32(63, true),
+        z: view.getFloat32(67, true)
+      },
+      roll: view.getFloat32(71, true),
+      rotation: {
+        m00: view.getFloat32(75, true),
+        m01: view.getFloat32(79, true),
+        m02: view.getFloat32(83, true),
+        m10: view.getFloat32(87, true),
+        m11: view.getFloat32(91, true),
+        m12: view.getFloat32(95, true),
+        m20: view.getFloat32(99, true),
+        m21: view.getFloat32(103, true),
+        m22: view.getFloat32(107, true)
+      },
+      yaw: view.getFloat32(111, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(115, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence, pose (143 bytes)
+const decodeBinary39 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(31, true),
+          y: view.getFloat32(35, true),
+          z: view.getFloat32(39, true)
+        },
+        direction: {
+          x: view.getFloat32(43, true),
+          y: view.getFloat32(47, true),
+          z: view.getFloat32(51, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(55, true),
+      orientation: {
+        w: view.getFloat32(59, true),
+        x: view.getFloat32(63, true),
+        y: view.getFloat32(67, true),
+        z: view.getFloat32(71, true)
+      },
+      pitch: view.getFloat32(75, true),
+      position: {
+        x: view.getFloat32(79, true),
+        y: view.getFloat32(83, true),
+        z: view.getFloat32(87, true)
+      },
+      roll: view.getFloat32(91, true),
+      rotation: {
+        m00: view.getFloat32(95, true),
+        m01: view.getFloat32(99, true),
+        m02: view.getFloat32(103, true),
+        m10: view.getFloat32(107, true),
+        m11: view.getFloat32(111, true),
+        m12: view.getFloat32(115, true),
+        m20: view.getFloat32(119, true),
+        m21: view.getFloat32(123, true),
+        m22: view.getFloat32(127, true)
+      },
+      yaw: view.getFloat32(131, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(135, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: screen, pose (114 bytes)
+const decodeBinary40 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(10, true),
+          y: view.getFloat32(14, true),
+          z: view.getFloat32(18, true)
+        },
+        direction: {
+          x: view.getFloat32(22, true),
+          y: view.getFloat32(26, true),
+          z: view.getFloat32(30, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(34, true),
+        u: view.getFloat32(38, true),
+        v: view.getFloat32(42, true),
+        x: view.getFloat32(46, true),
+        y: view.getFloat32(50, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(54, true),
+        x: view.getFloat32(58, true),
+        y: view.getFloat32(62, true),
+        z: view.getFloat32(66, true)
+      },
+      rotation: {
+        m00: view.getFloat32(70, true),
+        m01: view.getFloat32(74, true),
+        m02: view.getFloat32(78, true),
+        m10: view.getFloat32(82, true),
+        m11: view.getFloat32(86, true),
+        m12: view.getFloat32(90, true),
+        m20: view.getFloat32(94, true),
+        m21: view.getFloat32(98, true),
+        m22: view.getFloat32(102, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(106, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, screen, pose (134 bytes)
+const decodeBinary41 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(30, true),
+          y: view.getFloat32(34, true),
+          z: view.getFloat32(38, true)
+        },
+        direction: {
+          x: view.getFloat32(42, true),
+          y: view.getFloat32(46, true),
+          z: view.getFloat32(50, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(54, true),
+        u: view.getFloat32(58, true),
+        v: view.getFloat32(62, true),
+        x: view.getFloat32(66, true),
+        y: view.getFloat32(70, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(74, true),
+        x: view.getFloat32(78, true),
+        y: view.getFloat32(82, true),
+        z: view.getFloat32(86, true)
+      },
+      rotation: {
+        m00: view.getFloat32(90, true),
+        m01: view.getFloat32(94, true),
+        m02: view.getFloat32(98, true),
+        m10: view.getFloat32(102, true),
+        m11: view.getFloat32(106, true),
+        m12: view.getFloat32(110, true),
+        m20: view.getFloat32(114, true),
+        m21: view.getFloat32(118, true),
+        m22: view.getFloat32(122, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(126, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, screen, pose (142 bytes)
+const decodeBinary42 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(10, true),
+          y: view.getFloat32(14, true),
+          z: view.getFloat32(18, true)
+        },
+        direction: {
+          x: view.getFloat32(22, true),
+          y: view.getFloat32(26, true),
+          z: view.getFloat32(30, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(34, true),
+        u: view.getFloat32(38, true),
+        v: view.getFloat32(42, true),
+        x: view.getFloat32(46, true),
+        y: view.getFloat32(50, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(54, true),
+      orientation: {
+        w: view.getFloat32(58, true),
+        x: view.getFloat32(62, true),
+        y: view.getFloat32(66, true),
+        z: view.getFloat32(70, true)
+      },
+      pitch: view.getFloat32(74, true),
+      position: {
+        x: view.getFloat32(78, true),
+        y: view.getFloat32(82, true),
+        z: view.getFloat32(86, true)
+      },
+      roll: view.getFloat32(90, true),
+      rotation: {
+        m00: view.getFloat32(94, true),
+        m01: view.getFloat32(98, true),
+        m02: view.getFloat32(102, true),
+        m10: view.getFloat32(106, true),
+        m11: view.getFloat32(110, true),
+        m12: view.getFloat32(114, true),
+        m20: view.getFloat32(118, true),
+        m21: view.getFloat32(122, true),
+        m22: view.getFloat32(126, true)
+      },
+      yaw: view.getFloat32(130, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(134, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, screen, pose (162 bytes)
+const decodeBinary43 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(10, true),
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getFloat32(22, true),
+      y: view.getFloat32(26, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(30, true),
+          y: view.getFloat32(34, true),
+          z: view.getFloat32(38, true)
+        },
+        direction: {
+          x: view.getFloat32(42, true),
+          y: view.getFloat32(46, true),
+          z: view.getFloat32(50, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(54, true),
+        u: view.getFloat32(58, true),
+        v: view.getFloat32(62, true),
+        x: view.getFloat32(66, true),
+        y: view.getFloat32(70, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(74, true),
+      orientation: {
+        w: view.getFloat32(78, true),
+        x: view.getFloat32(82, true),
+        y: view.getFloat32(86, true),
+        z: view.getFloat32(90, true)
+      },
+      pitch: view.getFloat32(94, true),
+      position: {
+        x: view.getFloat32(98, true),
+        y: view.getFloat32(102, true),
+        z: view.getFloat32(106, true)
+      },
+      roll: view.getFloat32(110, true),
+      rotation: {
+        m00: view.getFloat32(114, true),
+        m01: view.getFloat32(118, true),
+        m02: view.getFloat32(122, true),
+        m10: view.getFloat32(126, true),
+        m11: view.getFloat32(130, true),
+        m12: view.getFloat32(134, true),
+        m20: view.getFloat32(138, true),
+        m21: view.getFloat32(142, true),
+        m22: view.getFloat32(146, true)
+      },
+      yaw: view.getFloat32(150, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(154, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence, screen, pose (115 bytes)
+const decodeBinary44 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(11, true),
+          y: view.getFloat32(15, true),
+          z: view.getFloat32(19, true)
+        },
+        direction: {
+          x: view.getFloat32(23, true),
+          y: view.getFloat32(27, true),
+          z: view.getFloat32(31, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(35, true),
+        u: view.getFloat32(39, true),
+        v: view.getFloat32(43, true),
+        x: view.getFloat32(47, true),
+        y: view.getFloat32(51, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(55, true),
+        x: view.getFloat32(59, true),
+        y: view.getFloat32(63, true),
+        z: view.getFloat32(67, true)
+      },
+      rotation: {
+        m00: view.getFloat32(71, true),
+        m01: view.getFloat32(75, true),
+        m02: view.getFloat32(79, true),
+        m10: view.getFloat32(83, true),
+        m11: view.getFloat32(87, true),
+        m12: view.getFloat32(91, true),
+        m20: view.getFloat32(95, true),
+        m21: view.getFloat32(99, true),
+        m22: view.getFloat32(103, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(107, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence, screen, pose (135 bytes)
+const decodeBinary45 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(31, true),
+          y: view.getFloat32(35, true),
+          z: view.getFloat32(39, true)
+        },
+        direction: {
+          x: view.getFloat32(43, true),
+          y: view.getFloat32(47, true),
+          z: view.getFloat32(51, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(55, true),
+        u: view.getFloat32(59, true),
+        v: view.getFloat32(63, true),
+        x: view.getFloat32(67, true),
+        y: view.getFloat32(71, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(75, true),
+        x: view.getFloat32(79, true),
+        y: view.getFloat32(83, true),
+        z: view.getFloat32(87, true)
+      },
+      rotation: {
+        m00: view.getFloat32(91, true),
+        m01: view.getFloat32(95, true),
+        m02: view.getFloat32(99, true),
+        m10: view.getFloat32(103, true),
+        m11: view.getFloat32(107, true),
+        m12: view.getFloat32(111, true),
+        m20: view.getFloat32(115, true),
+        m21: view.getFloat32(119, true),
+        m22: view.getFloat32(123, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(127, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence, screen, pose (143 bytes)
+const decodeBinary46 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(11, true),
+          y: view.getFloat32(15, true),
+          z: view.getFloat32(19, true)
+        },
+        direction: {
+          x: view.getFloat32(23, true),
+          y: view.getFloat32(27, true),
+          z: view.getFloat32(31, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(35, true),
+        u: view.getFloat32(39, true),
+        v: view.getFloat32(43, true),
+        x: view.getFloat32(47, true),
+        y: view.getFloat32(51, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(55, true),
+      orientation: {
+        w: view.getFloat32(59, true),
+        x: view.getFloat32(63, true),
+        y: view.getFloat32(67, true),
+        z: view.getFloat32(71, true)
+      },
+      pitch: view.getFloat32(75, true),
+      position: {
+        x: view.getFloat32(79, true),
+        y: view.getFloat32(83, true),
+        z: view.getFloat32(87, true)
+      },
+      roll: view.getFloat32(91, true),
+      rotation: {
+        m00: view.getFloat32(95, true),
+        m01: view.getFloat32(99, true),
+        m02: view.getFloat32(103, true),
+        m10: view.getFloat32(107, true),
+        m11: view.getFloat32(111, true),
+        m12: view.getFloat32(115, true),
+        m20: view.getFloat32(119, true),
+        m21: view.getFloat32(123, true),
+        m22: view.getFloat32(127, true)
+      },
+      yaw: view.getFloat32(131, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(135, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence, screen, pose (163 bytes)
+const decodeBinary47 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    present: view.getUint8(10) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(11, true),
+      timestamp: Number(view.getBigUint64(15, true)),
+      x: view.getFloat32(23, true),
+      y: view.getFloat32(27, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(31, true),
+          y: view.getFloat32(35, true),
+          z: view.getFloat32(39, true)
+        },
+        direction: {
+          x: view.getFloat32(43, true),
+          y: view.getFloat32(47, true),
+          z: view.getFloat32(51, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(55, true),
+        u: view.getFloat32(59, true),
+        v: view.getFloat32(63, true),
+        x: view.getFloat32(67, true),
+        y: view.getFloat32(71, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(75, true),
+      orientation: {
+        w: view.getFloat32(79, true),
+        x: view.getFloat32(83, true),
+        y: view.getFloat32(87, true),
+        z: view.getFloat32(91, true)
+      },
+      pitch: view.getFloat32(95, true),
+      position: {
+        x: view.getFloat32(99, true),
+        y: view.getFloat32(103, true),
+        z: view.getFloat32(107, true)
+      },
+      roll: view.getFloat32(111, true),
+      rotation: {
+        m00: view.getFloat32(115, true),
+        m01: view.getFloat32(119, true),
+        m02: view.getFloat32(123, true),
+        m10: view.getFloat32(127, true),
+        m11: view.getFloat32(131, true),
+        m12: view.getFloat32(135, true),
+        m20: view.getFloat32(139, true),
+        m21: view.getFloat32(143, true),
+        m22: view.getFloat32(147, true)
+      },
+      yaw: view.getFloat32(151, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(155, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: prediction, pose (99 bytes)
+const decodeBinary48 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(15, true),
+          y: view.getFloat32(19, true),
+          z: view.getFloat32(23, true)
+        },
+        direction: {
+          x: view.getFloat32(27, true),
+          y: view.getFloat32(31, true),
+          z: view.getFloat32(35, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(39, true),
+        x: view.getFloat32(43, true),
+        y: view.getFloat32(47, true),
+        z: view.getFloat32(51, true)
+      },
+      rotation: {
+        m00: view.getFloat32(55, true),
+        m01: view.getFloat32(59, true),
+        m02: view.getFloat32(63, true),
+        m10: view.getFloat32(67, true),
+        m11: view.getFloat32(71, true),
+        m12: view.getFloat32(75, true),
+        m20: view.getFloat32(79, true),
+        m21: view.getFloat32(83, true),
+        m22: view.getFloat32(87, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(91, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, prediction, pose (119 bytes)
+const decodeBinary49 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(35, true),
+          y: view.getFloat32(39, true),
+          z: view.getFloat32(43, true)
+        },
+        direction: {
+          x: view.getFloat32(47, true),
+          y: view.getFloat32(51, true),
+          z: view.getFloat32(55, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(59, true),
+        x: view.getFloat32(63, true),
+        y: view.getFloat32(67, true),
+        z: view.getFloat32(71, true)
+      },
+      rotation: {
+        m00: view.getFloat32(75, true),
+        m01: view.getFloat32(79, true),
+        m02: view.getFloat32(83, true),
+        m10: view.getFloat32(87, true),
+        m11: view.getFloat32(91, true),
+        m12: view.getFloat32(95, true),
+        m20: view.getFloat32(99, true),
+        m21: view.getFloat32(103, true),
+        m22: view.getFloat32(107, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(111, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, prediction, pose (127 bytes)
+const decodeBinary50 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(15, true),
+          y: view.getFloat32(19, true),
+          z: view.getFloat32(23, true)
+        },
+        direction: {
+          x: view.getFloat32(27, true),
+          y: view.getFloat32(31, true),
+          z: view.getFloat32(35, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(39, true),
+      orientation: {
+        w: view.getFloat32(43, true),
+        x: view.getFloat32(47, true),
+        y: view.getFloat32(51, true),
+        z: view.getFloat32(55, true)
+      },
+      pitch: view.getFloat32(59, true),
+      position: {
+        x: view.getFloat32(63, true),
+        y: view.getFloat32(67, true),
+        z: view.getFloat32(71, true)
+      },
+      roll: view.getFloat32(75, true),
+      rotation: {
+        m00: view.getFloat32(79, true),
+        m01: view.getFloat32(83, true),
+        m02: view.getFloat32(87, true),
+        m10: view.getFloat32(91, true),
+        m11: view.getFloat32(95, true),
+        m12: view.getFloat32(99, true),
+        m20: view.getFloat32(103, true),
+        m21: view.getFloat32(107, true),
+        m22: view.getFloat32(111, true)
+      },
+      yaw: view.getFloat32(115, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(119, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, prediction, pose (147 bytes)
+const decodeBinary51 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(35, true),
+          y: view.getFloat32(39, true),
+          z: view.getFloat32(43, true)
+        },
+        direction: {
+          x: view.getFloat32(47, true),
+          y: view.getFloat32(51, true),
+          z: view.getFloat32(55, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(59, true),
+      orientation: {
+        w: view.getFloat32(63, true),
+        x: view.getFloat32(67, true),
+        y: view.getFloat32(71, true),
+        z: view.getFloat32(75, true)
+      },
+      pitch: view.getFloat32(79, true),
+      position: {
+        x: view.getFloat32(83, true),
+        y: view.getFloat32(87, true),
+        z: view.getFloat32(91, true)
+      },
+      roll: view.getFloat32(95, true),
+      rotation: {
+        m00: view.getFloat32(99, true),
+        m01: view.getFloat32(103, true),
+        m02: view.getFloat32(107, true),
+        m10: view.getFloat32(111, true),
+        m11: view.getFloat32(115, true),
+        m12: view.getFloat32(119, true),
+        m20: view.getFloat32(123, true),
+        m21: view.getFloat32(127, true),
+        m22: view.getFloat32(131, true)
+      },
+      yaw: view.getFloat32(135, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(139, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence, prediction, pose (100 bytes)
+const decodeBinary52 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(16, true),
+          y: view.getFloat32(20, true),
+          z: view.getFloat32(24, true)
+        },
+        direction: {
+          x: view.getFloat32(28, true),
+          y: view.getFloat32(32, true),
+          z: view.getFloat32(36, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(40, true),
+        x: view.getFloat32(44, true),
+        y: view.getFloat32(48, true),
+        z: view.getFloat32(52, true)
+      },
+      rotation: {
+        m00: view.getFloat32(56, true),
+        m01: view.getFloat32(60, true),
+        m02: view.getFloat32(64, true),
+        m10: view.getFloat32(68, true),
+        m11: view.getFloat32(72, true),
+        m12: view.getFloat32(76, true),
+        m20: view.getFloat32(80, true),
+        m21: view.getFloat32(84, true),
+        m22: view.getFloat32(88, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(92, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence, prediction, pose (120 bytes)
+const decodeBinary53 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(36, true),
+          y: view.getFloat32(40, true),
+          z: view.getFloat32(44, true)
+        },
+        direction: {
+          x: view.getFloat32(48, true),
+          y: view.getFloat32(52, true),
+          z: view.getFloat32(56, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(60, true),
+        x: view.getFloat32(64, true),
+        y: view.getFloat32(68, true),
+        z: view.getFloat32(72, true)
+      },
+      rotation: {
+        m00: view.getFloat32(76, true),
+        m01: view.getFloat32(80, true),
+        m02: view.getFloat32(84, true),
+        m10: view.getFloat32(88, true),
+        m11: view.getFloat32(92, true),
+        m12: view.getFloat32(96, true),
+        m20: view.getFloat32(100, true),
+        m21: view.getFloat32(104, true),
+        m22: view.getFloat32(108, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(112, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence, prediction, pose (128 bytes)
+const decodeBinary54 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(16, true),
+          y: view.getFloat32(20, true),
+          z: view.getFloat32(24, true)
+        },
+        direction: {
+          x: view.getFloat32(28, true),
+          y: view.getFloat32(32, true),
+          z: view.getFloat32(36, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(40, true),
+      orientation: {
+        w: view.getFloat32(44, true),
+        x: view.getFloat32(48, true),
+        y: view.getFloat32(52, true),
+        z: view.getFloat32(56, true)
+      },
+      pitch: view.getFloat32(60, true),
+      position: {
+        x: view.getFloat32(64, true),
+        y: view.getFloat32(68, true),
+        z: view.getFloat32(72, true)
+      },
+      roll: view.getFloat32(76, true),
+      rotation: {
+        m00: view.getFloat32(80, true),
+        m01: view.getFloat32(84, true),
+        m02: view.getFloat32(88, true),
+        m10: view.getFloat32(92, true),
+        m11: view.getFloat32(96, true),
+        m12: view.getFloat32(100, true),
+        m20: view.getFloat32(104, true),
+        m21: view.getFloat32(108, true),
+        m22: view.getFloat32(112, true)
+      },
+      yaw: view.getFloat32(116, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(120, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence, prediction, pose (148 bytes)
+const decodeBinary55 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(36, true),
+          y: view.getFloat32(40, true),
+          z: view.getFloat32(44, true)
+        },
+        direction: {
+          x: view.getFloat32(48, true),
+          y: view.getFloat32(52, true),
+          z: view.getFloat32(56, true)
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(60, true),
+      orientation: {
+        w: view.getFloat32(64, true),
+        x: view.getFloat32(68, true),
+        y: view.getFloat32(72, true),
+        z: view.getFloat32(76, true)
+      },
+      pitch: view.getFloat32(80, true),
+      position: {
+        x: view.getFloat32(84, true),
+        y: view.getFloat32(88, true),
+        z: view.getFloat32(92, true)
+      },
+      roll: view.getFloat32(96, true),
+      rotation: {
+        m00: view.getFloat32(100, true),
+        m01: view.getFloat32(104, true),
+        m02: view.getFloat32(108, true),
+        m10: view.getFloat32(112, true),
+        m11: view.getFloat32(116, true),
+        m12: view.getFloat32(120, true),
+        m20: view.getFloat32(124, true),
+        m21: view.getFloat32(128, true),
+        m22: view.getFloat32(132, true)
+      },
+      yaw: view.getFloat32(136, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(140, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: screen, prediction, pose (119 bytes)
+const decodeBinary56 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(15, true),
+          y: view.getFloat32(19, true),
+          z: view.getFloat32(23, true)
+        },
+        direction: {
+          x: view.getFloat32(27, true),
+          y: view.getFloat32(31, true),
+          z: view.getFloat32(35, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(39, true),
+        u: view.getFloat32(43, true),
+        v: view.getFloat32(47, true),
+        x: view.getFloat32(51, true),
+        y: view.getFloat32(55, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(59, true),
+        x: view.getFloat32(63, true),
+        y: view.getFloat32(67, true),
+        z: view.getFloat32(71, true)
+      },
+      rotation: {
+        m00: view.getFloat32(75, true),
+        m01: view.getFloat32(79, true),
+        m02: view.getFloat32(83, true),
+        m10: view.getFloat32(87, true),
+        m11: view.getFloat32(91, true),
+        m12: view.getFloat32(95, true),
+        m20: view.getFloat32(99, true),
+        m21: view.getFloat32(103, true),
+        m22: view.getFloat32(107, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(111, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, screen, prediction, pose (139 bytes)
+const decodeBinary57 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(35, true),
+          y: view.getFloat32(39, true),
+          z: view.getFloat32(43, true)
+        },
+        direction: {
+          x: view.getFloat32(47, true),
+          y: view.getFloat32(51, true),
+          z: view.getFloat32(55, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(59, true),
+        u: view.getFloat32(63, true),
+        v: view.getFloat32(67, true),
+        x: view.getFloat32(71, true),
+        y: view.getFloat32(75, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(79, true),
+        x: view.getFloat32(83, true),
+        y: view.getFloat32(87, true),
+        z: view.getFloat32(91, true)
+      },
+      rotation: {
+        m00: view.getFloat32(95, true),
+        m01: view.getFloat32(99, true),
+        m02: view.getFloat32(103, true),
+        m10: view.getFloat32(107, true),
+        m11: view.getFloat32(111, true),
+        m12: view.getFloat32(115, true),
+        m20: view.getFloat32(119, true),
+        m21: view.getFloat32(123, true),
+        m22: view.getFloat32(127, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(131, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, screen, prediction, pose (147 bytes)
+const decodeBinary58 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(15, true),
+          y: view.getFloat32(19, true),
+          z: view.getFloat32(23, true)
+        },
+        direction: {
+          x: view.getFloat32(27, true),
+          y: view.getFloat32(31, true),
+          z: view.getFloat32(35, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(39, true),
+        u: view.getFloat32(43, true),
+        v: view.getFloat32(47, true),
+        x: view.getFloat32(51, true),
+        y: view.getFloat32(55, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(59, true),
+      orientation: {
+        w: view.getFloat32(63, true),
+        x: view.getFloat32(67, true),
+        y: view.getFloat32(71, true),
+        z: view.getFloat32(75, true)
+      },
+      pitch: view.getFloat32(79, true),
+      position: {
+        x: view.getFloat32(83, true),
+        y: view.getFloat32(87, true),
+        z: view.getFloat32(91, true)
+      },
+      roll: view.getFloat32(95, true),
+      rotation: {
+        m00: view.getFloat32(99, true),
+        m01: view.getFloat32(103, true),
+        m02: view.getFloat32(107, true),
+        m10: view.getFloat32(111, true),
+        m11: view.getFloat32(115, true),
+        m12: view.getFloat32(119, true),
+        m20: view.getFloat32(123, true),
+        m21: view.getFloat32(127, true),
+        m22: view.getFloat32(131, true)
+      },
+      yaw: view.getFloat32(135, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(139, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, screen, prediction, pose (167 bytes)
+const decodeBinary59 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(15, true),
+      timestamp: Number(view.getBigUint64(19, true)),
+      x: view.getFloat32(27, true),
+      y: view.getFloat32(31, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(35, true),
+          y: view.getFloat32(39, true),
+          z: view.getFloat32(43, true)
+        },
+        direction: {
+          x: view.getFloat32(47, true),
+          y: view.getFloat32(51, true),
+          z: view.getFloat32(55, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(59, true),
+        u: view.getFloat32(63, true),
+        v: view.getFloat32(67, true),
+        x: view.getFloat32(71, true),
+        y: view.getFloat32(75, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(79, true),
+      orientation: {
+        w: view.getFloat32(83, true),
+        x: view.getFloat32(87, true),
+        y: view.getFloat32(91, true),
+        z: view.getFloat32(95, true)
+      },
+      pitch: view.getFloat32(99, true),
+      position: {
+        x: view.getFloat32(103, true),
+        y: view.getFloat32(107, true),
+        z: view.getFloat32(111, true)
+      },
+      roll: view.getFloat32(115, true),
+      rotation: {
+        m00: view.getFloat32(119, true),
+        m01: view.getFloat32(123, true),
+        m02: view.getFloat32(127, true),
+        m10: view.getFloat32(131, true),
+        m11: view.getFloat32(135, true),
+        m12: view.getFloat32(139, true),
+        m20: view.getFloat32(143, true),
+        m21: view.getFloat32(147, true),
+        m22: view.getFloat32(151, true)
+      },
+      yaw: view.getFloat32(155, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(159, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: presence, screen, prediction, pose (120 bytes)
+const decodeBinary60 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(16, true),
+          y: view.getFloat32(20, true),
+          z: view.getFloat32(24, true)
+        },
+        direction: {
+          x: view.getFloat32(28, true),
+          y: view.getFloat32(32, true),
+          z: view.getFloat32(36, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(40, true),
+        u: view.getFloat32(44, true),
+        v: view.getFloat32(48, true),
+        x: view.getFloat32(52, true),
+        y: view.getFloat32(56, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(60, true),
+        x: view.getFloat32(64, true),
+        y: view.getFloat32(68, true),
+        z: view.getFloat32(72, true)
+      },
+      rotation: {
+        m00: view.getFloat32(76, true),
+        m01: view.getFloat32(80, true),
+        m02: view.getFloat32(84, true),
+        m10: view.getFloat32(88, true),
+        m11: view.getFloat32(92, true),
+        m12: view.getFloat32(96, true),
+        m20: view.getFloat32(100, true),
+        m21: view.getFloat32(104, true),
+        m22: view.getFloat32(108, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(112, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, presence, screen, prediction, pose (140 bytes)
+const decodeBinary61 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(36, true),
+          y: view.getFloat32(40, true),
+          z: view.getFloat32(44, true)
+        },
+        direction: {
+          x: view.getFloat32(48, true),
+          y: view.getFloat32(52, true),
+          z: view.getFloat32(56, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(60, true),
+        u: view.getFloat32(64, true),
+        v: view.getFloat32(68, true),
+        x: view.getFloat32(72, true),
+        y: view.getFloat32(76, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getFloat32(80, true),
+        x: view.getFloat32(84, true),
+        y: view.getFloat32(88, true),
+        z: view.getFloat32(92, true)
+      },
+      rotation: {
+        m00: view.getFloat32(96, true),
+        m01: view.getFloat32(100, true),
+        m02: view.getFloat32(104, true),
+        m10: view.getFloat32(108, true),
+        m11: view.getFloat32(112, true),
+        m12: view.getFloat32(116, true),
+        m20: view.getFloat32(120, true),
+        m21: view.getFloat32(124, true),
+        m22: view.getFloat32(128, true)
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(132, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: head, presence, screen, prediction, pose (148 bytes)
+const decodeBinary62 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getFloat32(16, true),
+          y: view.getFloat32(20, true),
+          z: view.getFloat32(24, true)
+        },
+        direction: {
+          x: view.getFloat32(28, true),
+          y: view.getFloat32(32, true),
+          z: view.getFloat32(36, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(40, true),
+        u: view.getFloat32(44, true),
+        v: view.getFloat32(48, true),
+        x: view.getFloat32(52, true),
+        y: view.getFloat32(56, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(60, true),
+      orientation: {
+        w: view.getFloat32(64, true),
+        x: view.getFloat32(68, true),
+        y: view.getFloat32(72, true),
+        z: view.getFloat32(76, true)
+      },
+      pitch: view.getFloat32(80, true),
+      position: {
+        x: view.getFloat32(84, true),
+        y: view.getFloat32(88, true),
+        z: view.getFloat32(92, true)
+      },
+      roll: view.getFloat32(96, true),
+      rotation: {
+        m00: view.getFloat32(100, true),
+        m01: view.getFloat32(104, true),
+        m02: view.getFloat32(108, true),
+        m10: view.getFloat32(112, true),
+        m11: view.getFloat32(116, true),
+        m12: view.getFloat32(120, true),
+        m20: view.getFloat32(124, true),
+        m21: view.getFloat32(128, true),
+        m22: view.getFloat32(132, true)
+      },
+      yaw: view.getFloat32(136, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(140, true)),
+  type: 'tobii-data'
+});
+
+// binary, streams: gaze, head, presence, screen, prediction, pose (168 bytes)
+const decodeBinary63 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getFloat32(6, true),
+    predicted: view.getUint8(10) !== 0,
+    predictionHorizonMs: view.getFloat32(11, true),
+    present: view.getUint8(15) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getFloat32(16, true),
+      timestamp: Number(view.getBigUint64(20, true)),
+      x: view.getFloat32(28, true),
+      y: view.getFloat32(32, true),
+      ray: {
+        origin: {
+          x: view.getFloat32(36, true),
+          y: view.getFloat32(40, true),
+          z: view.getFloat32(44, true)
+        },
+        direction: {
+          x: view.getFloat32(48, true),
+          y: view.getFloat32(52, true),
+          z: view.getFloat32(56, true)
+        }
+      },
+      screen: {
+        display: view.getInt32(60, true),
+        u: view.getFloat32(64, true),
+        v: view.getFloat32(68, true),
+        x: view.getFloat32(72, true),
+        y: view.getFloat32(76, true)
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getFloat32(80, true),
+      orientation: {
+        w: view.getFloat32(84, true),
+        x: view.getFloat32(88, true),
+        y: view.getFloat32(92, true),
+        z: view.getFloat32(96, true)
+      },
+      pitch: view.getFloat32(100, true),
+      position: {
+        x: view.getFloat32(104, true),
+        y: view.getFloat32(108, true),
+        z: view.getFloat32(112, true)
+      },
+      roll: view.getFloat32(116, true),
+      rotation: {
+        m00: view.getFloat32(120, true),
+        m01: view.getFloat32(124, true),
+        m02: view.getFloat32(128, true),
+        m10: view.getFloat32(132, true),
+        m11: view.getFloat32(136, true),
+        m12: view.getFloat32(140, true),
+        m20: view.getFloat32(144, true),
+        m21: view.getFloat32(148, true),
+        m22: view.getFloat32(152, true)
+      },
+      yaw: view.getFloat32(156, true)
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(160, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: none (16 bytes)
+const decodeQuantized0 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767
+  },
+  timestamp: Number(view.getBigUint64(8, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze (30 bytes)
+const decodeQuantized1 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(22, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head (30 bytes)
+const decodeQuantized2 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      pitch: view.getInt16(10, true) / 100,
+      position: {
+        x: view.getInt16(12, true) / 10,
+        y: view.getInt16(14, true) / 10,
+        z: view.getInt16(16, true) / 10
+      },
+      roll: view.getInt16(18, true) / 100,
+      yaw: view.getInt16(20, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(22, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head (44 bytes)
+const decodeQuantized3 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(22, true) / 32767,
+      pitch: view.getInt16(24, true) / 100,
+      position: {
+        x: view.getInt16(26, true) / 10,
+        y: view.getInt16(28, true) / 10,
+        z: view.getInt16(30, true) / 10
+      },
+      roll: view.getInt16(32, true) / 100,
+      yaw: view.getInt16(34, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(36, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence (17 bytes)
+const decodeQuantized4 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0
+  },
+  timestamp: Number(view.getBigUint64(9, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence (31 bytes)
+const decodeQuantized5 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(23, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence (31 bytes)
+const decodeQuantized6 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      pitch: view.getInt16(11, true) / 100,
+      position: {
+        x: view.getInt16(13, true) / 10,
+        y: view.getInt16(15, true) / 10,
+        z: view.getInt16(17, true) / 10
+      },
+      roll: view.getInt16(19, true) / 100,
+      yaw: view.getInt16(21, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(23, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence (45 bytes)
+const decodeQuantized7 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(23, true) / 32767,
+      pitch: view.getInt16(25, true) / 100,
+      position: {
+        x: view.getInt16(27, true) / 10,
+        y: view.getInt16(29, true) / 10,
+        z: view.getInt16(31, true) / 10
+      },
+      roll: view.getInt16(33, true) / 100,
+      yaw: view.getInt16(35, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(37, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: screen (28 bytes)
+const decodeQuantized8 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(8, true),
+        u: view.getInt16(12, true) / 16384,
+        v: view.getInt16(14, true) / 16384,
+        x: view.getInt16(16, true) / 1,
+        y: view.getInt16(18, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(20, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, screen (42 bytes)
+const decodeQuantized9 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192,
+      screen: {
+        display: view.getInt32(22, true),
+        u: view.getInt16(26, true) / 16384,
+        v: view.getInt16(28, true) / 16384,
+        x: view.getInt16(30, true) / 1,
+        y: view.getInt16(32, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(34, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, screen (42 bytes)
+const decodeQuantized10 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(8, true),
+        u: view.getInt16(12, true) / 16384,
+        v: view.getInt16(14, true) / 16384,
+        x: view.getInt16(16, true) / 1,
+        y: view.getInt16(18, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(20, true) / 32767,
+      pitch: view.getInt16(22, true) / 100,
+      position: {
+        x: view.getInt16(24, true) / 10,
+        y: view.getInt16(26, true) / 10,
+        z: view.getInt16(28, true) / 10
+      },
+      roll: view.getInt16(30, true) / 100,
+      yaw: view.getInt16(32, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(34, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, screen (56 bytes)
+const decodeQuantized11 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192,
+      screen: {
+        display: view.getInt32(22, true),
+        u: view.getInt16(26, true) / 16384,
+        v: view.getInt16(28, true) / 16384,
+        x: view.getInt16(30, true) / 1,
+        y: view.getInt16(32, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(34, true) / 32767,
+      pitch: view.getInt16(36, true) / 100,
+      position: {
+        x: view.getInt16(38, true) / 10,
+        y: view.getInt16(40, true) / 10,
+        z: view.getInt16(42, true) / 10
+      },
+      roll: view.getInt16(44, true) / 100,
+      yaw: view.getInt16(46, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(48, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence, screen (29 bytes)
+const decodeQuantized12 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(9, true),
+        u: view.getInt16(13, true) / 16384,
+        v: view.getInt16(15, true) / 16384,
+        x: view.getInt16(17, true) / 1,
+        y: view.getInt16(19, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(21, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence, screen (43 bytes)
+const decodeQuantized13 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192,
+      screen: {
+        display: view.getInt32(23, true),
+        u: view.getInt16(27, true) / 16384,
+        v: view.getInt16(29, true) / 16384,
+        x: view.getInt16(31, true) / 1,
+        y: view.getInt16(33, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(35, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence, screen (43 bytes)
+const decodeQuantized14 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(9, true),
+        u: view.getInt16(13, true) / 16384,
+        v: view.getInt16(15, true) / 16384,
+        x: view.getInt16(17, true) / 1,
+        y: view.getInt16(19, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(21, true) / 32767,
+      pitch: view.getInt16(23, true) / 100,
+      position: {
+        x: view.getInt16(25, true) / 10,
+        y: view.getInt16(27, true) / 10,
+        z: view.getInt16(29, true) / 10
+      },
+      roll: view.getInt16(31, true) / 100,
+      yaw: view.getInt16(33, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(35, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence, screen (57 bytes)
+const decodeQuantized15 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192,
+      screen: {
+        display: view.getInt32(23, true),
+        u: view.getInt16(27, true) / 16384,
+        v: view.getInt16(29, true) / 16384,
+        x: view.getInt16(31, true) / 1,
+        y: view.getInt16(33, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(35, true) / 32767,
+      pitch: view.getInt16(37, true) / 100,
+      position: {
+        x: view.getInt16(39, true) / 10,
+        y: view.getInt16(41, true) / 10,
+        z: view.getInt16(43, true) / 10
+      },
+      roll: view.getInt16(45, true) / 100,
+      yaw: view.getInt16(47, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(49, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: prediction (19 bytes)
+const decodeQuantized16 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10
+  },
+  timestamp: Number(view.getBigUint64(11, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, prediction (33 bytes)
+const decodeQuantized17 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(25, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, prediction (33 bytes)
+const decodeQuantized18 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      pitch: view.getInt16(13, true) / 100,
+      position: {
+        x: view.getInt16(15, true) / 10,
+        y: view.getInt16(17, true) / 10,
+        z: view.getInt16(19, true) / 10
+      },
+      roll: view.getInt16(21, true) / 100,
+      yaw: view.getInt16(23, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(25, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, prediction (47 bytes)
+const decodeQuantized19 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(25, true) / 32767,
+      pitch: view.getInt16(27, true) / 100,
+      position: {
+        x: view.getInt16(29, true) / 10,
+        y: view.getInt16(31, true) / 10,
+        z: view.getInt16(33, true) / 10
+      },
+      roll: view.getInt16(35, true) / 100,
+      yaw: view.getInt16(37, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(39, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence, prediction (20 bytes)
+const decodeQuantized20 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0
+  },
+  timestamp: Number(view.getBigUint64(12, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence, prediction (34 bytes)
+const decodeQuantized21 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(26, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence, prediction (34 bytes)
+const decodeQuantized22 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      pitch: view.getInt16(14, true) / 100,
+      position: {
+        x: view.getInt16(16, true) / 10,
+        y: view.getInt16(18, true) / 10,
+        z: view.getInt16(20, true) / 10
+      },
+      roll: view.getInt16(22, true) / 100,
+      yaw: view.getInt16(24, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(26, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence, prediction (48 bytes)
+const decodeQuantized23 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(26, true) / 32767,
+      pitch: view.getInt16(28, true) / 100,
+      position: {
+        x: view.getInt16(30, true) / 10,
+        y: view.getInt16(32, true) / 10,
+        z: view.getInt16(34, true) / 10
+      },
+      roll: view.getInt16(36, true) / 100,
+      yaw: view.getInt16(38, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(40, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: screen, prediction (31 bytes)
+const decodeQuantized24 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(11, true),
+        u: view.getInt16(15, true) / 16384,
+        v: view.getInt16(17, true) / 16384,
+        x: view.getInt16(19, true) / 1,
+        y: view.getInt16(21, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(23, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, screen, prediction (45 bytes)
+const decodeQuantized25 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192,
+      screen: {
+        display: view.getInt32(25, true),
+        u: view.getInt16(29, true) / 16384,
+        v: view.getInt16(31, true) / 16384,
+        x: view.getInt16(33, true) / 1,
+        y: view.getInt16(35, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(37, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, screen, prediction (45 bytes)
+const decodeQuantized26 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(11, true),
+        u: view.getInt16(15, true) / 16384,
+        v: view.getInt16(17, true) / 16384,
+        x: view.getInt16(19, true) / 1,
+        y: view.getInt16(21, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(23, true) / 32767,
+      pitch: view.getInt16(25, true) / 100,
+      position: {
+        x: view.getInt16(27, true) / 10,
+        y: view.getInt16(29, true) / 10,
+        z: view.getInt16(31, true) / 10
+      },
+      roll: view.getInt16(33, true) / 100,
+      yaw: view.getInt16(35, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(37, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, screen, prediction (59 bytes)
+const decodeQuantized27 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192,
+      screen: {
+        display: view.getInt32(25, true),
+        u: view.getInt16(29, true) / 16384,
+        v: view.getInt16(31, true) / 16384,
+        x: view.getInt16(33, true) / 1,
+        y: view.getInt16(35, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(37, true) / 32767,
+      pitch: view.getInt16(39, true) / 100,
+      position: {
+        x: view.getInt16(41, true) / 10,
+        y: view.getInt16(43, true) / 10,
+        z: view.getInt16(45, true) / 10
+      },
+      roll: view.getInt16(47, true) / 100,
+      yaw: view.getInt16(49, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(51, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence, screen, prediction (32 bytes)
+const decodeQuantized28 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(12, true),
+        u: view.getInt16(16, true) / 16384,
+        v: view.getInt16(18, true) / 16384,
+        x: view.getInt16(20, true) / 1,
+        y: view.getInt16(22, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(24, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence, screen, prediction (46 bytes)
+const decodeQuantized29 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192,
+      screen: {
+        display: view.getInt32(26, true),
+        u: view.getInt16(30, true) / 16384,
+        v: view.getInt16(32, true) / 16384,
+        x: view.getInt16(34, true) / 1,
+        y: view.getInt16(36, true) / 1
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(38, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence, screen, prediction (46 bytes)
+const decodeQuantized30 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      screen: {
+        display: view.getInt32(12, true),
+        u: view.getInt16(16, true) / 16384,
+        v: view.getInt16(18, true) / 16384,
+        x: view.getInt16(20, true) / 1,
+        y: view.getInt16(22, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(24, true) / 32767,
+      pitch: view.getInt16(26, true) / 100,
+      position: {
+        x: view.getInt16(28, true) / 10,
+        y: view.getInt16(30, true) / 10,
+        z: view.getInt16(32, true) / 10
+      },
+      roll: view.getInt16(34, true) / 100,
+      yaw: view.getInt16(36, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(38, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence, screen, prediction (60 bytes)
+const decodeQuantized31 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192,
+      screen: {
+        display: view.getInt32(26, true),
+        u: view.getInt16(30, true) / 16384,
+        v: view.getInt16(32, true) / 16384,
+        x: view.getInt16(34, true) / 1,
+        y: view.getInt16(36, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(38, true) / 32767,
+      pitch: view.getInt16(40, true) / 100,
+      position: {
+        x: view.getInt16(42, true) / 10,
+        y: view.getInt16(44, true) / 10,
+        z: view.getInt16(46, true) / 10
+      },
+      roll: view.getInt16(48, true) / 100,
+      yaw: view.getInt16(50, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(52, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: pose (54 bytes)
+const decodeQuantized32 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(8, true) / 10,
+          y: view.getInt16(10, true) / 10,
+          z: view.getInt16(12, true) / 10
+        },
+        direction: {
+          x: view.getInt16(14, true) / 32767,
+          y: view.getInt16(16, true) / 32767,
+          z: view.getInt16(18, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(20, true) / 32767,
+        x: view.getInt16(22, true) / 32767,
+        y: view.getInt16(24, true) / 32767,
+        z: view.getInt16(26, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(28, true) / 32767,
+        m01: view.getInt16(30, true) / 32767,
+        m02: view.getInt16(32, true) / 32767,
+        m10: view.getInt16(34, true) / 32767,
+        m11: view.getInt16(36, true) / 32767,
+        m12: view.getInt16(38, true) / 32767,
+        m20: view.getInt16(40, true) / 32767,
+        m21: view.getInt16(42, true) / 32767,
+        m22: view.getInt16(44, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(46, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, pose (68 bytes)
+const decodeQuantized33 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(22, true) / 10,
+          y: view.getInt16(24, true) / 10,
+          z: view.getInt16(26, true) / 10
+        },
+        direction: {
+          x: view.getInt16(28, true) / 32767,
+          y: view.getInt16(30, true) / 32767,
+          z: view.getInt16(32, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(34, true) / 32767,
+        x: view.getInt16(36, true) / 32767,
+        y: view.getInt16(38, true) / 32767,
+        z: view.getInt16(40, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(42, true) / 32767,
+        m01: view.getInt16(44, true) / 32767,
+        m02: view.getInt16(46, true) / 32767,
+        m10: view.getInt16(48, true) / 32767,
+        m11: view.getInt16(50, true) / 32767,
+        m12: view.getInt16(52, true) / 32767,
+        m20: view.getInt16(54, true) / 32767,
+        m21: view.getInt16(56, true) / 32767,
+        m22: view.getInt16(58, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(60, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, pose (68 bytes)
+const decodeQuantized34 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(8, true) / 10,
+          y: view.getInt16(10, true) / 10,
+          z: view.getInt16(12, true) / 10
+        },
+        direction: {
+          x: view.getInt16(14, true) / 32767,
+          y: view.getInt16(16, true) / 32767,
+          z: view.getInt16(18, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(20, true) / 32767,
+      orientation: {
+        w: view.getInt16(22, true) / 32767,
+        x: view.getInt16(24, true) / 32767,
+        y: view.getInt16(26, true) / 32767,
+        z: view.getInt16(28, true) / 32767
+      },
+      pitch: view.getInt16(30, true) / 100,
+      position: {
+        x: view.getInt16(32, true) / 10,
+        y: view.getInt16(34, true) / 10,
+        z: view.getInt16(36, true) / 10
+      },
+      roll: view.getInt16(38, true) / 100,
+      rotation: {
+        m00: view.getInt16(40, true) / 32767,
+        m01: view.getInt16(42, true) / 32767,
+        m02: view.getInt16(44, true) / 32767,
+        m10: view.getInt16(46, true) / 32767,
+        m11: view.getInt16(48, true) / 32767,
+        m12: view.getInt16(50, true) / 32767,
+        m20: view.getInt16(52, true) / 32767,
+        m21: view.getInt16(54, true) / 32767,
+        m22: view.getInt16(56, true) / 32767
+      },
+      yaw: view.getInt16(58, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(60, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, pose (82 bytes)
+const decodeQuantized35 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(22, true) / 10,
+          y: view.getInt16(24, true) / 10,
+          z: view.getInt16(26, true) / 10
+        },
+        direction: {
+          x: view.getInt16(28, true) / 32767,
+          y: view.getInt16(30, true) / 32767,
+          z: view.getInt16(32, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(34, true) / 32767,
+      orientation: {
+        w: view.getInt16(36, true) / 32767,
+        x: view.getInt16(38, true) / 32767,
+        y: view.getInt16(40, true) / 32767,
+        z: view.getInt16(42, true) / 32767
+      },
+      pitch: view.getInt16(44, true) / 100,
+      position: {
+        x: view.getInt16(46, true) / 10,
+        y: view.getInt16(48, true) / 10,
+        z: view.getInt16(50, true) / 10
+      },
+      roll: view.getInt16(52, true) / 100,
+      rotation: {
+        m00: view.getInt16(54, true) / 32767,
+        m01: view.getInt16(56, true) / 32767,
+        m02: view.getInt16(58, true) / 32767,
+        m10: view.getInt16(60, true) / 32767,
+        m11: view.getInt16(62, true) / 32767,
+        m12: view.getInt16(64, true) / 32767,
+        m20: view.getInt16(66, true) / 32767,
+        m21: view.getInt16(68, true) / 32767,
+        m22: view.getInt16(70, true) / 32767
+      },
+      yaw: view.getInt16(72, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(74, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence, pose (55 bytes)
+const decodeQuantized36 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(9, true) / 10,
+          y: view.getInt16(11, true) / 10,
+          z: view.getInt16(13, true) / 10
+        },
+        direction: {
+          x: view.getInt16(15, true) / 32767,
+          y: view.getInt16(17, true) / 32767,
+          z: view.getInt16(19, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(21, true) / 32767,
+        x: view.getInt16(23, true) / 32767,
+        y: view.getInt16(25, true) / 32767,
+        z: view.getInt16(27, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(29, true) / 32767,
+        m01: view.getInt16(31, true) / 32767,
+        m02: view.getInt16(33, true) / 32767,
+        m10: view.getInt16(35, true) / 32767,
+        m11: view.getInt16(37, true) / 32767,
+        m12: view.getInt16(39, true) / 32767,
+        m20: view.getInt16(41, true) / 32767,
+        m21: view.getInt16(43, true) / 32767,
+        m22: view.getInt16(45, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(47, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence, pose (69 bytes)
+const decodeQuantized37 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(23, true) / 10,
+          y: view.getInt16(25, true) / 10,
+          z: view.getInt16(27, true) / 10
+        },
+        direction: {
+          x: view.getInt16(29, true) / 32767,
+          y: view.getInt16(31, true) / 32767,
+          z: view.getInt16(33, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(35, true) / 32767,
+        x: view.getInt16(37, true) / 32767,
+        y: view.getInt16(39, true) / 32767,
+        z: view.getInt16(41, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(43, true) / 32767,
+        m01: view.getInt16(45, true) / 32767,
+        m02: view.getInt16(47, true) / 32767,
+        m10: view.getInt16(49, true) / 32767,
+        m11: view.getInt16(51, true) / 32767,
+        m12: view.getInt16(53, true) / 32767,
+        m20: view.getInt16(55, true) / 32767,
+        m21: view.getInt16(57, true) / 32767,
+        m22: view.getInt16(59, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(61, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence, pose (69 bytes)
+const decodeQuantized38 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(9, true) / 10,
+          y: view.getInt16(11, true) / 10,
+          z: view.getInt16(13, true) / 10
+        },
+        direction: {
+          x: view.getInt16(15, true) / 32767,
+          y: view.getInt16(17, true) / 32767,
+          z: view.getInt16(19, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(21, true) / 32767,
+      orientation: {
+        w: view.getInt16(23, true) / 32767,
+        x: view.getInt16(25, true) / 32767,
+        y: view.getInt16(27, true) / 32767,
+        z: view.getInt16(29, true) / 32767
+      },
+      pitch: view.getInt16(31, true) / 100,
+      position: {
+        x: view.getInt16(33, true) / 10,
+        y: view.getInt16(35, true) / 10,
+        z: view.getInt16(37, true) / 10
+      },
+      roll: view.getInt16(39, true) / 100,
+      rotation: {
+        m00: view.getInt16(41, true) / 32767,
+        m01: view.getInt16(43, true) / 32767,
+        m02: view.getInt16(45, true) / 32767,
+        m10: view.getInt16(47, true) / 32767,
+        m11: view.getInt16(49, true) / 32767,
+        m12: view.getInt16(51, true) / 32767,
+        m20: view.getInt16(53, true) / 32767,
+        m21: view.getInt16(55, true) / 32767,
+        m22: view.getInt16(57, true) / 32767
+      },
+      yaw: view.getInt16(59, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(61, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence, pose (83 bytes)
+const decodeQuantized39 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(23, true) / 10,
+          y: view.getInt16(25, true) / 10,
+          z: view.getInt16(27, true) / 10
+        },
+        direction: {
+          x: view.getInt16(29, true) / 32767,
+          y: view.getInt16(31, true) / 32767,
+          z: view.getInt16(33, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(35, true) / 32767,
+      orientation: {
+        w: view.getInt16(37, true) / 32767,
+        x: view.getInt16(39, true) / 32767,
+        y: view.getInt16(41, true) / 32767,
+        z: view.getInt16(43, true) / 32767
+      },
+      pitch: view.getInt16(45, true) / 100,
+      position: {
+        x: view.getInt16(47, true) / 10,
+        y: view.getInt16(49, true) / 10,
+        z: view.getInt16(51, true) / 10
+      },
+      roll: view.getInt16(53, true) / 100,
+      rotation: {
+        m00: view.getInt16(55, true) / 32767,
+        m01: view.getInt16(57, true) / 32767,
+        m02: view.getInt16(59, true) / 32767,
+        m10: view.getInt16(61, true) / 32767,
+        m11: view.getInt16(63, true) / 32767,
+        m12: view.getInt16(65, true) / 32767,
+        m20: view.getInt16(67, true) / 32767,
+        m21: view.getInt16(69, true) / 32767,
+        m22: view.getInt16(71, true) / 32767
+      },
+      yaw: view.getInt16(73, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(75, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: screen, pose (66 bytes)
+const decodeQuantized40 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(8, true) / 10,
+          y: view.getInt16(10, true) / 10,
+          z: view.getInt16(12, true) / 10
+        },
+        direction: {
+          x: view.getInt16(14, true) / 32767,
+          y: view.getInt16(16, true) / 32767,
+          z: view.getInt16(18, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(20, true),
+        u: view.getInt16(24, true) / 16384,
+        v: view.getInt16(26, true) / 16384,
+        x: view.getInt16(28, true) / 1,
+        y: view.getInt16(30, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(32, true) / 32767,
+        x: view.getInt16(34, true) / 32767,
+        y: view.getInt16(36, true) / 32767,
+        z: view.getInt16(38, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(40, true) / 32767,
+        m01: view.getInt16(42, true) / 32767,
+        m02: view.getInt16(44, true) / 32767,
+        m10: view.getInt16(46, true) / 32767,
+        m11: view.getInt16(48, true) / 32767,
+        m12: view.getInt16(50, true) / 32767,
+        m20: view.getInt16(52, true) / 32767,
+        m21: view.getInt16(54, true) / 32767,
+        m22: view.getInt16(56, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(58, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, screen, pose (80 bytes)
+const decodeQuantized41 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(22, true) / 10,
+          y: view.getInt16(24, true) / 10,
+          z: view.getInt16(26, true) / 10
+        },
+        direction: {
+          x: view.getInt16(28, true) / 32767,
+          y: view.getInt16(30, true) / 32767,
+          z: view.getInt16(32, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(34, true),
+        u: view.getInt16(38, true) / 16384,
+        v: view.getInt16(40, true) / 16384,
+        x: view.getInt16(42, true) / 1,
+        y: view.getInt16(44, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(46, true) / 32767,
+        x: view.getInt16(48, true) / 32767,
+        y: view.getInt16(50, true) / 32767,
+        z: view.getInt16(52, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(54, true) / 32767,
+        m01: view.getInt16(56, true) / 32767,
+        m02: view.getInt16(58, true) / 32767,
+        m10: view.getInt16(60, true) / 32767,
+        m11: view.getInt16(62, true) / 32767,
+        m12: view.getInt16(64, true) / 32767,
+        m20: view.getInt16(66, true) / 32767,
+        m21: view.getInt16(68, true) / 32767,
+        m22: view.getInt16(70, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(72, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, screen, pose (80 bytes)
+const decodeQuantized42 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(8, true) / 10,
+          y: view.getInt16(10, true) / 10,
+          z: view.getInt16(12, true) / 10
+        },
+        direction: {
+          x: view.getInt16(14, true) / 32767,
+          y: view.getInt16(16, true) / 32767,
+          z: view.getInt16(18, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(20, true),
+        u: view.getInt16(24, true) / 16384,
+        v: view.getInt16(26, true) / 16384,
+        x: view.getInt16(28, true) / 1,
+        y: view.getInt16(30, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(32, true) / 32767,
+      orientation: {
+        w: view.getInt16(34, true) / 32767,
+        x: view.getInt16(36, true) / 32767,
+        y: view.getInt16(38, true) / 32767,
+        z: view.getInt16(40, true) / 32767
+      },
+      pitch: view.getInt16(42, true) / 100,
+      position: {
+        x: view.getInt16(44, true) / 10,
+        y: view.getInt16(46, true) / 10,
+        z: view.getInt16(48, true) / 10
+      },
+      roll: view.getInt16(50, true) / 100,
+      rotation: {
+        m00: view.getInt16(52, true) / 32767,
+        m01: view.getInt16(54, true) / 32767,
+        m02: view.getInt16(56, true) / 32767,
+        m10: view.getInt16(58, true) / 32767,
+        m11: view.getInt16(60, true) / 32767,
+        m12: view.getInt16(62, true) / 32767,
+        m20: view.getInt16(64, true) / 32767,
+        m21: view.getInt16(66, true) / 32767,
+        m22: view.getInt16(68, true) / 32767
+      },
+      yaw: view.getInt16(70, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(72, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, screen, pose (94 bytes)
+const decodeQuantized43 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(8, true) / 32767,
+      timestamp: Number(view.getBigUint64(10, true)),
+      x: view.getInt16(18, true) / 8192,
+      y: view.getInt16(20, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(22, true) / 10,
+          y: view.getInt16(24, true) / 10,
+          z: view.getInt16(26, true) / 10
+        },
+        direction: {
+          x: view.getInt16(28, true) / 32767,
+          y: view.getInt16(30, true) / 32767,
+          z: view.getInt16(32, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(34, true),
+        u: view.getInt16(38, true) / 16384,
+        v: view.getInt16(40, true) / 16384,
+        x: view.getInt16(42, true) / 1,
+        y: view.getInt16(44, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(46, true) / 32767,
+      orientation: {
+        w: view.getInt16(48, true) / 32767,
+        x: view.getInt16(50, true) / 32767,
+        y: view.getInt16(52, true) / 32767,
+        z: view.getInt16(54, true) / 32767
+      },
+      pitch: view.getInt16(56, true) / 100,
+      position: {
+        x: view.getInt16(58, true) / 10,
+        y: view.getInt16(60, true) / 10,
+        z: view.getInt16(62, true) / 10
+      },
+      roll: view.getInt16(64, true) / 100,
+      rotation: {
+        m00: view.getInt16(66, true) / 32767,
+        m01: view.getInt16(68, true) / 32767,
+        m02: view.getInt16(70, true) / 32767,
+        m10: view.getInt16(72, true) / 32767,
+        m11: view.getInt16(74, true) / 32767,
+        m12: view.getInt16(76, true) / 32767,
+        m20: view.getInt16(78, true) / 32767,
+        m21: view.getInt16(80, true) / 32767,
+        m22: view.getInt16(82, true) / 32767
+      },
+      yaw: view.getInt16(84, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(86, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence, screen, pose (67 bytes)
+const decodeQuantized44 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(9, true) / 10,
+          y: view.getInt16(11, true) / 10,
+          z: view.getInt16(13, true) / 10
+        },
+        direction: {
+          x: view.getInt16(15, true) / 32767,
+          y: view.getInt16(17, true) / 32767,
+          z: view.getInt16(19, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(21, true),
+        u: view.getInt16(25, true) / 16384,
+        v: view.getInt16(27, true) / 16384,
+        x: view.getInt16(29, true) / 1,
+        y: view.getInt16(31, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(33, true) / 32767,
+        x: view.getInt16(35, true) / 32767,
+        y: view.getInt16(37, true) / 32767,
+        z: view.getInt16(39, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(41, true) / 32767,
+        m01: view.getInt16(43, true) / 32767,
+        m02: view.getInt16(45, true) / 32767,
+        m10: view.getInt16(47, true) / 32767,
+        m11: view.getInt16(49, true) / 32767,
+        m12: view.getInt16(51, true) / 32767,
+        m20: view.getInt16(53, true) / 32767,
+        m21: view.getInt16(55, true) / 32767,
+        m22: view.getInt16(57, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(59, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence, screen, pose (81 bytes)
+const decodeQuantized45 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(23, true) / 10,
+          y: view.getInt16(25, true) / 10,
+          z: view.getInt16(27, true) / 10
+        },
+        direction: {
+          x: view.getInt16(29, true) / 32767,
+          y: view.getInt16(31, true) / 32767,
+          z: view.getInt16(33, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(35, true),
+        u: view.getInt16(39, true) / 16384,
+        v: view.getInt16(41, true) / 16384,
+        x: view.getInt16(43, true) / 1,
+        y: view.getInt16(45, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(47, true) / 32767,
+        x: view.getInt16(49, true) / 32767,
+        y: view.getInt16(51, true) / 32767,
+        z: view.getInt16(53, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(55, true) / 32767,
+        m01: view.getInt16(57, true) / 32767,
+        m02: view.getInt16(59, true) / 32767,
+        m10: view.getInt16(61, true) / 32767,
+        m11: view.getInt16(63, true) / 32767,
+        m12: view.getInt16(65, true) / 32767,
+        m20: view.getInt16(67, true) / 32767,
+        m21: view.getInt16(69, true) / 32767,
+        m22: view.getInt16(71, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(73, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence, screen, pose (81 bytes)
+const decodeQuantized46 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(9, true) / 10,
+          y: view.getInt16(11, true) / 10,
+          z: view.getInt16(13, true) / 10
+        },
+        direction: {
+          x: view.getInt16(15, true) / 32767,
+          y: view.getInt16(17, true) / 32767,
+          z: view.getInt16(19, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(21, true),
+        u: view.getInt16(25, true) / 16384,
+        v: view.getInt16(27, true) / 16384,
+        x: view.getInt16(29, true) / 1,
+        y: view.getInt16(31, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(33, true) / 32767,
+      orientation: {
+        w: view.getInt16(35, true) / 32767,
+        x: view.getInt16(37, true) / 32767,
+        y: view.getInt16(39, true) / 32767,
+        z: view.getInt16(41, true) / 32767
+      },
+      pitch: view.getInt16(43, true) / 100,
+      position: {
+        x: view.getInt16(45, true) / 10,
+        y: view.getInt16(47, true) / 10,
+        z: view.getInt16(49, true) / 10
+      },
+      roll: view.getInt16(51, true) / 100,
+      rotation: {
+        m00: view.getInt16(53, true) / 32767,
+        m01: view.getInt16(55, true) / 32767,
+        m02: view.getInt16(57, true) / 32767,
+        m10: view.getInt16(59, true) / 32767,
+        m11: view.getInt16(61, true) / 32767,
+        m12: view.getInt16(63, true) / 32767,
+        m20: view.getInt16(65, true) / 32767,
+        m21: view.getInt16(67, true) / 32767,
+        m22: view.getInt16(69, true) / 32767
+      },
+      yaw: view.getInt16(71, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(73, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence, screen, pose (95 bytes)
+const decodeQuantized47 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    present: view.getUint8(8) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(9, true) / 32767,
+      timestamp: Number(view.getBigUint64(11, true)),
+      x: view.getInt16(19, true) / 8192,
+      y: view.getInt16(21, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(23, true) / 10,
+          y: view.getInt16(25, true) / 10,
+          z: view.getInt16(27, true) / 10
+        },
+        direction: {
+          x: view.getInt16(29, true) / 32767,
+          y: view.getInt16(31, true) / 32767,
+          z: view.getInt16(33, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(35, true),
+        u: view.getInt16(39, true) / 16384,
+        v: view.getInt16(41, true) / 16384,
+        x: view.getInt16(43, true) / 1,
+        y: view.getInt16(45, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(47, true) / 32767,
+      orientation: {
+        w: view.getInt16(49, true) / 32767,
+        x: view.getInt16(51, true) / 32767,
+        y: view.getInt16(53, true) / 32767,
+        z: view.getInt16(55, true) / 32767
+      },
+      pitch: view.getInt16(57, true) / 100,
+      position: {
+        x: view.getInt16(59, true) / 10,
+        y: view.getInt16(61, true) / 10,
+        z: view.getInt16(63, true) / 10
+      },
+      roll: view.getInt16(65, true) / 100,
+      rotation: {
+        m00: view.getInt16(67, true) / 32767,
+        m01: view.getInt16(69, true) / 32767,
+        m02: view.getInt16(71, true) / 32767,
+        m10: view.getInt16(73, true) / 32767,
+        m11: view.getInt16(75, true) / 32767,
+        m12: view.getInt16(77, true) / 32767,
+        m20: view.getInt16(79, true) / 32767,
+        m21: view.getInt16(81, true) / 32767,
+        m22: view.getInt16(83, true) / 32767
+      },
+      yaw: view.getInt16(85, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(87, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: prediction, pose (57 bytes)
+const decodeQuantized48 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(11, true) / 10,
+          y: view.getInt16(13, true) / 10,
+          z: view.getInt16(15, true) / 10
+        },
+        direction: {
+          x: view.getInt16(17, true) / 32767,
+          y: view.getInt16(19, true) / 32767,
+          z: view.getInt16(21, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(23, true) / 32767,
+        x: view.getInt16(25, true) / 32767,
+        y: view.getInt16(27, true) / 32767,
+        z: view.getInt16(29, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(31, true) / 32767,
+        m01: view.getInt16(33, true) / 32767,
+        m02: view.getInt16(35, true) / 32767,
+        m10: view.getInt16(37, true) / 32767,
+        m11: view.getInt16(39, true) / 32767,
+        m12: view.getInt16(41, true) / 32767,
+        m20: view.getInt16(43, true) / 32767,
+        m21: view.getInt16(45, true) / 32767,
+        m22: view.getInt16(47, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(49, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, prediction, pose (71 bytes)
+const decodeQuantized49 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(25, true) / 10,
+          y: view.getInt16(27, true) / 10,
+          z: view.getInt16(29, true) / 10
+        },
+        direction: {
+          x: view.getInt16(31, true) / 32767,
+          y: view.getInt16(33, true) / 32767,
+          z: view.getInt16(35, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(37, true) / 32767,
+        x: view.getInt16(39, true) / 32767,
+        y: view.getInt16(41, true) / 32767,
+        z: view.getInt16(43, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(45, true) / 32767,
+        m01: view.getInt16(47, true) / 32767,
+        m02: view.getInt16(49, true) / 32767,
+        m10: view.getInt16(51, true) / 32767,
+        m11: view.getInt16(53, true) / 32767,
+        m12: view.getInt16(55, true) / 32767,
+        m20: view.getInt16(57, true) / 32767,
+        m21: view.getInt16(59, true) / 32767,
+        m22: view.getInt16(61, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(63, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, prediction, pose (71 bytes)
+const decodeQuantized50 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(11, true) / 10,
+          y: view.getInt16(13, true) / 10,
+          z: view.getInt16(15, true) / 10
+        },
+        direction: {
+          x: view.getInt16(17, true) / 32767,
+          y: view.getInt16(19, true) / 32767,
+          z: view.getInt16(21, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(23, true) / 32767,
+      orientation: {
+        w: view.getInt16(25, true) / 32767,
+        x: view.getInt16(27, true) / 32767,
+        y: view.getInt16(29, true) / 32767,
+        z: view.getInt16(31, true) / 32767
+      },
+      pitch: view.getInt16(33, true) / 100,
+      position: {
+        x: view.getInt16(35, true) / 10,
+        y: view.getInt16(37, true) / 10,
+        z: view.getInt16(39, true) / 10
+      },
+      roll: view.getInt16(41, true) / 100,
+      rotation: {
+        m00: view.getInt16(43, true) / 32767,
+        m01: view.getInt16(45, true) / 32767,
+        m02: view.getInt16(47, true) / 32767,
+        m10: view.getInt16(49, true) / 32767,
+        m11: view.getInt16(51, true) / 32767,
+        m12: view.getInt16(53, true) / 32767,
+        m20: view.getInt16(55, true) / 32767,
+        m21: view.getInt16(57, true) / 32767,
+        m22: view.getInt16(59, true) / 32767
+      },
+      yaw: view.getInt16(61, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(63, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, prediction, pose (85 bytes)
+const decodeQuantized51 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(25, true) / 10,
+          y: view.getInt16(27, true) / 10,
+          z: view.getInt16(29, true) / 10
+        },
+        direction: {
+          x: view.getInt16(31, true) / 32767,
+          y: view.getInt16(33, true) / 32767,
+          z: view.getInt16(35, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(37, true) / 32767,
+      orientation: {
+        w: view.getInt16(39, true) / 32767,
+        x: view.getInt16(41, true) / 32767,
+        y: view.getInt16(43, true) / 32767,
+        z: view.getInt16(45, true) / 32767
+      },
+      pitch: view.getInt16(47, true) / 100,
+      position: {
+        x: view.getInt16(49, true) / 10,
+        y: view.getInt16(51, true) / 10,
+        z: view.getInt16(53, true) / 10
+      },
+      roll: view.getInt16(55, true) / 100,
+      rotation: {
+        m00: view.getInt16(57, true) / 32767,
+        m01: view.getInt16(59, true) / 32767,
+        m02: view.getInt16(61, true) / 32767,
+        m10: view.getInt16(63, true) / 32767,
+        m11: view.getInt16(65, true) / 32767,
+        m12: view.getInt16(67, true) / 32767,
+        m20: view.getInt16(69, true) / 32767,
+        m21: view.getInt16(71, true) / 32767,
+        m22: view.getInt16(73, true) / 32767
+      },
+      yaw: view.getInt16(75, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(77, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence, prediction, pose (58 bytes)
+const decodeQuantized52 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(12, true) / 10,
+          y: view.getInt16(14, true) / 10,
+          z: view.getInt16(16, true) / 10
+        },
+        direction: {
+          x: view.getInt16(18, true) / 32767,
+          y: view.getInt16(20, true) / 32767,
+          z: view.getInt16(22, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(24, true) / 32767,
+        x: view.getInt16(26, true) / 32767,
+        y: view.getInt16(28, true) / 32767,
+        z: view.getInt16(30, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(32, true) / 32767,
+        m01: view.getInt16(34, true) / 32767,
+        m02: view.getInt16(36, true) / 32767,
+        m10: view.getInt16(38, true) / 32767,
+        m11: view.getInt16(40, true) / 32767,
+        m12: view.getInt16(42, true) / 32767,
+        m20: view.getInt16(44, true) / 32767,
+        m21: view.getInt16(46, true) / 32767,
+        m22: view.getInt16(48, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(50, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence, prediction, pose (72 bytes)
+const decodeQuantized53 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(26, true) / 10,
+          y: view.getInt16(28, true) / 10,
+          z: view.getInt16(30, true) / 10
+        },
+        direction: {
+          x: view.getInt16(32, true) / 32767,
+          y: view.getInt16(34, true) / 32767,
+          z: view.getInt16(36, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(38, true) / 32767,
+        x: view.getInt16(40, true) / 32767,
+        y: view.getInt16(42, true) / 32767,
+        z: view.getInt16(44, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(46, true) / 32767,
+        m01: view.getInt16(48, true) / 32767,
+        m02: view.getInt16(50, true) / 32767,
+        m10: view.getInt16(52, true) / 32767,
+        m11: view.getInt16(54, true) / 32767,
+        m12: view.getInt16(56, true) / 32767,
+        m20: view.getInt16(58, true) / 32767,
+        m21: view.getInt16(60, true) / 32767,
+        m22: view.getInt16(62, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(64, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence, prediction, pose (72 bytes)
+const decodeQuantized54 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(12, true) / 10,
+          y: view.getInt16(14, true) / 10,
+          z: view.getInt16(16, true) / 10
+        },
+        direction: {
+          x: view.getInt16(18, true) / 32767,
+          y: view.getInt16(20, true) / 32767,
+          z: view.getInt16(22, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(24, true) / 32767,
+      orientation: {
+        w: view.getInt16(26, true) / 32767,
+        x: view.getInt16(28, true) / 32767,
+        y: view.getInt16(30, true) / 32767,
+        z: view.getInt16(32, true) / 32767
+      },
+      pitch: view.getInt16(34, true) / 100,
+      position: {
+        x: view.getInt16(36, true) / 10,
+        y: view.getInt16(38, true) / 10,
+        z: view.getInt16(40, true) / 10
+      },
+      roll: view.getInt16(42, true) / 100,
+      rotation: {
+        m00: view.getInt16(44, true) / 32767,
+        m01: view.getInt16(46, true) / 32767,
+        m02: view.getInt16(48, true) / 32767,
+        m10: view.getInt16(50, true) / 32767,
+        m11: view.getInt16(52, true) / 32767,
+        m12: view.getInt16(54, true) / 32767,
+        m20: view.getInt16(56, true) / 32767,
+        m21: view.getInt16(58, true) / 32767,
+        m22: view.getInt16(60, true) / 32767
+      },
+      yaw: view.getInt16(62, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(64, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence, prediction, pose (86 bytes)
+const decodeQuantized55 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(26, true) / 10,
+          y: view.getInt16(28, true) / 10,
+          z: view.getInt16(30, true) / 10
+        },
+        direction: {
+          x: view.getInt16(32, true) / 32767,
+          y: view.getInt16(34, true) / 32767,
+          z: view.getInt16(36, true) / 32767
+        }
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(38, true) / 32767,
+      orientation: {
+        w: view.getInt16(40, true) / 32767,
+        x: view.getInt16(42, true) / 32767,
+        y: view.getInt16(44, true) / 32767,
+        z: view.getInt16(46, true) / 32767
+      },
+      pitch: view.getInt16(48, true) / 100,
+      position: {
+        x: view.getInt16(50, true) / 10,
+        y: view.getInt16(52, true) / 10,
+        z: view.getInt16(54, true) / 10
+      },
+      roll: view.getInt16(56, true) / 100,
+      rotation: {
+        m00: view.getInt16(58, true) / 32767,
+        m01: view.getInt16(60, true) / 32767,
+        m02: view.getInt16(62, true) / 32767,
+        m10: view.getInt16(64, true) / 32767,
+        m11: view.getInt16(66, true) / 32767,
+        m12: view.getInt16(68, true) / 32767,
+        m20: view.getInt16(70, true) / 32767,
+        m21: view.getInt16(72, true) / 32767,
+        m22: view.getInt16(74, true) / 32767
+      },
+      yaw: view.getInt16(76, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(78, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: screen, prediction, pose (69 bytes)
+const decodeQuantized56 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(11, true) / 10,
+          y: view.getInt16(13, true) / 10,
+          z: view.getInt16(15, true) / 10
+        },
+        direction: {
+          x: view.getInt16(17, true) / 32767,
+          y: view.getInt16(19, true) / 32767,
+          z: view.getInt16(21, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(23, true),
+        u: view.getInt16(27, true) / 16384,
+        v: view.getInt16(29, true) / 16384,
+        x: view.getInt16(31, true) / 1,
+        y: view.getInt16(33, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(35, true) / 32767,
+        x: view.getInt16(37, true) / 32767,
+        y: view.getInt16(39, true) / 32767,
+        z: view.getInt16(41, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(43, true) / 32767,
+        m01: view.getInt16(45, true) / 32767,
+        m02: view.getInt16(47, true) / 32767,
+        m10: view.getInt16(49, true) / 32767,
+        m11: view.getInt16(51, true) / 32767,
+        m12: view.getInt16(53, true) / 32767,
+        m20: view.getInt16(55, true) / 32767,
+        m21: view.getInt16(57, true) / 32767,
+        m22: view.getInt16(59, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(61, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, screen, prediction, pose (83 bytes)
+const decodeQuantized57 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(25, true) / 10,
+          y: view.getInt16(27, true) / 10,
+          z: view.getInt16(29, true) / 10
+        },
+        direction: {
+          x: view.getInt16(31, true) / 32767,
+          y: view.getInt16(33, true) / 32767,
+          z: view.getInt16(35, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(37, true),
+        u: view.getInt16(41, true) / 16384,
+        v: view.getInt16(43, true) / 16384,
+        x: view.getInt16(45, true) / 1,
+        y: view.getInt16(47, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(49, true) / 32767,
+        x: view.getInt16(51, true) / 32767,
+        y: view.getInt16(53, true) / 32767,
+        z: view.getInt16(55, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(57, true) / 32767,
+        m01: view.getInt16(59, true) / 32767,
+        m02: view.getInt16(61, true) / 32767,
+        m10: view.getInt16(63, true) / 32767,
+        m11: view.getInt16(65, true) / 32767,
+        m12: view.getInt16(67, true) / 32767,
+        m20: view.getInt16(69, true) / 32767,
+        m21: view.getInt16(71, true) / 32767,
+        m22: view.getInt16(73, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(75, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, screen, prediction, pose (83 bytes)
+const decodeQuantized58 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(11, true) / 10,
+          y: view.getInt16(13, true) / 10,
+          z: view.getInt16(15, true) / 10
+        },
+        direction: {
+          x: view.getInt16(17, true) / 32767,
+          y: view.getInt16(19, true) / 32767,
+          z: view.getInt16(21, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(23, true),
+        u: view.getInt16(27, true) / 16384,
+        v: view.getInt16(29, true) / 16384,
+        x: view.getInt16(31, true) / 1,
+        y: view.getInt16(33, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(35, true) / 32767,
+      orientation: {
+        w: view.getInt16(37, true) / 32767,
+        x: view.getInt16(39, true) / 32767,
+        y: view.getInt16(41, true) / 32767,
+        z: view.getInt16(43, true) / 32767
+      },
+      pitch: view.getInt16(45, true) / 100,
+      position: {
+        x: view.getInt16(47, true) / 10,
+        y: view.getInt16(49, true) / 10,
+        z: view.getInt16(51, true) / 10
+      },
+      roll: view.getInt16(53, true) / 100,
+      rotation: {
+        m00: view.getInt16(55, true) / 32767,
+        m01: view.getInt16(57, true) / 32767,
+        m02: view.getInt16(59, true) / 32767,
+        m10: view.getInt16(61, true) / 32767,
+        m11: view.getInt16(63, true) / 32767,
+        m12: view.getInt16(65, true) / 32767,
+        m20: view.getInt16(67, true) / 32767,
+        m21: view.getInt16(69, true) / 32767,
+        m22: view.getInt16(71, true) / 32767
+      },
+      yaw: view.getInt16(73, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(75, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, screen, prediction, pose (97 bytes)
+const decodeQuantized59 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(11, true) / 32767,
+      timestamp: Number(view.getBigUint64(13, true)),
+      x: view.getInt16(21, true) / 8192,
+      y: view.getInt16(23, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(25, true) / 10,
+          y: view.getInt16(27, true) / 10,
+          z: view.getInt16(29, true) / 10
+        },
+        direction: {
+          x: view.getInt16(31, true) / 32767,
+          y: view.getInt16(33, true) / 32767,
+          z: view.getInt16(35, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(37, true),
+        u: view.getInt16(41, true) / 16384,
+        v: view.getInt16(43, true) / 16384,
+        x: view.getInt16(45, true) / 1,
+        y: view.getInt16(47, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(49, true) / 32767,
+      orientation: {
+        w: view.getInt16(51, true) / 32767,
+        x: view.getInt16(53, true) / 32767,
+        y: view.getInt16(55, true) / 32767,
+        z: view.getInt16(57, true) / 32767
+      },
+      pitch: view.getInt16(59, true) / 100,
+      position: {
+        x: view.getInt16(61, true) / 10,
+        y: view.getInt16(63, true) / 10,
+        z: view.getInt16(65, true) / 10
+      },
+      roll: view.getInt16(67, true) / 100,
+      rotation: {
+        m00: view.getInt16(69, true) / 32767,
+        m01: view.getInt16(71, true) / 32767,
+        m02: view.getInt16(73, true) / 32767,
+        m10: view.getInt16(75, true) / 32767,
+        m11: view.getInt16(77, true) / 32767,
+        m12: view.getInt16(79, true) / 32767,
+        m20: view.getInt16(81, true) / 32767,
+        m21: view.getInt16(83, true) / 32767,
+        m22: view.getInt16(85, true) / 32767
+      },
+      yaw: view.getInt16(87, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(89, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: presence, screen, prediction, pose (70 bytes)
+const decodeQuantized60 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(12, true) / 10,
+          y: view.getInt16(14, true) / 10,
+          z: view.getInt16(16, true) / 10
+        },
+        direction: {
+          x: view.getInt16(18, true) / 32767,
+          y: view.getInt16(20, true) / 32767,
+          z: view.getInt16(22, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(24, true),
+        u: view.getInt16(28, true) / 16384,
+        v: view.getInt16(30, true) / 16384,
+        x: view.getInt16(32, true) / 1,
+        y: view.getInt16(34, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(36, true) / 32767,
+        x: view.getInt16(38, true) / 32767,
+        y: view.getInt16(40, true) / 32767,
+        z: view.getInt16(42, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(44, true) / 32767,
+        m01: view.getInt16(46, true) / 32767,
+        m02: view.getInt16(48, true) / 32767,
+        m10: view.getInt16(50, true) / 32767,
+        m11: view.getInt16(52, true) / 32767,
+        m12: view.getInt16(54, true) / 32767,
+        m20: view.getInt16(56, true) / 32767,
+        m21: view.getInt16(58, true) / 32767,
+        m22: view.getInt16(60, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(62, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, presence, screen, prediction, pose (84 bytes)
+const decodeQuantized61 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(26, true) / 10,
+          y: view.getInt16(28, true) / 10,
+          z: view.getInt16(30, true) / 10
+        },
+        direction: {
+          x: view.getInt16(32, true) / 32767,
+          y: view.getInt16(34, true) / 32767,
+          z: view.getInt16(36, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(38, true),
+        u: view.getInt16(42, true) / 16384,
+        v: view.getInt16(44, true) / 16384,
+        x: view.getInt16(46, true) / 1,
+        y: view.getInt16(48, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      orientation: {
+        w: view.getInt16(50, true) / 32767,
+        x: view.getInt16(52, true) / 32767,
+        y: view.getInt16(54, true) / 32767,
+        z: view.getInt16(56, true) / 32767
+      },
+      rotation: {
+        m00: view.getInt16(58, true) / 32767,
+        m01: view.getInt16(60, true) / 32767,
+        m02: view.getInt16(62, true) / 32767,
+        m10: view.getInt16(64, true) / 32767,
+        m11: view.getInt16(66, true) / 32767,
+        m12: view.getInt16(68, true) / 32767,
+        m20: view.getInt16(70, true) / 32767,
+        m21: view.getInt16(72, true) / 32767,
+        m22: view.getInt16(74, true) / 32767
+      }
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(76, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: head, presence, screen, prediction, pose (84 bytes)
+const decodeQuantized62 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      ray: {
+        origin: {
+          x: view.getInt16(12, true) / 10,
+          y: view.getInt16(14, true) / 10,
+          z: view.getInt16(16, true) / 10
+        },
+        direction: {
+          x: view.getInt16(18, true) / 32767,
+          y: view.getInt16(20, true) / 32767,
+          z: view.getInt16(22, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(24, true),
+        u: view.getInt16(28, true) / 16384,
+        v: view.getInt16(30, true) / 16384,
+        x: view.getInt16(32, true) / 1,
+        y: view.getInt16(34, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(36, true) / 32767,
+      orientation: {
+        w: view.getInt16(38, true) / 32767,
+        x: view.getInt16(40, true) / 32767,
+        y: view.getInt16(42, true) / 32767,
+        z: view.getInt16(44, true) / 32767
+      },
+      pitch: view.getInt16(46, true) / 100,
+      position: {
+        x: view.getInt16(48, true) / 10,
+        y: view.getInt16(50, true) / 10,
+        z: view.getInt16(52, true) / 10
+      },
+      roll: view.getInt16(54, true) / 100,
+      rotation: {
+        m00: view.getInt16(56, true) / 32767,
+        m01: view.getInt16(58, true) / 32767,
+        m02: view.getInt16(60, true) / 32767,
+        m10: view.getInt16(62, true) / 32767,
+        m11: view.getInt16(64, true) / 32767,
+        m12: view.getInt16(66, true) / 32767,
+        m20: view.getInt16(68, true) / 32767,
+        m21: view.getInt16(70, true) / 32767,
+        m22: view.getInt16(72, true) / 32767
+      },
+      yaw: view.getInt16(74, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(76, true)),
+  type: 'tobii-data'
+});
+
+// quantized, streams: gaze, head, presence, screen, prediction, pose (98 bytes)
+const decodeQuantized63 = (view) => ({
+  data: {
+    hasGaze: view.getUint8(4) !== 0,
+    hasHead: view.getUint8(5) !== 0,
+    overallQuality: view.getInt16(6, true) / 32767,
+    predicted: view.getUint8(8) !== 0,
+    predictionHorizonMs: view.getInt16(9, true) / 10,
+    present: view.getUint8(11) !== 0,
+    gaze: view.getUint8(4) !== 0 ? {
+      confidence: view.getInt16(12, true) / 32767,
+      timestamp: Number(view.getBigUint64(14, true)),
+      x: view.getInt16(22, true) / 8192,
+      y: view.getInt16(24, true) / 8192,
+      ray: {
+        origin: {
+          x: view.getInt16(26, true) / 10,
+          y: view.getInt16(28, true) / 10,
+          z: view.getInt16(30, true) / 10
+        },
+        direction: {
+          x: view.getInt16(32, true) / 32767,
+          y: view.getInt16(34, true) / 32767,
+          z: view.getInt16(36, true) / 32767
+        }
+      },
+      screen: {
+        display: view.getInt32(38, true),
+        u: view.getInt16(42, true) / 16384,
+        v: view.getInt16(44, true) / 16384,
+        x: view.getInt16(46, true) / 1,
+        y: view.getInt16(48, true) / 1
+      }
+    } : undefined,
+    head: view.getUint8(5) !== 0 ? {
+      confidence: view.getInt16(50, true) / 32767,
+      orientation: {
+        w: view.getInt16(52, true) / 32767,
+        x: view.getInt16(54, true) / 32767,
+        y: view.getInt16(56, true) / 32767,
+        z: view.getInt16(58, true) / 32767
+      },
+      pitch: view.getInt16(60, true) / 100,
+      position: {
+        x: view.getInt16(62, true) / 10,
+        y: view.getInt16(64, true) / 10,
+        z: view.getInt16(66, true) / 10
+      },
+      roll: view.getInt16(68, true) / 100,
+      rotation: {
+        m00: view.getInt16(70, true) / 32767,
+        m01: view.getInt16(72, true) / 32767,
+        m02: view.getInt16(74, true) / 32767,
+        m10: view.getInt16(76, true) / 32767,
+        m11: view.getInt16(78, true) / 32767,
+        m12: view.getInt16(80, true) / 32767,
+        m20: view.getInt16(82, true) / 32767,
+        m21: view.getInt16(84, true) / 32767,
+        m22: view.getInt16(86, true) / 32767
+      },
+      yaw: view.getInt16(88, true) / 100
+    } : undefined
+  },
+  timestamp: Number(view.getBigUint64(90, true)),
+  type: 'tobii-data'
+});
+
+const DECODERS = [
+  null,
+  [decodeBinary0, decodeBinary1, decodeBinary2, decodeBinary3, decodeBinary4, decodeBinary5, decodeBinary6, decodeBinary7, decodeBinary8, decodeBinary9, decodeBinary10, decodeBinary11, decodeBinary12, decodeBinary13, decodeBinary14, decodeBinary15, decodeBinary16, decodeBinary17, decodeBinary18, decodeBinary19, decodeBinary20, decodeBinary21, decodeBinary22, decodeBinary23, decodeBinary24, decodeBinary25, decodeBinary26, decodeBinary27, decodeBinary28, decodeBinary29, decodeBinary30, decodeBinary31, decodeBinary32, decodeBinary33, decodeBinary34, decodeBinary35, decodeBinary36, decodeBinary37, decodeBinary38, decodeBinary39, decodeBinary40, decodeBinary41, decodeBinary42, decodeBinary43, decodeBinary44, decodeBinary45, decodeBinary46, decodeBinary47, decodeBinary48, decodeBinary49, decodeBinary50, decodeBinary51, decodeBinary52, decodeBinary53, decodeBinary54, decodeBinary55, decodeBinary56, decodeBinary57, decodeBinary58, decodeBinary59, decodeBinary60, decodeBinary61, decodeBinary62, decodeBinary63],
+  [decodeQuantized0, decodeQuantized1, decodeQuantized2, decodeQuantized3, decodeQuantized4, decodeQuantized5, decodeQuantized6, decodeQuantized7, decodeQuantized8, decodeQuantized9, decodeQuantized10, decodeQuantized11, decodeQuantized12, decodeQuantized13, decodeQuantized14, decodeQuantized15, decodeQuantized16, decodeQuantized17, decodeQuantized18, decodeQuantized19, decodeQuantized20, decodeQuantized21, decodeQuantized22, decodeQuantized23, decodeQuantized24, decodeQuantized25, decodeQuantized26, decodeQuantized27, decodeQuantized28, decodeQuantized29, decodeQuantized30, decodeQuantized31, decodeQuantized32, decodeQuantized33, decodeQuantized34, decodeQuantized35, decodeQuantized36, decodeQuantized37, decodeQuantized38, decodeQuantized39, decodeQuantized40, decodeQuantized41, decodeQuantized42, decodeQuantized43, decodeQuantized44, decodeQuantized45, decodeQuantized46, decodeQuantized47, decodeQuantized48, decodeQuantized49, decodeQuantized50, decodeQuantized51, decodeQuantized52, decodeQuantized53, decodeQuantized54, decodeQuantized55, decodeQuantized56, decodeQuantized57, decodeQuantized58, decodeQuantized59, decodeQuantized60, decodeQuantized61, decodeQuantized62, decodeQuantized63]
+];
+
+const FRAME_LENGTHS = [
+  null,
+  [18, 38, 46, 66, 19, 39, 47, 67, 38, 58, 66, 86, 39, 59, 67, 87, 23, 43, 51, 71, 24, 44, 52, 72, 43, 63, 71, 91, 44, 64, 72, 92, 94, 114, 122, 142, 95, 115, 123, 143, 114, 134, 142, 162, 115, 135, 143, 163, 99, 119, 127, 147, 100, 120, 128, 148, 119, 139, 147, 167, 120, 140, 148, 168],
+  [16, 30, 30, 44, 17, 31, 31, 45, 28, 42, 42, 56, 29, 43, 43, 57, 19, 33, 33, 47, 20, 34, 34, 48, 31, 45, 45, 59, 32, 46, 46, 60, 54, 68, 68, 82, 55, 69, 69, 83, 66, 80, 80, 94, 67, 81, 81, 95, 57, 71, 71, 85, 58, 72, 72, 86, 69, 83, 83, 97, 70, 84, 84, 98]
+];
+
+const toDataView = (buffer) => (ArrayBuffer.isView(buffer)
+  ? new DataView(buffer.buffer, buffer.byteOffset, buffer.byteLength)
+  : new DataView(buffer));
+
+/**
+ * Decode a binary tobii-data frame (ArrayBuffer, Buffer or typed array)
+ */
+export const decodeSample = (buffer) => {
+  const view = toDataView(buffer);
+  if (view.byteLength < 4 || view.getUint8(0) !== SAMPLE_SCHEMA_VERSION) {
+    throw new Error('Unsupported tobii-data frame version');
+  }
+
+  const format = view.getUint8(1);
+  const mask = view.getUint8(2) & 63;
+  const decoder = DECODERS[format]?.[mask];
+  if (!decoder || view.byteLength < FRAME_LENGTHS[format][mask]) {
+    throw new Error(`Malformed tobii-data frame (format ${format}, streams ${mask})`);
+  }
+  return decoder(view);
+};